@@ -0,0 +1,161 @@
+''' Generates 'nmd_x86_tables.c' from the opcode descriptions in 'x86_opcodes.txt' and the 'NMD_X86_INSTRUCTION' enumeration in 'nmd_assembly.h'. '''
+
+maps = [
+    # name in x86_opcodes.txt, table name
+    ('DEFAULT', '_nmd_x86_opcode_map_default'),
+    ('0F',      '_nmd_x86_opcode_map_0f'),
+    ('0F38',    '_nmd_x86_opcode_map_0f38'),
+    ('0F3A',    '_nmd_x86_opcode_map_0f3a'),
+]
+
+modrm_flags = {
+    '-':     [],
+    'modrm': ['_NMD_OPCODE_MODRM'],
+    'mem':   ['_NMD_OPCODE_MODRM', '_NMD_OPCODE_MEMORY_ONLY'],
+}
+
+immediates = {
+    '-':     '_NMD_OPCODE_IMM_NONE',
+    'IB':    '_NMD_OPCODE_IMM_IB',
+    'IW':    '_NMD_OPCODE_IMM_IW',
+    'IZ':    '_NMD_OPCODE_IMM_IZ',
+    'IV':    '_NMD_OPCODE_IMM_IV',
+    'JZ':    '_NMD_OPCODE_IMM_JZ',
+    'MOFFS': '_NMD_OPCODE_IMM_MOFFS',
+    'FAR':   '_NMD_OPCODE_IMM_FAR',
+    'ENTER': '_NMD_OPCODE_IMM_ENTER',
+    'GRP3':  '_NMD_OPCODE_IMM_GRP3',
+    'EXTRQ': '_NMD_OPCODE_IMM_EXTRQ',
+}
+
+simd_prefixes = {
+    'NP': '_NMD_SIMD_NP',
+    '66': '_NMD_SIMD_66',
+    'F3': '_NMD_SIMD_F3',
+    'F2': '_NMD_SIMD_F2',
+}
+
+groups = ['JUMP', 'CALL', 'RET', 'INT', 'PRIVILEGE', 'CONDITIONAL_BRANCH', 'UNCONDITIONAL_BRANCH', 'RELATIVE_ADDRESSING']
+
+import sys
+if sys.version_info < (3, 0):
+    # If we are running Python 2, ignore the 'newline' arg.
+    def wrap(opn):
+        def open_py2(*args, **kwargs):
+            if 'newline' in kwargs:
+                del kwargs['newline']
+            return opn(*args, **kwargs)
+        return open_py2
+    open = wrap(open)
+
+
+def error(line_number, message):
+    sys.exit('x86_opcodes.txt(%d): %s' % (line_number, message))
+
+
+def parse_entry(line_number, columns):
+    map_name, opcode, modrm, imm, simd, id, group = columns
+
+    if modrm not in modrm_flags:
+        error(line_number, "invalid modrm '%s'" % modrm)
+    flags = list(modrm_flags[modrm])
+
+    if imm not in immediates:
+        error(line_number, "invalid immediate '%s'" % imm)
+
+    if map_name in ('DEFAULT', '0F') and simd != '*':
+        error(line_number, "the validity of %s opcodes is checked by the decoder, the simd column must be '*'" % map_name)
+
+    if simd == '*':
+        simd_mask = '0'
+        flags.append('_NMD_OPCODE_DECODER_VALIDITY')
+    elif simd == '-':
+        simd_mask = '0'
+    else:
+        for prefix in simd.split('|'):
+            if prefix not in simd_prefixes:
+                error(line_number, "invalid simd prefix '%s'" % prefix)
+        simd_mask = ' | '.join(simd_prefixes[prefix] for prefix in simd.split('|'))
+
+    if id == '*':
+        id = 'NMD_X86_INSTRUCTION_INVALID'
+        flags.append('_NMD_OPCODE_DECODER_ID')
+    elif id == '-':
+        id = 'NMD_X86_INSTRUCTION_INVALID'
+    else:
+        id = 'NMD_X86_INSTRUCTION_' + id
+
+    if group == '*':
+        group = 'NMD_GROUP_NONE'
+        flags.append('_NMD_OPCODE_DECODER_GROUP')
+    elif group == '-':
+        group = 'NMD_GROUP_NONE'
+    else:
+        for name in group.split('|'):
+            if name not in groups:
+                error(line_number, "invalid group '%s'" % name)
+        group = ' | '.join('NMD_GROUP_' + name for name in group.split('|'))
+
+    return '{ %s, %s, %s, %s, %s }' % (id, ' | '.join(flags) if flags else '0', immediates[imm], simd_mask, group)
+
+
+tables = dict((map_name, [None] * 256) for map_name, _ in maps)
+
+with open('x86_opcodes.txt', 'r') as file:
+    for line_number, line in enumerate(file, 1):
+        line = line.split('#')[0].strip()
+        if not line:
+            continue
+
+        columns = line.split()
+        if len(columns) != 7:
+            error(line_number, 'expected 7 columns, got %d' % len(columns))
+
+        if columns[0] not in tables:
+            error(line_number, "invalid map '%s'" % columns[0])
+
+        opcode = int(columns[1], 16)
+        if tables[columns[0]][opcode] is not None:
+            error(line_number, 'duplicate opcode %02X' % opcode)
+
+        tables[columns[0]][opcode] = parse_entry(line_number, columns)
+
+empty_entry = '{ NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE }'
+
+# The members of 'NMD_X86_INSTRUCTION' in order. Only the first one may have an explicit value.
+with open('nmd_assembly.h', 'r') as file:
+    header = file.read()
+enum_start = header.index('enum NMD_X86_INSTRUCTION\n{')
+enum_body = header[header.index('{', enum_start) + 1:header.index('};', enum_start)]
+instructions = []
+for line in enum_body.split('\n'):
+    line = line.split('/*')[0].strip()
+    if not line:
+        continue
+    name = line.rstrip(',').split('=')[0].strip()
+    if not name.startswith('NMD_X86_INSTRUCTION_') or ('=' in line and instructions):
+        sys.exit("nmd_assembly.h: unexpected line in 'NMD_X86_INSTRUCTION': '%s'" % line)
+    instructions.append(name[len('NMD_X86_INSTRUCTION_'):].lower())
+
+if 'NMD_X86_NUM_INSTRUCTIONS (NMD_X86_INSTRUCTION_%s + 1)' % instructions[-1].upper() not in header:
+    sys.exit("nmd_assembly.h: 'NMD_X86_NUM_INSTRUCTIONS' must be 'NMD_X86_INSTRUCTION_%s + 1'" % instructions[-1].upper())
+
+with open('nmd_x86_tables.c', 'w', newline='') as out:
+    out.write('/* This file was generated by generate_tables.py from x86_opcodes.txt. Do not modify it manually. */\n\n')
+    out.write('#include "nmd_common.h"\n')
+
+    for map_name, table_name in maps:
+        out.write('\nNMD_ASSEMBLY_API const _nmd_x86_opcode_properties %s[256] = {\n' % table_name)
+        for opcode, entry in enumerate(tables[map_name]):
+            out.write('\t/* %02X */ %s,\n' % (opcode, entry or empty_entry))
+        out.write('};\n')
+
+    out.write('\n/* The names of the members of \'NMD_X86_INSTRUCTION\' in lowercase, in the order of the enumeration and separated by null characters. */\n')
+    out.write('NMD_ASSEMBLY_API const char _nmd_x86_instruction_names[] =')
+    line = ''
+    for name in instructions:
+        if len(line) + len(name) > 120:
+            out.write('\n\t"%s"' % line)
+            line = ''
+        line += name + '\\0'
+    out.write('\n\t"%s";\n' % line)
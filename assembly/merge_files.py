@@ -4,9 +4,26 @@ file_names = [
 
     # Implementation files
     'nmd_common.c', # common macros, functions, structs...
+    'nmd_x86_stats.c',
+    'nmd_x86_tables.c', # generated by generate_tables.py
     'nmd_x86_assembler.c',
     'nmd_x86_decoder.c',
+    'nmd_x86_decode_cache.c',
     'nmd_x86_ldisasm.c',
+    'nmd_x86_sweep.c',
+    'nmd_x86_recursive_descent.c',
+    'nmd_x86_cfg.c',
+    'nmd_x86_timing.c',
+    'nmd_x86_image.c',
+    'nmd_x86_elf.c',
+    'nmd_x86_pe.c',
+    'nmd_x86_signature.c',
+    'nmd_x86_xref.c',
+    'nmd_x86_function.c',
+    'nmd_x86_jump_table.c',
+    'nmd_x86_cache.c',
+    'nmd_x86_interpreter.c',
+    'nmd_x86_liveness.c',
     'nmd_x86_formatter.c',
 ]
 
@@ -33,6 +33,29 @@ Interfaces(i.e the functions you call from your application):
        - flags       [in]  A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use. If uncertain, use 'NMD_X86_DECODER_FLAGS_MINIMAL'.
       bool nmd_x86_decode(const void* buffer, size_t buffer_size, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags);
 
+    - Decodes the operands or the cpu flags of an instruction that was decoded without 'NMD_X86_DECODER_FLAGS_OPERANDS' or 'NMD_X86_DECODER_FLAGS_CPU_FLAGS'.
+      Only the fields already parsed by the decoder are used, so the common path can decode with 'NMD_X86_DECODER_FLAGS_MINIMAL' and pay for these features
+      only where they are needed. Returns false if the instruction is invalid.
+      bool nmd_x86_decode_operands(nmd_x86_instruction* instruction);
+      bool nmd_x86_decode_cpu_flags(nmd_x86_instruction* instruction);
+
+    - When the operands are decoded, 'regs_read' and 'regs_written' receive a mask of the architectural registers the instruction reads and writes,
+      including implicit ones(e.g. rsp for push and pop, rax and rdx for mul and div). Sub-registers are folded into their architectural register,
+      so dataflow analyses can use bit operations instead of walking the operands. See 'NMD_X86_REG_MASK_XXX' for the layout.
+      uint64_t nmd_x86_get_register_mask(NMD_X86_REG reg);
+
+    - Decodes consecutive instructions from a buffer. Returns the number of entries written to 'instructions'. Consecutive bytes that cannot be decoded are reported as
+      an entry whose 'valid' member is false, so the entries cover the buffer contiguously.
+      Parameters:
+       - buffer           [in]      A pointer to a buffer containing encoded instructions.
+       - buffer_size      [in]      The size of the buffer in bytes.
+       - instructions     [out]     A pointer to an array of 'nmd_x86_instruction' that receives the instructions.
+       - num_instructions [in]      The number of elements in 'instructions'.
+       - mode             [in]      The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+       - flags            [in]      A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use. If uncertain, use 'NMD_X86_DECODER_FLAGS_MINIMAL'.
+       - num_bytes        [out/opt] A pointer to a variable that receives the number of bytes consumed. This parameter may be null.
+      size_t nmd_x86_decode_buffer(const void* buffer, size_t buffer_size, nmd_x86_instruction* instructions, size_t num_instructions, NMD_X86_MODE mode, uint32_t flags, size_t* num_bytes);
+
     - Formats an instruction. This function may access invalid memory(thus causing a crash) if you modify 'instruction' manually.
       Parameters:
        - instruction     [in]  A pointer to a variable of type 'nmd_x86_instruction' describing the instruction to be formatted.
@@ -49,6 +72,152 @@ Interfaces(i.e the functions you call from your application):
      - mode        [in] The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
     size_t nmd_x86_ldisasm(const void* buffer, size_t buffer_size, NMD_X86_MODE mode);
 
+ - Padded variants of nmd_x86_decode() and nmd_x86_ldisasm(). They behave like the originals with 'buffer_size' equal to 'NMD_X86_MAXIMUM_INSTRUCTION_LENGTH'
+   but don't check the buffer's bounds for every byte they read. The caller must guarantee that at least 15 bytes starting at 'buffer' can be read(e.g. when
+   decoding from a memory mapped file or from a buffer with 15 bytes of padding at the end). Skipping the checks is not a speedup by itself: the padded
+   decoder is within noise of nmd_x86_decode() and nmd_x86_ldisasm_padded() is slightly slower than nmd_x86_ldisasm()(see benchmarks/padded_benchmark.c).
+    bool nmd_x86_decode_padded(const void* buffer, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags);
+    size_t nmd_x86_ldisasm_padded(const void* buffer, NMD_X86_MODE mode);
+
+ - Marks the start of every instruction of a linear sweep over a whole buffer in a bitmap(bit 'offset % 32' of 'boundary_bitmap[offset / 32]').
+   Bytes where no valid instruction starts are marked and skipped one at a time, so the result equals calling nmd_x86_ldisasm() in a loop. Runs of
+   single-byte instructions are classified with SSE2/AVX2 when the compiler targets them. Only one-byte opcodes take this fast path, so the gain
+   depends on the input: the classifier is not called for instructions of the 0F, 0F38 and 0F3A maps. See benchmarks/ldisasm_bulk_benchmark.c.
+   'boundary_bitmap' must have '(buffer_size + 31) / 32' elements.
+   Returns the number of bits set.
+    size_t nmd_x86_ldisasm_bulk(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t* boundary_bitmap);
+
+ - Decode cache. A fixed-capacity open-addressed table of decoded instructions keyed by runtime address, for tools that decode the same addresses
+   repeatedly(e.g. single-stepping). The entries are provided by the caller. A cached instruction is only returned if its bytes are unchanged;
+   call nmd_x86_decode_cache_invalidate() after patching to free the entries of the changed range. 'hits', 'misses' and 'evictions' count lookups.
+    void nmd_x86_decode_cache_init(nmd_x86_decode_cache* cache, nmd_x86_decode_cache_entry* entries, size_t capacity);
+    void nmd_x86_decode_cache_clear(nmd_x86_decode_cache* cache);
+    bool nmd_x86_decode_cached(nmd_x86_decode_cache* cache, const void* buffer, size_t buffer_size, uint64_t runtime_address, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags);
+    void nmd_x86_decode_cache_invalidate(nmd_x86_decode_cache* cache, uint64_t address, uint64_t size);
+
+ - Parallel linear sweep. The library doesn't create threads, instead the work is split into chunks that can be decoded by any number of threads:
+   nmd_x86_sweep_split() divides the buffer, nmd_x86_sweep_decode_chunk() decodes one chunk speculatively from a resynchronization point
+   (call it from a worker thread for every chunk) and nmd_x86_sweep_merge() checks that consecutive chunks converge, repairing them where they don't.
+   The resulting bitmap is identical to the one of a sequential sweep with nmd_x86_decode() in the same format as nmd_x86_ldisasm_bulk().
+    size_t nmd_x86_sweep_split(size_t buffer_size, nmd_x86_sweep_chunk* chunks, size_t num_chunks);
+    void nmd_x86_sweep_decode_chunk(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t flags, nmd_x86_sweep_chunk* chunk, uint32_t* boundary_bitmap);
+    size_t nmd_x86_sweep_merge(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t flags, nmd_x86_sweep_chunk* chunks, size_t num_chunks, uint32_t* boundary_bitmap);
+
+ - Recursive descent. Follows the control flow from a set of entry points using the instructions' group and relative branch targets, so data
+   embedded in code is never decoded. The work queue and the code map(one byte per offset, see 'NMD_X86_CODE_MAP') are provided by the caller.
+   nmd_x86_build_basic_blocks() then converts the code map into basic blocks(20 bytes each, sorted by offset) with their successor edges.
+   To use several threads, give each one a subset of the entry points and its own code map, and merge the maps with nmd_x86_code_map_merge().
+    void nmd_x86_recursive_descent_init(nmd_x86_recursive_descent* rd, const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint8_t* code_map, uint32_t* queue, size_t queue_capacity);
+    void nmd_x86_recursive_descent_add_entry(nmd_x86_recursive_descent* rd, size_t offset);
+    void nmd_x86_recursive_descent_run(nmd_x86_recursive_descent* rd);
+    void nmd_x86_code_map_merge(uint8_t* code_map, const uint8_t* other, size_t buffer_size);
+    size_t nmd_x86_build_basic_blocks(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, nmd_x86_basic_block* blocks, size_t max_blocks);
+ - Control flow graph. nmd_x86_cfg_build() stores the edges between basic blocks in compressed sparse row form(successor and predecessor lists
+   in one caller-provided array of 'NMD_X86_CFG_MEMORY_SIZE(num_blocks)' elements, 24 bytes per block). The dominator and post-dominator trees
+   are computed with the algorithm by Cooper, Harvey and Kennedy and natural loops are found from the back edges. All analyses use arrays of one
+   element per block plus a workspace of 'NMD_X86_CFG_WORKSPACE_SIZE(num_blocks)' elements, so memory grows linearly with the number of blocks.
+    void nmd_x86_cfg_build(nmd_x86_cfg* cfg, const nmd_x86_basic_block* blocks, size_t num_blocks, uint32_t* memory);
+    void nmd_x86_cfg_dominators(const nmd_x86_cfg* cfg, uint32_t entry, uint32_t* idom, uint32_t* workspace);
+    void nmd_x86_cfg_post_dominators(const nmd_x86_cfg* cfg, uint32_t* ipdom, uint32_t* workspace);
+    bool nmd_x86_cfg_dominates(const uint32_t* idom, uint32_t a, uint32_t b);
+    size_t nmd_x86_cfg_loops(const nmd_x86_cfg* cfg, uint32_t entry, const uint32_t* idom, uint32_t* loop_header, uint32_t* loop_parent, uint32_t* workspace);
+ - Timing model. nmd_x86_get_instruction_timing() returns the latency, reciprocal throughput, uops and execution ports of an instruction on a
+   microarchitecture(see 'NMD_X86_MICROARCHITECTURE'). nmd_x86_analyze_block_timing() estimates the cycles per iteration of a basic block
+   that runs in a loop from the front end, port pressure and dependency chains(found with 'regs_read' and 'regs_written'), reporting the bottleneck.
+   AVX, AVX2 and FMA loops are modelled for the VEX instructions the decoder gives an id and operands to(see '_nmd_x86_vex_instructions').
+    bool nmd_x86_get_instruction_timing(const nmd_x86_instruction* instruction, NMD_X86_MICROARCHITECTURE microarchitecture, nmd_x86_instruction_timing* timing);
+    bool nmd_x86_analyze_block_timing(const nmd_x86_instruction* instructions, size_t num_instructions, NMD_X86_MICROARCHITECTURE microarchitecture, nmd_x86_block_timing* block);
+ - Executable files. nmd_x86_elf_parse() and nmd_x86_pe_parse() read the headers of an ELF32/ELF64 or PE32/PE32+ file in place and return
+   its executable sections with their virtual addresses, pointing into the image. The instructions of a section are decoded directly from the
+   image with nmd_x86_section_next_instruction(). The library does no I/O: map the file read-only(e.g. mmap() with 'PROT_READ' and 'MAP_PRIVATE')
+   and pass the mapping, so nothing is copied and only the pages that are decoded become resident(see examples/listing_example.c). PE files are
+   read as they are on disk, so Windows binaries can be analyzed on any OS: nmd_x86_pe_rva_to_pointer() maps RVAs to file data, exports are
+   found by name with a binary search over the sorted export name table and nmd_x86_pe_get_exports()/nmd_x86_pe_get_imports() fill arrays
+   sorted by RVA that nmd_x86_pe_find_symbol() searches(e.g. to name the import address table slot of 'call [rip+x]').
+    void nmd_x86_section_iterator_init(nmd_x86_section_iterator* iterator, const nmd_x86_code_section* section, uint32_t flags);
+    bool nmd_x86_section_next_instruction(nmd_x86_section_iterator* iterator, nmd_x86_instruction* instruction, uint64_t* runtime_address);
+    bool nmd_x86_elf_parse(const void* image, size_t image_size, nmd_x86_elf* elf);
+    size_t nmd_x86_elf_get_executable_sections(const nmd_x86_elf* elf, nmd_x86_code_section* sections, size_t max_sections);
+    bool nmd_x86_pe_parse(const void* image, size_t image_size, nmd_x86_pe* pe);
+    const void* nmd_x86_pe_rva_to_pointer(const nmd_x86_pe* pe, uint32_t rva, size_t size);
+    size_t nmd_x86_pe_get_executable_sections(const nmd_x86_pe* pe, nmd_x86_code_section* sections, size_t max_sections);
+    size_t nmd_x86_pe_get_exports(const nmd_x86_pe* pe, nmd_x86_pe_symbol* exports, size_t max_exports);
+    bool nmd_x86_pe_find_export(const nmd_x86_pe* pe, const char* name, nmd_x86_pe_symbol* symbol);
+    size_t nmd_x86_pe_get_imports(const nmd_x86_pe* pe, nmd_x86_pe_symbol* imports, size_t max_imports);
+    const nmd_x86_pe_symbol* nmd_x86_pe_find_symbol(const nmd_x86_pe_symbol* symbols, size_t num_symbols, uint32_t rva);
+ - Statistics. If 'NMD_ASSEMBLY_ENABLE_STATS' is defined, the decoder and the length disassembler count, per thread, the instructions they
+   decode per opcode map, encoding, length and prefix, and the instructions they reject per reason(see 'NMD_X86_REJECTION'), which shows where
+   the time goes in a workload(e.g. how much of a binary is VEX or how often decoding stops at a truncated buffer).
+    void nmd_x86_stats_snapshot(nmd_x86_stats* stats);
+    void nmd_x86_stats_reset(void);
+    void nmd_x86_stats_add(nmd_x86_stats* total, const nmd_x86_stats* stats);
+ - Signatures. Unlike byte patterns, signatures still match when the compiler picks another register or displacement size, because they are
+   matched against decoded instructions by id, operand type and register class. A query such as "mov r64, [rip+?]; call ?" is compiled once
+   by nmd_x86_signature_compile() into an array of elements, one per instruction, separated by ';'. An element is '?'(any instruction) or the
+   name of a member of 'NMD_X86_INSTRUCTION' in lowercase(e.g. 'jz', not 'je'), followed by the comma-separated patterns of its explicit
+   operands; without operands it matches any operands. An operand is '?', 'imm', a number(which must start with a digit or '-'), a register,
+   a register class(see 'NMD_X86_SIGNATURE_REG') or a memory operand: '[?]' matches any, otherwise the terms between the brackets are a base,
+   an index('reg*n' or 'reg*?'; a second register is an index with a scale of one), a displacement(a number, or '?' for any) joined by '+'
+   or '-'. Omitted terms must be absent(the displacement must be zero). nmd_x86_signature_set_init() indexes any number of signatures by the
+   id of their first element, so nmd_x86_signature_scan() only tries the candidates of each instruction in a single pass over the stream.
+    size_t nmd_x86_signature_compile(const char* query, nmd_x86_signature_element* elements, size_t max_elements);
+    bool nmd_x86_signature_matches(const nmd_x86_signature* signature, const nmd_x86_instruction* instructions, size_t num_instructions);
+    void nmd_x86_signature_set_init(nmd_x86_signature_set* set, const nmd_x86_signature* signatures, size_t num_signatures, uint32_t* memory);
+    size_t nmd_x86_signature_scan(const nmd_x86_signature_set* set, const nmd_x86_instruction* instructions, size_t num_instructions, nmd_x86_signature_match* matches, size_t max_matches);
+ - Cross-references. nmd_x86_xref_collect() decodes every instruction of a range of a section once and records its relative branch targets,
+   RIP-relative and absolute memory operands and immediates that point into the image as 16-byte records sorted by source. To build the index
+   with several threads, split the section(e.g. with nmd_x86_sweep_split() and a boundary bitmap), let each thread collect and sort its run
+   with nmd_x86_xref_sort_by_target(), and merge the runs with nmd_x86_xref_merge(). Lookups by source or target are binary searches.
+    size_t nmd_x86_xref_collect(const nmd_x86_code_section* section, uint64_t image_base, uint64_t image_size, const uint32_t* boundary_bitmap, size_t begin, size_t end, nmd_x86_xref* xrefs, size_t max_xrefs);
+    void nmd_x86_xref_sort_by_target(const nmd_x86_xref* xrefs, size_t num_xrefs, nmd_x86_xref* sorted, nmd_x86_xref* workspace);
+    size_t nmd_x86_xref_merge(nmd_x86_xref_run* runs, size_t num_runs, bool by_target, nmd_x86_xref* xrefs);
+    void nmd_x86_xref_index_init(nmd_x86_xref_index* index, uint64_t image_base, const nmd_x86_xref* by_source, const nmd_x86_xref* by_target, size_t num_xrefs);
+    size_t nmd_x86_xref_find_from(const nmd_x86_xref_index* index, uint64_t address, const nmd_x86_xref** xrefs);
+    size_t nmd_x86_xref_find_to(const nmd_x86_xref_index* index, uint64_t address, const nmd_x86_xref** xrefs);
+ - Function detection. nmd_x86_find_functions() finds the functions of a stripped section from call targets, prologues, 'int3' and 'nop' padding
+   and tail calls, decoding the section once and refining the result with passes over a caller-provided map of one byte per offset.
+    size_t nmd_x86_find_functions(const nmd_x86_code_section* section, const uint64_t* entries, size_t num_entries, uint8_t* map, nmd_x86_function* functions, size_t max_functions);
+ - Jump tables. nmd_x86_resolve_jump_table() recognizes the 'switch' behind an indirect jump found by a recursive descent by decoding the few
+   instructions before it backwards: the load of the entry, the 'lea' of the table's base and the 'cmp'/'ja' bounds check of the index. The
+   entries are read from the mapped image with nmd_x86_jump_table_read(). nmd_x86_recursive_descent_resolve_jump_tables() does both for every
+   indirect jump and explores the targets until no new table is found, so the coverage of the descent includes the cases of every 'switch'.
+    bool nmd_x86_resolve_jump_table(const nmd_x86_recursive_descent* rd, uint64_t address, size_t offset, nmd_x86_jump_table* table);
+    size_t nmd_x86_jump_table_read(const nmd_x86_jump_table* table, const nmd_x86_code_section* regions, size_t num_regions, uint64_t* targets, size_t max_targets);
+    size_t nmd_x86_recursive_descent_resolve_jump_tables(nmd_x86_recursive_descent* rd, uint64_t address, const nmd_x86_code_section* regions, size_t num_regions, nmd_x86_jump_table* tables, size_t max_tables);
+ - Incremental analysis. After bytes of the buffer are patched, nmd_x86_recursive_descent_patch() decodes again only the explored instructions
+   that overlap the patch and the straight line after them until it resynchronizes with the old instructions(plus any new branch targets), and
+   returns the range of the code map that changed. nmd_x86_update_basic_blocks() rebuilds the blocks of that range and splices them into the
+   array in place, and nmd_x86_xref_update() replaces the cross-references from the range in both sorted arrays of an index. Decoding scales
+   with the size of the patch, but the other elements are still moved or renumbered and nmd_x86_cfg_build() rebuilds the whole graph, so the
+   update is linear in the number of blocks and cross-references of the image.
+    bool nmd_x86_recursive_descent_patch(nmd_x86_recursive_descent* rd, size_t begin, size_t end, size_t* changed_begin, size_t* changed_end);
+    size_t nmd_x86_update_basic_blocks(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, size_t changed_begin, size_t changed_end, nmd_x86_basic_block* blocks, size_t num_blocks, size_t max_blocks, nmd_x86_basic_block* workspace, size_t workspace_size);
+    bool nmd_x86_xref_update(nmd_x86_xref_index* index, const nmd_x86_code_section* section, uint64_t image_size, const uint32_t* boundary_bitmap, size_t begin, size_t end, nmd_x86_xref* by_source, nmd_x86_xref* by_target, size_t max_xrefs, nmd_x86_xref* workspace, size_t max_new_xrefs);
+ - Analysis cache. A recursive descent, its basic blocks and the cross-references of a buffer can be saved in a versioned file whose fields
+   are little-endian on any host, so later runs skip decoding. nmd_x86_cache_collect_instructions() stores a 12-byte record per instruction(offset,
+   length, id, group and operand types), nmd_x86_cache_save() writes the records, the blocks and both arrays of cross-references with the hash
+   of the buffer, and nmd_x86_cache_load() opens the mapped file in place: the arrays point into the mapping and a changed buffer is reported.
+    uint64_t nmd_x86_cache_hash(const void* buffer, size_t buffer_size);
+    size_t nmd_x86_cache_collect_instructions(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, nmd_x86_cached_instruction* instructions, size_t max_instructions);
+    size_t nmd_x86_cache_save(const nmd_x86_cache* cache, void* file, size_t file_size);
+    NMD_X86_CACHE_STATUS nmd_x86_cache_load(const void* file, size_t file_size, const void* source, size_t source_size, nmd_x86_cache* cache);
+    const nmd_x86_cached_instruction* nmd_x86_cache_find_instruction(const nmd_x86_cache* cache, uint64_t address);
+ - Interpreter. nmd_x86_interpreter_run() executes x86-64 code a basic block at a time: each block is decoded once into micro-ops that are cached
+   in caller-provided arrays, branches are chained to the block they went to last time, and the status flags are computed only when they are read.
+   Memory is accessed through a page translation callback, and writes to translated code are detected.
+    void nmd_x86_interpreter_init(nmd_x86_interpreter* it, nmd_x86_translate_page translate, void* context, nmd_x86_interpreter_block* blocks, size_t max_blocks, nmd_x86_micro_op* uops, size_t max_uops, uint32_t* block_map, size_t map_capacity);
+    NMD_X86_INTERPRETER_EXIT nmd_x86_interpreter_run(nmd_x86_interpreter* it, uint64_t max_instructions);
+    void nmd_x86_interpreter_flush(nmd_x86_interpreter* it);
+    uint64_t nmd_x86_interpreter_get_flags(const nmd_x86_interpreter* it);
+    void nmd_x86_interpreter_set_flags(nmd_x86_interpreter* it, uint64_t flags);
+    uint8_t* nmd_x86_page_table_translate(void* page_table, uint64_t address, bool write);
+ - Register liveness. nmd_x86_liveness_analyze() finds the registers and status flags that may still be read before and after every instruction
+   of a set of basic blocks, with a backward dataflow over the control flow graph that decodes each instruction once. Afterwards the registers
+   that are free to use as scratch and the flags that must be preserved at any offset are looked up in constant time, e.g. for hook trampolines.
+    size_t nmd_x86_liveness_analyze(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const nmd_x86_basic_block* blocks, const nmd_x86_cfg* cfg, uint64_t exit_regs, uint32_t exit_flags, nmd_x86_block_liveness* block_liveness, nmd_x86_instruction_liveness* instructions, uint32_t* instruction_map, uint32_t* workspace);
+    uint64_t nmd_x86_liveness_dead_registers(const nmd_x86_instruction_liveness* instructions, const uint32_t* instruction_map, size_t offset);
+    uint32_t nmd_x86_liveness_live_flags(const nmd_x86_instruction_liveness* instructions, const uint32_t* instruction_map, size_t offset);
+
 Enabling and disabling features of the decoder at compile-time:
 To dynamically choose which features are used by the decoder, use the 'flags' parameter of nmd_x86_decode(). The less features specified in the mask, the
 faster the decoder runs. By default all features are available, some can be completely disabled at compile time(thus reducing code size and increasing code speed) by defining
@@ -61,6 +230,21 @@ the following macros:
  - 'NMD_ASSEMBLY_DISABLE_DECODER_VEX': the decoder does not support VEX instructions.
  - 'NMD_ASSEMBLY_DISABLE_DECODER_EVEX': the decoder does not support EVEX instructions.
  - 'NMD_ASSEMBLY_DISABLE_DECODER_3DNOW': the decoder does not support 3DNow! instructions.
+ - 'NMD_ASSEMBLY_ENABLE_STATS': the decoder(every function that decodes, including nmd_x86_decode() and nmd_x86_decode_padded()) and
+   the length disassembler(nmd_x86_ldisasm(), nmd_x86_ldisasm_padded() and nmd_x86_ldisasm_bulk()) update thread-local counters(see 'nmd_x86_stats').
+   Without this macro the counters are not compiled at all.
+
+Specialized decoders:
+If the mode and the flags are always the same, a decoder specialized for them can be created with 'NMD_X86_DEFINE_DECODER(name, mode, flags)', which defines
+the function 'bool name(const void* buffer, size_t buffer_size, nmd_x86_instruction* instruction)'. It behaves exactly like nmd_x86_decode() called with 'mode'
+and 'flags', but since both are compile-time constants the compiler removes the branches on them. 'NMD_X86_DEFINE_DECODER_PADDED(name, mode, flags)' does the
+same for nmd_x86_decode_padded() and defines 'bool name(const void* buffer, nmd_x86_instruction* instruction)'. These macros must be used in the source file
+that defines 'NMD_ASSEMBLY_IMPLEMENTATION', after the include statement. Any number of specialized decoders can coexist with the generic one. Example:
+    #define NMD_ASSEMBLY_IMPLEMENTATION
+    #include "nmd_assembly.h"
+    NMD_X86_DEFINE_DECODER(decode64, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL)
+    NMD_X86_DEFINE_DECODER_PADDED(decode64_padded, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)
+Use 'NMD_X86_DECLARE_DECODER(name)' and 'NMD_X86_DECLARE_DECODER_PADDED(name)' to declare them in other source files.
 
 Enabling and disabling features of the formatter at compile-time:
 To dynamically choose which features are used by the formatter, use the 'flags' parameter of nmd_x86_format(). The less features specified in the mask, the
@@ -81,6 +265,7 @@ Use the following macros to disable features at compile-time:
  - 'NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK': the length disassembler does not check if the instruction is invalid.
  - 'NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VEX': the length disassembler does not support VEX instructions.
  - 'NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_3DNOW': the length disassembler does not support 3DNow! instructions.
+ - 'NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_SIMD': nmd_x86_ldisasm_bulk() does not use SSE2/AVX2 intrinsics(<emmintrin.h>/<immintrin.h> are not included).
 
 Fixed width integer types:
 By default the library includes <stdint.h> and <stddef.h> to include int types.
@@ -619,6 +804,27 @@ typedef enum NMD_X86_REG
 	NMD_X86_REG_ST7   = 239,
 } NMD_X86_REG;
 
+/*
+Bits of 'regs_read' and 'regs_written' in 'nmd_x86_instruction'. Bits 0-15 are the general purpose registers in encoding order(rax, rcx, rdx, rbx,
+rsp, rbp, rsi, rdi, r8-r15), bit 16 is the instruction pointer, bits 17-22 are the segment registers(es, cs, ss, ds, fs, gs), bit 23 is the
+x87/MMX register file, bits 24-31 are the mask registers(k0-k7) and bits 32-63 are the vector registers(xmm/ymm/zmm 0-31). Control and debug
+registers are not tracked.
+*/
+#define NMD_X86_REG_MASK_RAX ((uint64_t)1 << 0)
+#define NMD_X86_REG_MASK_RCX ((uint64_t)1 << 1)
+#define NMD_X86_REG_MASK_RDX ((uint64_t)1 << 2)
+#define NMD_X86_REG_MASK_RBX ((uint64_t)1 << 3)
+#define NMD_X86_REG_MASK_RSP ((uint64_t)1 << 4)
+#define NMD_X86_REG_MASK_RBP ((uint64_t)1 << 5)
+#define NMD_X86_REG_MASK_RSI ((uint64_t)1 << 6)
+#define NMD_X86_REG_MASK_RDI ((uint64_t)1 << 7)
+#define NMD_X86_REG_MASK_GPRS ((uint64_t)0xffff)
+#define NMD_X86_REG_MASK_RIP ((uint64_t)1 << 16)
+#define NMD_X86_REG_MASK_ES_BIT 17
+#define NMD_X86_REG_MASK_X87 ((uint64_t)1 << 23)
+#define NMD_X86_REG_MASK_K0_BIT 24
+#define NMD_X86_REG_MASK_VECTOR0_BIT 32
+
 /*
 Credits to the capstone engine:
 Some members of the enum are organized in such a way because the instruction's id parsing component of the decoder can take advantage of it.
@@ -2234,6 +2440,9 @@ enum NMD_X86_INSTRUCTION
 	NMD_X86_INSTRUCTION_ENDBR64,
 };
 
+/* The number of members of 'NMD_X86_INSTRUCTION'. */
+#define NMD_X86_NUM_INSTRUCTIONS (NMD_X86_INSTRUCTION_ENDBR64 + 1)
+
 enum NMD_X86_OPERAND_TYPE
 {
 	NMD_X86_OPERAND_TYPE_NONE = 0,
@@ -2374,6 +2583,7 @@ typedef struct nmd_x86_instruction
 	bool has_rex : 1;                                       /* If true, the instruction has a REX prefix */
 	bool rex_w_prefix : 1;                                  /* If true, a REX.W prefix is closer to the opcode than a operand size override prefix. */
 	bool repeat_prefix : 1;                                 /* If true, a 'repeat'(F3h) prefix is closer to the opcode than a 'repeat not zero'(F2h) prefix. */
+	bool regs_incomplete : 1;                               /* If true, 'regs_read' and 'regs_written' may miss registers because the operands are not decoded(e.g. unlisted VEX instructions). Assume every register is read. */
 	uint8_t mode;                                           /* The decoding mode. A member of 'NMD_X86_MODE'. */
 	uint8_t length;                                         /* The instruction's length in bytes. */
 	uint8_t opcode;                                         /* Opcode byte. */
@@ -2402,8 +2612,602 @@ typedef struct nmd_x86_instruction
 	uint8_t rex;                                            /* REX prefix. */
 	uint8_t segment_override;                               /* The segment override prefix closest to the opcode. A member of 'NMD_X86_PREFIXES'. */
 	uint16_t simd_prefix;                                   /* One of these prefixes that is the closest to the opcode: NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE, NMD_X86_PREFIXES_LOCK, NMD_X86_PREFIXES_REPEAT_NOT_ZERO, NMD_X86_PREFIXES_REPEAT, or NMD_X86_PREFIXES_NONE. The prefixes are specified as members of the 'NMD_X86_PREFIXES' enum. */
+	uint64_t regs_read;                                     /* A mask of the registers read by the instruction. See 'NMD_X86_REG_MASK_XXX'. Filled with the operands. */
+	uint64_t regs_written;                                  /* A mask of the registers written by the instruction. See 'NMD_X86_REG_MASK_XXX'. Filled with the operands. */
 } nmd_x86_instruction;
 
+/* An entry of a decode cache. See nmd_x86_decode_cache_init(). */
+typedef struct nmd_x86_decode_cache_entry
+{
+	uint64_t address;                /* The instruction's runtime address. */
+	uint32_t flags;                  /* The decoder flags used to decode the instruction. */
+	bool used;                       /* If false, the entry is empty. */
+	nmd_x86_instruction instruction;
+} nmd_x86_decode_cache_entry;
+
+/* A decode cache. See nmd_x86_decode_cache_init(). */
+typedef struct nmd_x86_decode_cache
+{
+	nmd_x86_decode_cache_entry* entries;
+	size_t capacity;    /* The number of entries. A power of two. */
+	size_t num_entries; /* The number of entries in use. */
+	size_t hits;        /* The number of lookups that returned a cached instruction. */
+	size_t misses;      /* The number of lookups that decoded the instruction. */
+	size_t evictions;   /* The number of entries replaced because all slots for an address were occupied. */
+} nmd_x86_decode_cache;
+
+/* A chunk of a parallel linear sweep. See nmd_x86_sweep_split(). */
+typedef struct nmd_x86_sweep_chunk
+{
+	size_t begin;            /* The offset of the chunk's first byte. */
+	size_t end;              /* The offset one past the chunk's last byte. */
+	size_t start;            /* The offset where the speculative sweep started(the resynchronization point). */
+	size_t next;             /* The offset of the first instruction after the chunk, i.e. where the sweep continues. */
+	size_t num_instructions; /* The number of instructions that start in the chunk. */
+} nmd_x86_sweep_chunk;
+
+/* The state of an offset in the code map of a recursive descent. See nmd_x86_recursive_descent_init(). */
+enum NMD_X86_CODE_MAP
+{
+	NMD_X86_CODE_MAP_LENGTH_MASK = 0x0f, /* The length of the instruction that starts at the offset, zero if none. */
+	NMD_X86_CODE_MAP_LEADER      = 0x10, /* A basic block starts at the offset. */
+	NMD_X86_CODE_MAP_END_MASK    = 0xe0, /* How the instruction at the offset ends the block. A member of 'NMD_X86_BLOCK_END'. 'NMD_X86_BLOCK_END_INVALID' if decoding failed at the offset. */
+	NMD_X86_CODE_MAP_END_SHIFT   = 5
+};
+
+/* How a basic block ends. */
+enum NMD_X86_BLOCK_END
+{
+	NMD_X86_BLOCK_END_FALLTHROUGH = 0, /* The block continues in 'successors[0]', the next instruction starts a block(e.g. a branch target). */
+	NMD_X86_BLOCK_END_JUMP,            /* Relative unconditional jump to 'successors[1]'. */
+	NMD_X86_BLOCK_END_CONDITIONAL,     /* Relative conditional branch(jcc, loop, jrcxz, xbegin) to 'successors[1]', falls through to 'successors[0]'. */
+	NMD_X86_BLOCK_END_RET,             /* Return instruction. */
+	NMD_X86_BLOCK_END_INDIRECT,        /* Indirect or far jump. The target is unknown. */
+	NMD_X86_BLOCK_END_TRAP,            /* 'int3', 'hlt', 'ud0', 'ud1' or 'ud2'. */
+	NMD_X86_BLOCK_END_INVALID,         /* The instruction after the block is invalid. */
+	NMD_X86_BLOCK_END_JUMP_TABLE       /* Indirect jump through a jump table resolved by nmd_x86_recursive_descent_resolve_jump_tables(). The targets are in the table. */
+};
+
+#define NMD_X86_INVALID_BLOCK 0xffffffff
+
+/* A basic block(20 bytes). */
+typedef struct nmd_x86_basic_block
+{
+	uint32_t begin;            /* The offset of the block's first instruction. */
+	uint32_t end;              /* The offset one past the block's last instruction. */
+	uint32_t successors[2];    /* Indices of the successors: [0] is the next block in the fall-through path, [1] the branch target. 'NMD_X86_INVALID_BLOCK' if absent. */
+	uint16_t num_instructions; /* The number of instructions in the block(at most 65535). */
+	uint8_t type;              /* How the block ends. A member of 'NMD_X86_BLOCK_END'. */
+} nmd_x86_basic_block;
+
+/* The state of a recursive descent. See nmd_x86_recursive_descent_init(). */
+typedef struct nmd_x86_recursive_descent
+{
+	const void* buffer;
+	size_t buffer_size;
+	uint8_t* code_map;     /* One byte per offset of the buffer. See 'NMD_X86_CODE_MAP'. */
+	uint32_t* queue;       /* The work queue. */
+	size_t queue_capacity;
+	size_t queue_size;
+	bool queue_overflow;   /* If true, some targets didn't fit in the queue. */
+	uint8_t mode;          /* A member of 'NMD_X86_MODE'. */
+	size_t changed_begin;  /* The offsets of the code map changed since the last call to nmd_x86_recursive_descent_patch() are in ['changed_begin', 'changed_end'). */
+	size_t changed_end;
+} nmd_x86_recursive_descent;
+
+/* The number of elements of the memory passed to nmd_x86_cfg_build(). */
+#define NMD_X86_CFG_MEMORY_SIZE(num_blocks) (6 * (size_t)(num_blocks) + 2)
+
+/* The number of elements of the workspace passed to the analyses of a control flow graph. */
+#define NMD_X86_CFG_WORKSPACE_SIZE(num_blocks) (4 * ((size_t)(num_blocks) + 1))
+
+/* The virtual exit node that follows every block without successors. See nmd_x86_cfg_post_dominators(). */
+#define NMD_X86_CFG_EXIT 0xfffffffe
+
+/* A control flow graph in compressed sparse row form. See nmd_x86_cfg_build(). */
+typedef struct nmd_x86_cfg
+{
+	uint32_t num_blocks;
+	uint32_t num_edges;
+	uint32_t* successor_offsets;   /* The successors of block 'i' are 'successors[successor_offsets[i]]' to 'successors[successor_offsets[i + 1] - 1]'. */
+	uint32_t* successors;
+	uint32_t* predecessor_offsets; /* The predecessors of block 'i' are 'predecessors[predecessor_offsets[i]]' to 'predecessors[predecessor_offsets[i + 1] - 1]'. */
+	uint32_t* predecessors;
+} nmd_x86_cfg;
+
+/* The microarchitectures of the timing model. */
+typedef enum NMD_X86_MICROARCHITECTURE
+{
+	NMD_X86_MICROARCHITECTURE_SKYLAKE = 0 /* Intel Skylake and its client derivatives(Kaby Lake, Coffee Lake). */
+} NMD_X86_MICROARCHITECTURE;
+
+/* The number of execution ports of the timing model. On Skylake ports 0, 1, 5 and 6 compute, 2 and 3 load, 4 stores data and 7 computes store addresses. */
+#define NMD_X86_NUM_PORTS 8
+
+/* The resource that limits a loop. See nmd_x86_analyze_block_timing(). */
+enum NMD_X86_BOTTLENECK
+{
+	NMD_X86_BOTTLENECK_NONE = 0,
+	NMD_X86_BOTTLENECK_FRONT_END,  /* The front end issues four fused uops per cycle. */
+	NMD_X86_BOTTLENECK_PORTS,      /* An execution port(see 'bottleneck_port'). */
+	NMD_X86_BOTTLENECK_THROUGHPUT, /* Instructions that are not fully pipelined(e.g. divisions). */
+	NMD_X86_BOTTLENECK_DEPENDENCY  /* A dependency chain carried from one iteration to the next. */
+};
+
+/* The timing of an instruction. See nmd_x86_get_instruction_timing(). */
+typedef struct nmd_x86_instruction_timing
+{
+	uint16_t reciprocal_throughput; /* The average number of cycles between independent executions, in hundredths of a cycle. */
+	uint8_t latency;                /* The number of cycles until the results are available. */
+	uint8_t load_latency;           /* The number of cycles added to 'latency' for inputs that are used to address loaded memory. */
+	uint8_t uops;                   /* The number of uops executed on 'ports'. Loads and stores are not included. */
+	uint8_t ports;                  /* A mask of the ports that can execute 'uops'(bit 'n' is port 'n'). */
+	uint8_t loads;                  /* The number of loads. Each one is a uop on port 2 or 3. */
+	uint8_t stores;                 /* The number of stores. Each one is a uop on port 4 and a uop on port 2, 3 or 7. */
+	uint8_t fused_uops;             /* The number of uops issued by the front end, where a load or store is fused with the operation. */
+} nmd_x86_instruction_timing;
+
+/* The estimated execution of a loop. Cycles are in hundredths of a cycle, except for 'critical_path'. See nmd_x86_analyze_block_timing(). */
+typedef struct nmd_x86_block_timing
+{
+	uint32_t cycles_per_iteration;             /* The largest of the four bounds below. */
+	uint32_t front_end_cycles;                 /* The bound of the front end. */
+	uint32_t port_cycles;                      /* The bound of the busiest execution port. */
+	uint32_t throughput_cycles;                /* The bound of the instructions that are not fully pipelined. */
+	uint32_t dependency_cycles;                /* The bound of the dependency chains carried from one iteration to the next. */
+	uint32_t critical_path;                    /* The latency of the longest dependency chain of one iteration, in cycles. */
+	uint32_t port_pressure[NMD_X86_NUM_PORTS]; /* The cycles each port is busy per iteration. */
+	uint32_t num_uops;                         /* The number of fused uops per iteration. */
+	uint32_t num_estimated;                    /* The number of instructions that are not in the timing table. They are assumed to be simple integer operations. */
+	uint8_t bottleneck;                        /* A member of 'NMD_X86_BOTTLENECK'. */
+	uint8_t bottleneck_port;                   /* The busiest port. */
+} nmd_x86_block_timing;
+
+/* An executable section of a file. See nmd_x86_elf_get_executable_sections() and nmd_x86_pe_get_executable_sections(). */
+typedef struct nmd_x86_code_section
+{
+	const char* name;    /* The section's name(e.g. ".text"). It is not null-terminated if it's eight characters long in a PE file. */
+	size_t name_length;  /* The length of 'name'. Zero for ELF segments and sections without a name. */
+	const uint8_t* code; /* A pointer to the contents of the section inside the image. */
+	size_t size;         /* The size of the section in bytes. */
+	uint64_t address;    /* The virtual address of the section. */
+	uint8_t mode;        /* A member of 'NMD_X86_MODE'. */
+} nmd_x86_code_section;
+
+/* An iterator over the instructions of an executable section. See nmd_x86_section_iterator_init(). */
+typedef struct nmd_x86_section_iterator
+{
+	const uint8_t* code; /* The contents of the section. */
+	size_t size;         /* The size of the section in bytes. */
+	size_t offset;       /* The offset of the next instruction. */
+	uint64_t address;    /* The virtual address of the section. */
+	uint32_t flags;      /* A mask of 'NMD_X86_DECODER_FLAGS_XXX'. */
+	uint8_t mode;        /* A member of 'NMD_X86_MODE'. */
+} nmd_x86_section_iterator;
+
+/* An ELF file parsed in place. See nmd_x86_elf_parse(). The offsets are relative to 'image'. */
+typedef struct nmd_x86_elf
+{
+	const uint8_t* image;       /* The contents of the file. */
+	size_t image_size;          /* The size of the file in bytes. */
+	uint64_t entry;             /* The virtual address of the entry point. */
+	size_t section_headers;     /* The offset of the section header table. */
+	size_t num_sections;        /* The number of section headers. */
+	size_t section_header_size; /* The size of a section header. */
+	size_t program_headers;     /* The offset of the program header table. */
+	size_t num_program_headers; /* The number of program headers. */
+	size_t program_header_size; /* The size of a program header. */
+	size_t section_names;       /* The offset of the section name table. */
+	size_t section_names_size;  /* The size of the section name table. Zero if the file has none. */
+	uint8_t mode;               /* 'NMD_X86_MODE_32' for ELF32 files or 'NMD_X86_MODE_64' for ELF64 files. */
+} nmd_x86_elf;
+
+/* A PE file parsed in place. See nmd_x86_pe_parse(). Addresses are relative to 'image_base'(RVAs) and offsets are relative to 'image'. */
+typedef struct nmd_x86_pe
+{
+	const uint8_t* image;           /* The contents of the file. */
+	size_t image_size;              /* The size of the file in bytes. */
+	uint64_t image_base;            /* The preferred virtual address of the image. */
+	uint32_t entry;                 /* The RVA of the entry point. */
+	uint32_t headers_size;          /* The size of the headers, which are mapped at RVA zero. */
+	size_t section_headers;         /* The offset of the section table. */
+	size_t num_sections;            /* The number of sections. */
+	uint32_t export_directory;      /* The RVA of the export directory. Zero if the file has none. */
+	uint32_t export_directory_size; /* The size of the export directory. */
+	uint32_t import_directory;      /* The RVA of the import descriptors. Zero if the file has none. */
+	uint32_t import_directory_size; /* The size of the import descriptors. */
+	uint32_t num_exports;           /* The number of entries of the export address table. */
+	uint8_t mode;                   /* 'NMD_X86_MODE_32' for PE32 files or 'NMD_X86_MODE_64' for PE32+ files. */
+} nmd_x86_pe;
+
+/* An export or import of a PE file. See nmd_x86_pe_get_exports() and nmd_x86_pe_get_imports(). The strings point into the image. */
+typedef struct nmd_x86_pe_symbol
+{
+	const char* module;    /* The name of the DLL that exports the symbol. May be null. */
+	const char* name;      /* The name of the symbol. Null if it is exported or imported by ordinal only. */
+	const char* forwarder; /* Exports only: the symbol the export is forwarded to(e.g. "NTDLL.RtlAllocateHeap"), otherwise null. */
+	uint32_t rva;          /* Exports: the RVA of the symbol. Imports: the RVA of the symbol's slot in the import address table. */
+	uint16_t ordinal;      /* The ordinal of the symbol. For imports by name it's the hint. */
+} nmd_x86_pe_symbol;
+
+/* The reasons the decoder or the length disassembler rejects an instruction. See 'nmd_x86_stats'. */
+enum NMD_X86_REJECTION
+{
+	NMD_X86_REJECTION_TRUNCATED = 0, /* The buffer ends before the instruction does. */
+	NMD_X86_REJECTION_OPCODE,        /* The opcode is not defined. */
+	NMD_X86_REJECTION_OPERANDS,      /* The opcode is not defined with this ModR/M byte(e.g. an undefined opcode extension or a register where only memory is allowed). */
+	NMD_X86_REJECTION_SIMD_PREFIX,   /* The opcode is not defined with this mandatory prefix(66h, F2h, F3h or none). */
+	NMD_X86_REJECTION_MODE,          /* The instruction is not valid in this mode(e.g. 'aaa' or a far call with an immediate in 64-bit mode). */
+	NMD_X86_REJECTION_LOCK,          /* The lock prefix is used with an instruction that doesn't accept it. */
+	NMD_X86_REJECTION_3DNOW,         /* The 3DNow! opcode is not defined or 3DNow! is disabled. */
+	NMD_X86_REJECTION_VEX,           /* The VEX instruction is not defined. */
+	NMD_X86_REJECTION_EVEX           /* EVEX instructions are not supported by the decoder. */
+};
+
+#define NMD_X86_NUM_REJECTIONS 9
+
+/* The number of bits in 'NMD_X86_PREFIXES'. */
+#define NMD_X86_NUM_PREFIXES 15
+
+/* Counters of the decoder and the length disassembler, see 'NMD_ASSEMBLY_ENABLE_STATS' and nmd_x86_stats_snapshot(). */
+typedef struct nmd_x86_stats
+{
+	uint64_t num_decoded;                                            /* The number of valid instructions returned by the decoder. */
+	uint64_t num_rejected;                                           /* The number of invalid instructions rejected by the decoder. */
+	uint64_t opcode_maps[6];                                         /* Valid instructions per 'opcode_map', indexed by 'NMD_X86_OPCODE_MAP'. VEX instructions are counted in the map selected by VEX.m_mmmm, 3DNow! instructions as reported by the decoder. */
+	uint64_t encodings[6];                                           /* Valid instructions per 'encoding', indexed by 'NMD_X86_ENCODING'. */
+	uint64_t rejections[NMD_X86_NUM_REJECTIONS];                     /* Invalid instructions per reason, indexed by 'NMD_X86_REJECTION'. */
+	uint64_t lengths[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH + 1];        /* Valid instructions per length in bytes. */
+	uint64_t prefixes[NMD_X86_NUM_PREFIXES];                         /* Valid instructions with a prefix, indexed by its bit in 'NMD_X86_PREFIXES'(e.g. 'prefixes[6]' is the operand size override). */
+	uint64_t ldisasm_lengths[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH + 1]; /* Results of the length disassembler per length. 'ldisasm_lengths[0]' counts invalid instructions. */
+	uint64_t ldisasm_rejections[NMD_X86_NUM_REJECTIONS];             /* Invalid instructions of the length disassembler per reason, indexed by 'NMD_X86_REJECTION'. */
+} nmd_x86_stats;
+
+/* The maximum number of operand patterns of a signature element. */
+#define NMD_X86_SIGNATURE_MAX_OPERANDS 4
+
+/* 'num_operands' of a signature element whose operands are not constrained. */
+#define NMD_X86_SIGNATURE_ANY_OPERANDS 0xff
+
+/* 'scale' of a memory operand pattern that matches any scale. */
+#define NMD_X86_SIGNATURE_ANY_SCALE 0xff
+
+/* Register classes of signature operand patterns. They are placed after the last member of 'NMD_X86_REG'. */
+enum NMD_X86_SIGNATURE_REG
+{
+	NMD_X86_SIGNATURE_REG_ANY = 0xf0, /* 'reg': any register. */
+	NMD_X86_SIGNATURE_REG_GPR8,       /* 'reg8': al-bh and r8b-r15b. */
+	NMD_X86_SIGNATURE_REG_GPR16,      /* 'reg16' or 'r16': ax-di and r8w-r15w. */
+	NMD_X86_SIGNATURE_REG_GPR32,      /* 'reg32' or 'r32': eax-edi and r8d-r15d. */
+	NMD_X86_SIGNATURE_REG_GPR64,      /* 'reg64' or 'r64': rax-rdi and r8-r15. */
+	NMD_X86_SIGNATURE_REG_SREG,       /* 'sreg': es-gs. */
+	NMD_X86_SIGNATURE_REG_CR,         /* 'cr': cr0-cr15. */
+	NMD_X86_SIGNATURE_REG_DR,         /* 'dr': dr0-dr15. */
+	NMD_X86_SIGNATURE_REG_MM,         /* 'mm': mm0-mm7. */
+	NMD_X86_SIGNATURE_REG_XMM,        /* 'xmm': xmm0-xmm31. */
+	NMD_X86_SIGNATURE_REG_YMM,        /* 'ymm': ymm0-ymm31. */
+	NMD_X86_SIGNATURE_REG_ZMM,        /* 'zmm': zmm0-zmm31. */
+	NMD_X86_SIGNATURE_REG_K,          /* 'k': k0-k7. */
+	NMD_X86_SIGNATURE_REG_ST,         /* 'st': st0-st7. */
+	NMD_X86_SIGNATURE_REG_OPTIONAL    /* Any register or none. Used by '[?]'. */
+};
+
+/* The pattern of an operand. See nmd_x86_signature_compile(). */
+typedef struct nmd_x86_signature_operand
+{
+	uint8_t type;   /* A member of 'NMD_X86_OPERAND_TYPE'. 'NMD_X86_OPERAND_TYPE_NONE' matches any operand. */
+	uint8_t reg;    /* Registers: the register. Memory: the base register. A member of 'NMD_X86_REG' or 'NMD_X86_SIGNATURE_REG'. */
+	uint8_t index;  /* Memory: the index register. A member of 'NMD_X86_REG' or 'NMD_X86_SIGNATURE_REG'. */
+	uint8_t scale;  /* Memory: the scale as stored in 'nmd_x86_memory_operand'(0, 1, 2 or 3 for 1, 2, 4 or 8) or 'NMD_X86_SIGNATURE_ANY_SCALE'. */
+	bool has_value; /* Immediates and memory: if true, the immediate or the displacement must be equal to 'value'. */
+	int64_t value;  /* The immediate or the displacement. Immediates are compared with the width of the instruction's immediate. */
+} nmd_x86_signature_operand;
+
+/* The pattern of an instruction. See nmd_x86_signature_compile(). */
+typedef struct nmd_x86_signature_element
+{
+	uint16_t id;                                                     /* A member of 'NMD_X86_INSTRUCTION'. 'NMD_X86_INSTRUCTION_INVALID' matches any valid instruction. */
+	uint8_t num_operands;                                            /* The number of explicit operands, or 'NMD_X86_SIGNATURE_ANY_OPERANDS'. */
+	nmd_x86_signature_operand operands[NMD_X86_SIGNATURE_MAX_OPERANDS]; /* The patterns of the explicit operands. */
+} nmd_x86_signature_element;
+
+/* A sequence of consecutive instructions. */
+typedef struct nmd_x86_signature
+{
+	const nmd_x86_signature_element* elements; /* The elements compiled by nmd_x86_signature_compile(). */
+	size_t num_elements;                       /* The number of elements. A signature without elements never matches. */
+} nmd_x86_signature;
+
+/* The number of elements of the memory of a signature set, see nmd_x86_signature_set_init(). */
+#define NMD_X86_SIGNATURE_SET_MEMORY_SIZE(num_signatures) (NMD_X86_NUM_INSTRUCTIONS + 1 + (size_t)(num_signatures))
+
+/* Signatures indexed by the id of their first element. See nmd_x86_signature_set_init(). */
+typedef struct nmd_x86_signature_set
+{
+	const nmd_x86_signature* signatures; /* The signatures. */
+	size_t num_signatures;               /* The number of signatures. */
+	const uint32_t* offsets;             /* The signatures whose first element has the id 'i' are 'order[offsets[i]]' to 'order[offsets[i + 1] - 1]'. */
+	const uint32_t* order;               /* Indices of 'signatures' sorted by the id of their first element. */
+} nmd_x86_signature_set;
+
+/* A match found by nmd_x86_signature_scan(). */
+typedef struct nmd_x86_signature_match
+{
+	uint32_t signature;   /* The index of the signature in the set. */
+	uint32_t instruction; /* The index of the first instruction that matches the signature. */
+} nmd_x86_signature_match;
+
+/* The kinds of cross-references. See nmd_x86_xref_collect(). */
+enum NMD_X86_XREF_TYPE
+{
+	NMD_X86_XREF_TYPE_CALL = 0, /* A relative call. */
+	NMD_X86_XREF_TYPE_JUMP,     /* A relative jump, conditional branch or loop. */
+	NMD_X86_XREF_TYPE_READ,     /* A RIP-relative or absolute memory operand that is read(e.g. 'call [rip+x]'). */
+	NMD_X86_XREF_TYPE_WRITE,    /* A RIP-relative or absolute memory operand that is written, and possibly read. */
+	NMD_X86_XREF_TYPE_ADDRESS   /* An address that is computed but not accessed: 'lea' or an immediate inside the image. */
+};
+
+/* A reference from an instruction to an address(16 bytes). */
+typedef struct nmd_x86_xref
+{
+	uint64_t target; /* The referenced address. */
+	uint32_t source; /* The address of the referencing instruction relative to the image base. */
+	uint8_t type;    /* A member of 'NMD_X86_XREF_TYPE'. */
+} nmd_x86_xref;
+
+/* A sorted array of cross-references, e.g. the output of one thread. See nmd_x86_xref_merge(). */
+typedef struct nmd_x86_xref_run
+{
+	const nmd_x86_xref* xrefs; /* The cross-references. */
+	size_t num_xrefs;          /* The number of cross-references. */
+} nmd_x86_xref_run;
+
+/* The cross-references of an image sorted by source and by target. See nmd_x86_xref_index_init(). */
+typedef struct nmd_x86_xref_index
+{
+	uint64_t image_base;           /* The address 'source' is relative to. */
+	const nmd_x86_xref* by_source; /* The cross-references sorted by source. */
+	const nmd_x86_xref* by_target; /* The same cross-references sorted by target, then by source. */
+	size_t num_xrefs;              /* The number of elements of both arrays. */
+} nmd_x86_xref_index;
+
+/* Why an address was found to be the start of a function. See nmd_x86_find_functions(). */
+enum NMD_X86_FUNCTION_REASON
+{
+	NMD_X86_FUNCTION_REASON_ENTRY       = (1 << 0), /* It's one of the entry points given by the caller(e.g. the entry point or the exports). */
+	NMD_X86_FUNCTION_REASON_CALL_TARGET = (1 << 1), /* It's the target of a relative call. */
+	NMD_X86_FUNCTION_REASON_PROLOGUE    = (1 << 2), /* A prologue('endbr32', 'endbr64' or 'push rbp; mov rbp, rsp') follows the end of the previous code. */
+	NMD_X86_FUNCTION_REASON_PADDING     = (1 << 3), /* It follows a run of 'int3' after the end of the previous code. */
+	NMD_X86_FUNCTION_REASON_TAIL_CALL   = (1 << 4)  /* It's the target of a jump from another function. */
+};
+
+/* A function found by nmd_x86_find_functions(). */
+typedef struct nmd_x86_function
+{
+	uint64_t start;  /* The address of the first instruction. */
+	uint64_t end;    /* The address one past the last instruction, excluding the padding that follows it. */
+	uint8_t reasons; /* A mask of 'NMD_X86_FUNCTION_REASON_XXX'. */
+} nmd_x86_function;
+
+/* How the entries of a jump table are converted into addresses. See nmd_x86_resolve_jump_table(). */
+enum NMD_X86_JUMP_TABLE_ENTRY
+{
+	NMD_X86_JUMP_TABLE_ENTRY_ABSOLUTE = 0, /* Each entry is an address of 'entry_size' bytes('jmp [table+index*8]'). */
+	NMD_X86_JUMP_TABLE_ENTRY_OFFSET,       /* Each entry is a signed 32-bit offset from 'base'('movsxd rax, [base+index*4]; add rax, base; jmp rax'). */
+	NMD_X86_JUMP_TABLE_ENTRY_RVA           /* Each entry is an unsigned 32-bit offset from 'base', usually the image base('mov eax, [base+index*4+table]; add rax, base; jmp rax'). */
+};
+
+/* A jump table of a 'switch'(32 bytes). See nmd_x86_resolve_jump_table(). */
+typedef struct nmd_x86_jump_table
+{
+	uint64_t table;       /* The address of the first entry. */
+	uint64_t base;        /* The address the entries are relative to. Zero if they are absolute. */
+	uint32_t jump;        /* The offset of the indirect jump in the recursive descent's buffer. */
+	uint32_t num_entries; /* The number of entries allowed by the bounds check. */
+	uint8_t entry_size;   /* The size of an entry in bytes: 4 or 8. */
+	uint8_t type;         /* How the entries are converted into addresses. A member of 'NMD_X86_JUMP_TABLE_ENTRY'. */
+} nmd_x86_jump_table;
+
+/* The version of the cache file format written by nmd_x86_cache_save(). Files of other versions are rejected by nmd_x86_cache_load(). */
+#define NMD_X86_CACHE_VERSION 1
+
+/* The result of nmd_x86_cache_load(). */
+typedef enum NMD_X86_CACHE_STATUS
+{
+	NMD_X86_CACHE_STATUS_OK = 0,     /* The file can be used. */
+	NMD_X86_CACHE_STATUS_INVALID,    /* The file is not a cache file or it's truncated. */
+	NMD_X86_CACHE_STATUS_VERSION,    /* The file was written by another version of the format. */
+	NMD_X86_CACHE_STATUS_STALE,      /* The analyzed buffer changed since the file was saved. */
+	NMD_X86_CACHE_STATUS_UNSUPPORTED /* The tables can't be used in place: the host is big-endian or the file is not aligned to 8 bytes. */
+} NMD_X86_CACHE_STATUS;
+
+/* A compact(12 bytes) record of a decoded instruction stored in a cache file. See nmd_x86_cache_collect_instructions(). */
+typedef struct nmd_x86_cached_instruction
+{
+	uint32_t offset;           /* The instruction's offset in the analyzed buffer. */
+	uint16_t id;               /* The instruction's identifier. A member of 'NMD_X86_INSTRUCTION'. */
+	uint16_t operand_types;    /* The 'NMD_X86_OPERAND_TYPE' of the first eight operands, two bits each: operand 'i' is '(operand_types >> (2 * i)) & 3'. */
+	uint8_t length;            /* The instruction's length in bytes. */
+	uint8_t group;             /* The instruction's group. A member of 'NMD_GROUP'. */
+	uint8_t num_operands;      /* The number of operands. */
+	uint8_t implicit_operands; /* A mask of the first eight operands that are implicit. */
+} nmd_x86_cached_instruction;
+
+/* The analysis of a buffer stored in a cache file. See nmd_x86_cache_save() and nmd_x86_cache_load(). */
+typedef struct nmd_x86_cache
+{
+	uint64_t address;                                /* The runtime address of the analyzed buffer. */
+	uint64_t source_size;                            /* The size of the analyzed buffer in bytes. */
+	uint64_t source_hash;                            /* The hash of the analyzed buffer. See nmd_x86_cache_hash(). */
+	uint8_t mode;                                    /* The architecture mode. A member of 'NMD_X86_MODE'. */
+	const nmd_x86_cached_instruction* instructions;  /* The instructions sorted by offset. */
+	size_t num_instructions;
+	const nmd_x86_basic_block* blocks;               /* The basic blocks sorted by offset. See nmd_x86_build_basic_blocks(). */
+	size_t num_blocks;
+	const nmd_x86_xref* xrefs_by_source;             /* The cross-references sorted by source. See 'nmd_x86_xref_index'. */
+	const nmd_x86_xref* xrefs_by_target;             /* The same cross-references sorted by target. */
+	size_t num_xrefs;
+} nmd_x86_cache;
+
+/* The general purpose registers of 'nmd_x86_interpreter', numbered like their encoding. */
+typedef enum NMD_X86_GPR
+{
+	NMD_X86_GPR_RAX = 0,
+	NMD_X86_GPR_RCX,
+	NMD_X86_GPR_RDX,
+	NMD_X86_GPR_RBX,
+	NMD_X86_GPR_RSP,
+	NMD_X86_GPR_RBP,
+	NMD_X86_GPR_RSI,
+	NMD_X86_GPR_RDI,
+	NMD_X86_GPR_R8,
+	NMD_X86_GPR_R9,
+	NMD_X86_GPR_R10,
+	NMD_X86_GPR_R11,
+	NMD_X86_GPR_R12,
+	NMD_X86_GPR_R13,
+	NMD_X86_GPR_R14,
+	NMD_X86_GPR_R15,
+	NMD_X86_GPR_FS_BASE = 17, /* The base of the 'fs' segment. */
+	NMD_X86_GPR_GS_BASE = 18  /* The base of the 'gs' segment. */
+} NMD_X86_GPR;
+
+/* The reason nmd_x86_interpreter_run() returned. */
+typedef enum NMD_X86_INTERPRETER_EXIT
+{
+	NMD_X86_INTERPRETER_EXIT_LIMIT = 0,   /* The requested number of instructions was executed. */
+	NMD_X86_INTERPRETER_EXIT_UNSUPPORTED, /* The instruction at 'rip' is valid but not supported by the interpreter. */
+	NMD_X86_INTERPRETER_EXIT_INVALID,     /* The bytes at 'rip' are not a valid instruction. */
+	NMD_X86_INTERPRETER_EXIT_PAGE_FAULT,  /* The instruction at 'rip' accessed 'fault_address', which is not mapped or not writable. */
+	NMD_X86_INTERPRETER_EXIT_DIVIDE_ERROR /* The instruction at 'rip' divided by zero or its quotient doesn't fit. */
+} NMD_X86_INTERPRETER_EXIT;
+
+/* The number of cached page translations, for reads and for writes. */
+#define NMD_X86_TLB_SIZE 64
+
+/* The minimum number of micro-ops of nmd_x86_interpreter_init(), enough for the longest block. */
+#define NMD_X86_INTERPRETER_MIN_UOPS 65
+
+/* Returns the host address of the 4096-byte page at 'address', or null if it's not mapped(or not writable if 'write' is true). */
+typedef uint8_t* (*nmd_x86_translate_page)(void* context, uint64_t address, bool write);
+
+/* A page of the default page table. */
+typedef struct nmd_x86_page
+{
+	uint64_t address; /* The guest address of the page, a multiple of 4096. */
+	uint8_t* data;    /* A pointer to the 4096 bytes of the page. */
+	bool writable;
+} nmd_x86_page;
+
+/* A sorted array of pages. See nmd_x86_page_table_translate(). */
+typedef struct nmd_x86_page_table
+{
+	const nmd_x86_page* pages; /* The pages sorted by address. */
+	size_t num_pages;
+} nmd_x86_page_table;
+
+typedef struct nmd_x86_tlb_entry
+{
+	uint64_t page; /* The guest address of the page, or 1 if the entry is empty. */
+	uint8_t* data;
+} nmd_x86_tlb_entry;
+
+/* An instruction translated by the interpreter, with its operands decoded(24 bytes). */
+typedef struct nmd_x86_micro_op
+{
+	uint8_t op;     /* The operation. */
+	uint8_t size;   /* The operand size in bytes. */
+	uint8_t reg;    /* The register operand, the destination unless the operation stores it. */
+	uint8_t base;   /* The base register of the memory operand, or the source register. */
+	uint8_t index;  /* The index register of the memory operand. */
+	uint8_t scale;  /* Bits 0-1: the log2 of the scale. Bits 2-3: the segment(1 is 'fs', 2 is 'gs'). */
+	uint8_t length; /* The length of the instruction. */
+	uint8_t extra;  /* A sub-operation, condition code or source size. */
+	uint64_t disp;  /* The displacement of the memory operand(absolute for RIP-relative operands), or the fall-through address of a branch. */
+	uint64_t imm;   /* The immediate operand, or the target of a relative branch. */
+} nmd_x86_micro_op;
+
+/* A translated basic block. */
+typedef struct nmd_x86_interpreter_block
+{
+	uint64_t address;          /* The address of the first instruction. */
+	uint32_t first_uop;        /* The index of the first micro-op in the interpreter's 'uops'. */
+	uint32_t num_instructions; /* The number of instructions, each one a micro-op. */
+	uint32_t links[2];         /* The index of the block the exits(fall-through or taken) went to last time, or 0xffffffff. */
+} nmd_x86_interpreter_block;
+
+/* The state of the x86-64 interpreter. See nmd_x86_interpreter_init(). */
+typedef struct nmd_x86_interpreter
+{
+	uint64_t regs[19];         /* The registers, see 'NMD_X86_GPR'. 'regs[16]' must stay zero. */
+	uint64_t rip;              /* The address of the next instruction. */
+	uint64_t rflags;           /* The flags that are not computed lazily. Use nmd_x86_interpreter_get_flags() and nmd_x86_interpreter_set_flags(). */
+	uint64_t num_instructions; /* The number of instructions executed. */
+	uint64_t fault_address;    /* The address that caused the last 'NMD_X86_INTERPRETER_EXIT_PAGE_FAULT'. */
+	size_t num_flushes;        /* The number of times the block cache was flushed. */
+
+	/* The operands and result of the last instruction that modified the status flags. */
+	uint64_t flags_dst;
+	uint64_t flags_src;
+	uint64_t flags_result;
+	uint64_t flags_aux;
+	uint8_t flags_kind;
+	uint8_t flags_size;
+
+	bool code_modified; /* An instruction wrote memory in ['code_begin', 'code_end'). */
+	uint64_t code_begin;
+	uint64_t code_end;
+
+	nmd_x86_translate_page translate;
+	void* context;
+	nmd_x86_tlb_entry tlb[2][NMD_X86_TLB_SIZE]; /* Reads and writes. */
+
+	nmd_x86_interpreter_block* blocks;
+	size_t num_blocks;
+	size_t max_blocks;
+	nmd_x86_micro_op* uops;
+	size_t num_uops;
+	size_t max_uops;
+	uint32_t* block_map;
+	size_t map_capacity;
+} nmd_x86_interpreter;
+
+/* The status flags tracked by the liveness analysis: CF, PF, AF, ZF, SF, DF and OF. See nmd_x86_liveness_analyze(). */
+#define NMD_X86_LIVENESS_FLAGS ((uint32_t)(NMD_X86_EFLAGS_CF | NMD_X86_EFLAGS_PF | NMD_X86_EFLAGS_AF | NMD_X86_EFLAGS_ZF | NMD_X86_EFLAGS_SF | NMD_X86_EFLAGS_DF | NMD_X86_EFLAGS_OF))
+
+/* The registers tracked by the liveness analysis: every bit of 'NMD_X86_REG_MASK_XXX' except the instruction pointer. */
+#define NMD_X86_LIVENESS_REGS (~NMD_X86_REG_MASK_RIP)
+
+/* The value of the instruction map of nmd_x86_liveness_analyze() at offsets where no instruction starts. */
+#define NMD_X86_LIVENESS_NO_INSTRUCTION 0xffffffff
+
+/* The number of elements of the workspace of nmd_x86_liveness_analyze(). */
+#define NMD_X86_LIVENESS_WORKSPACE_SIZE(num_blocks) (2 * (size_t)(num_blocks))
+
+/* The registers and status flags live before and after an instruction(24 bytes). See nmd_x86_liveness_analyze(). */
+typedef struct nmd_x86_instruction_liveness
+{
+	uint64_t regs_in;   /* The registers live before the instruction. See 'NMD_X86_REG_MASK_XXX'. */
+	uint64_t regs_out;  /* The registers live after the instruction. */
+	uint32_t flags_in;  /* The status flags live before the instruction. See 'NMD_X86_LIVENESS_FLAGS'. */
+	uint32_t flags_out; /* The status flags live after the instruction. */
+} nmd_x86_instruction_liveness;
+
+/* The liveness at the boundaries of a basic block. See nmd_x86_liveness_analyze(). */
+typedef struct nmd_x86_block_liveness
+{
+	uint64_t regs_in;           /* The registers live at the start of the block. */
+	uint64_t regs_out;          /* The registers live at the end of the block. */
+	uint64_t regs_used;         /* The registers read by the block before being written. */
+	uint64_t regs_defined;      /* The registers written by the block. */
+	uint32_t flags_in;
+	uint32_t flags_out;
+	uint32_t flags_used;
+	uint32_t flags_defined;
+	uint32_t first_instruction; /* The index of the block's first instruction in the analysis' instructions. */
+	uint32_t num_instructions;
+} nmd_x86_block_liveness;
+
 typedef union nmd_x86_register
 {
 	int8_t  h8;
@@ -2443,6 +3247,79 @@ Parameters:
 */
 NMD_ASSEMBLY_API bool nmd_x86_decode(const void* buffer, size_t buffer_size, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags);
 
+/*
+Decodes an instruction. Returns true if the instruction is valid, false otherwise. Behaves like nmd_x86_decode() with 'buffer_size'
+equal to 'NMD_X86_MAXIMUM_INSTRUCTION_LENGTH' but doesn't check the buffer's bounds for every byte it reads.
+Parameters:
+ - buffer      [in]  A pointer to a buffer containing a encoded instruction. At least 15 bytes must be readable.
+ - instruction [out] A pointer to a variable of type 'nmd_x86_instruction' that receives information about the instruction.
+ - mode        [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - flags       [in]  A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use. If uncertain, use 'NMD_X86_DECODER_FLAGS_MINIMAL'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_decode_padded(const void* buffer, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags);
+
+/*
+Defines 'bool name(const void* buffer, size_t buffer_size, nmd_x86_instruction* instruction)', a decoder that behaves like nmd_x86_decode()
+but whose mode and flags are the compile-time constants 'mode' and 'flags', so the branches on them are removed. 'NMD_X86_DEFINE_DECODER_PADDED'
+defines 'bool name(const void* buffer, nmd_x86_instruction* instruction)' which behaves like nmd_x86_decode_padded(). These macros must be used
+after the implementation(i.e. in the source file that defines 'NMD_ASSEMBLY_IMPLEMENTATION').
+*/
+#define NMD_X86_DEFINE_DECODER(name, mode, flags) \
+	NMD_ASSEMBLY_API bool name(const void* const buffer, size_t buffer_size, nmd_x86_instruction* instruction) \
+	{ \
+		_nmd_x86_clear_instruction(instruction, NMD_X86_DECODER_FLAGS_ALL); \
+		return _nmd_x86_decode_inline(buffer, buffer_size, instruction, mode, flags, false); \
+	}
+#define NMD_X86_DEFINE_DECODER_PADDED(name, mode, flags) \
+	NMD_ASSEMBLY_API bool name(const void* const buffer, nmd_x86_instruction* instruction) \
+	{ \
+		_nmd_x86_clear_instruction(instruction, NMD_X86_DECODER_FLAGS_ALL); \
+		return _nmd_x86_decode_inline(buffer, NMD_X86_MAXIMUM_INSTRUCTION_LENGTH, instruction, mode, flags, true); \
+	}
+
+/* Declares a decoder defined by 'NMD_X86_DEFINE_DECODER' or 'NMD_X86_DEFINE_DECODER_PADDED' respectively. */
+#define NMD_X86_DECLARE_DECODER(name) NMD_ASSEMBLY_API bool name(const void* buffer, size_t buffer_size, nmd_x86_instruction* instruction)
+#define NMD_X86_DECLARE_DECODER_PADDED(name) NMD_ASSEMBLY_API bool name(const void* buffer, nmd_x86_instruction* instruction)
+
+/*
+Decodes the operands of an instruction that was decoded without 'NMD_X86_DECODER_FLAGS_OPERANDS'. Returns true if the operands
+were decoded, false if the instruction is invalid. Only the fields the decoder has already parsed are used.
+Parameters:
+ - instruction [in/out] A pointer to a valid instruction returned by a decoder function.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_decode_operands(nmd_x86_instruction* instruction);
+
+/*
+Decodes the cpu flags of an instruction that was decoded without 'NMD_X86_DECODER_FLAGS_CPU_FLAGS'. Returns true if the cpu flags
+were decoded, false if the instruction is invalid. Only the fields the decoder has already parsed are used.
+Parameters:
+ - instruction [in/out] A pointer to a valid instruction returned by a decoder function.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_decode_cpu_flags(nmd_x86_instruction* instruction);
+
+/*
+Returns the bit that represents a register in 'regs_read' and 'regs_written' of 'nmd_x86_instruction', or zero if the register is not tracked.
+Sub-registers share the bit of their architectural register(e.g. 'al', 'ax', 'eax' and 'rax' all return 'NMD_X86_REG_MASK_RAX').
+Parameters:
+ - reg [in] A member of 'NMD_X86_REG'.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_get_register_mask(NMD_X86_REG reg);
+
+/*
+Decodes consecutive instructions from a buffer. Returns the number of entries written to 'instructions'.
+Consecutive bytes that cannot be decoded are reported as a single entry(up to 15 bytes) whose 'valid' member is false, so
+the entries cover the buffer contiguously: the offset of an entry is the sum of the lengths of the previous entries.
+Parameters:
+ - buffer           [in]      A pointer to a buffer containing encoded instructions.
+ - buffer_size      [in]      The buffer's size in bytes.
+ - instructions     [out]     A pointer to an array of 'nmd_x86_instruction' that receives the instructions.
+ - num_instructions [in]      The number of elements in 'instructions'.
+ - mode             [in]      The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - flags            [in]      A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use. If uncertain, use 'NMD_X86_DECODER_FLAGS_MINIMAL'.
+ - num_bytes        [out/opt] A pointer to a variable that receives the number of bytes consumed. This parameter may be null.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_decode_buffer(const void* buffer, size_t buffer_size, nmd_x86_instruction* instructions, size_t num_instructions, NMD_X86_MODE mode, uint32_t flags, size_t* num_bytes);
+
 /*
 Formats an instruction. This function may cause a crash if you modify 'instruction' manually.
 Parameters:
@@ -2462,4 +3339,745 @@ Parameters:
 */
 NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* buffer, size_t buffer_size, NMD_X86_MODE mode);
 
+/*
+Returns the instruction's length if it's valid, zero otherwise. Behaves like nmd_x86_ldisasm() with 'buffer_size' equal to
+'NMD_X86_MAXIMUM_INSTRUCTION_LENGTH' but doesn't check the buffer's bounds for every byte it reads.
+Parameters:
+ - buffer [in] A pointer to a buffer containing a encoded instruction. At least 15 bytes must be readable.
+ - mode   [in] The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_ldisasm_padded(const void* buffer, NMD_X86_MODE mode);
+
+/*
+Performs a linear sweep over a buffer and sets bit 'offset % 32' of 'boundary_bitmap[offset / 32]' for every offset where an instruction starts.
+Bytes where no valid instruction starts are marked and skipped one at a time, exactly like calling nmd_x86_ldisasm() in a loop. Returns the number of bits set.
+Parameters:
+ - buffer          [in]  A pointer to a buffer containing encoded instructions.
+ - buffer_size     [in]  The buffer's size in bytes.
+ - mode            [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - boundary_bitmap [out] A pointer to an array of '(buffer_size + 31) / 32' elements that receives the bitmap.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_ldisasm_bulk(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t* boundary_bitmap);
+
+/*
+Initializes a decode cache.
+Parameters:
+ - cache    [out] A pointer to a variable of type 'nmd_x86_decode_cache'.
+ - entries  [in]  A pointer to an array of 'nmd_x86_decode_cache_entry' that holds the cached instructions.
+ - capacity [in]  The number of elements in 'entries'. Only the largest power of two less than or equal to it is used.
+*/
+NMD_ASSEMBLY_API void nmd_x86_decode_cache_init(nmd_x86_decode_cache* cache, nmd_x86_decode_cache_entry* entries, size_t capacity);
+
+/*
+Removes all entries from a decode cache and resets its counters.
+Parameters:
+ - cache [in/out] A pointer to a variable initialized by nmd_x86_decode_cache_init().
+*/
+NMD_ASSEMBLY_API void nmd_x86_decode_cache_clear(nmd_x86_decode_cache* cache);
+
+/*
+Decodes an instruction like nmd_x86_decode(), returning the cached result if the instruction at 'runtime_address' was already decoded with the
+same mode and flags and its bytes are unchanged. Returns true if the instruction is valid, false otherwise.
+Parameters:
+ - cache           [in/out] A pointer to a variable initialized by nmd_x86_decode_cache_init().
+ - buffer          [in]     A pointer to a buffer containing an encoded instruction.
+ - buffer_size     [in]     The buffer's size in bytes.
+ - runtime_address [in]     The instruction's runtime address.
+ - instruction     [out]    A pointer to a variable of type 'nmd_x86_instruction' that receives information about the instruction.
+ - mode            [in]     The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - flags           [in]     A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_decode_cached(nmd_x86_decode_cache* cache, const void* buffer, size_t buffer_size, uint64_t runtime_address, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags);
+
+/*
+Removes the entries of all instructions that overlap a range of addresses.
+Parameters:
+ - cache   [in/out] A pointer to a variable initialized by nmd_x86_decode_cache_init().
+ - address [in]     The runtime address of the first changed byte.
+ - size    [in]     The number of changed bytes.
+*/
+NMD_ASSEMBLY_API void nmd_x86_decode_cache_invalidate(nmd_x86_decode_cache* cache, uint64_t address, uint64_t size);
+
+/*
+Splits a buffer into chunks, each beginning at a multiple of 32 bytes, for a parallel linear sweep. Returns the number of chunks used.
+Parameters:
+ - buffer_size [in]  The buffer's size in bytes.
+ - chunks      [out] A pointer to an array of 'nmd_x86_sweep_chunk' that receives the chunks.
+ - num_chunks  [in]  The number of elements in 'chunks'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_sweep_split(size_t buffer_size, nmd_x86_sweep_chunk* chunks, size_t num_chunks);
+
+/*
+Performs a speculative linear sweep over a chunk starting at a heuristic resynchronization point. Writes only the elements of 'boundary_bitmap'
+that cover the chunk, so chunks can be decoded concurrently.
+Parameters:
+ - buffer          [in]     A pointer to the whole buffer.
+ - buffer_size     [in]     The whole buffer's size in bytes.
+ - mode            [in]     The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - flags           [in]     A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use.
+ - chunk           [in/out] A pointer to a chunk returned by nmd_x86_sweep_split().
+ - boundary_bitmap [out]    A pointer to an array of '(buffer_size + 31) / 32' elements shared by all chunks.
+*/
+NMD_ASSEMBLY_API void nmd_x86_sweep_decode_chunk(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t flags, nmd_x86_sweep_chunk* chunk, uint32_t* boundary_bitmap);
+
+/*
+Verifies that the speculative sweeps of consecutive chunks converge with the real one and repairs the bitmap where they don't, so that it
+becomes identical to the result of a sequential sweep. A chunk whose speculative sweep already has an instruction where the previous chunk's
+sweep continues is not decoded again. Must be called after all chunks were decoded. Returns the number of bits set.
+Parameters:
+ - buffer          [in]     A pointer to the whole buffer.
+ - buffer_size     [in]     The whole buffer's size in bytes.
+ - mode            [in]     The architecture mode used to decode the chunks.
+ - flags           [in]     The flags used to decode the chunks.
+ - chunks          [in/out] A pointer to the array of chunks.
+ - num_chunks      [in]     The number of chunks.
+ - boundary_bitmap [in/out] A pointer to the bitmap passed to nmd_x86_sweep_decode_chunk().
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_sweep_merge(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t flags, nmd_x86_sweep_chunk* chunks, size_t num_chunks, uint32_t* boundary_bitmap);
+
+/*
+Initializes a recursive descent and clears the code map.
+Parameters:
+ - rd             [out] A pointer to a variable of type 'nmd_x86_recursive_descent'.
+ - buffer         [in]  A pointer to a buffer containing code.
+ - buffer_size    [in]  The buffer's size in bytes. Must be less than 4GB.
+ - mode           [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - code_map       [out] A pointer to an array of 'buffer_size' bytes that receives the state of every offset. See 'NMD_X86_CODE_MAP'.
+ - queue          [in]  A pointer to an array of offsets used as the work queue.
+ - queue_capacity [in]  The number of elements in 'queue'.
+*/
+NMD_ASSEMBLY_API void nmd_x86_recursive_descent_init(nmd_x86_recursive_descent* rd, const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint8_t* code_map, uint32_t* queue, size_t queue_capacity);
+
+/*
+Adds an entry point to the work queue.
+Parameters:
+ - rd     [in/out] A pointer to a variable initialized by nmd_x86_recursive_descent_init().
+ - offset [in]     The entry point's offset in the buffer.
+*/
+NMD_ASSEMBLY_API void nmd_x86_recursive_descent_add_entry(nmd_x86_recursive_descent* rd, size_t offset);
+
+/*
+Follows the control flow from the entry points until all reachable code is explored, decoding every byte at most once.
+Parameters:
+ - rd [in/out] A pointer to a variable initialized by nmd_x86_recursive_descent_init().
+*/
+NMD_ASSEMBLY_API void nmd_x86_recursive_descent_run(nmd_x86_recursive_descent* rd);
+
+/*
+Merges the code map of a recursive descent into another one of the same buffer.
+Parameters:
+ - code_map    [in/out] A pointer to the code map that receives the result.
+ - other       [in]     A pointer to the code map to be merged.
+ - buffer_size [in]     The buffer's size in bytes.
+*/
+NMD_ASSEMBLY_API void nmd_x86_code_map_merge(uint8_t* code_map, const uint8_t* other, size_t buffer_size);
+
+/*
+Builds the basic blocks described by a code map, sorted by their offset. Returns the number of blocks, which may be greater than 'max_blocks'.
+Parameters:
+ - buffer      [in]  A pointer to the buffer passed to nmd_x86_recursive_descent_init().
+ - buffer_size [in]  The buffer's size in bytes.
+ - mode        [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - code_map    [in]  A pointer to the code map filled by nmd_x86_recursive_descent_run().
+ - blocks      [out] A pointer to an array of 'nmd_x86_basic_block' that receives the blocks.
+ - max_blocks  [in]  The number of elements in 'blocks'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_build_basic_blocks(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, nmd_x86_basic_block* blocks, size_t max_blocks);
+
+/*
+Updates the code map of a recursive descent after the bytes in ['begin', 'end') of its buffer were changed(e.g. patched in place). Only the
+explored instructions that overlap the range are decoded again: the straight line is decoded from the first of them until it reaches an
+instruction that is still valid, instructions that only fell through the old bytes are forgotten, branch targets among them are explored again
+and new branch targets are explored as usual. Code that only the old bytes reached is kept. The range of offsets whose state changed is stored
+in 'changed_begin' and 'changed_end' for nmd_x86_update_basic_blocks() and nmd_x86_xref_update(). Returns false if no explored instruction
+overlaps the range, in which case nothing changed.
+Parameters:
+ - rd            [in/out] A pointer to a recursive descent after nmd_x86_recursive_descent_run(), whose buffer contains the new bytes.
+ - begin         [in]     The offset of the first changed byte.
+ - end           [in]     The offset one past the last changed byte.
+ - changed_begin [out]    A pointer to a variable that receives the first offset whose state changed.
+ - changed_end   [out]    A pointer to a variable that receives the offset one past the last offset whose state changed.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_recursive_descent_patch(nmd_x86_recursive_descent* rd, size_t begin, size_t end, size_t* changed_begin, size_t* changed_end);
+
+/*
+Updates the basic blocks built by nmd_x86_build_basic_blocks() after nmd_x86_recursive_descent_patch(). Only the blocks that overlap the
+changed range(or end where it begins) are built again, in 'workspace', and replace the old ones in place; the other blocks are moved and
+their successors renumbered. Only a kept block whose branch target wasn't a block is decoded again, in case the target now starts one.
+Decoding scales with the changed range, but finding the overlapping blocks, renumbering and moving are linear in the number of blocks, and
+so is rebuilding the control flow graph with nmd_x86_cfg_build() afterwards. Returns the new number of blocks, or zero if the new blocks
+don't fit in 'workspace' or the result doesn't fit in 'max_blocks', in which case 'blocks' is not modified.
+Parameters:
+ - buffer         [in]     A pointer to the buffer passed to nmd_x86_recursive_descent_init().
+ - buffer_size    [in]     The buffer's size in bytes.
+ - mode           [in]     The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - code_map       [in]     A pointer to the code map updated by nmd_x86_recursive_descent_patch().
+ - changed_begin  [in]     The first offset whose state changed.
+ - changed_end    [in]     The offset one past the last offset whose state changed.
+ - blocks         [in/out] A pointer to the blocks of the code map before the patch.
+ - num_blocks     [in]     The number of blocks before the patch.
+ - max_blocks     [in]     The number of elements in 'blocks'.
+ - workspace      [in]     A pointer to an array used as temporary storage for the new blocks of the changed range.
+ - workspace_size [in]     The number of elements in 'workspace'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_update_basic_blocks(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, size_t changed_begin, size_t changed_end, nmd_x86_basic_block* blocks, size_t num_blocks, size_t max_blocks, nmd_x86_basic_block* workspace, size_t workspace_size);
+
+/*
+Builds a control flow graph in compressed sparse row form from basic blocks. Duplicate edges are stored once.
+Parameters:
+ - cfg        [out] A pointer to a variable of type 'nmd_x86_cfg'.
+ - blocks     [in]  A pointer to an array of blocks returned by nmd_x86_build_basic_blocks().
+ - num_blocks [in]  The number of blocks.
+ - memory     [in]  A pointer to an array of 'NMD_X86_CFG_MEMORY_SIZE(num_blocks)' elements that receives the graph.
+*/
+NMD_ASSEMBLY_API void nmd_x86_cfg_build(nmd_x86_cfg* cfg, const nmd_x86_basic_block* blocks, size_t num_blocks, uint32_t* memory);
+
+/*
+Computes the immediate dominator of every block reachable from 'entry'. Unreachable blocks receive 'NMD_X86_INVALID_BLOCK'.
+Parameters:
+ - cfg       [in]  A pointer to a graph built by nmd_x86_cfg_build().
+ - entry     [in]  The index of the entry block.
+ - idom      [out] A pointer to an array of 'cfg->num_blocks' elements that receives the immediate dominators.
+ - workspace [in]  A pointer to an array of 'NMD_X86_CFG_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API void nmd_x86_cfg_dominators(const nmd_x86_cfg* cfg, uint32_t entry, uint32_t* idom, uint32_t* workspace);
+
+/*
+Computes the immediate post-dominator of every block. Blocks without successors are followed by the virtual exit 'NMD_X86_CFG_EXIT'.
+Blocks that can't reach an exit receive 'NMD_X86_INVALID_BLOCK'.
+Parameters:
+ - cfg       [in]  A pointer to a graph built by nmd_x86_cfg_build().
+ - ipdom     [out] A pointer to an array of 'cfg->num_blocks' elements that receives the immediate post-dominators.
+ - workspace [in]  A pointer to an array of 'NMD_X86_CFG_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API void nmd_x86_cfg_post_dominators(const nmd_x86_cfg* cfg, uint32_t* ipdom, uint32_t* workspace);
+
+/*
+Returns true if block 'a' dominates(or post-dominates) block 'b'.
+Parameters:
+ - idom [in] A pointer to the immediate dominators or post-dominators.
+ - a    [in] The index of the dominating block.
+ - b    [in] The index of the dominated block.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_cfg_dominates(const uint32_t* idom, uint32_t a, uint32_t b);
+
+/*
+Finds the natural loops of the blocks reachable from 'entry'. Returns the number of loops.
+Parameters:
+ - cfg         [in]  A pointer to a graph built by nmd_x86_cfg_build().
+ - entry       [in]  The index of the entry block.
+ - idom        [in]  A pointer to the immediate dominators computed by nmd_x86_cfg_dominators() with the same entry.
+ - loop_header [out] A pointer to an array of 'cfg->num_blocks' elements that receives the header of the innermost loop of each block.
+ - loop_parent [out] A pointer to an array of 'cfg->num_blocks' elements that receives the header of the enclosing loop of each header.
+ - workspace   [in]  A pointer to an array of 'NMD_X86_CFG_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_cfg_loops(const nmd_x86_cfg* cfg, uint32_t entry, const uint32_t* idom, uint32_t* loop_header, uint32_t* loop_parent, uint32_t* workspace);
+
+/*
+Returns the timing of an instruction decoded with at least 'NMD_X86_DECODER_FLAGS_INSTRUCTION_ID' and 'NMD_X86_DECODER_FLAGS_OPERANDS'.
+Returns false if the instruction is not in the timing table(then 'timing' describes a simple integer operation) or the microarchitecture is not supported.
+Parameters:
+ - instruction       [in]  A pointer to a decoded instruction.
+ - microarchitecture [in]  A member of 'NMD_X86_MICROARCHITECTURE'.
+ - timing            [out] A pointer to a variable of type 'nmd_x86_instruction_timing'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_get_instruction_timing(const nmd_x86_instruction* instruction, NMD_X86_MICROARCHITECTURE microarchitecture, nmd_x86_instruction_timing* timing);
+
+/*
+Estimates the cycles per iteration, the bottleneck and the critical path of a basic block that runs in a loop. The instructions must have
+been decoded with 'NMD_X86_DECODER_FLAGS_ALL'. Returns false if the microarchitecture is not supported.
+Parameters:
+ - instructions      [in]  A pointer to an array of the instructions of the block.
+ - num_instructions  [in]  The number of instructions.
+ - microarchitecture [in]  A member of 'NMD_X86_MICROARCHITECTURE'.
+ - block             [out] A pointer to a variable of type 'nmd_x86_block_timing'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_analyze_block_timing(const nmd_x86_instruction* instructions, size_t num_instructions, NMD_X86_MICROARCHITECTURE microarchitecture, nmd_x86_block_timing* block);
+
+/*
+Initializes an iterator over the instructions of an executable section.
+Parameters:
+ - iterator [out] A pointer to a variable of type 'nmd_x86_section_iterator'.
+ - section  [in]  A pointer to a section returned by nmd_x86_elf_get_executable_sections() or nmd_x86_pe_get_executable_sections().
+ - flags    [in]  A mask of 'NMD_X86_DECODER_FLAGS_XXX' passed to the decoder.
+*/
+NMD_ASSEMBLY_API void nmd_x86_section_iterator_init(nmd_x86_section_iterator* iterator, const nmd_x86_code_section* section, uint32_t flags);
+
+/*
+Decodes the next instruction of a section directly from the image. Bytes where no valid instruction starts are returned one at a
+time as an instruction with 'valid' set to false, 'length' set to one and the byte in 'buffer[0]', so the sweep never stops early.
+Returns false when the end of the section is reached.
+Parameters:
+ - iterator        [in/out] A pointer to a variable initialized by nmd_x86_section_iterator_init().
+ - instruction     [out]    A pointer to a variable of type 'nmd_x86_instruction'.
+ - runtime_address [out]    A pointer to a variable that receives the virtual address of the instruction. May be null.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_section_next_instruction(nmd_x86_section_iterator* iterator, nmd_x86_instruction* instruction, uint64_t* runtime_address);
+
+/*
+Parses the headers of an ELF32 or ELF64 file for x86 or x86-64. Nothing is copied: 'elf' and the sections returned by
+nmd_x86_elf_get_executable_sections() point into 'image', which must stay valid while they are used. Returns true if the
+file is a little-endian x86 ELF whose header tables are inside the image.
+Parameters:
+ - image      [in]  A pointer to the contents of the file(e.g. a read-only memory mapping of the file).
+ - image_size [in]  The size of the file in bytes.
+ - elf        [out] A pointer to a variable of type 'nmd_x86_elf'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_elf_parse(const void* image, size_t image_size, nmd_x86_elf* elf);
+
+/*
+Finds the executable sections of a parsed ELF file: the sections with the 'SHF_EXECINSTR' flag or, if the file has no section headers,
+the 'PT_LOAD' segments with the 'PF_X' flag. Sections whose contents are not inside the image are skipped. Returns the number of executable
+sections, which may be larger than 'max_sections'; only the first 'max_sections' are stored.
+Parameters:
+ - elf          [in]  A pointer to a variable parsed by nmd_x86_elf_parse().
+ - sections     [out] A pointer to an array of 'nmd_x86_code_section' that receives the sections. May be null if 'max_sections' is zero.
+ - max_sections [in]  The number of elements in 'sections'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_elf_get_executable_sections(const nmd_x86_elf* elf, nmd_x86_code_section* sections, size_t max_sections);
+
+/*
+Parses the headers of a PE32 or PE32+ file for x86 or x86-64. Nothing is copied: 'pe', the sections and the symbols point into 'image',
+which must stay valid while they are used. The file is read as it is on disk, it doesn't need to be loaded. Returns true if the file is
+an x86 PE whose section table is inside the image.
+Parameters:
+ - image      [in]  A pointer to the contents of the file(e.g. a read-only memory mapping of the file).
+ - image_size [in]  The size of the file in bytes.
+ - pe         [out] A pointer to a variable of type 'nmd_x86_pe'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_pe_parse(const void* image, size_t image_size, nmd_x86_pe* pe);
+
+/*
+Returns a pointer to the file data of the range ['rva', 'rva' + 'size'), or null if the range is not entirely inside the file data of one
+section or of the headers(e.g. uninitialized data).
+Parameters:
+ - pe   [in] A pointer to a variable parsed by nmd_x86_pe_parse().
+ - rva  [in] A relative virtual address.
+ - size [in] The number of bytes that must be readable.
+*/
+NMD_ASSEMBLY_API const void* nmd_x86_pe_rva_to_pointer(const nmd_x86_pe* pe, uint32_t rva, size_t size);
+
+/*
+Finds the executable sections of a parsed PE file(the sections with the 'IMAGE_SCN_MEM_EXECUTE' or 'IMAGE_SCN_CNT_CODE' characteristic).
+Only the part of a section that is stored in the file is returned. Returns the number of executable sections, which may be larger than
+'max_sections'; only the first 'max_sections' are stored.
+Parameters:
+ - pe           [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - sections     [out] A pointer to an array of 'nmd_x86_code_section' that receives the sections. May be null if 'max_sections' is zero.
+ - max_sections [in]  The number of elements in 'sections'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_pe_get_executable_sections(const nmd_x86_pe* pe, nmd_x86_code_section* sections, size_t max_sections);
+
+/*
+Fills an array with the exports of a PE file sorted by RVA, so it can be searched with nmd_x86_pe_find_symbol(). Pass at least
+'pe->num_exports' elements to get all exports. Returns the number of exports stored.
+Parameters:
+ - pe          [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - exports     [out] A pointer to an array of 'nmd_x86_pe_symbol' that receives the exports.
+ - max_exports [in]  The number of elements in 'exports'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_pe_get_exports(const nmd_x86_pe* pe, nmd_x86_pe_symbol* exports, size_t max_exports);
+
+/*
+Finds an export by name with a binary search over the export name table, which the PE format requires to be sorted. Needs no index.
+Returns false if the name is not exported.
+Parameters:
+ - pe     [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - name   [in]  The name of the export.
+ - symbol [out] A pointer to a variable that receives the export.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_pe_find_export(const nmd_x86_pe* pe, const char* name, nmd_x86_pe_symbol* symbol);
+
+/*
+Fills an array with the imports of a PE file sorted by the RVA of their import address table slot, so the target of an indirect call
+or jump(e.g. 'call [__imp_CreateFileW]') can be found with nmd_x86_pe_find_symbol(). Returns the number of imports, which may be larger
+than 'max_imports'; only the first 'max_imports' are stored.
+Parameters:
+ - pe          [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - imports     [out] A pointer to an array of 'nmd_x86_pe_symbol' that receives the imports. May be null if 'max_imports' is zero.
+ - max_imports [in]  The number of elements in 'imports'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_pe_get_imports(const nmd_x86_pe* pe, nmd_x86_pe_symbol* imports, size_t max_imports);
+
+/*
+Finds the symbol at an RVA with a binary search. Returns a pointer to the symbol, or null if there's none at 'rva'.
+Parameters:
+ - symbols     [in] A pointer to an array filled by nmd_x86_pe_get_exports() or nmd_x86_pe_get_imports().
+ - num_symbols [in] The number of elements in 'symbols'.
+ - rva         [in] The RVA of an export, or of an import address table slot.
+*/
+NMD_ASSEMBLY_API const nmd_x86_pe_symbol* nmd_x86_pe_find_symbol(const nmd_x86_pe_symbol* symbols, size_t num_symbols, uint32_t rva);
+
+#ifdef NMD_ASSEMBLY_ENABLE_STATS
+/*
+Copies the counters of the calling thread. Only available if 'NMD_ASSEMBLY_ENABLE_STATS' is defined.
+Parameters:
+ - stats [out] A pointer to a variable of type 'nmd_x86_stats' that receives the counters.
+*/
+NMD_ASSEMBLY_API void nmd_x86_stats_snapshot(nmd_x86_stats* stats);
+
+/* Sets the counters of the calling thread to zero. Only available if 'NMD_ASSEMBLY_ENABLE_STATS' is defined. */
+NMD_ASSEMBLY_API void nmd_x86_stats_reset(void);
+
+/*
+Adds every counter of 'stats' to 'total', e.g. to combine the snapshots of several threads. Only available if 'NMD_ASSEMBLY_ENABLE_STATS' is defined.
+Parameters:
+ - total [in/out] A pointer to a variable of type 'nmd_x86_stats' that receives the sums.
+ - stats [in]     A pointer to a snapshot.
+*/
+NMD_ASSEMBLY_API void nmd_x86_stats_add(nmd_x86_stats* total, const nmd_x86_stats* stats);
+#endif /* NMD_ASSEMBLY_ENABLE_STATS */
+
+/*
+Compiles a signature query. Returns the number of elements, or zero if the query is not valid or 'max_elements' is too small.
+Parameters:
+ - query        [in]  A null-terminated string. See the 'Signatures' section at the top of this file for the syntax.
+ - elements     [out] A pointer to an array of 'nmd_x86_signature_element' that receives the compiled elements.
+ - max_elements [in]  The number of elements in 'elements'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_signature_compile(const char* query, nmd_x86_signature_element* elements, size_t max_elements);
+
+/*
+Returns true if the instructions starting at 'instructions' match a signature.
+Parameters:
+ - signature        [in] A pointer to a variable of type 'nmd_x86_signature'.
+ - instructions     [in] A pointer to an array of instructions decoded with 'NMD_X86_DECODER_FLAGS_INSTRUCTION_ID' and 'NMD_X86_DECODER_FLAGS_OPERANDS'.
+ - num_instructions [in] The number of elements in 'instructions'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_signature_matches(const nmd_x86_signature* signature, const nmd_x86_instruction* instructions, size_t num_instructions);
+
+/*
+Indexes signatures by the id of their first element. The set points to 'signatures' and 'memory', which must stay valid while it is used.
+Parameters:
+ - set            [out] A pointer to a variable of type 'nmd_x86_signature_set'.
+ - signatures     [in]  A pointer to an array of signatures.
+ - num_signatures [in]  The number of elements in 'signatures'.
+ - memory         [in]  A pointer to an array of 'NMD_X86_SIGNATURE_SET_MEMORY_SIZE(num_signatures)' elements that receives the index.
+*/
+NMD_ASSEMBLY_API void nmd_x86_signature_set_init(nmd_x86_signature_set* set, const nmd_x86_signature* signatures, size_t num_signatures, uint32_t* memory);
+
+/*
+Finds every match of every signature of a set in a stream of decoded instructions in one pass. Returns the number of matches, which may
+be larger than 'max_matches'; only the first 'max_matches' are stored. Matches are sorted by instruction, then by signature.
+Parameters:
+ - set              [in]  A pointer to a set initialized by nmd_x86_signature_set_init().
+ - instructions     [in]  A pointer to an array of instructions decoded with 'NMD_X86_DECODER_FLAGS_INSTRUCTION_ID' and 'NMD_X86_DECODER_FLAGS_OPERANDS'(e.g. by nmd_x86_decode_buffer()).
+ - num_instructions [in]  The number of elements in 'instructions'.
+ - matches          [out] A pointer to an array of 'nmd_x86_signature_match' that receives the matches. May be null if 'max_matches' is zero.
+ - max_matches      [in]  The number of elements in 'matches'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_signature_scan(const nmd_x86_signature_set* set, const nmd_x86_instruction* instructions, size_t num_instructions, nmd_x86_signature_match* matches, size_t max_matches);
+
+/*
+Collects the cross-references of the instructions that start in ['begin', 'end') of a section, decoding each instruction once: relative
+branches('NMD_GROUP_RELATIVE_ADDRESSING'), RIP-relative and absolute memory operands, and immediates of 32 or 64 bits that point into the image.
+Returns the number of cross-references, which may be larger than 'max_xrefs'; only the first 'max_xrefs' are stored, sorted by source.
+Parameters:
+ - section         [in]  A pointer to the section, see nmd_x86_elf_get_executable_sections() and nmd_x86_pe_get_executable_sections().
+ - image_base      [in]  The lowest address of the image. Sources are stored relative to it, so the image must be smaller than 4GiB.
+ - image_size      [in]  The size of the image in bytes. Immediates in ['image_base', 'image_base' + 'image_size') are references.
+ - boundary_bitmap [in]  A bitmap that marks the start of every instruction of the section(see nmd_x86_ldisasm_bulk() and nmd_x86_sweep_merge()),
+                         or null to sweep linearly from 'begin', skipping bytes that cannot be decoded one at a time.
+ - begin           [in]  The offset of the first byte of the range.
+ - end             [in]  The offset one past the last byte of the range. Instructions may extend past it.
+ - xrefs           [out] A pointer to an array of 'nmd_x86_xref' that receives the cross-references. May be null if 'max_xrefs' is zero.
+ - max_xrefs       [in]  The number of elements in 'xrefs'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_collect(const nmd_x86_code_section* section, uint64_t image_base, uint64_t image_size, const uint32_t* boundary_bitmap, size_t begin, size_t end, nmd_x86_xref* xrefs, size_t max_xrefs);
+
+/*
+Copies cross-references sorted by source and sorts the copy by target. Equal targets keep their order, so they stay sorted by source.
+Parameters:
+ - xrefs     [in]  A pointer to an array of cross-references sorted by source.
+ - num_xrefs [in]  The number of elements in 'xrefs'.
+ - sorted    [out] A pointer to an array of 'num_xrefs' elements that receives the sorted cross-references.
+ - workspace [in]  A pointer to an array of 'num_xrefs' elements used as temporary storage.
+*/
+NMD_ASSEMBLY_API void nmd_x86_xref_sort_by_target(const nmd_x86_xref* xrefs, size_t num_xrefs, nmd_x86_xref* sorted, nmd_x86_xref* workspace);
+
+/*
+Merges sorted runs(e.g. one per thread) into one array. Returns the number of cross-references.
+Parameters:
+ - runs      [in/out] A pointer to an array of runs, all sorted by source or all sorted by target. They are advanced past the merged elements, so they are empty on return.
+ - num_runs  [in]     The number of elements in 'runs'.
+ - by_target [in]     False if the runs are sorted by source, true if they are sorted by target.
+ - xrefs     [out]    A pointer to an array that receives the merged cross-references. It must be large enough for all of them.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_merge(nmd_x86_xref_run* runs, size_t num_runs, bool by_target, nmd_x86_xref* xrefs);
+
+/*
+Initializes an index over cross-references. The index points to the arrays, which must stay valid while it is used.
+Parameters:
+ - index      [out] A pointer to a variable of type 'nmd_x86_xref_index'.
+ - image_base [in]  The image base passed to nmd_x86_xref_collect().
+ - by_source  [in]  A pointer to the cross-references sorted by source.
+ - by_target  [in]  A pointer to the same cross-references sorted by target, see nmd_x86_xref_sort_by_target().
+ - num_xrefs  [in]  The number of elements of both arrays.
+*/
+NMD_ASSEMBLY_API void nmd_x86_xref_index_init(nmd_x86_xref_index* index, uint64_t image_base, const nmd_x86_xref* by_source, const nmd_x86_xref* by_target, size_t num_xrefs);
+
+/*
+Updates an index in place after the instructions that start in ['begin', 'end') of a section changed, e.g. with the range returned by
+nmd_x86_recursive_descent_patch(). The cross-references from the range are replaced by the ones collected again from it, which is the only
+decoding: they are spliced into 'by_source' and merged into 'by_target', moving the other elements without sorting them again. Decoding
+scales with the range, but the update is linear in the number of cross-references: 'by_target' is filtered and merged as a whole and the
+elements of 'by_source' after the range are moved. Returns false
+if the new cross-references don't fit in 'max_new_xrefs' or the result doesn't fit in 'max_xrefs', in which case nothing is modified.
+Parameters:
+ - index           [in/out] A pointer to an index initialized with 'by_source' and 'by_target'.
+ - section         [in]     A pointer to the section that contains the new bytes.
+ - image_size      [in]     The image size passed to nmd_x86_xref_collect().
+ - boundary_bitmap [in]     A bitmap that marks the start of every instruction of the section after the change, or null. See nmd_x86_xref_collect().
+ - begin           [in]     The offset of the first byte of the range.
+ - end             [in]     The offset one past the last byte of the range.
+ - by_source       [in/out] A pointer to the cross-references sorted by source that the index points to.
+ - by_target       [in/out] A pointer to the cross-references sorted by target that the index points to.
+ - max_xrefs       [in]     The number of elements of 'by_source' and of 'by_target'.
+ - workspace       [in]     A pointer to an array of '3 * max_new_xrefs' elements used as temporary storage.
+ - max_new_xrefs   [in]     The maximum number of cross-references from the range.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_xref_update(nmd_x86_xref_index* index, const nmd_x86_code_section* section, uint64_t image_size, const uint32_t* boundary_bitmap, size_t begin, size_t end, nmd_x86_xref* by_source, nmd_x86_xref* by_target, size_t max_xrefs, nmd_x86_xref* workspace, size_t max_new_xrefs);
+
+/*
+Finds the cross-references from the instruction at an address with a binary search. Returns their number.
+Parameters:
+ - index   [in]  A pointer to an index initialized by nmd_x86_xref_index_init().
+ - address [in]  The address of the instruction.
+ - xrefs   [out] A pointer to a variable that receives a pointer to the first cross-reference in 'by_source'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_find_from(const nmd_x86_xref_index* index, uint64_t address, const nmd_x86_xref** xrefs);
+
+/*
+Finds the cross-references to an address with a binary search(e.g. the callers of a function). Returns their number.
+Parameters:
+ - index   [in]  A pointer to an index initialized by nmd_x86_xref_index_init().
+ - address [in]  The referenced address.
+ - xrefs   [out] A pointer to a variable that receives a pointer to the first cross-reference in 'by_target'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_find_to(const nmd_x86_xref_index* index, uint64_t address, const nmd_x86_xref** xrefs);
+
+/*
+Finds the functions of a section in one linear sweep and a few passes over a map of one byte per offset. Function starts are the given entry
+points, the targets of relative calls, prologues and code after 'int3' padding that follow the end of the previous code(a return, a jump, 'hlt',
+'ud2' or padding), and the targets of jumps that leave the function they are in(tail calls), repeated until no start is added. A function ends
+before the padding that precedes the next start. Sections are independent, so each one can be analyzed by a different thread. Returns the number
+of functions, which may be larger than 'max_functions'; only the first 'max_functions' are stored, sorted by address.
+Parameters:
+ - section       [in]  A pointer to the section, see nmd_x86_elf_get_executable_sections() and nmd_x86_pe_get_executable_sections().
+ - entries       [in]  A pointer to an array of addresses known to be functions. Addresses outside the section are ignored. May be null if 'num_entries' is zero.
+ - num_entries   [in]  The number of elements in 'entries'.
+ - map           [in]  A pointer to an array of 'section->size' bytes used as temporary storage.
+ - functions     [out] A pointer to an array of 'nmd_x86_function' that receives the functions. May be null if 'max_functions' is zero.
+ - max_functions [in]  The number of elements in 'functions'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_find_functions(const nmd_x86_code_section* section, const uint64_t* entries, size_t num_entries, uint8_t* map, nmd_x86_function* functions, size_t max_functions);
+
+/*
+Recognizes the jump table of an indirect jump explored by a recursive descent. Starting at the jump, the instructions that fall through to it
+are decoded backwards(at most 16) to find how the target is computed: 'jmp [table+index*size]', 'mov target, [base+index*size+disp]; jmp target'
+or 'movsxd target, [base+index*4+disp]; add target, base; jmp target'(also with 'mov target32', whose entries are unsigned), the base register's
+'lea base, [rip+disp]' or 'lea base, [disp]', and the bounds check of the index: 'cmp index, imm' followed by 'ja' or 'jae'. Register to register
+moves of the index are followed. Returns true if the jump and its bounds check were recognized.
+Parameters:
+ - rd      [in]  A pointer to a recursive descent after nmd_x86_recursive_descent_run().
+ - address [in]  The runtime address of the recursive descent's buffer.
+ - offset  [in]  The offset of the indirect jump in the buffer.
+ - table   [out] A pointer to a variable of type 'nmd_x86_jump_table' that receives the table.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_resolve_jump_table(const nmd_x86_recursive_descent* rd, uint64_t address, size_t offset, nmd_x86_jump_table* table);
+
+/*
+Reads the targets of a jump table from the mapped image. Returns the number of entries that lie inside one of the regions, stopping at the
+end of the region that contains the table. Only the first 'max_targets' targets are stored.
+Parameters:
+ - table       [in]  A pointer to a table recognized by nmd_x86_resolve_jump_table().
+ - regions     [in]  A pointer to an array of regions of the image the table may be in, e.g. the sections returned by nmd_x86_elf_get_executable_sections()
+                     and the read-only data. Only 'code', 'size' and 'address' are used.
+ - num_regions [in]  The number of elements in 'regions'.
+ - targets     [out] A pointer to an array that receives the addresses. May be null if 'max_targets' is zero.
+ - max_targets [in]  The number of elements in 'targets'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_jump_table_read(const nmd_x86_jump_table* table, const nmd_x86_code_section* regions, size_t num_regions, uint64_t* targets, size_t max_targets);
+
+/*
+Runs a recursive descent and resolves the jump tables of the indirect jumps it finds. The targets of every table whose entries are all inside
+the regions are queued and the descent is run again, until the new code has no more tables. Resolved jumps end their block with
+'NMD_X86_BLOCK_END_JUMP_TABLE' in the code map, so they are not analyzed again. Indirect jumps that are not tables are remembered at the end of
+the queue(in up to half of it, the descent uses the rest), so they aren't analyzed again either. The first round scans the whole code map and
+the next ones only the range their descent explored. Only the few instructions before each indirect jump are decoded, the rest of the code is
+only visited through the code map. Returns the number of tables, which may be larger than 'max_tables'; only the first 'max_tables' are stored,
+in the order they were found.
+Parameters:
+ - rd          [in/out] A pointer to a variable initialized by nmd_x86_recursive_descent_init() whose entry points were added.
+ - address     [in]     The runtime address of the recursive descent's buffer.
+ - regions     [in]     A pointer to an array of regions of the image the tables may be in, see nmd_x86_jump_table_read().
+ - num_regions [in]     The number of elements in 'regions'.
+ - tables      [out]    A pointer to an array of 'nmd_x86_jump_table' that receives the tables. May be null if 'max_tables' is zero.
+ - max_tables  [in]     The number of elements in 'tables'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_recursive_descent_resolve_jump_tables(nmd_x86_recursive_descent* rd, uint64_t address, const nmd_x86_code_section* regions, size_t num_regions, nmd_x86_jump_table* tables, size_t max_tables);
+
+/*
+Returns a hash of a buffer, stored in a cache file to detect that the buffer changed since the file was saved. The bytes are combined eight
+at a time, so hashing is much faster than decoding, but the hash is not cryptographic.
+Parameters:
+ - buffer      [in] A pointer to the buffer.
+ - buffer_size [in] The buffer's size in bytes.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_cache_hash(const void* buffer, size_t buffer_size);
+
+/*
+Decodes the instructions of a code map once and stores a compact record of each one, sorted by offset. Returns the number of instructions,
+which may be larger than 'max_instructions'; only the first 'max_instructions' are stored.
+Parameters:
+ - buffer           [in]  A pointer to the buffer analyzed by the recursive descent.
+ - buffer_size      [in]  The buffer's size in bytes.
+ - mode             [in]  The architecture mode. Must be the same as in nmd_x86_recursive_descent_init().
+ - code_map         [in]  A pointer to the code map filled by nmd_x86_recursive_descent_run().
+ - instructions     [out] A pointer to an array of 'nmd_x86_cached_instruction' that receives the records. May be null if 'max_instructions' is zero.
+ - max_instructions [in]  The number of elements in 'instructions'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_cache_collect_instructions(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, nmd_x86_cached_instruction* instructions, size_t max_instructions);
+
+/*
+Writes the analysis of a buffer as a cache file: a 64-byte header followed by the instructions, the basic blocks and both arrays of
+cross-references, with the same sizes as in memory. Every field is little-endian regardless of the host. Returns the size of the file;
+nothing is written if it's larger than 'file_size', so the size can be queried with a 'file_size' of zero.
+Parameters:
+ - cache     [in]  A pointer to a variable of type 'nmd_x86_cache' that describes the analysis. 'source_hash' must be nmd_x86_cache_hash() of the buffer.
+ - file      [out] A pointer to a buffer that receives the file. May be null if 'file_size' is zero.
+ - file_size [in]  The size of 'file' in bytes.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_cache_save(const nmd_x86_cache* cache, void* file, size_t file_size);
+
+/*
+Opens a cache file written by nmd_x86_cache_save() in place: the header is checked and the arrays of 'cache' point into 'file', so nothing is
+copied or decoded and 'file' must stay valid while they are used. Map the file read-only(e.g. mmap() with 'PROT_READ' and 'MAP_PRIVATE') and
+pass the mapping; only the pages that are queried become resident. The arrays can be searched directly(the instructions and the blocks are
+sorted by offset, see nmd_x86_cache_find_instruction()) or passed to nmd_x86_xref_index_init() and nmd_x86_cfg_build(). The contents of the
+tables are not validated, only their bounds. Returns 'NMD_X86_CACHE_STATUS_OK' if the file can be used.
+Parameters:
+ - file        [in]  A pointer to the contents of the file, aligned to 8 bytes(a mapping is aligned to a page).
+ - file_size   [in]  The size of the file in bytes.
+ - source      [in]  A pointer to the current contents of the analyzed buffer, which is hashed to detect a stale file. May be null to skip the check.
+ - source_size [in]  The size of 'source' in bytes.
+ - cache       [out] A pointer to a variable of type 'nmd_x86_cache'.
+*/
+NMD_ASSEMBLY_API NMD_X86_CACHE_STATUS nmd_x86_cache_load(const void* file, size_t file_size, const void* source, size_t source_size, nmd_x86_cache* cache);
+
+/*
+Returns the record of the instruction that starts at 'address' with a binary search, or null if no instruction of the cache starts there.
+Parameters:
+ - cache   [in] A pointer to a variable filled by nmd_x86_cache_load().
+ - address [in] The instruction's runtime address.
+*/
+NMD_ASSEMBLY_API const nmd_x86_cached_instruction* nmd_x86_cache_find_instruction(const nmd_x86_cache* cache, uint64_t address);
+
+/*
+Initializes an interpreter of 64-bit code. The registers are zero and 'rflags' is 202h. Memory is accessed through 'translate', which returns the
+host address of a page of 4096 bytes. Translated blocks are stored in the given arrays; when one of them is full, all blocks are removed.
+Parameters:
+ - it           [out] A pointer to the interpreter.
+ - translate    [in]  A function that returns the host address of a page, see nmd_x86_page_table_translate().
+ - context      [in]  The first argument of 'translate'.
+ - blocks       [in]  A pointer to an array of 'nmd_x86_interpreter_block'.
+ - max_blocks   [in]  The number of elements in 'blocks'.
+ - uops         [in]  A pointer to an array of 'nmd_x86_micro_op'.
+ - max_uops     [in]  The number of elements in 'uops', at least 'NMD_X86_INTERPRETER_MIN_UOPS'.
+ - block_map    [in]  A pointer to an array of 'uint32_t' used as a hash table of the blocks.
+ - map_capacity [in]  The number of elements in 'block_map', a power of two larger than 'max_blocks'(twice as large is recommended).
+*/
+NMD_ASSEMBLY_API void nmd_x86_interpreter_init(nmd_x86_interpreter* it, nmd_x86_translate_page translate, void* context, nmd_x86_interpreter_block* blocks, size_t max_blocks, nmd_x86_micro_op* uops, size_t max_uops, uint32_t* block_map, size_t map_capacity);
+
+/*
+Executes instructions starting at 'it->rip' until 'max_instructions' instructions have been executed(checked when a block is left, so a few more
+may be executed) or an instruction can't be executed. Code is translated a basic block at a time into micro-ops with decoded operands, which are
+cached and executed with one indirect jump per instruction(computed goto when the compiler supports it). Blocks are chained: each branch remembers
+the block it went to last time. The status flags are computed lazily, and not at all when the flags an instruction writes are overwritten before
+being read. On return, 'it->rip' is the address of the next instruction to execute, or of the instruction that couldn't be executed.
+Parameters:
+ - it               [in] A pointer to the interpreter.
+ - max_instructions [in] The number of instructions to execute.
+*/
+NMD_ASSEMBLY_API NMD_X86_INTERPRETER_EXIT nmd_x86_interpreter_run(nmd_x86_interpreter* it, uint64_t max_instructions);
+
+/*
+Removes all translated blocks and the cached page translations. Call it after changing the code or the pages behind the interpreter's back,
+writes made by the interpreter itself are detected.
+Parameters:
+ - it [in] A pointer to the interpreter.
+*/
+NMD_ASSEMBLY_API void nmd_x86_interpreter_flush(nmd_x86_interpreter* it);
+
+/*
+Returns 'rflags' with the status flags computed from the last instruction that modified them.
+Parameters:
+ - it [in] A pointer to the interpreter.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_interpreter_get_flags(const nmd_x86_interpreter* it);
+
+/*
+Sets 'rflags'.
+Parameters:
+ - it    [in] A pointer to the interpreter.
+ - flags [in] The new value of 'rflags'.
+*/
+NMD_ASSEMBLY_API void nmd_x86_interpreter_set_flags(nmd_x86_interpreter* it, uint64_t flags);
+
+/*
+Returns the host address of the page at 'address' in a 'nmd_x86_page_table', or null if it's not mapped or 'write' is true and it's not writable.
+The pages are found with a binary search. Pass this function to nmd_x86_interpreter_init() with a pointer to the page table as the context.
+Parameters:
+ - page_table [in] A pointer to a 'nmd_x86_page_table' whose pages are sorted by address.
+ - address    [in] The address of the page, a multiple of 4096.
+ - write      [in] True if the page is written to.
+*/
+NMD_ASSEMBLY_API uint8_t* nmd_x86_page_table_translate(void* page_table, uint64_t address, bool write);
+
+/*
+Computes which registers and status flags are live(may be read before being written) before and after every instruction of the basic blocks.
+Each block is decoded once to find the registers its instructions read and write('regs_read', 'regs_written', 'tested_flags', 'modified_flags'
+and the other cpu flags), then a backward dataflow over the graph with a worklist finds the live registers at the boundaries of the blocks,
+and a last pass over the stored masks gives the ones of each instruction. Registers written partially(e.g. 'al') and conditionally('cmovcc')
+count as read. At returns, indirect jumps, traps, branches out of the buffer, calls and interrupts, the registers in 'exit_regs' and the flags
+in 'exit_flags' are live; 'NMD_X86_LIVENESS_REGS' and 'NMD_X86_LIVENESS_FLAGS' are the safe choice when the calling convention is unknown.
+Then nmd_x86_liveness_dead_registers() and nmd_x86_liveness_live_flags() answer in constant time for any offset. Returns the number of
+instructions.
+Parameters:
+ - buffer          [in]  A pointer to the buffer the blocks were built from.
+ - buffer_size     [in]  The size of the buffer in bytes.
+ - mode            [in]  The architecture mode. A member of 'NMD_X86_MODE'.
+ - blocks          [in]  A pointer to an array of blocks returned by nmd_x86_build_basic_blocks().
+ - cfg             [in]  A pointer to the graph of the blocks built by nmd_x86_cfg_build().
+ - exit_regs       [in]  A mask of the registers live where control leaves the known code. See 'NMD_X86_REG_MASK_XXX'.
+ - exit_flags      [in]  A mask of the flags live where control leaves the known code. See 'NMD_X86_LIVENESS_FLAGS'.
+ - block_liveness  [out] A pointer to an array of 'cfg->num_blocks' elements that receives the liveness at the boundaries of each block.
+ - instructions    [out] A pointer to an array with an element per instruction of the blocks(the sum of their 'num_instructions') that
+                         receives the liveness of each instruction, in the order of the blocks.
+ - instruction_map [out] A pointer to an array of 'buffer_size' elements that receives the index in 'instructions' of the instruction that starts
+                         at each offset, or 'NMD_X86_LIVENESS_NO_INSTRUCTION'.
+ - workspace       [in]  A pointer to an array of 'NMD_X86_LIVENESS_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_liveness_analyze(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const nmd_x86_basic_block* blocks, const nmd_x86_cfg* cfg, uint64_t exit_regs, uint32_t exit_flags, nmd_x86_block_liveness* block_liveness, nmd_x86_instruction_liveness* instructions, uint32_t* instruction_map, uint32_t* workspace);
+
+/*
+Returns a mask of the registers that are dead before the instruction at 'offset'(their value is never read), so instrumentation inserted there
+may use them as scratch registers. Returns zero if no instruction starts at 'offset'. Runs in constant time.
+Parameters:
+ - instructions    [in] A pointer to the instructions filled by nmd_x86_liveness_analyze().
+ - instruction_map [in] A pointer to the map filled by nmd_x86_liveness_analyze().
+ - offset          [in] The offset of an instruction in the buffer.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_liveness_dead_registers(const nmd_x86_instruction_liveness* instructions, const uint32_t* instruction_map, size_t offset);
+
+/*
+Returns a mask of the status flags that are live before the instruction at 'offset', zero if instrumentation inserted there may change the flags
+without saving them. Returns 'NMD_X86_LIVENESS_FLAGS' if no instruction starts at 'offset'. Runs in constant time.
+Parameters:
+ - instructions    [in] A pointer to the instructions filled by nmd_x86_liveness_analyze().
+ - instruction_map [in] A pointer to the map filled by nmd_x86_liveness_analyze().
+ - offset          [in] The offset of an instruction in the buffer.
+*/
+NMD_ASSEMBLY_API uint32_t nmd_x86_liveness_live_flags(const nmd_x86_instruction_liveness* instructions, const uint32_t* instruction_map, size_t offset);
+
 #endif /* NMD_ASSEMBLY_H */
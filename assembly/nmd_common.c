@@ -30,6 +30,109 @@
 /* Make sure we can read a byte, read a byte, increment the buffer and decrement the buffer's size */
 #define _NMD_READ_BYTE(buffer_, buffer_size_, var_) { if ((buffer_size_) < sizeof(uint8_t)) { return false; } var_ = *((uint8_t*)(buffer_)); buffer_ = ((uint8_t*)(buffer_)) + sizeof(uint8_t); (buffer_size_) -= sizeof(uint8_t); }
 
+/* Same as _NMD_READ_BYTE() but the bounds check is skipped if 'padded_' is true(see nmd_x86_decode_padded()). */
+#define _NMD_READ_BYTE_PADDED(padded_, buffer_, buffer_size_, var_) { if (!(padded_) && (buffer_size_) < sizeof(uint8_t)) { return false; } var_ = *((uint8_t*)(buffer_)); buffer_ = ((uint8_t*)(buffer_)) + sizeof(uint8_t); (buffer_size_) -= sizeof(uint8_t); }
+
+/* The maximum number of bytes an instruction can have after its prefixes(e.g. 0F 3A op + ModR/M + SIB + disp32 + imm8, or VEX3 + op + ModR/M + SIB + disp32 + imm8). */
+#define _NMD_X86_MAXIMUM_NON_PREFIX_LENGTH 11
+
+/* Forces a function to be inlined, so that constant arguments(e.g. 'padded') are propagated into its body. */
+#if defined(_MSC_VER)
+	#define _NMD_FORCE_INLINE static __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+	#define _NMD_FORCE_INLINE static __inline__ __attribute__((always_inline))
+#else
+	#define _NMD_FORCE_INLINE static
+#endif
+
+#ifdef NMD_ASSEMBLY_ENABLE_STATS
+/* Declares a variable that has one instance per thread. */
+#if defined(__cplusplus) && __cplusplus >= 201103L
+	#define _NMD_THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+	#define _NMD_THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+	#define _NMD_THREAD_LOCAL __declspec(thread)
+#else
+	#define _NMD_THREAD_LOCAL __thread
+#endif
+
+/* The counters of the calling thread. See nmd_x86_stats_snapshot(). */
+static _NMD_THREAD_LOCAL nmd_x86_stats _nmd_x86_stats;
+
+/* Counts an instruction rejected by the decoder for 'rule'(a member of 'NMD_X86_REJECTION') and returns false. */
+#define _NMD_REJECT(rule) do { _nmd_x86_stats.rejections[rule]++; _nmd_x86_stats.num_rejected++; return false; } while (0)
+
+/* Counts an instruction rejected by the length disassembler for 'rule'(a member of 'NMD_X86_REJECTION') and returns zero. */
+#define _NMD_LDISASM_REJECT(rule) do { _nmd_x86_stats.ldisasm_rejections[rule]++; return 0; } while (0)
+
+/* Counts a valid instruction returned by the decoder. */
+#define _NMD_COUNT_DECODED(instruction) _nmd_x86_stats_count_decoded(instruction)
+
+/* Counts a length returned by the length disassembler and evaluates to it. */
+#define _NMD_COUNT_LENGTH(length) _nmd_x86_stats_count_length(length)
+#else
+#define _NMD_REJECT(rule) return false
+#define _NMD_LDISASM_REJECT(rule) return 0
+#define _NMD_COUNT_DECODED(instruction)
+#define _NMD_COUNT_LENGTH(length) (length)
+#endif /* NMD_ASSEMBLY_ENABLE_STATS */
+
+/* Same as _NMD_READ_BYTE_PADDED() but a read past the end of the buffer is counted as a truncated instruction. Used by the decoder. */
+#define _NMD_DECODER_READ_BYTE_PADDED(padded_, buffer_, buffer_size_, var_) { if (!(padded_) && (buffer_size_) < sizeof(uint8_t)) { _NMD_REJECT(NMD_X86_REJECTION_TRUNCATED); } var_ = *((uint8_t*)(buffer_)); buffer_ = ((uint8_t*)(buffer_)) + sizeof(uint8_t); (buffer_size_) -= sizeof(uint8_t); }
+
+/* Same as _NMD_READ_BYTE_PADDED() but a read past the end of the buffer is counted as a truncated instruction. Used by the length disassembler. */
+#define _NMD_LDISASM_READ_BYTE_PADDED(padded_, buffer_, buffer_size_, var_) { if (!(padded_) && (buffer_size_) < sizeof(uint8_t)) { _NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED); } var_ = *((uint8_t*)(buffer_)); buffer_ = ((uint8_t*)(buffer_)) + sizeof(uint8_t); (buffer_size_) -= sizeof(uint8_t); }
+
+/* SSE2/AVX2 intrinsics used by nmd_x86_ldisasm_bulk(). They are only included when the compiler targets these instruction sets. */
+#ifndef NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_SIMD
+	#if defined(__AVX2__)
+		#define _NMD_AVX2
+		#include <immintrin.h>
+	#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define _NMD_SSE2
+		#include <emmintrin.h>
+	#endif
+#endif
+
+#ifndef _NMD_OPCODE_MODRM
+/* Properties of an opcode. See 'x86_opcodes.txt' */
+typedef struct _nmd_x86_opcode_properties
+{
+	uint16_t id;    /* A member of 'NMD_X86_INSTRUCTION'. Only valid if '_NMD_OPCODE_DECODER_ID' is not set. */
+	uint8_t flags;  /* A mask of '_NMD_OPCODE_XXX'. */
+	uint8_t imm;    /* A member of '_NMD_OPCODE_IMM_XXX'. */
+	uint8_t simd;   /* A mask of '_NMD_SIMD_XXX' that specifies the SIMD prefixes the instruction is valid with. Only valid if '_NMD_OPCODE_DECODER_VALIDITY' is not set(0F38 and 0F3A maps). */
+	uint8_t group;  /* A member of 'NMD_GROUP'. Only valid if '_NMD_OPCODE_DECODER_GROUP' is not set. */
+} _nmd_x86_opcode_properties;
+
+#define _NMD_OPCODE_MODRM            (1 << 0) /* The instruction has a ModR/M byte. */
+#define _NMD_OPCODE_MEMORY_ONLY      (1 << 1) /* The instruction is only valid with a memory operand(mod != 0b11). */
+#define _NMD_OPCODE_DECODER_VALIDITY (1 << 2) /* The validity depends on more than the opcode and is checked by the decoder. */
+#define _NMD_OPCODE_DECODER_ID       (1 << 3) /* The id depends on more than the opcode and is computed by the decoder. */
+#define _NMD_OPCODE_DECODER_GROUP    (1 << 4) /* The group depends on more than the opcode and is computed by the decoder. */
+
+#define _NMD_OPCODE_IMM_NONE  0
+#define _NMD_OPCODE_IMM_IB    1  /* imm8 */
+#define _NMD_OPCODE_IMM_IW    2  /* imm16 */
+#define _NMD_OPCODE_IMM_IZ    3  /* imm16/32 */
+#define _NMD_OPCODE_IMM_IV    4  /* imm16/32/64 */
+#define _NMD_OPCODE_IMM_JZ    5  /* rel16/32, rel32 in 64-bit mode */
+#define _NMD_OPCODE_IMM_MOFFS 6  /* moffs16/32/64 */
+#define _NMD_OPCODE_IMM_FAR   7  /* ptr16:16/32 */
+#define _NMD_OPCODE_IMM_ENTER 8  /* imm16 + imm8 */
+#define _NMD_OPCODE_IMM_GRP3  9  /* F6h,F7h: depends on ModR/M.reg */
+#define _NMD_OPCODE_IMM_EXTRQ 10 /* imm8 + imm8 with 66h or F2h */
+
+#define _NMD_SIMD_NP (1 << 0)
+#define _NMD_SIMD_66 (1 << 1)
+#define _NMD_SIMD_F3 (1 << 2)
+#define _NMD_SIMD_F2 (1 << 3)
+
+/* Converts 'simd_prefix' to a member of '_NMD_SIMD_XXX', or zero if it's the lock prefix. */
+#define _NMD_GET_SIMD_MASK(simd_prefix) ((simd_prefix) == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE ? _NMD_SIMD_66 : ((simd_prefix) == NMD_X86_PREFIXES_REPEAT ? _NMD_SIMD_F3 : ((simd_prefix) == NMD_X86_PREFIXES_REPEAT_NOT_ZERO ? _NMD_SIMD_F2 : ((simd_prefix) ? 0 : _NMD_SIMD_NP))))
+#endif /* _NMD_OPCODE_MODRM */
+
 NMD_ASSEMBLY_API const char* const _nmd_reg8[] = { "al", "cl", "dl", "bl", "ah", "ch", "dh", "bh" };
 NMD_ASSEMBLY_API const char* const _nmd_reg8_x64[] = { "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil" };
 NMD_ASSEMBLY_API const char* const _nmd_reg16[] = { "ax", "cx", "dx", "bx", "sp", "bp", "si", "di" };
@@ -643,16 +643,15 @@ NMD_ASSEMBLY_API size_t _nmd_assemble_single(_nmd_assemble_info* ai)
     NMD_X86_REG reg, reg2;
 	size_t i = 0;
 
-	/* Parse prefixes */
-	bool lock_prefix = false, repeat_prefix = false, repeat_zero_prefix = false, repeat_not_zero_prefix = false;
+	/* Skip prefixes. They are not encoded yet. */
 	if (_nmd_strstr(ai->s, "lock ") == ai->s)
-		lock_prefix = true, ai->s += 5;
+		ai->s += 5;
 	else if (_nmd_strstr(ai->s, "rep ") == ai->s)
-		repeat_prefix = true, ai->s += 4;
+		ai->s += 4;
 	else if (_nmd_strstr(ai->s, "repe ") == ai->s || _nmd_strstr(ai->s, "repz ") == ai->s)
-		repeat_zero_prefix = true, ai->s += 5;
+		ai->s += 5;
 	else if (_nmd_strstr(ai->s, "repne ") == ai->s || _nmd_strstr(ai->s, "repnz ") == ai->s)
-		repeat_not_zero_prefix = true, ai->s += 6;
+		ai->s += 6;
 	
 	if (_nmd_strstr(ai->s, "xacquire ") == ai->s)
 	{
@@ -0,0 +1,276 @@
+#include "nmd_common.h"
+
+/* The records only need the operands' types besides what the recursive descent decodes. */
+#define _NMD_CACHE_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_GROUP | NMD_X86_DECODER_FLAGS_OPERANDS)
+
+/* The layout of a cache file. Every field is little-endian and every table starts at a multiple of 8 bytes. */
+#define _NMD_CACHE_HEADER_SIZE      64
+#define _NMD_CACHE_INSTRUCTION_SIZE 12
+#define _NMD_CACHE_BLOCK_SIZE       20
+#define _NMD_CACHE_XREF_SIZE        16
+
+#define _NMD_CACHE_ALIGN(offset) (((offset) + 7) & ~(uint64_t)7)
+
+/* Writes a little-endian integer of 'size' bytes at 'p'. */
+_NMD_FORCE_INLINE void _nmd_x86_write_le(uint8_t* p, uint64_t value, size_t size)
+{
+	size_t i;
+	for (i = 0; i < size; i++, value >>= 8)
+		p[i] = (uint8_t)value;
+}
+
+/* Returns true if the host stores the tables of a cache file like the file does, so they can be used in place. */
+_NMD_FORCE_INLINE bool _nmd_x86_cache_is_native(void)
+{
+	const uint16_t one = 1;
+	return *(const uint8_t*)&one == 1 && sizeof(nmd_x86_cached_instruction) == _NMD_CACHE_INSTRUCTION_SIZE && sizeof(nmd_x86_basic_block) == _NMD_CACHE_BLOCK_SIZE && sizeof(nmd_x86_xref) == _NMD_CACHE_XREF_SIZE;
+}
+
+/* Computes the offsets of the tables of a cache file from the number of elements. Returns the size of the file. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_cache_layout(uint64_t num_instructions, uint64_t num_blocks, uint64_t num_xrefs, uint64_t* blocks, uint64_t* by_source, uint64_t* by_target)
+{
+	*blocks = _NMD_CACHE_ALIGN(_NMD_CACHE_HEADER_SIZE + num_instructions * _NMD_CACHE_INSTRUCTION_SIZE);
+	*by_source = _NMD_CACHE_ALIGN(*blocks + num_blocks * _NMD_CACHE_BLOCK_SIZE);
+	*by_target = *by_source + num_xrefs * _NMD_CACHE_XREF_SIZE;
+	return *by_target + num_xrefs * _NMD_CACHE_XREF_SIZE;
+}
+
+/* Writes 'num_xrefs' cross-references at 'p'. */
+_NMD_FORCE_INLINE void _nmd_x86_cache_write_xrefs(uint8_t* p, const nmd_x86_xref* xrefs, size_t num_xrefs)
+{
+	size_t i;
+	for (i = 0; i < num_xrefs; i++, p += _NMD_CACHE_XREF_SIZE)
+	{
+		_nmd_x86_write_le(p, xrefs[i].target, 8);
+		_nmd_x86_write_le(p + 8, xrefs[i].source, 4);
+		_nmd_x86_write_le(p + 12, xrefs[i].type, 4);
+	}
+}
+
+/*
+Returns a hash of a buffer, stored in a cache file to detect that the buffer changed since the file was saved. The bytes are combined eight
+at a time, so hashing is much faster than decoding, but the hash is not cryptographic.
+Parameters:
+ - buffer      [in] A pointer to the buffer.
+ - buffer_size [in] The buffer's size in bytes.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_cache_hash(const void* buffer, size_t buffer_size)
+{
+	const uint8_t* b = (const uint8_t*)buffer;
+	uint64_t hash = 0xcbf29ce484222325 ^ (uint64_t)buffer_size;
+	size_t remaining = buffer_size;
+
+	for (; remaining >= 8; remaining -= 8, b += 8)
+	{
+		hash = (hash ^ _nmd_x86_read_le(b, 8)) * 0x9e3779b97f4a7c15;
+		hash ^= hash >> 32;
+	}
+
+	if (remaining)
+	{
+		hash = (hash ^ _nmd_x86_read_le(b, remaining)) * 0x9e3779b97f4a7c15;
+		hash ^= hash >> 32;
+	}
+
+	hash *= 0xff51afd7ed558ccd;
+	return hash ^ (hash >> 33);
+}
+
+/*
+Decodes the instructions of a code map once and stores a compact record of each one, sorted by offset. Returns the number of instructions,
+which may be larger than 'max_instructions'; only the first 'max_instructions' are stored.
+Parameters:
+ - buffer           [in]  A pointer to the buffer analyzed by the recursive descent.
+ - buffer_size      [in]  The buffer's size in bytes.
+ - mode             [in]  The architecture mode. Must be the same as in nmd_x86_recursive_descent_init().
+ - code_map         [in]  A pointer to the code map filled by nmd_x86_recursive_descent_run().
+ - instructions     [out] A pointer to an array of 'nmd_x86_cached_instruction' that receives the records. May be null if 'max_instructions' is zero.
+ - max_instructions [in]  The number of elements in 'instructions'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_cache_collect_instructions(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, nmd_x86_cached_instruction* instructions, size_t max_instructions)
+{
+	const uint8_t* const b = (const uint8_t*)buffer;
+	nmd_x86_instruction instruction;
+	nmd_x86_cached_instruction* record;
+	size_t offset, i, num_instructions = 0;
+	bool valid;
+
+	for (offset = 0; offset < buffer_size; offset++)
+	{
+		if (!(code_map[offset] & NMD_X86_CODE_MAP_LENGTH_MASK))
+			continue;
+
+		if (num_instructions < max_instructions)
+		{
+			if (buffer_size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+				valid = nmd_x86_decode_padded(b + offset, &instruction, mode, _NMD_CACHE_DECODER_FLAGS);
+			else
+				valid = nmd_x86_decode(b + offset, buffer_size - offset, &instruction, mode, _NMD_CACHE_DECODER_FLAGS);
+
+			/* The code map only stores the length of valid instructions. */
+			if (!valid)
+				continue;
+
+			record = &instructions[num_instructions];
+			record->offset = (uint32_t)offset;
+			record->id = instruction.id;
+			record->length = instruction.length;
+			record->group = instruction.group;
+			record->num_operands = instruction.num_operands;
+			record->operand_types = 0;
+			record->implicit_operands = 0;
+			for (i = 0; i < instruction.num_operands && i < 8; i++)
+			{
+				record->operand_types |= (uint16_t)(instruction.operands[i].type << (2 * i));
+				if (instruction.operands[i].is_implicit)
+					record->implicit_operands |= (uint8_t)(1 << i);
+			}
+		}
+
+		num_instructions++;
+	}
+
+	return num_instructions;
+}
+
+/*
+Writes the analysis of a buffer as a cache file: a 64-byte header followed by the instructions, the basic blocks and both arrays of
+cross-references, with the same sizes as in memory. Every field is little-endian regardless of the host. Returns the size of the file;
+nothing is written if it's larger than 'file_size', so the size can be queried with a 'file_size' of zero.
+Parameters:
+ - cache     [in]  A pointer to a variable of type 'nmd_x86_cache' that describes the analysis. 'source_hash' must be nmd_x86_cache_hash() of the buffer.
+ - file      [out] A pointer to a buffer that receives the file. May be null if 'file_size' is zero.
+ - file_size [in]  The size of 'file' in bytes.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_cache_save(const nmd_x86_cache* cache, void* file, size_t file_size)
+{
+	uint8_t* const f = (uint8_t*)file;
+	uint8_t* p;
+	uint64_t blocks, by_source, by_target;
+	const uint64_t size = _nmd_x86_cache_layout(cache->num_instructions, cache->num_blocks, cache->num_xrefs, &blocks, &by_source, &by_target);
+	size_t i;
+
+	if (size > file_size)
+		return (size_t)size;
+
+	for (i = 0; i < _NMD_CACHE_HEADER_SIZE; i++)
+		f[i] = 0;
+	f[0] = 'N', f[1] = 'M', f[2] = 'D', f[3] = 'C';
+	_nmd_x86_write_le(f + 4, NMD_X86_CACHE_VERSION, 4);
+	_nmd_x86_write_le(f + 8, size, 8);
+	_nmd_x86_write_le(f + 16, cache->source_hash, 8);
+	_nmd_x86_write_le(f + 24, cache->source_size, 8);
+	_nmd_x86_write_le(f + 32, cache->address, 8);
+	_nmd_x86_write_le(f + 40, cache->num_instructions, 4);
+	_nmd_x86_write_le(f + 44, cache->num_blocks, 4);
+	_nmd_x86_write_le(f + 48, cache->num_xrefs, 4);
+	f[52] = cache->mode;
+
+	/* The padding between the tables is zeroed too, so the same analysis always produces the same file. */
+	for (i = _NMD_CACHE_HEADER_SIZE; i < by_source; i++)
+		f[i] = 0;
+
+	p = f + _NMD_CACHE_HEADER_SIZE;
+	for (i = 0; i < cache->num_instructions; i++, p += _NMD_CACHE_INSTRUCTION_SIZE)
+	{
+		_nmd_x86_write_le(p, cache->instructions[i].offset, 4);
+		_nmd_x86_write_le(p + 4, cache->instructions[i].id, 2);
+		_nmd_x86_write_le(p + 6, cache->instructions[i].operand_types, 2);
+		p[8] = cache->instructions[i].length;
+		p[9] = cache->instructions[i].group;
+		p[10] = cache->instructions[i].num_operands;
+		p[11] = cache->instructions[i].implicit_operands;
+	}
+
+	p = f + blocks;
+	for (i = 0; i < cache->num_blocks; i++, p += _NMD_CACHE_BLOCK_SIZE)
+	{
+		_nmd_x86_write_le(p, cache->blocks[i].begin, 4);
+		_nmd_x86_write_le(p + 4, cache->blocks[i].end, 4);
+		_nmd_x86_write_le(p + 8, cache->blocks[i].successors[0], 4);
+		_nmd_x86_write_le(p + 12, cache->blocks[i].successors[1], 4);
+		_nmd_x86_write_le(p + 16, cache->blocks[i].num_instructions, 2);
+		_nmd_x86_write_le(p + 18, cache->blocks[i].type, 2);
+	}
+
+	_nmd_x86_cache_write_xrefs(f + by_source, cache->xrefs_by_source, cache->num_xrefs);
+	_nmd_x86_cache_write_xrefs(f + by_target, cache->xrefs_by_target, cache->num_xrefs);
+
+	return (size_t)size;
+}
+
+/*
+Opens a cache file written by nmd_x86_cache_save() in place: the header is checked and the arrays of 'cache' point into 'file', so nothing is
+copied or decoded and 'file' must stay valid while they are used. Map the file read-only(e.g. mmap() with 'PROT_READ' and 'MAP_PRIVATE') and
+pass the mapping; only the pages that are queried become resident. The arrays can be searched directly(the instructions and the blocks are
+sorted by offset, see nmd_x86_cache_find_instruction()) or passed to nmd_x86_xref_index_init() and nmd_x86_cfg_build(). The contents of the
+tables are not validated, only their bounds. Returns 'NMD_X86_CACHE_STATUS_OK' if the file can be used.
+Parameters:
+ - file        [in]  A pointer to the contents of the file, aligned to 8 bytes(a mapping is aligned to a page).
+ - file_size   [in]  The size of the file in bytes.
+ - source      [in]  A pointer to the current contents of the analyzed buffer, which is hashed to detect a stale file. May be null to skip the check.
+ - source_size [in]  The size of 'source' in bytes.
+ - cache       [out] A pointer to a variable of type 'nmd_x86_cache'.
+*/
+NMD_ASSEMBLY_API NMD_X86_CACHE_STATUS nmd_x86_cache_load(const void* file, size_t file_size, const void* source, size_t source_size, nmd_x86_cache* cache)
+{
+	const uint8_t* const f = (const uint8_t*)file;
+	uint64_t blocks, by_source, by_target, size;
+
+	if (file_size < _NMD_CACHE_HEADER_SIZE || f[0] != 'N' || f[1] != 'M' || f[2] != 'D' || f[3] != 'C')
+		return NMD_X86_CACHE_STATUS_INVALID;
+
+	if (_nmd_x86_read_le(f + 4, 4) != NMD_X86_CACHE_VERSION)
+		return NMD_X86_CACHE_STATUS_VERSION;
+
+	cache->source_hash = _nmd_x86_read_le(f + 16, 8);
+	cache->source_size = _nmd_x86_read_le(f + 24, 8);
+	cache->address = _nmd_x86_read_le(f + 32, 8);
+	cache->num_instructions = (size_t)_nmd_x86_read_le(f + 40, 4);
+	cache->num_blocks = (size_t)_nmd_x86_read_le(f + 44, 4);
+	cache->num_xrefs = (size_t)_nmd_x86_read_le(f + 48, 4);
+	cache->mode = f[52];
+
+	size = _nmd_x86_cache_layout(cache->num_instructions, cache->num_blocks, cache->num_xrefs, &blocks, &by_source, &by_target);
+	if (_nmd_x86_read_le(f + 8, 8) != size || size > file_size)
+		return NMD_X86_CACHE_STATUS_INVALID;
+
+	if (source && (source_size != cache->source_size || nmd_x86_cache_hash(source, source_size) != cache->source_hash))
+		return NMD_X86_CACHE_STATUS_STALE;
+
+	if (!_nmd_x86_cache_is_native() || ((size_t)f & 7))
+		return NMD_X86_CACHE_STATUS_UNSUPPORTED;
+
+	cache->instructions = (const nmd_x86_cached_instruction*)(f + _NMD_CACHE_HEADER_SIZE);
+	cache->blocks = (const nmd_x86_basic_block*)(f + blocks);
+	cache->xrefs_by_source = (const nmd_x86_xref*)(f + by_source);
+	cache->xrefs_by_target = (const nmd_x86_xref*)(f + by_target);
+
+	return NMD_X86_CACHE_STATUS_OK;
+}
+
+/*
+Returns the record of the instruction that starts at 'address' with a binary search, or null if no instruction of the cache starts there.
+Parameters:
+ - cache   [in] A pointer to a variable filled by nmd_x86_cache_load().
+ - address [in] The instruction's runtime address.
+*/
+NMD_ASSEMBLY_API const nmd_x86_cached_instruction* nmd_x86_cache_find_instruction(const nmd_x86_cache* cache, uint64_t address)
+{
+	size_t low = 0, high = cache->num_instructions, middle;
+	const uint64_t offset = address - cache->address;
+
+	if (address < cache->address || offset >= cache->source_size)
+		return 0;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (cache->instructions[middle].offset < offset)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low < cache->num_instructions && cache->instructions[low].offset == offset ? &cache->instructions[low] : 0;
+}
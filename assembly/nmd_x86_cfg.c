@@ -0,0 +1,321 @@
+#include "nmd_common.h"
+
+/* Marks a node that is on the depth-first search's stack. */
+#define _NMD_CFG_VISITING 0xfffffffe
+
+/*
+Numbers the nodes reachable from 'root' in postorder using an iterative depth-first search along 'edges'. If 'root' is 'num_nodes' it's a
+virtual root whose children are the nodes without edges in 'other_offsets'(e.g. the exit blocks when searching along the predecessors).
+Returns the number of nodes reached, including 'root'. Nodes that aren't reached have 'NMD_X86_INVALID_BLOCK' as their number.
+*/
+NMD_ASSEMBLY_API size_t _nmd_x86_cfg_postorder(size_t num_nodes, uint32_t root, const uint32_t* edge_offsets, const uint32_t* edges, const uint32_t* other_offsets, uint32_t* postorder_number, uint32_t* order, uint32_t* stack, uint32_t* cursor)
+{
+	size_t i, count = 0, depth = 1;
+	uint32_t node, child;
+
+	for (i = 0; i <= num_nodes; i++)
+		postorder_number[i] = NMD_X86_INVALID_BLOCK;
+
+	stack[0] = root;
+	cursor[0] = 0;
+	postorder_number[root] = _NMD_CFG_VISITING;
+
+	while (depth > 0)
+	{
+		node = stack[depth - 1];
+		child = NMD_X86_INVALID_BLOCK;
+
+		if (node == num_nodes)
+		{
+			while (cursor[depth - 1] < num_nodes && other_offsets[cursor[depth - 1] + 1] != other_offsets[cursor[depth - 1]])
+				cursor[depth - 1]++;
+			if (cursor[depth - 1] < num_nodes)
+				child = cursor[depth - 1]++;
+		}
+		else if (edge_offsets[node] + cursor[depth - 1] < edge_offsets[node + 1])
+			child = edges[edge_offsets[node] + cursor[depth - 1]++];
+
+		if (child == NMD_X86_INVALID_BLOCK)
+		{
+			postorder_number[node] = (uint32_t)count;
+			order[count++] = node;
+			depth--;
+		}
+		else if (postorder_number[child] == NMD_X86_INVALID_BLOCK)
+		{
+			postorder_number[child] = _NMD_CFG_VISITING;
+			stack[depth] = child;
+			cursor[depth] = 0;
+			depth++;
+		}
+	}
+
+	return count;
+}
+
+/*
+Computes the immediate dominators of the nodes reachable from 'root' along 'out_edges' using the iterative algorithm by Cooper, Harvey and Kennedy
+("A Simple, Fast Dominance Algorithm"). 'in_edges' are the edges in the opposite direction. If 'root' is 'num_nodes' it's a virtual root(see
+_nmd_x86_cfg_postorder()) and nodes immediately dominated by it receive 'NMD_X86_CFG_EXIT'.
+*/
+NMD_ASSEMBLY_API void _nmd_x86_cfg_compute_dominators(size_t num_nodes, uint32_t root, const uint32_t* out_offsets, const uint32_t* out_edges, const uint32_t* in_offsets, const uint32_t* in_edges, uint32_t* idom, uint32_t* workspace)
+{
+	uint32_t* const postorder_number = workspace;
+	uint32_t* const order = workspace + num_nodes + 1;
+	const size_t count = _nmd_x86_cfg_postorder(num_nodes, root, out_offsets, out_edges, in_offsets, postorder_number, order, workspace + 2 * (num_nodes + 1), workspace + 3 * (num_nodes + 1));
+	size_t i, k;
+	bool changed = true;
+
+	for (i = 0; i < num_nodes; i++)
+		idom[i] = NMD_X86_INVALID_BLOCK;
+	if (root < num_nodes)
+		idom[root] = root;
+
+	while (changed)
+	{
+		changed = false;
+
+		/* Visit the nodes in reverse postorder, skipping the root(the last node in postorder) */
+		for (k = count - 1; k-- > 0;)
+		{
+			const uint32_t node = order[k];
+			uint32_t new_idom = NMD_X86_INVALID_BLOCK, predecessor;
+
+			for (i = in_offsets[node]; i <= in_offsets[node + 1]; i++)
+			{
+				if (i < in_offsets[node + 1])
+					predecessor = in_edges[i];
+				else if (root == num_nodes && in_offsets[node + 1] == in_offsets[node])
+					predecessor = root; /* The virtual root precedes the nodes without edges */
+				else
+					break;
+
+				/* Skip predecessors that are unreachable or weren't processed yet */
+				if (postorder_number[predecessor] == NMD_X86_INVALID_BLOCK || (predecessor != root && idom[predecessor] == NMD_X86_INVALID_BLOCK))
+					continue;
+
+				if (new_idom == NMD_X86_INVALID_BLOCK)
+					new_idom = predecessor;
+				else
+				{
+					/* Intersect: walk up the dominator tree from both nodes until they meet */
+					uint32_t a = predecessor, b = new_idom;
+					while (a != b)
+					{
+						while (postorder_number[a] < postorder_number[b])
+							a = idom[a];
+						while (postorder_number[b] < postorder_number[a])
+							b = idom[b];
+					}
+					new_idom = a;
+				}
+			}
+
+			if (idom[node] != new_idom)
+			{
+				idom[node] = new_idom;
+				changed = true;
+			}
+		}
+	}
+
+	if (root == num_nodes)
+	{
+		for (i = 0; i < num_nodes; i++)
+		{
+			if (idom[i] == num_nodes)
+				idom[i] = NMD_X86_CFG_EXIT;
+		}
+	}
+}
+
+/*
+Builds a control flow graph in compressed sparse row form from basic blocks. Every block has at most two successors, so the graph needs
+'NMD_X86_CFG_MEMORY_SIZE(num_blocks)' elements of memory. Predecessors are sorted by index. Duplicate edges(e.g. a conditional branch to the
+next block) are stored once.
+Parameters:
+ - cfg        [out] A pointer to a variable of type 'nmd_x86_cfg'.
+ - blocks     [in]  A pointer to an array of blocks returned by nmd_x86_build_basic_blocks().
+ - num_blocks [in]  The number of blocks.
+ - memory     [in]  A pointer to an array of 'NMD_X86_CFG_MEMORY_SIZE(num_blocks)' elements that receives the graph. It must live as long as 'cfg'.
+*/
+NMD_ASSEMBLY_API void nmd_x86_cfg_build(nmd_x86_cfg* cfg, const nmd_x86_basic_block* blocks, size_t num_blocks, uint32_t* memory)
+{
+	size_t i, k, num_edges = 0;
+	uint32_t successor;
+
+	cfg->num_blocks = (uint32_t)num_blocks;
+	cfg->successor_offsets = memory;
+	cfg->predecessor_offsets = memory + num_blocks + 1;
+	cfg->successors = memory + 2 * (num_blocks + 1);
+	cfg->predecessors = cfg->successors + 2 * num_blocks;
+
+	for (i = 0; i <= num_blocks; i++)
+		cfg->predecessor_offsets[i] = 0;
+
+	/* Successors, counting the predecessors of every block at the same time */
+	for (i = 0; i < num_blocks; i++)
+	{
+		cfg->successor_offsets[i] = (uint32_t)num_edges;
+		for (k = 0; k < 2; k++)
+		{
+			successor = blocks[i].successors[k];
+			if (successor == NMD_X86_INVALID_BLOCK || successor >= num_blocks || (k == 1 && successor == blocks[i].successors[0]))
+				continue;
+
+			cfg->successors[num_edges++] = successor;
+			cfg->predecessor_offsets[successor + 1]++;
+		}
+	}
+	cfg->successor_offsets[num_blocks] = (uint32_t)num_edges;
+	cfg->num_edges = (uint32_t)num_edges;
+
+	/* Predecessors: turn the counts into offsets, fill using the offsets as cursors, then shift the cursors back */
+	for (i = 0; i < num_blocks; i++)
+		cfg->predecessor_offsets[i + 1] += cfg->predecessor_offsets[i];
+
+	for (i = 0; i < num_blocks; i++)
+	{
+		for (k = cfg->successor_offsets[i]; k < cfg->successor_offsets[i + 1]; k++)
+			cfg->predecessors[cfg->predecessor_offsets[cfg->successors[k]]++] = (uint32_t)i;
+	}
+
+	for (i = num_blocks; i > 0; i--)
+		cfg->predecessor_offsets[i] = cfg->predecessor_offsets[i - 1];
+	cfg->predecessor_offsets[0] = 0;
+}
+
+/*
+Computes the dominator tree of the blocks reachable from 'entry'. 'idom[i]' receives the immediate dominator of block 'i', 'idom[entry]' is
+'entry' and blocks that are not reachable receive 'NMD_X86_INVALID_BLOCK'.
+Parameters:
+ - cfg       [in]  A pointer to a graph built by nmd_x86_cfg_build().
+ - entry     [in]  The index of the entry block(e.g. a function's first block).
+ - idom      [out] A pointer to an array of 'cfg->num_blocks' elements that receives the immediate dominators.
+ - workspace [in]  A pointer to an array of 'NMD_X86_CFG_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API void nmd_x86_cfg_dominators(const nmd_x86_cfg* cfg, uint32_t entry, uint32_t* idom, uint32_t* workspace)
+{
+	_nmd_x86_cfg_compute_dominators(cfg->num_blocks, entry, cfg->successor_offsets, cfg->successors, cfg->predecessor_offsets, cfg->predecessors, idom, workspace);
+}
+
+/*
+Computes the post-dominator tree. All blocks without successors(returns, traps, indirect jumps...) are connected to a virtual exit node.
+'ipdom[i]' receives the immediate post-dominator of block 'i', 'NMD_X86_CFG_EXIT' if it's the virtual exit, or 'NMD_X86_INVALID_BLOCK'
+if block 'i' can't reach an exit(e.g. an infinite loop).
+Parameters:
+ - cfg       [in]  A pointer to a graph built by nmd_x86_cfg_build().
+ - ipdom     [out] A pointer to an array of 'cfg->num_blocks' elements that receives the immediate post-dominators.
+ - workspace [in]  A pointer to an array of 'NMD_X86_CFG_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API void nmd_x86_cfg_post_dominators(const nmd_x86_cfg* cfg, uint32_t* ipdom, uint32_t* workspace)
+{
+	_nmd_x86_cfg_compute_dominators(cfg->num_blocks, cfg->num_blocks, cfg->predecessor_offsets, cfg->predecessors, cfg->successor_offsets, cfg->successors, ipdom, workspace);
+}
+
+/*
+Returns true if block 'a' dominates block 'b'(every block dominates itself). Works with post-dominators as well.
+Parameters:
+ - idom [in] A pointer to the immediate dominators computed by nmd_x86_cfg_dominators() or nmd_x86_cfg_post_dominators().
+ - a    [in] The index of the dominating block.
+ - b    [in] The index of the dominated block.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_cfg_dominates(const uint32_t* idom, uint32_t a, uint32_t b)
+{
+	while (b != a)
+	{
+		if (b == NMD_X86_INVALID_BLOCK || b == NMD_X86_CFG_EXIT || idom[b] == b)
+			return false;
+		b = idom[b];
+	}
+
+	return true;
+}
+
+/*
+Finds the natural loops of the blocks reachable from 'entry'. An edge from 'latch' to 'header' where 'header' dominates 'latch' is a back edge,
+and its loop consists of the header and the blocks that reach the latch without passing through the header. Loops with the same header are
+merged. Returns the number of loops.
+Parameters:
+ - cfg         [in]  A pointer to a graph built by nmd_x86_cfg_build().
+ - entry       [in]  The index of the entry block. Must be the same as in nmd_x86_cfg_dominators().
+ - idom        [in]  A pointer to the immediate dominators computed by nmd_x86_cfg_dominators().
+ - loop_header [out] A pointer to an array of 'cfg->num_blocks' elements that receives the header of the innermost loop that contains each
+                     block('loop_header[h]' is 'h' for a header), or 'NMD_X86_INVALID_BLOCK' if the block is not in a loop.
+ - loop_parent [out] A pointer to an array of 'cfg->num_blocks' elements. For every header it receives the header of the enclosing loop, or
+                     'NMD_X86_INVALID_BLOCK' if the loop is outermost. Other elements receive 'NMD_X86_INVALID_BLOCK'.
+ - workspace   [in]  A pointer to an array of 'NMD_X86_CFG_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_cfg_loops(const nmd_x86_cfg* cfg, uint32_t entry, const uint32_t* idom, uint32_t* loop_header, uint32_t* loop_parent, uint32_t* workspace)
+{
+	const size_t num_blocks = cfg->num_blocks;
+	uint32_t* const postorder_number = workspace;
+	uint32_t* const order = workspace + num_blocks + 1;
+	uint32_t* const stack = workspace + 2 * (num_blocks + 1); /* Every edge is pushed at most once, so this needs '2 * num_blocks' elements. */
+	size_t count, i, k, num_loops = 0, depth;
+	uint32_t header, latch, block, top;
+
+	count = _nmd_x86_cfg_postorder(num_blocks, entry, cfg->successor_offsets, cfg->successors, cfg->successor_offsets, postorder_number, order, stack, stack + num_blocks + 1);
+
+	for (i = 0; i < num_blocks; i++)
+		loop_header[i] = loop_parent[i] = NMD_X86_INVALID_BLOCK;
+
+	/* In postorder an inner loop's header comes before the header of the loop that encloses it */
+	for (i = 0; i < count; i++)
+	{
+		header = order[i];
+		depth = 0;
+
+		for (k = cfg->predecessor_offsets[header]; k < cfg->predecessor_offsets[header + 1]; k++)
+		{
+			latch = cfg->predecessors[k];
+
+			/* Only a retreating edge(to a node that finishes later in the search) can be a back edge */
+			if (postorder_number[latch] == NMD_X86_INVALID_BLOCK || postorder_number[latch] > postorder_number[header])
+				continue;
+
+			/* Check that the header dominates the latch. The postorder number increases towards the root of the dominator tree. */
+			block = latch;
+			while (postorder_number[block] < postorder_number[header])
+				block = idom[block];
+			if (block != header)
+				continue;
+
+			stack[depth++] = latch;
+		}
+
+		if (depth == 0)
+			continue;
+
+		num_loops++;
+		loop_header[header] = header;
+
+		/* Walk backwards from the latches. Blocks of inner loops are represented by the header of their outermost loop found so far. */
+		while (depth > 0)
+		{
+			block = stack[--depth];
+			if (loop_header[block] == NMD_X86_INVALID_BLOCK)
+			{
+				loop_header[block] = header;
+				top = block;
+			}
+			else
+			{
+				top = loop_header[block];
+				while (loop_parent[top] != NMD_X86_INVALID_BLOCK)
+					top = loop_parent[top];
+				if (top == header)
+					continue;
+				loop_parent[top] = header;
+			}
+
+			for (k = cfg->predecessor_offsets[top]; k < cfg->predecessor_offsets[top + 1]; k++)
+			{
+				if (postorder_number[cfg->predecessors[k]] != NMD_X86_INVALID_BLOCK)
+					stack[depth++] = cfg->predecessors[k];
+			}
+		}
+	}
+
+	return num_loops;
+}
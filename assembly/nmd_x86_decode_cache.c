@@ -0,0 +1,183 @@
+#include "nmd_common.h"
+
+/* The number of consecutive slots where an address may be stored. Lookups never check more slots, so removing an entry needs no tombstone. */
+#define _NMD_DECODE_CACHE_PROBES 4
+
+/* Returns the index of the first slot where 'address' may be stored(Fibonacci hashing, so consecutive addresses are spread over the table). */
+_NMD_FORCE_INLINE size_t _nmd_x86_decode_cache_index(const nmd_x86_decode_cache* cache, uint64_t address)
+{
+	return (size_t)((address * 0x9e3779b97f4a7c15) >> 32) & (cache->capacity - 1);
+}
+
+/* Removes the entries in the probe window of 'address' that overlap the range ['begin', 'end'). */
+NMD_ASSEMBLY_API void _nmd_x86_decode_cache_invalidate_window(nmd_x86_decode_cache* cache, uint64_t address, uint64_t begin, uint64_t end)
+{
+	const size_t index = _nmd_x86_decode_cache_index(cache, address);
+	size_t i;
+
+	for (i = 0; i < _NMD_DECODE_CACHE_PROBES; i++)
+	{
+		nmd_x86_decode_cache_entry* const entry = &cache->entries[(index + i) & (cache->capacity - 1)];
+		if (entry->used && entry->address < end && entry->address + entry->instruction.length > begin)
+		{
+			entry->used = false;
+			cache->num_entries--;
+		}
+	}
+}
+
+/*
+Initializes a decode cache.
+Parameters:
+ - cache    [out] A pointer to a variable of type 'nmd_x86_decode_cache'.
+ - entries  [in]  A pointer to an array of 'nmd_x86_decode_cache_entry' that holds the cached instructions. It must live as long as 'cache'.
+ - capacity [in]  The number of elements in 'entries'. Only the largest power of two less than or equal to it is used.
+*/
+NMD_ASSEMBLY_API void nmd_x86_decode_cache_init(nmd_x86_decode_cache* cache, nmd_x86_decode_cache_entry* entries, size_t capacity)
+{
+	size_t power_of_two = 1;
+	while (power_of_two <= capacity / 2)
+		power_of_two *= 2;
+
+	cache->entries = entries;
+	cache->capacity = capacity ? power_of_two : 0;
+	nmd_x86_decode_cache_clear(cache);
+}
+
+/*
+Removes all entries from a decode cache and resets its counters.
+Parameters:
+ - cache [in/out] A pointer to a variable initialized by nmd_x86_decode_cache_init().
+*/
+NMD_ASSEMBLY_API void nmd_x86_decode_cache_clear(nmd_x86_decode_cache* cache)
+{
+	size_t i;
+	for (i = 0; i < cache->capacity; i++)
+		cache->entries[i].used = false;
+
+	cache->num_entries = 0;
+	cache->hits = 0;
+	cache->misses = 0;
+	cache->evictions = 0;
+}
+
+/*
+Decodes an instruction like nmd_x86_decode(), returning a copy of the cached result if the instruction at 'runtime_address' was already decoded
+with the same mode and flags. An entry is only used if the instruction's bytes in 'buffer' are identical to the cached ones, so stale entries
+are never returned, but invalidating changed ranges with nmd_x86_decode_cache_invalidate() keeps them from occupying the cache. Invalid
+instructions are not cached. When all slots for an address are occupied, one of them is evicted.
+Parameters:
+ - cache           [in/out] A pointer to a variable initialized by nmd_x86_decode_cache_init().
+ - buffer          [in]     A pointer to a buffer containing an encoded instruction.
+ - buffer_size     [in]     The buffer's size in bytes.
+ - runtime_address [in]     The instruction's runtime address. The key of the cache.
+ - instruction     [out]    A pointer to a variable of type 'nmd_x86_instruction' that receives information about the instruction.
+ - mode            [in]     The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - flags           [in]     A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_decode_cached(nmd_x86_decode_cache* cache, const void* buffer, size_t buffer_size, uint64_t runtime_address, nmd_x86_instruction* instruction, NMD_X86_MODE mode, uint32_t flags)
+{
+	const uint8_t* const b = (const uint8_t*)buffer;
+	const size_t index = _nmd_x86_decode_cache_index(cache, runtime_address);
+	nmd_x86_decode_cache_entry* entry;
+	nmd_x86_decode_cache_entry* free_entry = 0;
+	nmd_x86_decode_cache_entry* same_key = 0;
+	size_t i, k;
+
+	if (!cache->capacity)
+		return nmd_x86_decode(buffer, buffer_size, instruction, mode, flags);
+
+	for (i = 0; i < _NMD_DECODE_CACHE_PROBES; i++)
+	{
+		entry = &cache->entries[(index + i) & (cache->capacity - 1)];
+		if (!entry->used)
+		{
+			if (!free_entry)
+				free_entry = entry;
+			continue;
+		}
+
+		if (entry->address == runtime_address && entry->flags == flags && entry->instruction.mode == (uint8_t)mode)
+		{
+			/* The cached instruction doesn't fit in the buffer. The new result replaces it in the same slot so the address has one entry. */
+			if (entry->instruction.length > buffer_size)
+			{
+				same_key = entry;
+				continue;
+			}
+
+			for (k = 0; k < entry->instruction.length && b[k] == entry->instruction.buffer[k]; k++);
+			if (k == entry->instruction.length)
+			{
+				cache->hits++;
+				*instruction = entry->instruction;
+				return true;
+			}
+
+			/* The bytes at the address changed, the entry is stale */
+			entry->used = false;
+			cache->num_entries--;
+			if (!free_entry)
+				free_entry = entry;
+		}
+	}
+
+	cache->misses++;
+	if (!nmd_x86_decode(buffer, buffer_size, instruction, mode, flags))
+		return false;
+
+	if (same_key)
+		free_entry = same_key;
+	else if (free_entry)
+		cache->num_entries++;
+	else
+	{
+		/* Rotate the victim so that addresses competing for a window don't keep evicting the same slot */
+		free_entry = &cache->entries[(index + cache->misses % _NMD_DECODE_CACHE_PROBES) & (cache->capacity - 1)];
+		cache->evictions++;
+	}
+
+	free_entry->used = true;
+	free_entry->address = runtime_address;
+	free_entry->flags = flags;
+	free_entry->instruction = *instruction;
+
+	return true;
+}
+
+/*
+Removes the entries of all instructions that overlap a range of addresses. Call it after the bytes in the range change(e.g. a patch).
+Parameters:
+ - cache   [in/out] A pointer to a variable initialized by nmd_x86_decode_cache_init().
+ - address [in]     The runtime address of the first changed byte.
+ - size    [in]     The number of changed bytes.
+*/
+NMD_ASSEMBLY_API void nmd_x86_decode_cache_invalidate(nmd_x86_decode_cache* cache, uint64_t address, uint64_t size)
+{
+	const uint64_t end = address + size < address ? NMD_X86_INVALID_RUNTIME_ADDRESS : address + size;
+	const uint64_t first = address >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - 1 ? address - (NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - 1) : 0;
+	uint64_t candidate;
+	size_t i;
+
+	if (!size || !cache->capacity)
+		return;
+
+	/* An instruction that overlaps the range starts at most 14 bytes before it. Check the windows of these addresses if that is cheaper than a full scan. */
+	if ((end - first) <= cache->capacity / _NMD_DECODE_CACHE_PROBES)
+	{
+		for (candidate = first; candidate < end; candidate++)
+			_nmd_x86_decode_cache_invalidate_window(cache, candidate, address, end);
+	}
+	else
+	{
+		for (i = 0; i < cache->capacity; i++)
+		{
+			nmd_x86_decode_cache_entry* const entry = &cache->entries[i];
+			if (entry->used && entry->address < end && entry->address + entry->instruction.length > address)
+			{
+				entry->used = false;
+				cache->num_entries--;
+			}
+		}
+	}
+}
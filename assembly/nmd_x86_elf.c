@@ -0,0 +1,197 @@
+#include "nmd_common.h"
+
+#define _NMD_ELF_CLASS_32 1
+#define _NMD_ELF_CLASS_64 2
+#define _NMD_ELF_DATA_LITTLE_ENDIAN 1
+#define _NMD_ELF_MACHINE_386 3
+#define _NMD_ELF_MACHINE_X86_64 62
+#define _NMD_ELF_SECTION_NOBITS 8
+#define _NMD_ELF_SECTION_EXECINSTR 4
+#define _NMD_ELF_SEGMENT_LOAD 1
+#define _NMD_ELF_SEGMENT_EXECUTE 1
+#define _NMD_ELF_SECTION_INDEX_EXTENDED 0xffff
+
+/* Reads a field whose size and offset depend on the class: 'offset32'/'size32' for ELF32, 'offset64'/'size64' for ELF64. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_elf_field(const nmd_x86_elf* elf, const uint8_t* p, size_t offset32, size_t size32, size_t offset64, size_t size64)
+{
+	return elf->mode == NMD_X86_MODE_64 ? _nmd_x86_read_le(p + offset64, size64) : _nmd_x86_read_le(p + offset32, size32);
+}
+
+/* Returns true if the range ['offset', 'offset' + 'size') is inside the image. */
+_NMD_FORCE_INLINE bool _nmd_x86_elf_in_bounds(const nmd_x86_elf* elf, uint64_t offset, uint64_t size)
+{
+	return offset <= elf->image_size && size <= elf->image_size - offset;
+}
+
+/* Sets the name of a section, which stays empty if the name is not a null-terminated string inside the section name table. */
+NMD_ASSEMBLY_API void _nmd_x86_code_section_name(const nmd_x86_elf* elf, uint32_t name, nmd_x86_code_section* section)
+{
+	size_t i;
+	section->name = "";
+	section->name_length = 0;
+	if (name >= elf->section_names_size)
+		return;
+
+	for (i = (size_t)name; i < elf->section_names_size; i++)
+	{
+		if (elf->image[elf->section_names + i] == '\0')
+		{
+			section->name = (const char*)elf->image + elf->section_names + name;
+			section->name_length = i - name;
+			return;
+		}
+	}
+}
+
+/*
+Parses the headers of an ELF32 or ELF64 file for x86 or x86-64. Nothing is copied: 'elf' and the sections returned by
+nmd_x86_elf_get_executable_sections() point into 'image', which must stay valid while they are used. Returns true if the
+file is a little-endian x86 ELF whose header tables are inside the image.
+Parameters:
+ - image      [in]  A pointer to the contents of the file(e.g. a read-only memory mapping of the file).
+ - image_size [in]  The size of the file in bytes.
+ - elf        [out] A pointer to a variable of type 'nmd_x86_elf'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_elf_parse(const void* image, size_t image_size, nmd_x86_elf* elf)
+{
+	const uint8_t* const b = (const uint8_t*)image;
+	uint64_t section_headers, num_sections, names_index, program_headers, num_program_headers;
+	size_t header_size, section_header_size, program_header_size;
+	uint16_t machine;
+
+	if (image_size < 52 || b[0] != 0x7f || b[1] != 'E' || b[2] != 'L' || b[3] != 'F' || b[5] != _NMD_ELF_DATA_LITTLE_ENDIAN)
+		return false;
+
+	machine = (uint16_t)_nmd_x86_read_le(b + 18, 2);
+	if (b[4] == _NMD_ELF_CLASS_64 && machine == _NMD_ELF_MACHINE_X86_64)
+		elf->mode = NMD_X86_MODE_64, header_size = 64, section_header_size = 64, program_header_size = 56;
+	else if (b[4] == _NMD_ELF_CLASS_32 && machine == _NMD_ELF_MACHINE_386)
+		elf->mode = NMD_X86_MODE_32, header_size = 52, section_header_size = 40, program_header_size = 32;
+	else
+		return false;
+
+	elf->image = b;
+	elf->image_size = image_size;
+	if (image_size < header_size)
+		return false;
+
+	elf->entry = _nmd_x86_elf_field(elf, b, 24, 4, 24, 8);
+	program_headers = _nmd_x86_elf_field(elf, b, 28, 4, 32, 8);
+	section_headers = _nmd_x86_elf_field(elf, b, 32, 4, 40, 8);
+	num_program_headers = _nmd_x86_elf_field(elf, b, 44, 2, 56, 2);
+	num_sections = _nmd_x86_elf_field(elf, b, 48, 2, 60, 2);
+	names_index = _nmd_x86_elf_field(elf, b, 50, 2, 62, 2);
+
+	elf->program_header_size = (size_t)_nmd_x86_elf_field(elf, b, 42, 2, 54, 2);
+	elf->section_header_size = (size_t)_nmd_x86_elf_field(elf, b, 46, 2, 58, 2);
+
+	/* The entry sizes must be at least as large as the structures that are read. Larger entries are allowed by the specification. */
+	if ((num_program_headers && elf->program_header_size < program_header_size) || (section_headers && elf->section_header_size < section_header_size))
+		return false;
+
+	/* Files with 0xff00 or more sections store the count and the index of the name table in the first section header. */
+	if (section_headers && (num_sections == 0 || names_index == _NMD_ELF_SECTION_INDEX_EXTENDED))
+	{
+		if (!_nmd_x86_elf_in_bounds(elf, section_headers, section_header_size))
+			return false;
+		if (num_sections == 0)
+			num_sections = _nmd_x86_elf_field(elf, b + section_headers, 20, 4, 32, 8);
+		if (names_index == _NMD_ELF_SECTION_INDEX_EXTENDED)
+			names_index = _nmd_x86_elf_field(elf, b + section_headers, 24, 4, 40, 4);
+	}
+
+	if (!section_headers)
+		num_sections = 0;
+	if (!program_headers)
+		num_program_headers = 0;
+
+	if ((num_sections && (num_sections > image_size / elf->section_header_size || !_nmd_x86_elf_in_bounds(elf, section_headers, num_sections * elf->section_header_size))) ||
+		(num_program_headers && (num_program_headers > image_size / elf->program_header_size || !_nmd_x86_elf_in_bounds(elf, program_headers, num_program_headers * elf->program_header_size))))
+		return false;
+
+	elf->section_headers = (size_t)section_headers;
+	elf->num_sections = (size_t)num_sections;
+	elf->program_headers = (size_t)program_headers;
+	elf->num_program_headers = (size_t)num_program_headers;
+
+	/* A missing or invalid name table is not an error, the sections just have no names. */
+	elf->section_names = 0;
+	elf->section_names_size = 0;
+	if (names_index && names_index < num_sections)
+	{
+		const uint8_t* const header = b + section_headers + names_index * elf->section_header_size;
+		const uint64_t offset = _nmd_x86_elf_field(elf, header, 16, 4, 24, 8), size = _nmd_x86_elf_field(elf, header, 20, 4, 32, 8);
+		if (_nmd_x86_elf_in_bounds(elf, offset, size))
+		{
+			elf->section_names = (size_t)offset;
+			elf->section_names_size = (size_t)size;
+		}
+	}
+
+	return true;
+}
+
+/*
+Finds the executable sections of a parsed ELF file: the sections with the 'SHF_EXECINSTR' flag or, if the file has no section headers,
+the 'PT_LOAD' segments with the 'PF_X' flag. Sections whose contents are not inside the image are skipped. Returns the number of executable
+sections, which may be larger than 'max_sections'; only the first 'max_sections' are stored.
+Parameters:
+ - elf          [in]  A pointer to a variable parsed by nmd_x86_elf_parse().
+ - sections     [out] A pointer to an array of 'nmd_x86_code_section' that receives the sections. May be null if 'max_sections' is zero.
+ - max_sections [in]  The number of elements in 'sections'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_elf_get_executable_sections(const nmd_x86_elf* elf, nmd_x86_code_section* sections, size_t max_sections)
+{
+	size_t i, num_executable = 0;
+	uint64_t offset, size;
+
+	for (i = 0; i < elf->num_sections; i++)
+	{
+		const uint8_t* const header = elf->image + elf->section_headers + i * elf->section_header_size;
+		if (_nmd_x86_read_le(header + 4, 4) == _NMD_ELF_SECTION_NOBITS || !(_nmd_x86_elf_field(elf, header, 8, 4, 8, 8) & _NMD_ELF_SECTION_EXECINSTR))
+			continue;
+
+		offset = _nmd_x86_elf_field(elf, header, 16, 4, 24, 8);
+		size = _nmd_x86_elf_field(elf, header, 20, 4, 32, 8);
+		if (!_nmd_x86_elf_in_bounds(elf, offset, size))
+			continue;
+
+		if (num_executable < max_sections)
+		{
+			_nmd_x86_code_section_name(elf, (uint32_t)_nmd_x86_read_le(header, 4), &sections[num_executable]);
+			sections[num_executable].code = elf->image + offset;
+			sections[num_executable].size = (size_t)size;
+			sections[num_executable].address = _nmd_x86_elf_field(elf, header, 12, 4, 16, 8);
+			sections[num_executable].mode = elf->mode;
+		}
+		num_executable++;
+	}
+
+	if (elf->num_sections)
+		return num_executable;
+
+	for (i = 0; i < elf->num_program_headers; i++)
+	{
+		const uint8_t* const header = elf->image + elf->program_headers + i * elf->program_header_size;
+		if (_nmd_x86_read_le(header, 4) != _NMD_ELF_SEGMENT_LOAD || !(_nmd_x86_elf_field(elf, header, 24, 4, 4, 4) & _NMD_ELF_SEGMENT_EXECUTE))
+			continue;
+
+		offset = _nmd_x86_elf_field(elf, header, 4, 4, 8, 8);
+		size = _nmd_x86_elf_field(elf, header, 16, 4, 32, 8);
+		if (!_nmd_x86_elf_in_bounds(elf, offset, size))
+			continue;
+
+		if (num_executable < max_sections)
+		{
+			sections[num_executable].name = "";
+			sections[num_executable].name_length = 0;
+			sections[num_executable].code = elf->image + offset;
+			sections[num_executable].size = (size_t)size;
+			sections[num_executable].address = _nmd_x86_elf_field(elf, header, 8, 4, 16, 8);
+			sections[num_executable].mode = elf->mode;
+		}
+		num_executable++;
+	}
+
+	return num_executable;
+}
@@ -0,0 +1,250 @@
+#include "nmd_common.h"
+
+/* The group tells branches and returns apart, the instruction's id finds padding, traps and 'endbr'. */
+#define _NMD_FUNCTION_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_GROUP)
+
+/* Each byte of the map describes the offset: the low three bits are set by the linear sweep, the high five bits are the 'NMD_X86_FUNCTION_REASON_XXX' of a function start. */
+#define _NMD_FUNCTION_MAP_INSTRUCTION  (1 << 0) /* An instruction starts at the offset. */
+#define _NMD_FUNCTION_MAP_PADDING      (1 << 1) /* The instruction is 'nop' or 'int3'. */
+#define _NMD_FUNCTION_MAP_TERMINATOR   (1 << 2) /* The instruction doesn't fall through. */
+#define _NMD_FUNCTION_MAP_REASON_SHIFT 3
+
+#define _NMD_FUNCTION_MAP_REASONS(entry) ((entry) >> _NMD_FUNCTION_MAP_REASON_SHIFT)
+
+/* Decodes the instruction at 'offset'. */
+_NMD_FORCE_INLINE bool _nmd_x86_function_decode(const nmd_x86_code_section* section, size_t offset, nmd_x86_instruction* instruction)
+{
+	if (section->size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+		return nmd_x86_decode_padded(section->code + offset, instruction, (NMD_X86_MODE)section->mode, _NMD_FUNCTION_DECODER_FLAGS);
+	else
+		return nmd_x86_decode(section->code + offset, section->size - offset, instruction, (NMD_X86_MODE)section->mode, _NMD_FUNCTION_DECODER_FLAGS);
+}
+
+/* Returns true if the instruction is a jump that never falls through(relative or not). */
+_NMD_FORCE_INLINE bool _nmd_x86_function_is_jump(const nmd_x86_instruction* instruction)
+{
+	return (instruction->group & NMD_GROUP_UNCONDITIONAL_BRANCH) && !(instruction->group & NMD_GROUP_CALL);
+}
+
+/* Returns true if the instruction ends the code of a function. */
+_NMD_FORCE_INLINE bool _nmd_x86_function_is_terminator(const nmd_x86_instruction* instruction)
+{
+	return (instruction->group & NMD_GROUP_RET) || _nmd_x86_function_is_jump(instruction) || instruction->id == NMD_X86_INSTRUCTION_HLT || instruction->id == NMD_X86_INSTRUCTION_UD2;
+}
+
+/* Returns true if the bytes at 'offset' are 'endbr32', 'endbr64' or 'push rbp; mov rbp, rsp'('push ebp; mov ebp, esp' outside 64-bit mode) in either encoding of 'mov'. */
+_NMD_FORCE_INLINE bool _nmd_x86_function_is_prologue(const nmd_x86_code_section* section, size_t offset, const nmd_x86_instruction* instruction)
+{
+	const uint8_t* b = section->code + offset;
+	size_t remaining = section->size - offset;
+
+	if (instruction->id == NMD_X86_INSTRUCTION_ENDBR64 || instruction->id == NMD_X86_INSTRUCTION_ENDBR32)
+		return true;
+
+	if (remaining < 3 || b[0] != 0x55)
+		return false;
+
+	if (section->mode == NMD_X86_MODE_64)
+	{
+		if (remaining < 4 || b[1] != 0x48)
+			return false;
+		b++;
+	}
+
+	return (b[1] == 0x89 && b[2] == 0xe5) || (b[1] == 0x8b && b[2] == 0xec);
+}
+
+/* Returns true if a function starts at an offset in the range ('low', 'high'). */
+_NMD_FORCE_INLINE bool _nmd_x86_function_has_start_between(const uint8_t* map, size_t low, size_t high)
+{
+	size_t i = low + 1;
+	for (; i < high; i++)
+	{
+		if (_NMD_FUNCTION_MAP_REASONS(map[i]))
+			return true;
+	}
+
+	return false;
+}
+
+/* Decodes the section once, marking instructions, padding, terminators, call targets and starts found by prologues or 'int3' padding. */
+NMD_ASSEMBLY_API void _nmd_x86_function_sweep(const nmd_x86_code_section* section, uint8_t* map)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0;
+	int64_t target;
+	uint8_t reasons;
+
+	/* True if the previous instruction that isn't padding doesn't fall through, so a function may start after it. */
+	bool boundary = true;
+
+	/* True if an 'int3' was found between the boundary and the current offset. */
+	bool int3_padding = false;
+
+	while (offset < section->size)
+	{
+		if (!_nmd_x86_function_decode(section, offset, &instruction))
+		{
+			/* Bytes that can't be decoded are data, so code can't flow through them. */
+			boundary = true;
+			int3_padding = false;
+			offset++;
+			continue;
+		}
+
+		map[offset] |= _NMD_FUNCTION_MAP_INSTRUCTION;
+
+		if (instruction.id == NMD_X86_INSTRUCTION_NOP || instruction.id == NMD_X86_INSTRUCTION_INT3)
+		{
+			map[offset] |= _NMD_FUNCTION_MAP_PADDING;
+			if (instruction.id == NMD_X86_INSTRUCTION_INT3 && boundary)
+				int3_padding = true;
+		}
+		else
+		{
+			if (boundary)
+			{
+				reasons = 0;
+				if (_nmd_x86_function_is_prologue(section, offset, &instruction))
+					reasons |= NMD_X86_FUNCTION_REASON_PROLOGUE;
+				if (int3_padding)
+					reasons |= NMD_X86_FUNCTION_REASON_PADDING;
+				map[offset] |= (uint8_t)(reasons << _NMD_FUNCTION_MAP_REASON_SHIFT);
+			}
+
+			if ((instruction.group & NMD_GROUP_CALL) && (instruction.group & NMD_GROUP_RELATIVE_ADDRESSING))
+			{
+				target = _nmd_x86_get_branch_target(&instruction, offset);
+				if (target >= 0 && (uint64_t)target < section->size)
+					map[target] |= NMD_X86_FUNCTION_REASON_CALL_TARGET << _NMD_FUNCTION_MAP_REASON_SHIFT;
+			}
+
+			boundary = _nmd_x86_function_is_terminator(&instruction);
+			if (boundary)
+				map[offset] |= _NMD_FUNCTION_MAP_TERMINATOR;
+			int3_padding = false;
+		}
+
+		offset += instruction.length;
+	}
+}
+
+/*
+Marks the targets of relative jumps that leave their function as tail calls. Only the terminators are decoded again, and each new start may split a
+function and turn other jumps into tail calls, so the pass is repeated until no start is added. Returns the number of passes.
+*/
+NMD_ASSEMBLY_API size_t _nmd_x86_function_find_tail_calls(const nmd_x86_code_section* section, uint8_t* map)
+{
+	nmd_x86_instruction instruction;
+	size_t offset, start;
+	size_t num_passes = 0;
+	bool has_start, changed;
+	int64_t target;
+
+	do
+	{
+		changed = false;
+		has_start = false;
+		start = 0;
+		num_passes++;
+
+		for (offset = 0; offset < section->size; offset++)
+		{
+			if (_NMD_FUNCTION_MAP_REASONS(map[offset]))
+			{
+				start = offset;
+				has_start = true;
+			}
+
+			if (!has_start || !(map[offset] & _NMD_FUNCTION_MAP_TERMINATOR))
+				continue;
+
+			if (!_nmd_x86_function_decode(section, offset, &instruction) || !_nmd_x86_function_is_jump(&instruction) || !(instruction.group & NMD_GROUP_RELATIVE_ADDRESSING))
+				continue;
+
+			target = _nmd_x86_get_branch_target(&instruction, offset);
+			if (target < 0 || (uint64_t)target >= section->size || _NMD_FUNCTION_MAP_REASONS(map[target]) || !(map[target] & _NMD_FUNCTION_MAP_INSTRUCTION))
+				continue;
+
+			/* A jump behind the start of its function or past the start of the next one. */
+			if ((size_t)target < start || ((size_t)target > offset && _nmd_x86_function_has_start_between(map, offset, (size_t)target)))
+			{
+				map[target] |= NMD_X86_FUNCTION_REASON_TAIL_CALL << _NMD_FUNCTION_MAP_REASON_SHIFT;
+				changed = true;
+			}
+		}
+	} while (changed);
+
+	return num_passes;
+}
+
+/*
+Finds the functions of a section in one linear sweep and a few passes over a map of one byte per offset. Function starts are the given entry
+points, the targets of relative calls, prologues and code after 'int3' padding that follow the end of the previous code(a return, a jump, 'hlt',
+'ud2' or padding), and the targets of jumps that leave the function they are in(tail calls), repeated until no start is added. A function ends
+before the padding that precedes the next start. Sections are independent, so each one can be analyzed by a different thread. Returns the number
+of functions, which may be larger than 'max_functions'; only the first 'max_functions' are stored, sorted by address.
+Parameters:
+ - section       [in]  A pointer to the section, see nmd_x86_elf_get_executable_sections() and nmd_x86_pe_get_executable_sections().
+ - entries       [in]  A pointer to an array of addresses known to be functions. Addresses outside the section are ignored. May be null if 'num_entries' is zero.
+ - num_entries   [in]  The number of elements in 'entries'.
+ - map           [in]  A pointer to an array of 'section->size' bytes used as temporary storage.
+ - functions     [out] A pointer to an array of 'nmd_x86_function' that receives the functions. May be null if 'max_functions' is zero.
+ - max_functions [in]  The number of elements in 'functions'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_find_functions(const nmd_x86_code_section* section, const uint64_t* entries, size_t num_entries, uint8_t* map, nmd_x86_function* functions, size_t max_functions)
+{
+	size_t offset, padding_start = 0;
+	size_t num_functions = 0;
+	bool in_padding = false;
+	uint64_t entry;
+	size_t i;
+
+	for (offset = 0; offset < section->size; offset++)
+		map[offset] = 0;
+
+	_nmd_x86_function_sweep(section, map);
+
+	for (i = 0; i < num_entries; i++)
+	{
+		entry = entries[i] - section->address;
+		if (entries[i] >= section->address && entry < section->size)
+			map[entry] |= NMD_X86_FUNCTION_REASON_ENTRY << _NMD_FUNCTION_MAP_REASON_SHIFT;
+	}
+
+	_nmd_x86_function_find_tail_calls(section, map);
+
+	/* Each function ends where the padding before the next start begins, or at the next start. */
+	for (offset = 0; offset < section->size; offset++)
+	{
+		if (_NMD_FUNCTION_MAP_REASONS(map[offset]))
+		{
+			if (num_functions && num_functions <= max_functions)
+				functions[num_functions - 1].end = section->address + (in_padding ? padding_start : offset);
+
+			if (num_functions < max_functions)
+			{
+				functions[num_functions].start = section->address + offset;
+				functions[num_functions].reasons = (uint8_t)_NMD_FUNCTION_MAP_REASONS(map[offset]);
+			}
+
+			num_functions++;
+			in_padding = false;
+		}
+		else if (map[offset] & _NMD_FUNCTION_MAP_INSTRUCTION)
+		{
+			if (!(map[offset] & _NMD_FUNCTION_MAP_PADDING))
+				in_padding = false;
+			else if (!in_padding)
+			{
+				padding_start = offset;
+				in_padding = true;
+			}
+		}
+	}
+
+	if (num_functions && num_functions <= max_functions)
+		functions[num_functions - 1].end = section->address + (in_padding ? padding_start : section->size);
+
+	return num_functions;
+}
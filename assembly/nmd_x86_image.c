@@ -0,0 +1,66 @@
+#include "nmd_common.h"
+
+/* Reads a little-endian integer of 'size' bytes. The image may be unaligned and the host may be big-endian. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_read_le(const uint8_t* p, size_t size)
+{
+	uint64_t value = 0;
+	while (size--)
+		value = (value << 8) | p[size];
+	return value;
+}
+
+/*
+Initializes an iterator over the instructions of an executable section.
+Parameters:
+ - iterator [out] A pointer to a variable of type 'nmd_x86_section_iterator'.
+ - section  [in]  A pointer to a section returned by nmd_x86_elf_get_executable_sections() or nmd_x86_pe_get_executable_sections().
+ - flags    [in]  A mask of 'NMD_X86_DECODER_FLAGS_XXX' passed to the decoder.
+*/
+NMD_ASSEMBLY_API void nmd_x86_section_iterator_init(nmd_x86_section_iterator* iterator, const nmd_x86_code_section* section, uint32_t flags)
+{
+	iterator->code = section->code;
+	iterator->size = section->size;
+	iterator->offset = 0;
+	iterator->address = section->address;
+	iterator->mode = section->mode;
+	iterator->flags = flags;
+}
+
+/*
+Decodes the next instruction of a section directly from the image. Bytes where no valid instruction starts are returned one at a
+time as an instruction with 'valid' set to false, 'length' set to one and the byte in 'buffer[0]', so the sweep never stops early.
+Returns false when the end of the section is reached.
+Parameters:
+ - iterator        [in/out] A pointer to a variable initialized by nmd_x86_section_iterator_init().
+ - instruction     [out]    A pointer to a variable of type 'nmd_x86_instruction'.
+ - runtime_address [out]    A pointer to a variable that receives the virtual address of the instruction. May be null.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_section_next_instruction(nmd_x86_section_iterator* iterator, nmd_x86_instruction* instruction, uint64_t* runtime_address)
+{
+	const size_t remaining = iterator->size - iterator->offset;
+	const uint8_t* const p = iterator->code + iterator->offset;
+	bool valid;
+
+	if (iterator->offset >= iterator->size)
+		return false;
+
+	/* Far from the end of the section the bounds checks of every byte can be skipped. */
+	if (remaining >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+		valid = nmd_x86_decode_padded(p, instruction, (NMD_X86_MODE)iterator->mode, iterator->flags);
+	else
+		valid = nmd_x86_decode(p, remaining, instruction, (NMD_X86_MODE)iterator->mode, iterator->flags);
+
+	if (!valid)
+	{
+		instruction->valid = false;
+		instruction->mode = iterator->mode;
+		instruction->length = 1;
+		instruction->buffer[0] = *p;
+	}
+
+	if (runtime_address)
+		*runtime_address = iterator->address + iterator->offset;
+	iterator->offset += instruction->length;
+
+	return true;
+}
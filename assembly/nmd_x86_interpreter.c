@@ -0,0 +1,1558 @@
+#include "nmd_common.h"
+
+/* The cpu flags tell which instructions' flags are never read, so they aren't computed. */
+#define _NMD_INTERPRETER_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_CPU_FLAGS)
+
+/* The maximum number of instructions in a block. A longer straight line is split into blocks that are chained. */
+#define _NMD_INTERPRETER_MAX_BLOCK_INSTRUCTIONS 64
+
+/* CF, PF, AF, ZF, SF and OF: the flags computed lazily from the last instruction that modified them. */
+#define _NMD_INTERPRETER_STATUS_FLAGS 0x8d5
+
+#define _NMD_INTERPRETER_NO_BLOCK 0xffffffff
+
+/* The register that is always zero, used for absent bases and indices. */
+#define _NMD_INTERPRETER_ZERO 16
+
+/* Added to the number of a byte register to select bits 8-15('ah', 'ch', 'dh', 'bh'). */
+#define _NMD_INTERPRETER_HIGH_BYTE 0x20
+
+/* The micro-ops. Handlers of the same operation on registers with and without flags are generated by macros. */
+#define _NMD_INTERPRETER_UOPS(X) \
+	X(NOP) X(MOV_RR) X(MOV_RI) X(LOAD) X(STORE) X(STORE_I) X(LEA) X(MOVZX_RR) X(MOVZX_RM) X(MOVSX_RR) X(MOVSX_RM) \
+	X(ADD_RR) X(ADD_RR_NF) X(ADD_RI) X(ADD_RI_NF) X(SUB_RR) X(SUB_RR_NF) X(SUB_RI) X(SUB_RI_NF) \
+	X(AND_RR) X(AND_RR_NF) X(AND_RI) X(AND_RI_NF) X(OR_RR) X(OR_RR_NF) X(OR_RI) X(OR_RI_NF) X(XOR_RR) X(XOR_RR_NF) X(XOR_RI) X(XOR_RI_NF) \
+	X(CMP_RR) X(CMP_RI) X(TEST_RR) X(TEST_RI) X(INC_R) X(INC_R_NF) X(DEC_R) X(DEC_R_NF) \
+	X(ALU_RR) X(ALU_RI) X(ALU_RM) X(ALU_MR) X(ALU_MI) X(UNARY_R) X(UNARY_M) X(SHIFT_R) X(SHIFT_M) X(SHIFT_R_CL) X(SHIFT_M_CL) \
+	X(IMUL_RR) X(IMUL_RM) X(IMUL_RRI) X(IMUL_RMI) X(MULDIV_R) X(MULDIV_M) X(CMOV_RR) X(CMOV_RM) X(SETCC_R) X(SETCC_M) \
+	X(XCHG_RR) X(XCHG_RM) X(PUSH_R) X(PUSH_I) X(PUSH_M) X(POP_R) X(LEAVE) X(CONVERT_A) X(CONVERT_D) X(FLAG) X(STRING) \
+	X(JMP) X(JMP_R) X(JMP_M) X(JCC) X(CALL) X(CALL_R) X(CALL_M) X(RET) X(EXIT)
+
+#define _NMD_INTERPRETER_UOP_ENUM(name) _NMD_UOP_##name,
+enum _NMD_INTERPRETER_UOP { _NMD_INTERPRETER_UOPS(_NMD_INTERPRETER_UOP_ENUM) _NMD_UOP_COUNT };
+
+/* The operations of the generic ALU micro-ops, numbered like the 'reg' field of opcodes 80h-83h, plus 'test'. */
+enum _NMD_INTERPRETER_ALU { _NMD_ALU_ADD = 0, _NMD_ALU_OR, _NMD_ALU_ADC, _NMD_ALU_SBB, _NMD_ALU_AND, _NMD_ALU_SUB, _NMD_ALU_XOR, _NMD_ALU_CMP, _NMD_ALU_TEST };
+
+/* The operations of 'UNARY'(the 'reg' field of opcode F7h for 'not' and 'neg'). */
+enum _NMD_INTERPRETER_UNARY { _NMD_UNARY_INC = 0, _NMD_UNARY_DEC = 1, _NMD_UNARY_NOT = 2, _NMD_UNARY_NEG = 3 };
+
+/* The operations of 'SHIFT'(the 'reg' field of opcodes C0h-D3h). 'rcl' and 'rcr' are not supported. */
+enum _NMD_INTERPRETER_SHIFT { _NMD_SHIFT_ROL = 0, _NMD_SHIFT_ROR = 1, _NMD_SHIFT_SHL = 4, _NMD_SHIFT_SHR = 5, _NMD_SHIFT_SAR = 7 };
+
+/* The operations of 'MULDIV'(the 'reg' field of opcode F7h). */
+enum _NMD_INTERPRETER_MULDIV { _NMD_MULDIV_MUL = 4, _NMD_MULDIV_IMUL = 5, _NMD_MULDIV_DIV = 6, _NMD_MULDIV_IDIV = 7 };
+
+/* The operations of 'FLAG'. */
+enum _NMD_INTERPRETER_FLAG { _NMD_FLAG_CMC, _NMD_FLAG_CLC, _NMD_FLAG_STC, _NMD_FLAG_CLD, _NMD_FLAG_STD };
+
+/* The operations of 'STRING'. Bit 2 is set by a 'rep' prefix. */
+enum _NMD_INTERPRETER_STRING { _NMD_STRING_MOVS = 0, _NMD_STRING_STOS = 1, _NMD_STRING_REP = 4 };
+
+/* How the status flags are computed from 'flags_dst', 'flags_src' and 'flags_result'. */
+enum _NMD_INTERPRETER_FLAGS_KIND
+{
+	_NMD_FLAGS_NONE = 0, /* The flags are in 'rflags'. */
+	_NMD_FLAGS_ADD,
+	_NMD_FLAGS_ADC,      /* 'flags_aux' is the carry in. */
+	_NMD_FLAGS_SUB,
+	_NMD_FLAGS_SBB,      /* 'flags_aux' is the borrow in. */
+	_NMD_FLAGS_LOGIC,
+	_NMD_FLAGS_INC,      /* 'flags_aux' is the preserved carry. */
+	_NMD_FLAGS_DEC,      /* 'flags_aux' is the preserved carry. */
+	_NMD_FLAGS_SHL,      /* 'flags_src' is the count. */
+	_NMD_FLAGS_SHR,
+	_NMD_FLAGS_SAR,
+	_NMD_FLAGS_MUL       /* 'flags_aux' is the overflow. */
+};
+
+static const uint64_t _nmd_x86_interpreter_masks[9] = { 0, 0xff, 0xffff, 0, 0xffffffff, 0, 0, 0, 0xffffffffffffffff };
+
+#define _NMD_INTERPRETER_MASK(size) (_nmd_x86_interpreter_masks[size])
+#define _NMD_INTERPRETER_SIGN(size) ((uint64_t)1 << ((size) * 8 - 1))
+
+/* Sign extends the low 'size' bytes of 'value'. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_sign_extend(uint64_t value, size_t size)
+{
+	const unsigned shift = (unsigned)(64 - size * 8);
+	return (uint64_t)((int64_t)(value << shift) >> shift);
+}
+
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_get(const nmd_x86_interpreter* it, uint8_t reg, size_t size)
+{
+	if (size == 8)
+		return it->regs[reg];
+	else if (reg & _NMD_INTERPRETER_HIGH_BYTE)
+		return (it->regs[reg & 3] >> 8) & 0xff;
+	else
+		return it->regs[reg] & _NMD_INTERPRETER_MASK(size);
+}
+
+/* Writes a register like the cpu: 32-bit writes clear the upper half, 8 and 16-bit writes keep the other bits. */
+_NMD_FORCE_INLINE void _nmd_x86_interpreter_set(nmd_x86_interpreter* it, uint8_t reg, size_t size, uint64_t value)
+{
+	if (size == 8)
+		it->regs[reg] = value;
+	else if (size == 4)
+		it->regs[reg] = (uint32_t)value;
+	else if (reg & _NMD_INTERPRETER_HIGH_BYTE)
+		it->regs[reg & 3] = (it->regs[reg & 3] & ~(uint64_t)0xff00) | ((value & 0xff) << 8);
+	else
+		it->regs[reg] = (it->regs[reg] & ~_NMD_INTERPRETER_MASK(size)) | (value & _NMD_INTERPRETER_MASK(size));
+}
+
+/* Computes the status flags from the last instruction that modified them. Returns the whole 'rflags'. */
+NMD_ASSEMBLY_API uint64_t _nmd_x86_interpreter_compute_flags(const nmd_x86_interpreter* it)
+{
+	const size_t size = it->flags_size;
+	uint64_t mask, sign, dst, src, result, flags, parity;
+	bool cf = false, of = false;
+
+	if (it->flags_kind == _NMD_FLAGS_NONE)
+		return it->rflags;
+
+	mask = _NMD_INTERPRETER_MASK(size);
+	sign = _NMD_INTERPRETER_SIGN(size);
+	dst = it->flags_dst & mask;
+	src = it->flags_src & mask;
+	result = it->flags_result & mask;
+
+	switch (it->flags_kind)
+	{
+	case _NMD_FLAGS_ADD: cf = result < dst; of = ((dst ^ result) & (src ^ result) & sign) != 0; break;
+	case _NMD_FLAGS_ADC: cf = it->flags_aux ? result <= dst : result < dst; of = ((dst ^ result) & (src ^ result) & sign) != 0; break;
+	case _NMD_FLAGS_SUB: cf = dst < src; of = ((dst ^ src) & (dst ^ result) & sign) != 0; break;
+	case _NMD_FLAGS_SBB: cf = it->flags_aux ? dst <= src : dst < src; of = ((dst ^ src) & (dst ^ result) & sign) != 0; break;
+	case _NMD_FLAGS_INC: cf = it->flags_aux != 0; of = result == sign; break;
+	case _NMD_FLAGS_DEC: cf = it->flags_aux != 0; of = result == sign - 1; break;
+	case _NMD_FLAGS_SHL: cf = it->flags_src <= size * 8 && (dst >> (size * 8 - it->flags_src)) & 1; of = ((result & sign) != 0) != cf; break;
+	case _NMD_FLAGS_SHR: cf = (dst >> (it->flags_src - 1)) & 1; of = (dst & sign) != 0; break;
+	case _NMD_FLAGS_SAR: cf = (_nmd_x86_interpreter_sign_extend(dst, size) >> (it->flags_src - 1)) & 1; break;
+	case _NMD_FLAGS_MUL: cf = of = it->flags_aux != 0; break;
+	}
+
+	parity = ((result & 0xff) ^ ((result & 0xff) >> 4)) & 0xf;
+	flags = it->rflags & ~(uint64_t)_NMD_INTERPRETER_STATUS_FLAGS;
+	flags |= (uint64_t)cf | ((uint64_t)(~(0x6996 >> parity) & 1) << 2) | ((uint64_t)(result & sign ? 1 : 0) << 7) | ((uint64_t)(result == 0) << 6) | ((uint64_t)of << 11);
+	if (it->flags_kind <= _NMD_FLAGS_SBB || it->flags_kind == _NMD_FLAGS_INC || it->flags_kind == _NMD_FLAGS_DEC)
+		flags |= (dst ^ src ^ result) & 0x10;
+
+	return flags;
+}
+
+/* Stores the computed flags in 'rflags'. */
+_NMD_FORCE_INLINE void _nmd_x86_interpreter_materialize(nmd_x86_interpreter* it)
+{
+	it->rflags = _nmd_x86_interpreter_compute_flags(it);
+	it->flags_kind = _NMD_FLAGS_NONE;
+}
+
+/* Returns the carry flag without computing the other flags, for 'adc', 'sbb', 'inc' and 'dec'. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_carry(const nmd_x86_interpreter* it)
+{
+	const uint64_t mask = _NMD_INTERPRETER_MASK(it->flags_size);
+
+	switch (it->flags_kind)
+	{
+	case _NMD_FLAGS_NONE: return it->rflags & 1;
+	case _NMD_FLAGS_ADD: return (it->flags_result & mask) < (it->flags_dst & mask);
+	case _NMD_FLAGS_SUB: return (it->flags_dst & mask) < (it->flags_src & mask);
+	case _NMD_FLAGS_LOGIC: return 0;
+	case _NMD_FLAGS_INC: case _NMD_FLAGS_DEC: return it->flags_aux;
+	default: return _nmd_x86_interpreter_compute_flags(it) & 1;
+	}
+}
+
+_NMD_FORCE_INLINE void _nmd_x86_interpreter_record(nmd_x86_interpreter* it, uint8_t kind, size_t size, uint64_t dst, uint64_t src, uint64_t result)
+{
+	it->flags_kind = kind;
+	it->flags_size = (uint8_t)size;
+	it->flags_dst = dst;
+	it->flags_src = src;
+	it->flags_result = result;
+}
+
+/* Evaluates a condition code(the low nibble of 'jcc', 'setcc' and 'cmovcc'). Comparisons and the zero and sign flags don't compute the other flags. */
+_NMD_FORCE_INLINE bool _nmd_x86_interpreter_condition(const nmd_x86_interpreter* it, uint8_t condition)
+{
+	const size_t size = it->flags_size;
+	uint64_t dst, src, flags;
+	bool result;
+
+	if (it->flags_kind == _NMD_FLAGS_SUB && condition != 0 && condition != 1 && condition != 10 && condition != 11)
+	{
+		dst = it->flags_dst & _NMD_INTERPRETER_MASK(size);
+		src = it->flags_src & _NMD_INTERPRETER_MASK(size);
+		switch (condition >> 1)
+		{
+		case 1: result = dst < src; break;
+		case 2: result = dst == src; break;
+		case 3: result = dst <= src; break;
+		case 4: result = ((dst - src) & _NMD_INTERPRETER_SIGN(size)) != 0; break;
+		case 6: result = (int64_t)_nmd_x86_interpreter_sign_extend(dst, size) < (int64_t)_nmd_x86_interpreter_sign_extend(src, size); break;
+		default: result = (int64_t)_nmd_x86_interpreter_sign_extend(dst, size) <= (int64_t)_nmd_x86_interpreter_sign_extend(src, size); break;
+		}
+		return result != (condition & 1);
+	}
+
+	if (it->flags_kind != _NMD_FLAGS_NONE && (condition >> 1 == 2 || condition >> 1 == 4))
+	{
+		result = condition >> 1 == 2 ? (it->flags_result & _NMD_INTERPRETER_MASK(size)) == 0 : (it->flags_result & _NMD_INTERPRETER_SIGN(size)) != 0;
+		return result != (condition & 1);
+	}
+
+	flags = _nmd_x86_interpreter_compute_flags(it);
+	switch (condition >> 1)
+	{
+	case 0: result = (flags >> 11) & 1; break;
+	case 1: result = flags & 1; break;
+	case 2: result = (flags >> 6) & 1; break;
+	case 3: result = (flags & 0x41) != 0; break;
+	case 4: result = (flags >> 7) & 1; break;
+	case 5: result = (flags >> 2) & 1; break;
+	case 6: result = ((flags >> 7) & 1) != ((flags >> 11) & 1); break;
+	default: result = ((flags >> 6) & 1) || ((flags >> 7) & 1) != ((flags >> 11) & 1); break;
+	}
+	return result != (condition & 1);
+}
+
+/* Returns the host address of the page that contains 'address', using the TLB. Returns null if it's not mapped(or not writable if 'write'). */
+_NMD_FORCE_INLINE uint8_t* _nmd_x86_interpreter_page(nmd_x86_interpreter* it, uint64_t address, bool write)
+{
+	nmd_x86_tlb_entry* const entry = &it->tlb[write][(address >> 12) & (NMD_X86_TLB_SIZE - 1)];
+	const uint64_t page = address & ~(uint64_t)0xfff;
+	uint8_t* data;
+
+	if (entry->page != page)
+	{
+		data = it->translate(it->context, page, write);
+		if (!data)
+			return 0;
+		entry->page = page;
+		entry->data = data;
+	}
+
+	return entry->data;
+}
+
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_load(const uint8_t* p, size_t size)
+{
+	switch (size)
+	{
+	case 1: return p[0];
+	case 2: return (uint64_t)p[0] | (uint64_t)p[1] << 8;
+	case 4: return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24;
+	default: return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 | (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+	}
+}
+
+_NMD_FORCE_INLINE void _nmd_x86_interpreter_store(uint8_t* p, size_t size, uint64_t value)
+{
+	size_t i;
+	for (i = 0; i < size; i++, value >>= 8)
+		p[i] = (uint8_t)value;
+}
+
+/* Reads memory byte by byte, for accesses that cross a page. */
+NMD_ASSEMBLY_API bool _nmd_x86_interpreter_read_slow(nmd_x86_interpreter* it, uint64_t address, size_t size, uint64_t* value)
+{
+	const uint8_t* page;
+	size_t i;
+
+	*value = 0;
+	for (i = 0; i < size; i++)
+	{
+		page = _nmd_x86_interpreter_page(it, address + i, false);
+		if (!page)
+		{
+			it->fault_address = address + i;
+			return false;
+		}
+		*value |= (uint64_t)page[(address + i) & 0xfff] << (i * 8);
+	}
+
+	return true;
+}
+
+/* Writes memory byte by byte, for accesses that cross a page. All pages are checked before anything is written. */
+NMD_ASSEMBLY_API bool _nmd_x86_interpreter_write_slow(nmd_x86_interpreter* it, uint64_t address, size_t size, uint64_t value)
+{
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		if (!_nmd_x86_interpreter_page(it, address + i, true))
+		{
+			it->fault_address = address + i;
+			return false;
+		}
+	}
+
+	for (i = 0; i < size; i++, value >>= 8)
+		_nmd_x86_interpreter_page(it, address + i, true)[(address + i) & 0xfff] = (uint8_t)value;
+
+	return true;
+}
+
+_NMD_FORCE_INLINE bool _nmd_x86_interpreter_read(nmd_x86_interpreter* it, uint64_t address, size_t size, uint64_t* value)
+{
+	const uint8_t* page;
+
+	if ((address & 0xfff) + size > 0x1000)
+		return _nmd_x86_interpreter_read_slow(it, address, size, value);
+
+	page = _nmd_x86_interpreter_page(it, address, false);
+	if (!page)
+	{
+		it->fault_address = address;
+		return false;
+	}
+
+	*value = _nmd_x86_interpreter_load(page + (address & 0xfff), size);
+	return true;
+}
+
+/* Writes memory. A write to translated code is noted in 'code_modified', so the block cache is flushed after the instruction. */
+_NMD_FORCE_INLINE bool _nmd_x86_interpreter_write(nmd_x86_interpreter* it, uint64_t address, size_t size, uint64_t value)
+{
+	uint8_t* page;
+
+	if (address < it->code_end && address + size > it->code_begin)
+		it->code_modified = true;
+
+	if ((address & 0xfff) + size > 0x1000)
+		return _nmd_x86_interpreter_write_slow(it, address, size, value);
+
+	page = _nmd_x86_interpreter_page(it, address, true);
+	if (!page)
+	{
+		it->fault_address = address;
+		return false;
+	}
+
+	_nmd_x86_interpreter_store(page + (address & 0xfff), size, value);
+	return true;
+}
+
+/* Returns the low 64 bits of the unsigned product of 'a' and 'b' and stores the high 64 bits in 'high'. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_multiply(uint64_t a, uint64_t b, uint64_t* high)
+{
+	const uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+	const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	const uint64_t middle = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+
+	*high = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+	return (middle << 32) | (uint32_t)p00;
+}
+
+/* Divides the unsigned 128-bit 'high:low' by 'divisor'. Returns false if the quotient doesn't fit in 64 bits. */
+NMD_ASSEMBLY_API bool _nmd_x86_interpreter_divide(uint64_t high, uint64_t low, uint64_t divisor, uint64_t* quotient, uint64_t* remainder)
+{
+	uint64_t q = 0;
+	size_t i;
+	bool carry;
+
+	if (high >= divisor)
+		return false;
+
+	if (!high)
+	{
+		*quotient = low / divisor;
+		*remainder = low % divisor;
+		return true;
+	}
+
+	/* Restoring division, one bit of the quotient per step. */
+	for (i = 0; i < 64; i++)
+	{
+		carry = (high >> 63) != 0;
+		high = (high << 1) | (low >> 63);
+		low <<= 1;
+		q <<= 1;
+		if (carry || high >= divisor)
+		{
+			high -= divisor;
+			q |= 1;
+		}
+	}
+
+	*quotient = q;
+	*remainder = high;
+	return true;
+}
+
+/* Computes the result of a generic ALU operation. The flags are recorded by the caller once the result is written. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_alu(nmd_x86_interpreter* it, uint8_t operation, uint64_t dst, uint64_t src)
+{
+	switch (operation)
+	{
+	case _NMD_ALU_ADD: return dst + src;
+	case _NMD_ALU_OR: return dst | src;
+	case _NMD_ALU_ADC: it->flags_aux = _nmd_x86_interpreter_carry(it); return dst + src + it->flags_aux;
+	case _NMD_ALU_SBB: it->flags_aux = _nmd_x86_interpreter_carry(it); return dst - src - it->flags_aux;
+	case _NMD_ALU_AND: case _NMD_ALU_TEST: return dst & src;
+	case _NMD_ALU_SUB: case _NMD_ALU_CMP: return dst - src;
+	default: return dst ^ src;
+	}
+}
+
+static const uint8_t _nmd_x86_interpreter_alu_flags[9] = { _NMD_FLAGS_ADD, _NMD_FLAGS_LOGIC, _NMD_FLAGS_ADC, _NMD_FLAGS_SBB, _NMD_FLAGS_LOGIC, _NMD_FLAGS_SUB, _NMD_FLAGS_LOGIC, _NMD_FLAGS_SUB, _NMD_FLAGS_LOGIC };
+
+/* Computes 'inc', 'dec', 'not' or 'neg' and records the flags. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_unary(nmd_x86_interpreter* it, uint8_t operation, size_t size, uint64_t value)
+{
+	switch (operation)
+	{
+	case _NMD_UNARY_INC:
+		it->flags_aux = _nmd_x86_interpreter_carry(it);
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_INC, size, value, 1, value + 1);
+		return value + 1;
+	case _NMD_UNARY_DEC:
+		it->flags_aux = _nmd_x86_interpreter_carry(it);
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_DEC, size, value, 1, value - 1);
+		return value - 1;
+	case _NMD_UNARY_NOT:
+		return ~value;
+	default:
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_SUB, size, 0, value, 0 - value);
+		return 0 - value;
+	}
+}
+
+/* Computes a shift or a rotation and updates the flags. Returns 'value' if the masked count is zero, which changes nothing. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_shift(nmd_x86_interpreter* it, uint8_t operation, size_t size, uint64_t value, uint64_t count)
+{
+	const size_t bits = size * 8;
+	uint64_t result;
+
+	count &= size == 8 ? 63 : 31;
+	if (!count)
+		return value;
+
+	switch (operation)
+	{
+	case _NMD_SHIFT_SHL:
+		result = value << count;
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_SHL, size, value, count, result);
+		return result;
+	case _NMD_SHIFT_SHR:
+		result = (value & _NMD_INTERPRETER_MASK(size)) >> count;
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_SHR, size, value, count, result);
+		return result;
+	case _NMD_SHIFT_SAR:
+		result = (uint64_t)((int64_t)_nmd_x86_interpreter_sign_extend(value, size) >> count);
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_SAR, size, value, count, result);
+		return result;
+	default:
+		/* Rotations only change CF and OF. */
+		value &= _NMD_INTERPRETER_MASK(size);
+		count %= bits;
+		if (operation == _NMD_SHIFT_ROL)
+			result = count ? (value << count) | (value >> (bits - count)) : value;
+		else
+			result = count ? (value >> count) | (value << (bits - count)) : value;
+		result &= _NMD_INTERPRETER_MASK(size);
+
+		_nmd_x86_interpreter_materialize(it);
+		it->rflags &= ~(uint64_t)0x801;
+		if (operation == _NMD_SHIFT_ROL)
+			it->rflags |= (result & 1) | ((uint64_t)(((result >> (bits - 1)) ^ result) & 1) << 11);
+		else
+			it->rflags |= ((result >> (bits - 1)) & 1) | ((uint64_t)(((result >> (bits - 1)) ^ (result >> (bits - 2))) & 1) << 11);
+		return result;
+	}
+}
+
+/* Executes 'mul', 'imul', 'div' or 'idiv' with 'rdx:rax'. Returns false on a divide error, in which case nothing changed. */
+NMD_ASSEMBLY_API bool _nmd_x86_interpreter_muldiv(nmd_x86_interpreter* it, uint8_t operation, size_t size, uint64_t src)
+{
+	const uint64_t mask = _NMD_INTERPRETER_MASK(size);
+	const size_t bits = size * 8;
+	uint64_t a = it->regs[NMD_X86_GPR_RAX] & mask, d = it->regs[NMD_X86_GPR_RDX] & mask, low, high, quotient, remainder;
+	bool dividend_negative, divisor_negative;
+
+	src &= mask;
+	if (operation == _NMD_MULDIV_MUL || operation == _NMD_MULDIV_IMUL)
+	{
+		if (size == 8)
+		{
+			low = _nmd_x86_interpreter_multiply(a, src, &high);
+			if (operation == _NMD_MULDIV_IMUL)
+			{
+				high -= ((int64_t)a < 0 ? src : 0) + ((int64_t)src < 0 ? a : 0);
+				it->flags_aux = high != (uint64_t)((int64_t)low >> 63);
+			}
+			else
+				it->flags_aux = high != 0;
+		}
+		else if (operation == _NMD_MULDIV_IMUL)
+		{
+			low = (uint64_t)((int64_t)_nmd_x86_interpreter_sign_extend(a, size) * (int64_t)_nmd_x86_interpreter_sign_extend(src, size));
+			high = low >> bits;
+			it->flags_aux = _nmd_x86_interpreter_sign_extend(low, size) != low;
+		}
+		else
+		{
+			low = a * src;
+			high = low >> bits;
+			it->flags_aux = high != 0;
+		}
+
+		_nmd_x86_interpreter_record(it, _NMD_FLAGS_MUL, size, a, src, low);
+		if (size == 1)
+			_nmd_x86_interpreter_set(it, NMD_X86_GPR_RAX, 2, low);
+		else
+		{
+			_nmd_x86_interpreter_set(it, NMD_X86_GPR_RAX, size, low);
+			_nmd_x86_interpreter_set(it, NMD_X86_GPR_RDX, size, high);
+		}
+		return true;
+	}
+
+	if (!src)
+		return false;
+
+	if (size == 1)
+	{
+		d = (it->regs[NMD_X86_GPR_RAX] >> 8) & 0xff;
+		a &= 0xff;
+	}
+
+	if (operation == _NMD_MULDIV_DIV)
+	{
+		if (size == 8)
+		{
+			if (!_nmd_x86_interpreter_divide(d, a, src, &quotient, &remainder))
+				return false;
+		}
+		else
+		{
+			low = (d << bits) | a;
+			quotient = low / src;
+			remainder = low % src;
+			if (quotient > mask)
+				return false;
+		}
+	}
+	else
+	{
+		/* Divide the magnitudes, then check that the signed quotient fits. */
+		dividend_negative = size == 8 ? (int64_t)d < 0 : (int64_t)_nmd_x86_interpreter_sign_extend((d << bits) | a, size * 2) < 0;
+		divisor_negative = (src & _NMD_INTERPRETER_SIGN(size)) != 0;
+		if (size != 8)
+		{
+			a = _nmd_x86_interpreter_sign_extend((d << bits) | a, size * 2);
+			d = 0;
+			if (dividend_negative)
+				a = 0 - a;
+		}
+		else if (dividend_negative)
+		{
+			a = 0 - a;
+			d = ~d + (a == 0);
+		}
+		if (divisor_negative)
+			src = (0 - src) & mask;
+
+		if (size == 8)
+		{
+			if (!_nmd_x86_interpreter_divide(d, a, src, &quotient, &remainder))
+				return false;
+		}
+		else
+		{
+			quotient = a / src;
+			remainder = a % src;
+		}
+
+		if (quotient > _NMD_INTERPRETER_SIGN(size) - (dividend_negative == divisor_negative))
+			return false;
+		if (dividend_negative != divisor_negative)
+			quotient = 0 - quotient;
+		if (dividend_negative)
+			remainder = 0 - remainder;
+	}
+
+	_nmd_x86_interpreter_materialize(it);
+	if (size == 1)
+		it->regs[NMD_X86_GPR_RAX] = (it->regs[NMD_X86_GPR_RAX] & ~(uint64_t)0xffff) | (quotient & 0xff) | ((remainder & 0xff) << 8);
+	else
+	{
+		_nmd_x86_interpreter_set(it, NMD_X86_GPR_RAX, size, quotient);
+		_nmd_x86_interpreter_set(it, NMD_X86_GPR_RDX, size, remainder);
+	}
+	return true;
+}
+
+/* Returns the unsigned or signed('is_signed') product of 'a' and 'b' truncated to 'size' bytes and records the flags of 'imul'. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_imul(nmd_x86_interpreter* it, size_t size, uint64_t a, uint64_t b)
+{
+	uint64_t low, high;
+
+	if (size == 8)
+	{
+		low = _nmd_x86_interpreter_multiply(a, b, &high);
+		high -= ((int64_t)a < 0 ? b : 0) + ((int64_t)b < 0 ? a : 0);
+		it->flags_aux = high != (uint64_t)((int64_t)low >> 63);
+	}
+	else
+	{
+		low = (uint64_t)((int64_t)_nmd_x86_interpreter_sign_extend(a, size) * (int64_t)_nmd_x86_interpreter_sign_extend(b, size));
+		it->flags_aux = _nmd_x86_interpreter_sign_extend(low, size) != low;
+	}
+
+	_nmd_x86_interpreter_record(it, _NMD_FLAGS_MUL, size, a, b, low);
+	return low;
+}
+
+/* Removes all blocks. */
+NMD_ASSEMBLY_API void _nmd_x86_interpreter_flush_blocks(nmd_x86_interpreter* it)
+{
+	size_t i;
+	for (i = 0; i < it->map_capacity; i++)
+		it->block_map[i] = _NMD_INTERPRETER_NO_BLOCK;
+
+	it->num_blocks = 0;
+	it->num_uops = 0;
+	it->code_begin = 0xffffffffffffffff;
+	it->code_end = 0;
+	it->code_modified = false;
+	it->num_flushes++;
+}
+
+/* Copies the bytes of the instruction at 'address' to 'buffer'. Returns the number of bytes, less than 15 if the next page is not mapped. */
+_NMD_FORCE_INLINE size_t _nmd_x86_interpreter_fetch(nmd_x86_interpreter* it, uint64_t address, uint8_t* buffer)
+{
+	const uint8_t* page;
+	size_t i;
+
+	for (i = 0; i < NMD_X86_MAXIMUM_INSTRUCTION_LENGTH; i++)
+	{
+		page = _nmd_x86_interpreter_page(it, address + i, false);
+		if (!page)
+			break;
+		buffer[i] = page[(address + i) & 0xfff];
+	}
+
+	return i;
+}
+
+/* Returns the number of a byte register: 4 to 7 are 'ah' to 'bh' unless the instruction has a REX prefix. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_interpreter_byte_register(const nmd_x86_instruction* instruction, uint8_t reg)
+{
+	return !instruction->has_rex && reg >= 4 && reg < 8 ? (uint8_t)((reg - 4) | _NMD_INTERPRETER_HIGH_BYTE) : reg;
+}
+
+/* Returns the number of a register operand of 'size' bytes. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_interpreter_register(const nmd_x86_instruction* instruction, uint8_t reg, size_t size)
+{
+	return size == 1 ? _nmd_x86_interpreter_byte_register(instruction, reg) : reg;
+}
+
+/* Fills the memory operand of a micro-op. RIP-relative displacements become absolute. Returns false for 32-bit addressing, which is not supported. */
+_NMD_FORCE_INLINE bool _nmd_x86_interpreter_memory_operand(const nmd_x86_instruction* instruction, uint64_t next, nmd_x86_micro_op* uop)
+{
+	const uint8_t rex_b = instruction->prefixes & NMD_X86_PREFIXES_REX_B ? 8 : 0;
+	uint8_t index;
+
+	if (instruction->prefixes & NMD_X86_PREFIXES_ADDRESS_SIZE_OVERRIDE)
+		return false;
+
+	uop->disp = instruction->disp_mask ? _nmd_x86_interpreter_sign_extend(instruction->displacement, instruction->disp_mask) : 0;
+	if (instruction->modrm.fields.rm == 0b100)
+	{
+		index = (uint8_t)(instruction->sib.fields.index | (instruction->prefixes & NMD_X86_PREFIXES_REX_X ? 8 : 0));
+		uop->index = index == 4 ? _NMD_INTERPRETER_ZERO : index;
+		uop->scale = instruction->sib.fields.scale;
+		uop->base = instruction->sib.fields.base == 0b101 && instruction->modrm.fields.mod == 0b00 ? _NMD_INTERPRETER_ZERO : (uint8_t)(instruction->sib.fields.base | rex_b);
+	}
+	else if (instruction->modrm.fields.rm == 0b101 && instruction->modrm.fields.mod == 0b00)
+		uop->disp += next;
+	else
+		uop->base = (uint8_t)(instruction->modrm.fields.rm | rex_b);
+
+	if (instruction->prefixes & NMD_X86_PREFIXES_FS_SEGMENT_OVERRIDE)
+		uop->scale |= 1 << 2;
+	else if (instruction->prefixes & NMD_X86_PREFIXES_GS_SEGMENT_OVERRIDE)
+		uop->scale |= 2 << 2;
+
+	return true;
+}
+
+/* Returns the micro-op of an ALU operation on a register and a register('immediate' false) or an immediate. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_interpreter_alu_uop(uint8_t operation, bool immediate)
+{
+	static const uint8_t register_uops[9] = { _NMD_UOP_ADD_RR, _NMD_UOP_OR_RR, _NMD_UOP_ALU_RR, _NMD_UOP_ALU_RR, _NMD_UOP_AND_RR, _NMD_UOP_SUB_RR, _NMD_UOP_XOR_RR, _NMD_UOP_CMP_RR, _NMD_UOP_TEST_RR };
+	static const uint8_t immediate_uops[9] = { _NMD_UOP_ADD_RI, _NMD_UOP_OR_RI, _NMD_UOP_ALU_RI, _NMD_UOP_ALU_RI, _NMD_UOP_AND_RI, _NMD_UOP_SUB_RI, _NMD_UOP_XOR_RI, _NMD_UOP_CMP_RI, _NMD_UOP_TEST_RI };
+	return immediate ? immediate_uops[operation] : register_uops[operation];
+}
+
+/* Returns true if the micro-op ends a block. */
+_NMD_FORCE_INLINE bool _nmd_x86_interpreter_ends_block(uint8_t op)
+{
+	return op >= _NMD_UOP_JMP;
+}
+
+/*
+Translates an instruction into a micro-op. Operands are taken from the instruction's raw fields(ModR/M, SIB, REX and prefixes), so only the
+decoder's minimal features are needed. Stores the status flags the instruction writes and reads. Returns false if it's not supported.
+*/
+NMD_ASSEMBLY_API bool _nmd_x86_interpreter_translate_instruction(const nmd_x86_instruction* instruction, uint64_t address, nmd_x86_micro_op* uop, uint32_t* written, uint32_t* tested)
+{
+	const uint64_t next = address + instruction->length;
+	const uint8_t op = instruction->opcode;
+	const size_t operand_size = instruction->prefixes & NMD_X86_PREFIXES_REX_W ? 8 : (instruction->prefixes & NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE ? 2 : 4);
+	const uint8_t reg = (uint8_t)(instruction->modrm.fields.reg | (instruction->prefixes & NMD_X86_PREFIXES_REX_R ? 8 : 0));
+	const uint8_t rm = (uint8_t)(instruction->modrm.fields.rm | (instruction->prefixes & NMD_X86_PREFIXES_REX_B ? 8 : 0));
+	const bool memory = instruction->has_modrm && instruction->modrm.fields.mod != 0b11;
+	const uint64_t immediate = instruction->imm_mask ? _nmd_x86_interpreter_sign_extend(instruction->immediate, instruction->imm_mask) : 0;
+	size_t size = operand_size;
+	uint8_t operation;
+
+	uop->op = _NMD_UOP_EXIT;
+	uop->reg = reg;
+	uop->base = _NMD_INTERPRETER_ZERO;
+	uop->index = _NMD_INTERPRETER_ZERO;
+	uop->scale = 0;
+	uop->length = instruction->length;
+	uop->extra = 0;
+	uop->disp = 0;
+	uop->imm = immediate;
+
+	*written = (instruction->modified_flags.eflags | instruction->set_flags.eflags | instruction->cleared_flags.eflags | instruction->undefined_flags.eflags) & _NMD_INTERPRETER_STATUS_FLAGS;
+	*tested = instruction->tested_flags.eflags & _NMD_INTERPRETER_STATUS_FLAGS;
+
+	if (instruction->encoding != NMD_X86_ENCODING_LEGACY || (memory && !_nmd_x86_interpreter_memory_operand(instruction, next, uop)))
+		return false;
+
+	if (instruction->opcode_map == NMD_X86_OPCODE_MAP_DEFAULT)
+	{
+		if (op < 0x40 && (op & 7) < 6)
+		{
+			/* add, or, adc, sbb, and, sub, xor, cmp */
+			operation = op >> 3;
+			size = op & 1 ? operand_size : 1;
+			uop->extra = operation;
+			if (operation == _NMD_ALU_ADC || operation == _NMD_ALU_SBB)
+				*tested |= 1; /* The decoder doesn't report the carry in. */
+
+			if ((op & 7) >= 4)
+			{
+				uop->op = _nmd_x86_interpreter_alu_uop(operation, true);
+				uop->reg = NMD_X86_GPR_RAX;
+			}
+			else if (memory)
+			{
+				uop->op = op & 2 ? _NMD_UOP_ALU_RM : _NMD_UOP_ALU_MR;
+				uop->reg = _nmd_x86_interpreter_register(instruction, reg, size);
+			}
+			else
+			{
+				uop->op = _nmd_x86_interpreter_alu_uop(operation, false);
+				uop->reg = _nmd_x86_interpreter_register(instruction, op & 2 ? reg : rm, size);
+				uop->base = _nmd_x86_interpreter_register(instruction, op & 2 ? rm : reg, size);
+			}
+		}
+		else if (op >= 0x50 && op <= 0x5f)
+		{
+			uop->op = op < 0x58 ? _NMD_UOP_PUSH_R : _NMD_UOP_POP_R;
+			uop->reg = (uint8_t)((op & 7) | (instruction->prefixes & NMD_X86_PREFIXES_REX_B ? 8 : 0));
+			size = instruction->prefixes & NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE ? 2 : 8;
+		}
+		else if (op == 0x63)
+		{
+			/* movsxd, or a 32-bit mov without REX.W */
+			uop->op = memory ? (size == 8 ? _NMD_UOP_MOVSX_RM : _NMD_UOP_LOAD) : (size == 8 ? _NMD_UOP_MOVSX_RR : _NMD_UOP_MOV_RR);
+			uop->base = memory ? uop->base : rm;
+			uop->extra = 4;
+		}
+		else if (op == 0x68 || op == 0x6a)
+		{
+			uop->op = _NMD_UOP_PUSH_I;
+			size = operand_size == 2 ? 2 : 8;
+		}
+		else if (op == 0x69 || op == 0x6b)
+		{
+			uop->op = memory ? _NMD_UOP_IMUL_RMI : _NMD_UOP_IMUL_RRI;
+			uop->base = memory ? uop->base : rm;
+		}
+		else if ((op >= 0x70 && op <= 0x7f) || op == 0xe9 || op == 0xeb || op == 0xe8)
+		{
+			uop->op = op == 0xe8 ? _NMD_UOP_CALL : (op >= 0x70 && op <= 0x7f ? _NMD_UOP_JCC : _NMD_UOP_JMP);
+			uop->extra = op & 0xf;
+			uop->imm = next + immediate;
+			uop->disp = next;
+			size = 8;
+		}
+		else if (op >= 0x80 && op <= 0x83 && op != 0x82)
+		{
+			operation = instruction->modrm.fields.reg;
+			size = op == 0x80 ? 1 : operand_size;
+			uop->extra = operation;
+			if (operation == _NMD_ALU_ADC || operation == _NMD_ALU_SBB)
+				*tested |= 1;
+			uop->op = memory ? _NMD_UOP_ALU_MI : _nmd_x86_interpreter_alu_uop(operation, true);
+			uop->reg = _nmd_x86_interpreter_register(instruction, rm, size);
+		}
+		else if (op >= 0x84 && op <= 0x8b)
+		{
+			/* test, xchg and mov: 'reg' is the destination of 8Ah-8Bh and the source of the others. */
+			size = op & 1 ? operand_size : 1;
+			uop->reg = _nmd_x86_interpreter_register(instruction, reg, size);
+			if (!memory)
+				uop->base = _nmd_x86_interpreter_register(instruction, rm, size);
+
+			if (op <= 0x85)
+			{
+				uop->op = memory ? _NMD_UOP_ALU_RM : _NMD_UOP_TEST_RR;
+				uop->extra = _NMD_ALU_TEST;
+			}
+			else if (op <= 0x87)
+				uop->op = memory ? _NMD_UOP_XCHG_RM : _NMD_UOP_XCHG_RR;
+			else if (op <= 0x89 && memory)
+				uop->op = _NMD_UOP_STORE;
+			else if (op <= 0x89)
+			{
+				uop->op = _NMD_UOP_MOV_RR;
+				uop->base = uop->reg;
+				uop->reg = _nmd_x86_interpreter_register(instruction, rm, size);
+			}
+			else
+				uop->op = memory ? _NMD_UOP_LOAD : _NMD_UOP_MOV_RR;
+		}
+		else if (op == 0x8d && memory)
+		{
+			uop->op = _NMD_UOP_LEA;
+			uop->scale &= 3;
+		}
+		else if (op == 0x90 && !(instruction->prefixes & NMD_X86_PREFIXES_REX_B))
+			uop->op = _NMD_UOP_NOP;
+		else if (op >= 0x90 && op <= 0x97)
+		{
+			uop->op = _NMD_UOP_XCHG_RR;
+			uop->reg = NMD_X86_GPR_RAX;
+			uop->base = (uint8_t)((op & 7) | (instruction->prefixes & NMD_X86_PREFIXES_REX_B ? 8 : 0));
+		}
+		else if (op == 0x98 || op == 0x99)
+			uop->op = op == 0x98 ? _NMD_UOP_CONVERT_A : _NMD_UOP_CONVERT_D;
+		else if (op == 0xa4 || op == 0xa5 || op == 0xaa || op == 0xab)
+		{
+			uop->op = _NMD_UOP_STRING;
+			size = op & 1 ? operand_size : 1;
+			uop->extra = (uint8_t)((op >= 0xaa ? _NMD_STRING_STOS : _NMD_STRING_MOVS) | (instruction->prefixes & (NMD_X86_PREFIXES_REPEAT | NMD_X86_PREFIXES_REPEAT_NOT_ZERO) ? _NMD_STRING_REP : 0));
+			if (instruction->prefixes & NMD_X86_PREFIXES_ADDRESS_SIZE_OVERRIDE)
+				return false;
+		}
+		else if (op == 0xa8 || op == 0xa9)
+		{
+			uop->op = _NMD_UOP_TEST_RI;
+			uop->reg = NMD_X86_GPR_RAX;
+			size = op & 1 ? operand_size : 1;
+		}
+		else if (op >= 0xb0 && op <= 0xbf)
+		{
+			uop->op = _NMD_UOP_MOV_RI;
+			size = op < 0xb8 ? 1 : operand_size;
+			uop->reg = _nmd_x86_interpreter_register(instruction, (uint8_t)((op & 7) | (instruction->prefixes & NMD_X86_PREFIXES_REX_B ? 8 : 0)), size);
+		}
+		else if (op == 0xc0 || op == 0xc1 || (op >= 0xd0 && op <= 0xd3))
+		{
+			operation = instruction->modrm.fields.reg == 6 ? _NMD_SHIFT_SHL : instruction->modrm.fields.reg;
+			if (operation == 2 || operation == 3)
+				return false;
+
+			size = op & 1 ? operand_size : 1;
+			uop->extra = operation;
+			uop->reg = _nmd_x86_interpreter_register(instruction, rm, size);
+			if (op >= 0xd2)
+			{
+				uop->op = memory ? _NMD_UOP_SHIFT_M_CL : _NMD_UOP_SHIFT_R_CL;
+				*written = 0; /* A count of zero changes no flag. */
+			}
+			else
+			{
+				uop->op = memory ? _NMD_UOP_SHIFT_M : _NMD_UOP_SHIFT_R;
+				uop->imm = op >= 0xd0 ? 1 : immediate & 0xff;
+				if (!(uop->imm & (size == 8 ? 63 : 31)))
+					*written = 0;
+			}
+		}
+		else if (op == 0xc2 || op == 0xc3)
+		{
+			uop->op = _NMD_UOP_RET;
+			uop->imm = op == 0xc2 ? instruction->immediate & 0xffff : 0;
+		}
+		else if ((op == 0xc6 || op == 0xc7) && instruction->modrm.fields.reg == 0)
+		{
+			size = op & 1 ? operand_size : 1;
+			uop->op = memory ? _NMD_UOP_STORE_I : _NMD_UOP_MOV_RI;
+			uop->reg = _nmd_x86_interpreter_register(instruction, rm, size);
+		}
+		else if (op == 0xc9)
+			uop->op = _NMD_UOP_LEAVE;
+		else if (op == 0xf5 || op == 0xf8 || op == 0xf9 || op == 0xfc || op == 0xfd)
+		{
+			uop->op = _NMD_UOP_FLAG;
+			uop->extra = (uint8_t)(op == 0xf5 ? _NMD_FLAG_CMC : (op == 0xf8 ? _NMD_FLAG_CLC : (op == 0xf9 ? _NMD_FLAG_STC : (op == 0xfc ? _NMD_FLAG_CLD : _NMD_FLAG_STD))));
+		}
+		else if (op == 0xf6 || op == 0xf7)
+		{
+			size = op & 1 ? operand_size : 1;
+			operation = instruction->modrm.fields.reg;
+			uop->extra = operation;
+			uop->reg = _nmd_x86_interpreter_register(instruction, rm, size);
+			if (operation <= 1)
+			{
+				uop->op = memory ? _NMD_UOP_ALU_MI : _NMD_UOP_TEST_RI;
+				uop->extra = _NMD_ALU_TEST;
+			}
+			else if (operation <= 3)
+				uop->op = memory ? _NMD_UOP_UNARY_M : _NMD_UOP_UNARY_R;
+			else
+				uop->op = memory ? _NMD_UOP_MULDIV_M : _NMD_UOP_MULDIV_R;
+		}
+		else if ((op == 0xfe && instruction->modrm.fields.reg <= 1) || op == 0xff)
+		{
+			operation = instruction->modrm.fields.reg;
+			size = op == 0xfe ? 1 : operand_size;
+			uop->extra = operation;
+			uop->reg = _nmd_x86_interpreter_register(instruction, rm, size);
+			if (operation <= 1)
+				uop->op = memory ? _NMD_UOP_UNARY_M : (operation == _NMD_UNARY_INC ? _NMD_UOP_INC_R : _NMD_UOP_DEC_R);
+			else if (operation == 2 || operation == 4)
+			{
+				uop->op = operation == 2 ? (memory ? _NMD_UOP_CALL_M : _NMD_UOP_CALL_R) : (memory ? _NMD_UOP_JMP_M : _NMD_UOP_JMP_R);
+				uop->disp = memory ? uop->disp : next;
+				uop->imm = next;
+				size = 8;
+			}
+			else if (operation == 6)
+			{
+				uop->op = memory ? _NMD_UOP_PUSH_M : _NMD_UOP_PUSH_R;
+				size = operand_size == 2 ? 2 : 8;
+			}
+			else
+				return false;
+		}
+		else
+			return false;
+	}
+	else if (instruction->opcode_map == NMD_X86_OPCODE_MAP_0F)
+	{
+		if (op == 0x1f)
+			uop->op = _NMD_UOP_NOP;
+		else if (op >= 0x40 && op <= 0x4f)
+		{
+			uop->op = memory ? _NMD_UOP_CMOV_RM : _NMD_UOP_CMOV_RR;
+			uop->base = memory ? uop->base : rm;
+			uop->extra = op & 0xf;
+		}
+		else if (op >= 0x80 && op <= 0x8f)
+		{
+			uop->op = _NMD_UOP_JCC;
+			uop->extra = op & 0xf;
+			uop->imm = next + immediate;
+			uop->disp = next;
+		}
+		else if (op >= 0x90 && op <= 0x9f)
+		{
+			uop->op = memory ? _NMD_UOP_SETCC_M : _NMD_UOP_SETCC_R;
+			uop->reg = _nmd_x86_interpreter_byte_register(instruction, rm);
+			uop->extra = op & 0xf;
+			size = 1;
+		}
+		else if (op == 0xaf)
+		{
+			uop->op = memory ? _NMD_UOP_IMUL_RM : _NMD_UOP_IMUL_RR;
+			uop->base = memory ? uop->base : rm;
+		}
+		else if (op == 0xb6 || op == 0xb7 || op == 0xbe || op == 0xbf)
+		{
+			uop->op = op < 0xb8 ? (memory ? _NMD_UOP_MOVZX_RM : _NMD_UOP_MOVZX_RR) : (memory ? _NMD_UOP_MOVSX_RM : _NMD_UOP_MOVSX_RR);
+			uop->extra = op & 1 ? 2 : 1;
+			uop->base = memory ? uop->base : (op & 1 ? rm : _nmd_x86_interpreter_byte_register(instruction, rm));
+		}
+		else
+			return false;
+	}
+	else
+		return false;
+
+	uop->size = (uint8_t)size;
+	return true;
+}
+
+/* Replaces a micro-op whose flags are never read with its variant that doesn't record them. */
+_NMD_FORCE_INLINE void _nmd_x86_interpreter_drop_flags(nmd_x86_micro_op* uop)
+{
+	switch (uop->op)
+	{
+	case _NMD_UOP_ADD_RR: case _NMD_UOP_ADD_RI: case _NMD_UOP_SUB_RR: case _NMD_UOP_SUB_RI: case _NMD_UOP_AND_RR: case _NMD_UOP_AND_RI:
+	case _NMD_UOP_OR_RR: case _NMD_UOP_OR_RI: case _NMD_UOP_XOR_RR: case _NMD_UOP_XOR_RI: case _NMD_UOP_INC_R: case _NMD_UOP_DEC_R:
+		uop->op++;
+		break;
+	case _NMD_UOP_CMP_RR: case _NMD_UOP_CMP_RI: case _NMD_UOP_TEST_RR: case _NMD_UOP_TEST_RI:
+		uop->op = _NMD_UOP_NOP;
+		break;
+	}
+}
+
+/*
+Translates the block at 'address' into micro-ops. The block ends after a branch, a return, an instruction that is not supported or 64
+instructions. A backward pass with the status flags each instruction writes and reads('modified_flags', 'tested_flags'...) removes the
+recording of flags that are overwritten before they are read. Flags are assumed to be read after the block.
+*/
+NMD_ASSEMBLY_API nmd_x86_interpreter_block* _nmd_x86_interpreter_translate(nmd_x86_interpreter* it, uint64_t address)
+{
+	nmd_x86_interpreter_block* const block = &it->blocks[it->num_blocks++];
+	nmd_x86_micro_op* const uops = &it->uops[it->num_uops];
+	uint32_t written[_NMD_INTERPRETER_MAX_BLOCK_INSTRUCTIONS], tested[_NMD_INTERPRETER_MAX_BLOCK_INSTRUCTIONS], live = _NMD_INTERPRETER_STATUS_FLAGS;
+	uint8_t buffer[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH];
+	nmd_x86_instruction instruction;
+	uint64_t current = address;
+	size_t num_instructions = 0, length, i;
+	nmd_x86_micro_op* exit;
+
+	block->address = address;
+	block->first_uop = (uint32_t)it->num_uops;
+	block->links[0] = block->links[1] = _NMD_INTERPRETER_NO_BLOCK;
+
+	for (;;)
+	{
+		exit = &uops[num_instructions];
+		if (num_instructions == _NMD_INTERPRETER_MAX_BLOCK_INSTRUCTIONS)
+		{
+			exit->op = _NMD_UOP_JMP;
+			exit->imm = current;
+			exit->length = 0;
+			break;
+		}
+
+		length = _nmd_x86_interpreter_fetch(it, current, buffer);
+		if (!nmd_x86_decode(buffer, length, &instruction, NMD_X86_MODE_64, _NMD_INTERPRETER_DECODER_FLAGS))
+		{
+			/* Decoding stopped at a page that is not mapped, or the bytes are not an instruction. */
+			exit->op = _NMD_UOP_EXIT;
+			exit->extra = (uint8_t)(length < NMD_X86_MAXIMUM_INSTRUCTION_LENGTH ? NMD_X86_INTERPRETER_EXIT_PAGE_FAULT : NMD_X86_INTERPRETER_EXIT_INVALID);
+			exit->imm = current + length;
+			exit->length = 0;
+			break;
+		}
+
+		if (!_nmd_x86_interpreter_translate_instruction(&instruction, current, exit, &written[num_instructions], &tested[num_instructions]))
+		{
+			exit->op = _NMD_UOP_EXIT;
+			exit->extra = NMD_X86_INTERPRETER_EXIT_UNSUPPORTED;
+			exit->length = 0;
+			break;
+		}
+
+		if (current < it->code_begin)
+			it->code_begin = current;
+		if (current + instruction.length > it->code_end)
+			it->code_end = current + instruction.length;
+
+		current += instruction.length;
+		if (_nmd_x86_interpreter_ends_block(uops[num_instructions++].op))
+			break;
+	}
+
+	for (i = num_instructions; i > 0; i--)
+	{
+		if (!(written[i - 1] & live))
+			_nmd_x86_interpreter_drop_flags(&uops[i - 1]);
+		live = (live & ~written[i - 1]) | tested[i - 1];
+	}
+
+	block->num_instructions = (uint32_t)num_instructions;
+	it->num_uops += num_instructions + (exit == &uops[num_instructions]);
+	return block;
+}
+
+/* Returns the block at 'address', translating it if it's not in the cache. The cache is flushed when it's full. */
+NMD_ASSEMBLY_API nmd_x86_interpreter_block* _nmd_x86_interpreter_find_block(nmd_x86_interpreter* it, uint64_t address)
+{
+	size_t slot = (size_t)((address * 0x9e3779b97f4a7c15) >> 32) & (it->map_capacity - 1);
+	uint32_t index;
+
+	for (;; slot = (slot + 1) & (it->map_capacity - 1))
+	{
+		index = it->block_map[slot];
+		if (index == _NMD_INTERPRETER_NO_BLOCK)
+			break;
+		if (it->blocks[index].address == address)
+			return &it->blocks[index];
+	}
+
+	if (it->num_blocks == it->max_blocks || it->num_uops + _NMD_INTERPRETER_MAX_BLOCK_INSTRUCTIONS + 1 > it->max_uops || (it->num_blocks + 1) * 2 > it->map_capacity)
+	{
+		_nmd_x86_interpreter_flush_blocks(it);
+		slot = (size_t)((address * 0x9e3779b97f4a7c15) >> 32) & (it->map_capacity - 1);
+	}
+
+	it->block_map[slot] = (uint32_t)it->num_blocks;
+	return _nmd_x86_interpreter_translate(it, address);
+}
+
+/* Returns the address of the instruction of 'uop' and removes the instructions of the block from it onwards from the count of executed instructions. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_interpreter_leave(nmd_x86_interpreter* it, const nmd_x86_interpreter_block* block, const nmd_x86_micro_op* uop)
+{
+	const nmd_x86_micro_op* p = &it->uops[block->first_uop];
+	uint64_t address = block->address;
+
+	for (; p < uop; p++)
+		address += p->length;
+
+	it->num_instructions -= block->num_instructions - (uint64_t)(uop - &it->uops[block->first_uop]);
+	return address;
+}
+
+/*
+Returns the host address of the page at 'address' in a 'nmd_x86_page_table', or null if it's not mapped or 'write' is true and it's not writable.
+The pages are found with a binary search. Pass this function to nmd_x86_interpreter_init() with a pointer to the page table as the context.
+Parameters:
+ - page_table [in] A pointer to a 'nmd_x86_page_table' whose pages are sorted by address.
+ - address    [in] The address of the page, a multiple of 4096.
+ - write      [in] True if the page is written to.
+*/
+NMD_ASSEMBLY_API uint8_t* nmd_x86_page_table_translate(void* page_table, uint64_t address, bool write)
+{
+	const nmd_x86_page_table* const table = (const nmd_x86_page_table*)page_table;
+	size_t low = 0, high = table->num_pages, middle;
+
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (table->pages[middle].address < address)
+			low = middle + 1;
+		else if (table->pages[middle].address > address)
+			high = middle;
+		else
+			return write && !table->pages[middle].writable ? 0 : table->pages[middle].data;
+	}
+
+	return 0;
+}
+
+/*
+Removes all translated blocks and the cached page translations. Call it after changing the code or the pages behind the interpreter's back,
+writes made by the interpreter itself are detected.
+Parameters:
+ - it [in] A pointer to the interpreter.
+*/
+NMD_ASSEMBLY_API void nmd_x86_interpreter_flush(nmd_x86_interpreter* it)
+{
+	size_t i;
+	for (i = 0; i < NMD_X86_TLB_SIZE; i++)
+	{
+		it->tlb[0][i].page = 1;
+		it->tlb[1][i].page = 1;
+	}
+
+	_nmd_x86_interpreter_flush_blocks(it);
+}
+
+/*
+Initializes an interpreter of 64-bit code. The registers are zero and 'rflags' is 202h. Memory is accessed through 'translate', which returns the
+host address of a page of 4096 bytes. Translated blocks are stored in the given arrays; when one of them is full, all blocks are removed.
+Parameters:
+ - it           [out] A pointer to the interpreter.
+ - translate    [in]  A function that returns the host address of a page, see nmd_x86_page_table_translate().
+ - context      [in]  The first argument of 'translate'.
+ - blocks       [in]  A pointer to an array of 'nmd_x86_interpreter_block'.
+ - max_blocks   [in]  The number of elements in 'blocks'.
+ - uops         [in]  A pointer to an array of 'nmd_x86_micro_op'.
+ - max_uops     [in]  The number of elements in 'uops', at least 'NMD_X86_INTERPRETER_MIN_UOPS'.
+ - block_map    [in]  A pointer to an array of 'uint32_t' used as a hash table of the blocks.
+ - map_capacity [in]  The number of elements in 'block_map', a power of two larger than 'max_blocks'(twice as large is recommended).
+*/
+NMD_ASSEMBLY_API void nmd_x86_interpreter_init(nmd_x86_interpreter* it, nmd_x86_translate_page translate, void* context, nmd_x86_interpreter_block* blocks, size_t max_blocks, nmd_x86_micro_op* uops, size_t max_uops, uint32_t* block_map, size_t map_capacity)
+{
+	size_t i;
+	for (i = 0; i < sizeof(it->regs) / sizeof(it->regs[0]); i++)
+		it->regs[i] = 0;
+
+	it->rip = 0;
+	it->rflags = 0x202;
+	it->flags_kind = _NMD_FLAGS_NONE;
+	it->translate = translate;
+	it->context = context;
+	it->blocks = blocks;
+	it->max_blocks = max_blocks;
+	it->uops = uops;
+	it->max_uops = max_uops;
+	it->block_map = block_map;
+	it->map_capacity = map_capacity;
+	it->num_instructions = 0;
+	it->num_flushes = 0;
+	it->fault_address = 0;
+
+	nmd_x86_interpreter_flush(it);
+	it->num_flushes = 0;
+}
+
+/*
+Returns 'rflags' with the status flags computed from the last instruction that modified them.
+Parameters:
+ - it [in] A pointer to the interpreter.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_interpreter_get_flags(const nmd_x86_interpreter* it)
+{
+	return _nmd_x86_interpreter_compute_flags(it);
+}
+
+/*
+Sets 'rflags'.
+Parameters:
+ - it    [in] A pointer to the interpreter.
+ - flags [in] The new value of 'rflags'.
+*/
+NMD_ASSEMBLY_API void nmd_x86_interpreter_set_flags(nmd_x86_interpreter* it, uint64_t flags)
+{
+	it->rflags = flags;
+	it->flags_kind = _NMD_FLAGS_NONE;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define _NMD_INTERPRETER_THREADED
+#endif
+
+#ifdef _NMD_INTERPRETER_THREADED
+#define _NMD_INTERPRETER_LABEL(name) &&_nmd_uop_##name,
+#define _NMD_HANDLER(name) case _NMD_UOP_##name: _nmd_uop_##name:
+#define _NMD_DISPATCH() goto *handlers[uop->op]
+#else
+#define _NMD_HANDLER(name) case _NMD_UOP_##name:
+#define _NMD_DISPATCH() goto _nmd_dispatch
+#endif
+
+#define _NMD_NEXT() { uop++; _NMD_DISPATCH(); }
+
+/* Continues after an instruction that wrote memory, leaving the block if it wrote translated code. */
+#define _NMD_NEXT_STORE() { if (it->code_modified) goto _nmd_code_modified; _NMD_NEXT(); }
+
+#define _NMD_ADDRESS() (it->regs[uop->base] + (it->regs[uop->index] << (uop->scale & 3)) + uop->disp + it->regs[_NMD_INTERPRETER_ZERO + (uop->scale >> 2)])
+#define _NMD_GET(reg) _nmd_x86_interpreter_get(it, reg, uop->size)
+#define _NMD_SET(reg, value) _nmd_x86_interpreter_set(it, reg, uop->size, value)
+#define _NMD_READ(address, size, value) if (!_nmd_x86_interpreter_read(it, address, size, value)) goto _nmd_fault
+#define _NMD_WRITE(address, size, value) if (!_nmd_x86_interpreter_write(it, address, size, value)) goto _nmd_fault
+
+/* Generates the handlers of a binary operation on registers, with and without recording the flags. */
+#define _NMD_BINARY(name, kind, expression) \
+	_NMD_HANDLER(name##_RR) dst = _NMD_GET(uop->reg); src = _NMD_GET(uop->base); result = expression; _NMD_SET(uop->reg, result); _nmd_x86_interpreter_record(it, kind, uop->size, dst, src, result); _NMD_NEXT(); \
+	_NMD_HANDLER(name##_RR_NF) dst = _NMD_GET(uop->reg); src = _NMD_GET(uop->base); _NMD_SET(uop->reg, expression); _NMD_NEXT(); \
+	_NMD_HANDLER(name##_RI) dst = _NMD_GET(uop->reg); src = uop->imm; result = expression; _NMD_SET(uop->reg, result); _nmd_x86_interpreter_record(it, kind, uop->size, dst, src, result); _NMD_NEXT(); \
+	_NMD_HANDLER(name##_RI_NF) dst = _NMD_GET(uop->reg); src = uop->imm; _NMD_SET(uop->reg, expression); _NMD_NEXT();
+
+/*
+Executes instructions starting at 'it->rip' until 'max_instructions' instructions have been executed(checked when a block is left, so a few more
+may be executed) or an instruction can't be executed. Code is translated a basic block at a time into micro-ops with decoded operands, which are
+cached and executed with one indirect jump per instruction(computed goto when the compiler supports it). Blocks are chained: each branch remembers
+the block it went to last time. The status flags are computed lazily, and not at all when the flags an instruction writes are overwritten before
+being read. On return, 'it->rip' is the address of the next instruction to execute, or of the instruction that couldn't be executed.
+Parameters:
+ - it               [in] A pointer to the interpreter.
+ - max_instructions [in] The number of instructions to execute.
+*/
+NMD_ASSEMBLY_API NMD_X86_INTERPRETER_EXIT nmd_x86_interpreter_run(nmd_x86_interpreter* it, uint64_t max_instructions)
+{
+#ifdef _NMD_INTERPRETER_THREADED
+	static const void* const handlers[] = { _NMD_INTERPRETER_UOPS(_NMD_INTERPRETER_LABEL) };
+#endif
+	const uint64_t limit = it->num_instructions + max_instructions;
+	nmd_x86_interpreter_block* block;
+	const nmd_x86_micro_op* uop;
+	uint64_t dst, src, result, address, value, target, count;
+	uint32_t unlinked = _NMD_INTERPRETER_NO_BLOCK, *link;
+	size_t num_flushes;
+
+	if (it->code_modified)
+		_nmd_x86_interpreter_flush_blocks(it);
+
+	target = it->rip;
+	link = &unlinked;
+
+_nmd_branch:
+	if (it->num_instructions >= limit)
+	{
+		it->rip = target;
+		return NMD_X86_INTERPRETER_EXIT_LIMIT;
+	}
+
+	if (*link != _NMD_INTERPRETER_NO_BLOCK && it->blocks[*link].address == target)
+		block = &it->blocks[*link];
+	else
+	{
+		num_flushes = it->num_flushes;
+		block = _nmd_x86_interpreter_find_block(it, target);
+		if (num_flushes == it->num_flushes && link != &unlinked)
+			*link = (uint32_t)(block - it->blocks);
+	}
+
+	it->num_instructions += block->num_instructions;
+	uop = &it->uops[block->first_uop];
+
+	for (;;)
+	{
+#ifndef _NMD_INTERPRETER_THREADED
+	_nmd_dispatch:
+#endif
+		switch (uop->op)
+		{
+		_NMD_HANDLER(NOP) _NMD_NEXT();
+		_NMD_HANDLER(MOV_RR) _NMD_SET(uop->reg, _NMD_GET(uop->base)); _NMD_NEXT();
+		_NMD_HANDLER(MOV_RI) _NMD_SET(uop->reg, uop->imm); _NMD_NEXT();
+		_NMD_HANDLER(LOAD) _NMD_READ(_NMD_ADDRESS(), uop->size, &value); _NMD_SET(uop->reg, value); _NMD_NEXT();
+		_NMD_HANDLER(STORE) _NMD_WRITE(_NMD_ADDRESS(), uop->size, _NMD_GET(uop->reg)); _NMD_NEXT_STORE();
+		_NMD_HANDLER(STORE_I) _NMD_WRITE(_NMD_ADDRESS(), uop->size, uop->imm); _NMD_NEXT_STORE();
+		_NMD_HANDLER(LEA) _NMD_SET(uop->reg, _NMD_ADDRESS()); _NMD_NEXT();
+		_NMD_HANDLER(MOVZX_RR) _NMD_SET(uop->reg, _nmd_x86_interpreter_get(it, uop->base, uop->extra)); _NMD_NEXT();
+		_NMD_HANDLER(MOVZX_RM) _NMD_READ(_NMD_ADDRESS(), uop->extra, &value); _NMD_SET(uop->reg, value); _NMD_NEXT();
+		_NMD_HANDLER(MOVSX_RR) _NMD_SET(uop->reg, _nmd_x86_interpreter_sign_extend(_nmd_x86_interpreter_get(it, uop->base, uop->extra), uop->extra)); _NMD_NEXT();
+		_NMD_HANDLER(MOVSX_RM) _NMD_READ(_NMD_ADDRESS(), uop->extra, &value); _NMD_SET(uop->reg, _nmd_x86_interpreter_sign_extend(value, uop->extra)); _NMD_NEXT();
+
+		_NMD_BINARY(ADD, _NMD_FLAGS_ADD, dst + src)
+		_NMD_BINARY(SUB, _NMD_FLAGS_SUB, dst - src)
+		_NMD_BINARY(AND, _NMD_FLAGS_LOGIC, dst & src)
+		_NMD_BINARY(OR, _NMD_FLAGS_LOGIC, dst | src)
+		_NMD_BINARY(XOR, _NMD_FLAGS_LOGIC, dst ^ src)
+
+		_NMD_HANDLER(CMP_RR) dst = _NMD_GET(uop->reg); src = _NMD_GET(uop->base); _nmd_x86_interpreter_record(it, _NMD_FLAGS_SUB, uop->size, dst, src, dst - src); _NMD_NEXT();
+		_NMD_HANDLER(CMP_RI) dst = _NMD_GET(uop->reg); _nmd_x86_interpreter_record(it, _NMD_FLAGS_SUB, uop->size, dst, uop->imm, dst - uop->imm); _NMD_NEXT();
+		_NMD_HANDLER(TEST_RR) result = _NMD_GET(uop->reg) & _NMD_GET(uop->base); _nmd_x86_interpreter_record(it, _NMD_FLAGS_LOGIC, uop->size, result, result, result); _NMD_NEXT();
+		_NMD_HANDLER(TEST_RI) result = _NMD_GET(uop->reg) & uop->imm; _nmd_x86_interpreter_record(it, _NMD_FLAGS_LOGIC, uop->size, result, result, result); _NMD_NEXT();
+		_NMD_HANDLER(INC_R) _NMD_SET(uop->reg, _nmd_x86_interpreter_unary(it, _NMD_UNARY_INC, uop->size, _NMD_GET(uop->reg))); _NMD_NEXT();
+		_NMD_HANDLER(INC_R_NF) _NMD_SET(uop->reg, _NMD_GET(uop->reg) + 1); _NMD_NEXT();
+		_NMD_HANDLER(DEC_R) _NMD_SET(uop->reg, _nmd_x86_interpreter_unary(it, _NMD_UNARY_DEC, uop->size, _NMD_GET(uop->reg))); _NMD_NEXT();
+		_NMD_HANDLER(DEC_R_NF) _NMD_SET(uop->reg, _NMD_GET(uop->reg) - 1); _NMD_NEXT();
+
+		_NMD_HANDLER(ALU_RR)
+			dst = _NMD_GET(uop->reg);
+			src = _NMD_GET(uop->base);
+			goto _nmd_alu_register;
+		_NMD_HANDLER(ALU_RI)
+			dst = _NMD_GET(uop->reg);
+			src = uop->imm;
+			goto _nmd_alu_register;
+		_NMD_HANDLER(ALU_RM)
+			_NMD_READ(_NMD_ADDRESS(), uop->size, &src);
+			dst = _NMD_GET(uop->reg);
+		_nmd_alu_register:
+			result = _nmd_x86_interpreter_alu(it, uop->extra, dst, src);
+			if (uop->extra != _NMD_ALU_CMP && uop->extra != _NMD_ALU_TEST)
+				_NMD_SET(uop->reg, result);
+			_nmd_x86_interpreter_record(it, _nmd_x86_interpreter_alu_flags[uop->extra], uop->size, dst, src, result);
+			_NMD_NEXT();
+		_NMD_HANDLER(ALU_MR)
+			src = _NMD_GET(uop->reg);
+			goto _nmd_alu_memory;
+		_NMD_HANDLER(ALU_MI)
+			src = uop->imm;
+		_nmd_alu_memory:
+			address = _NMD_ADDRESS();
+			_NMD_READ(address, uop->size, &dst);
+			result = _nmd_x86_interpreter_alu(it, uop->extra, dst, src);
+			if (uop->extra != _NMD_ALU_CMP && uop->extra != _NMD_ALU_TEST)
+			{
+				_NMD_WRITE(address, uop->size, result);
+			}
+			_nmd_x86_interpreter_record(it, _nmd_x86_interpreter_alu_flags[uop->extra], uop->size, dst, src, result);
+			_NMD_NEXT_STORE();
+
+		_NMD_HANDLER(UNARY_R) _NMD_SET(uop->reg, _nmd_x86_interpreter_unary(it, uop->extra, uop->size, _NMD_GET(uop->reg))); _NMD_NEXT();
+		_NMD_HANDLER(UNARY_M)
+			address = _NMD_ADDRESS();
+			_NMD_READ(address, uop->size, &value);
+			_NMD_WRITE(address, uop->size, _nmd_x86_interpreter_unary(it, uop->extra, uop->size, value));
+			_NMD_NEXT_STORE();
+
+		_NMD_HANDLER(SHIFT_R) _NMD_SET(uop->reg, _nmd_x86_interpreter_shift(it, uop->extra, uop->size, _NMD_GET(uop->reg), uop->imm)); _NMD_NEXT();
+		_NMD_HANDLER(SHIFT_R_CL) _NMD_SET(uop->reg, _nmd_x86_interpreter_shift(it, uop->extra, uop->size, _NMD_GET(uop->reg), it->regs[NMD_X86_GPR_RCX])); _NMD_NEXT();
+		_NMD_HANDLER(SHIFT_M)
+			count = uop->imm;
+			goto _nmd_shift_memory;
+		_NMD_HANDLER(SHIFT_M_CL)
+			count = it->regs[NMD_X86_GPR_RCX];
+		_nmd_shift_memory:
+			address = _NMD_ADDRESS();
+			_NMD_READ(address, uop->size, &value);
+			_NMD_WRITE(address, uop->size, _nmd_x86_interpreter_shift(it, uop->extra, uop->size, value, count));
+			_NMD_NEXT_STORE();
+
+		_NMD_HANDLER(IMUL_RR) _NMD_SET(uop->reg, _nmd_x86_interpreter_imul(it, uop->size, _NMD_GET(uop->reg), _NMD_GET(uop->base))); _NMD_NEXT();
+		_NMD_HANDLER(IMUL_RM) _NMD_READ(_NMD_ADDRESS(), uop->size, &value); _NMD_SET(uop->reg, _nmd_x86_interpreter_imul(it, uop->size, _NMD_GET(uop->reg), value)); _NMD_NEXT();
+		_NMD_HANDLER(IMUL_RRI) _NMD_SET(uop->reg, _nmd_x86_interpreter_imul(it, uop->size, _NMD_GET(uop->base), uop->imm)); _NMD_NEXT();
+		_NMD_HANDLER(IMUL_RMI) _NMD_READ(_NMD_ADDRESS(), uop->size, &value); _NMD_SET(uop->reg, _nmd_x86_interpreter_imul(it, uop->size, value, uop->imm)); _NMD_NEXT();
+		_NMD_HANDLER(MULDIV_R)
+			value = _NMD_GET(uop->reg);
+			goto _nmd_muldiv;
+		_NMD_HANDLER(MULDIV_M)
+			_NMD_READ(_NMD_ADDRESS(), uop->size, &value);
+		_nmd_muldiv:
+			if (!_nmd_x86_interpreter_muldiv(it, uop->extra, uop->size, value))
+			{
+				it->rip = _nmd_x86_interpreter_leave(it, block, uop);
+				return NMD_X86_INTERPRETER_EXIT_DIVIDE_ERROR;
+			}
+			_NMD_NEXT();
+
+		_NMD_HANDLER(CMOV_RR)
+			value = _NMD_GET(uop->base);
+			goto _nmd_cmov;
+		_NMD_HANDLER(CMOV_RM)
+			_NMD_READ(_NMD_ADDRESS(), uop->size, &value);
+		_nmd_cmov:
+			/* A 32-bit 'cmovcc' clears the upper half of the destination even if the condition is false. */
+			_NMD_SET(uop->reg, _nmd_x86_interpreter_condition(it, uop->extra) ? value : _NMD_GET(uop->reg));
+			_NMD_NEXT();
+		_NMD_HANDLER(SETCC_R) _NMD_SET(uop->reg, _nmd_x86_interpreter_condition(it, uop->extra)); _NMD_NEXT();
+		_NMD_HANDLER(SETCC_M) _NMD_WRITE(_NMD_ADDRESS(), 1, _nmd_x86_interpreter_condition(it, uop->extra)); _NMD_NEXT_STORE();
+
+		_NMD_HANDLER(XCHG_RR)
+			value = _NMD_GET(uop->reg);
+			_NMD_SET(uop->reg, _NMD_GET(uop->base));
+			_NMD_SET(uop->base, value);
+			_NMD_NEXT();
+		_NMD_HANDLER(XCHG_RM)
+			address = _NMD_ADDRESS();
+			_NMD_READ(address, uop->size, &value);
+			_NMD_WRITE(address, uop->size, _NMD_GET(uop->reg));
+			_NMD_SET(uop->reg, value);
+			_NMD_NEXT_STORE();
+
+		_NMD_HANDLER(PUSH_R)
+			value = _NMD_GET(uop->reg);
+			goto _nmd_push;
+		_NMD_HANDLER(PUSH_I)
+			value = uop->imm;
+			goto _nmd_push;
+		_NMD_HANDLER(PUSH_M)
+			_NMD_READ(_NMD_ADDRESS(), uop->size, &value);
+		_nmd_push:
+			_NMD_WRITE(it->regs[NMD_X86_GPR_RSP] - uop->size, uop->size, value);
+			it->regs[NMD_X86_GPR_RSP] -= uop->size;
+			_NMD_NEXT_STORE();
+		_NMD_HANDLER(POP_R)
+			_NMD_READ(it->regs[NMD_X86_GPR_RSP], uop->size, &value);
+			it->regs[NMD_X86_GPR_RSP] += uop->size;
+			_NMD_SET(uop->reg, value);
+			_NMD_NEXT();
+		_NMD_HANDLER(LEAVE)
+			_NMD_READ(it->regs[NMD_X86_GPR_RBP], 8, &value);
+			it->regs[NMD_X86_GPR_RSP] = it->regs[NMD_X86_GPR_RBP] + 8;
+			it->regs[NMD_X86_GPR_RBP] = value;
+			_NMD_NEXT();
+
+		_NMD_HANDLER(CONVERT_A)
+			/* cbw, cwde, cdqe */
+			_NMD_SET(NMD_X86_GPR_RAX, _nmd_x86_interpreter_sign_extend(it->regs[NMD_X86_GPR_RAX], uop->size / 2));
+			_NMD_NEXT();
+		_NMD_HANDLER(CONVERT_D)
+			/* cwd, cdq, cqo */
+			_NMD_SET(NMD_X86_GPR_RDX, it->regs[NMD_X86_GPR_RAX] & _NMD_INTERPRETER_SIGN(uop->size) ? 0xffffffffffffffff : 0);
+			_NMD_NEXT();
+
+		_NMD_HANDLER(FLAG)
+			_nmd_x86_interpreter_materialize(it);
+			switch (uop->extra)
+			{
+			case _NMD_FLAG_CMC: it->rflags ^= 1; break;
+			case _NMD_FLAG_CLC: it->rflags &= ~(uint64_t)1; break;
+			case _NMD_FLAG_STC: it->rflags |= 1; break;
+			case _NMD_FLAG_CLD: it->rflags &= ~(uint64_t)0x400; break;
+			default: it->rflags |= 0x400; break;
+			}
+			_NMD_NEXT();
+
+		_NMD_HANDLER(STRING)
+			/* 'rep movs' and 'rep stos' run to completion. A fault leaves 'rcx', 'rsi' and 'rdi' at the element that faulted. */
+			count = uop->extra & _NMD_STRING_REP ? it->regs[NMD_X86_GPR_RCX] : 1;
+			src = it->rflags & 0x400 ? (uint64_t)0 - uop->size : uop->size;
+			for (; count; count--)
+			{
+				if ((uop->extra & 3) == _NMD_STRING_MOVS)
+				{
+					_NMD_READ(it->regs[NMD_X86_GPR_RSI], uop->size, &value);
+				}
+				else
+					value = it->regs[NMD_X86_GPR_RAX];
+				_NMD_WRITE(it->regs[NMD_X86_GPR_RDI], uop->size, value);
+
+				it->regs[NMD_X86_GPR_RDI] += src;
+				if ((uop->extra & 3) == _NMD_STRING_MOVS)
+					it->regs[NMD_X86_GPR_RSI] += src;
+				if (uop->extra & _NMD_STRING_REP)
+					it->regs[NMD_X86_GPR_RCX] = count - 1;
+			}
+			_NMD_NEXT_STORE();
+
+		_NMD_HANDLER(JMP)
+			target = uop->imm;
+			link = &block->links[0];
+			goto _nmd_branch;
+		_NMD_HANDLER(JMP_R)
+			target = it->regs[uop->reg];
+			link = &block->links[0];
+			goto _nmd_branch;
+		_NMD_HANDLER(JMP_M)
+			_NMD_READ(_NMD_ADDRESS(), 8, &target);
+			link = &block->links[0];
+			goto _nmd_branch;
+		_NMD_HANDLER(JCC)
+			if (_nmd_x86_interpreter_condition(it, uop->extra))
+			{
+				target = uop->imm;
+				link = &block->links[1];
+			}
+			else
+			{
+				target = uop->disp;
+				link = &block->links[0];
+			}
+			goto _nmd_branch;
+		_NMD_HANDLER(CALL)
+			target = uop->imm;
+			value = uop->disp;
+			goto _nmd_call;
+		_NMD_HANDLER(CALL_R)
+			target = it->regs[uop->reg];
+			value = uop->imm;
+			goto _nmd_call;
+		_NMD_HANDLER(CALL_M)
+			_NMD_READ(_NMD_ADDRESS(), 8, &target);
+			value = uop->imm;
+		_nmd_call:
+			_NMD_WRITE(it->regs[NMD_X86_GPR_RSP] - 8, 8, value);
+			it->regs[NMD_X86_GPR_RSP] -= 8;
+			link = &block->links[0];
+			goto _nmd_leave_block;
+		_NMD_HANDLER(RET)
+			_NMD_READ(it->regs[NMD_X86_GPR_RSP], 8, &target);
+			it->regs[NMD_X86_GPR_RSP] += 8 + uop->imm;
+			link = &block->links[0];
+			goto _nmd_branch;
+
+		_NMD_HANDLER(EXIT)
+			it->rip = _nmd_x86_interpreter_leave(it, block, uop);
+			if (uop->extra == NMD_X86_INTERPRETER_EXIT_PAGE_FAULT)
+				it->fault_address = uop->imm;
+			return (NMD_X86_INTERPRETER_EXIT)uop->extra;
+		}
+	}
+
+_nmd_fault:
+	it->rip = _nmd_x86_interpreter_leave(it, block, uop);
+	return NMD_X86_INTERPRETER_EXIT_PAGE_FAULT;
+
+_nmd_code_modified:
+	/* The instruction wrote translated code: the block may be stale after it, so translation starts again at the next instruction. */
+	target = _nmd_x86_interpreter_leave(it, block, uop + 1);
+	link = &unlinked;
+_nmd_leave_block:
+	if (it->code_modified)
+	{
+		_nmd_x86_interpreter_flush_blocks(it);
+		link = &unlinked;
+	}
+	goto _nmd_branch;
+}
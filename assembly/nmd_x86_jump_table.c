@@ -0,0 +1,423 @@
+#include "nmd_common.h"
+
+/* The operands are needed to follow the registers of the indirect jump back to the table's load, base and bounds check. */
+#define _NMD_JUMP_TABLE_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_GROUP | NMD_X86_DECODER_FLAGS_OPERANDS)
+
+/* The number of instructions before an indirect jump that are searched for the load of the entry and for the base and the bounds check. */
+#define _NMD_JUMP_TABLE_MAX_BACKTRACK 16
+
+/* Bounds checks that allow more entries are assumed to be something else. */
+#define _NMD_JUMP_TABLE_MAX_ENTRIES 0x10000
+
+#define _NMD_NO_GPR 0xff
+
+/* Returns the number(0 to 15) of the 64-bit register that contains a general-purpose register of any size, or '_NMD_NO_GPR'. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_gpr_number(uint8_t reg)
+{
+	if (reg >= NMD_X86_REG_AL && reg <= NMD_X86_REG_BH)
+		return (uint8_t)((reg - NMD_X86_REG_AL) % 4);
+	else if (reg >= NMD_X86_REG_R8 && reg <= NMD_X86_REG_R15)
+		return (uint8_t)(reg - NMD_X86_REG_RAX);
+	else if (reg >= NMD_X86_REG_AX && reg <= NMD_X86_REG_RDI)
+		return (uint8_t)((reg - NMD_X86_REG_AX) % 8);
+	else if (reg >= NMD_X86_REG_R8B && reg <= NMD_X86_REG_R15D)
+		return (uint8_t)(8 + (reg - NMD_X86_REG_R8B) % 8);
+	else
+		return _NMD_NO_GPR;
+}
+
+/* Returns the displacement of an instruction sign extended to 64 bits. */
+_NMD_FORCE_INLINE int64_t _nmd_x86_jump_table_displacement(const nmd_x86_instruction* instruction)
+{
+	switch (instruction->disp_mask)
+	{
+	case NMD_X86_DISP8:  return (int8_t)instruction->displacement;
+	case NMD_X86_DISP16: return (int16_t)instruction->displacement;
+	case NMD_X86_DISP32: return (int32_t)instruction->displacement;
+	default:             return 0;
+	}
+}
+
+/* Decodes the instruction explored by the recursive descent at 'offset'. */
+_NMD_FORCE_INLINE bool _nmd_x86_jump_table_decode(const nmd_x86_recursive_descent* rd, size_t offset, nmd_x86_instruction* instruction)
+{
+	const uint8_t* const b = (const uint8_t*)rd->buffer;
+	if (rd->buffer_size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+		return nmd_x86_decode_padded(b + offset, instruction, (NMD_X86_MODE)rd->mode, _NMD_JUMP_TABLE_DECODER_FLAGS);
+	else
+		return nmd_x86_decode(b + offset, rd->buffer_size - offset, instruction, (NMD_X86_MODE)rd->mode, _NMD_JUMP_TABLE_DECODER_FLAGS);
+}
+
+/* Returns the offset of the explored instruction that falls through(or branches conditionally) to 'offset', or 'offset' if there is none. */
+_NMD_FORCE_INLINE size_t _nmd_x86_jump_table_previous(const uint8_t* code_map, size_t offset)
+{
+	size_t length;
+	uint8_t end;
+
+	for (length = 1; length <= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH && length <= offset; length++)
+	{
+		if ((size_t)(code_map[offset - length] & NMD_X86_CODE_MAP_LENGTH_MASK) == length)
+		{
+			end = _NMD_CODE_MAP_END(code_map[offset - length]);
+			return end == NMD_X86_BLOCK_END_FALLTHROUGH || end == NMD_X86_BLOCK_END_CONDITIONAL ? offset - length : offset;
+		}
+	}
+
+	return offset;
+}
+
+/* Returns the general-purpose register written by the first operand of an instruction, or '_NMD_NO_GPR'. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_jump_table_written_gpr(const nmd_x86_instruction* instruction)
+{
+	if (instruction->num_operands > 0 && instruction->operands[0].type == NMD_X86_OPERAND_TYPE_REGISTER && instruction->operands[0].action & NMD_X86_OPERAND_ACTION_ANY_WRITE)
+		return _nmd_x86_gpr_number(instruction->operands[0].fields.reg);
+	else
+		return _NMD_NO_GPR;
+}
+
+/* Returns the general-purpose register copied by a register to register move(including 'movzx', 'movsx' and 'movsxd'), or '_NMD_NO_GPR'. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_jump_table_copied_gpr(const nmd_x86_instruction* instruction)
+{
+	if ((instruction->id == NMD_X86_INSTRUCTION_MOV || instruction->id == NMD_X86_INSTRUCTION_MOVZX || instruction->id == NMD_X86_INSTRUCTION_MOVSX || instruction->id == NMD_X86_INSTRUCTION_MOVSXD) && instruction->num_operands == 2 && instruction->operands[1].type == NMD_X86_OPERAND_TYPE_REGISTER)
+		return _nmd_x86_gpr_number(instruction->operands[1].fields.reg);
+	else
+		return _NMD_NO_GPR;
+}
+
+/* Returns the general-purpose register compared with an immediate by 'cmp', or '_NMD_NO_GPR'. */
+_NMD_FORCE_INLINE uint8_t _nmd_x86_jump_table_compared_gpr(const nmd_x86_instruction* instruction)
+{
+	if (!instruction->imm_mask)
+		return _NMD_NO_GPR;
+	else if (instruction->opcode_map == NMD_X86_OPCODE_MAP_DEFAULT && (instruction->opcode == 0x3c || instruction->opcode == 0x3d)) /* 'cmp al/ax/eax/rax, imm' */
+		return 0;
+	else if (instruction->num_operands > 0 && instruction->operands[0].type == NMD_X86_OPERAND_TYPE_REGISTER)
+		return _nmd_x86_gpr_number(instruction->operands[0].fields.reg);
+	else
+		return _NMD_NO_GPR;
+}
+
+/* Finds the region that contains the table and returns a pointer to its first entry, storing the number of entries inside the region in 'num_readable'. */
+NMD_ASSEMBLY_API const uint8_t* _nmd_x86_jump_table_find_data(const nmd_x86_jump_table* table, const nmd_x86_code_section* regions, size_t num_regions, size_t* num_readable)
+{
+	size_t i;
+	uint64_t available;
+
+	for (i = 0; i < num_regions; i++)
+	{
+		if (table->table < regions[i].address || table->table - regions[i].address >= regions[i].size)
+			continue;
+
+		available = (regions[i].size - (table->table - regions[i].address)) / table->entry_size;
+		*num_readable = (size_t)(available < table->num_entries ? available : table->num_entries);
+		return regions[i].code + (table->table - regions[i].address);
+	}
+
+	*num_readable = 0;
+	return 0;
+}
+
+/* Returns the address stored in an entry of a jump table. */
+_NMD_FORCE_INLINE uint64_t _nmd_x86_jump_table_entry(const nmd_x86_jump_table* table, const uint8_t* entry)
+{
+	const uint32_t low = (uint32_t)entry[0] | ((uint32_t)entry[1] << 8) | ((uint32_t)entry[2] << 16) | ((uint32_t)entry[3] << 24);
+
+	if (table->type == NMD_X86_JUMP_TABLE_ENTRY_OFFSET)
+		return table->base + (uint64_t)(int64_t)(int32_t)low;
+	else if (table->type == NMD_X86_JUMP_TABLE_ENTRY_RVA)
+		return table->base + low;
+	else if (table->entry_size == 4)
+		return low;
+	else
+		return low | ((uint64_t)((uint32_t)entry[4] | ((uint32_t)entry[5] << 8) | ((uint32_t)entry[6] << 16) | ((uint32_t)entry[7] << 24)) << 32);
+}
+
+/*
+Recognizes the jump table of an indirect jump explored by a recursive descent. Starting at the jump, the instructions that fall through to it
+are decoded backwards(at most 16) to find how the target is computed: 'jmp [table+index*size]', 'mov target, [base+index*size+disp]; jmp target'
+or 'movsxd target, [base+index*4+disp]; add target, base; jmp target'(also with 'mov target32', whose entries are unsigned), the base register's
+'lea base, [rip+disp]' or 'lea base, [disp]', and the bounds check of the index: 'cmp index, imm' followed by 'ja' or 'jae'. Register to register
+moves of the index are followed. Returns true if the jump and its bounds check were recognized.
+Parameters:
+ - rd      [in]  A pointer to a recursive descent after nmd_x86_recursive_descent_run().
+ - address [in]  The runtime address of the recursive descent's buffer.
+ - offset  [in]  The offset of the indirect jump in the buffer.
+ - table   [out] A pointer to a variable of type 'nmd_x86_jump_table' that receives the table.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_resolve_jump_table(const nmd_x86_recursive_descent* rd, uint64_t address, size_t offset, nmd_x86_jump_table* table)
+{
+	nmd_x86_instruction instruction;
+	nmd_x86_memory_operand load;
+	int64_t load_disp;
+	uint8_t target_reg, added_reg = _NMD_NO_GPR, base_reg, index_reg, copied;
+	uint64_t base = 0, bound = 0;
+	bool has_base, has_bound = false, seen_ja = false, seen_jae = false;
+	size_t i, previous;
+
+	if (rd->mode == NMD_X86_MODE_16 || !_nmd_x86_jump_table_decode(rd, offset, &instruction) || instruction.id != NMD_X86_INSTRUCTION_JMP || instruction.num_operands != 1)
+		return false;
+
+	table->jump = (uint32_t)offset;
+	table->base = 0;
+	table->type = NMD_X86_JUMP_TABLE_ENTRY_ABSOLUTE;
+
+	if (instruction.operands[0].type == NMD_X86_OPERAND_TYPE_MEMORY)
+	{
+		/* 'jmp [table+index*size]' */
+		load = instruction.operands[0].fields.mem;
+		load_disp = _nmd_x86_jump_table_displacement(&instruction);
+		table->entry_size = rd->mode == NMD_X86_MODE_64 ? 8 : 4;
+	}
+	else if (instruction.operands[0].type == NMD_X86_OPERAND_TYPE_REGISTER)
+	{
+		/* Find the load of the entry, which may be followed by the addition of the base. */
+		target_reg = _nmd_x86_gpr_number(instruction.operands[0].fields.reg);
+		for (i = 0;; i++)
+		{
+			previous = _nmd_x86_jump_table_previous(rd->code_map, offset);
+			if (i == _NMD_JUMP_TABLE_MAX_BACKTRACK || previous == offset || !_nmd_x86_jump_table_decode(rd, previous, &instruction))
+				return false;
+			offset = previous;
+
+			if (_nmd_x86_jump_table_written_gpr(&instruction) != target_reg)
+				continue;
+
+			if (instruction.id == NMD_X86_INSTRUCTION_ADD && added_reg == _NMD_NO_GPR && instruction.num_operands == 2 && instruction.operands[1].type == NMD_X86_OPERAND_TYPE_REGISTER)
+			{
+				added_reg = _nmd_x86_gpr_number(instruction.operands[1].fields.reg);
+				continue;
+			}
+
+			if ((instruction.id != NMD_X86_INSTRUCTION_MOV && instruction.id != NMD_X86_INSTRUCTION_MOVSXD) || instruction.num_operands != 2 || instruction.operands[1].type != NMD_X86_OPERAND_TYPE_MEMORY)
+				return false;
+
+			load = instruction.operands[1].fields.mem;
+			load_disp = _nmd_x86_jump_table_displacement(&instruction);
+			if (instruction.id == NMD_X86_INSTRUCTION_MOVSXD)
+				table->entry_size = 4;
+			else
+				table->entry_size = instruction.operands[0].fields.reg >= NMD_X86_REG_RAX && instruction.operands[0].fields.reg <= NMD_X86_REG_R15 ? 8 : 4;
+
+			if (added_reg != _NMD_NO_GPR)
+			{
+				/* The entries are relative to the base register of the load. */
+				if (table->entry_size != 4 || _nmd_x86_gpr_number(load.base) != added_reg)
+					return false;
+				table->type = instruction.id == NMD_X86_INSTRUCTION_MOVSXD ? NMD_X86_JUMP_TABLE_ENTRY_OFFSET : NMD_X86_JUMP_TABLE_ENTRY_RVA;
+			}
+			else if (instruction.id == NMD_X86_INSTRUCTION_MOVSXD)
+				return false;
+
+			break;
+		}
+	}
+	else
+		return false;
+
+	if (load.index == NMD_X86_REG_NONE || ((size_t)1 << load.scale) != table->entry_size || load.base == NMD_X86_REG_RIP || load.base == NMD_X86_REG_EIP)
+		return false;
+
+	/* Find the value of the base register and the bounds check of the index. */
+	index_reg = _nmd_x86_gpr_number(load.index);
+	base_reg = _nmd_x86_gpr_number(load.base);
+	has_base = load.base == NMD_X86_REG_NONE;
+	for (i = 0; i < _NMD_JUMP_TABLE_MAX_BACKTRACK && !(has_base && has_bound); i++)
+	{
+		previous = _nmd_x86_jump_table_previous(rd->code_map, offset);
+		if (previous == offset || !_nmd_x86_jump_table_decode(rd, previous, &instruction))
+			break;
+		offset = previous;
+
+		if (instruction.id == NMD_X86_INSTRUCTION_JA || instruction.id == NMD_X86_INSTRUCTION_JNB)
+		{
+			if (!has_bound && !seen_ja && !seen_jae)
+			{
+				seen_ja = instruction.id == NMD_X86_INSTRUCTION_JA;
+				seen_jae = !seen_ja;
+			}
+			continue;
+		}
+		else if (instruction.id == NMD_X86_INSTRUCTION_CMP || instruction.id == NMD_X86_INSTRUCTION_TEST)
+		{
+			if (!has_bound && (seen_ja || seen_jae))
+			{
+				/* The flags tested by the branch come from this comparison. */
+				if (instruction.id != NMD_X86_INSTRUCTION_CMP || _nmd_x86_jump_table_compared_gpr(&instruction) != index_reg)
+					return false;
+
+				switch (instruction.imm_mask)
+				{
+				case NMD_X86_IMM8:  bound = (uint64_t)(int64_t)(int8_t)instruction.immediate; break;
+				case NMD_X86_IMM16: bound = (uint16_t)instruction.immediate; break;
+				default:            bound = (uint32_t)instruction.immediate; break;
+				}
+				if (seen_ja)
+					bound++;
+				has_bound = true;
+			}
+			continue;
+		}
+
+		copied = _nmd_x86_jump_table_written_gpr(&instruction);
+		if (copied == _NMD_NO_GPR)
+			continue;
+
+		if (!has_base && copied == base_reg)
+		{
+			if (instruction.id != NMD_X86_INSTRUCTION_LEA || instruction.num_operands != 2 || instruction.operands[1].fields.mem.index != NMD_X86_REG_NONE)
+				return false;
+			else if (instruction.operands[1].fields.mem.base == NMD_X86_REG_RIP)
+				base = address + offset + instruction.length + (uint64_t)_nmd_x86_jump_table_displacement(&instruction);
+			else if (instruction.operands[1].fields.mem.base == NMD_X86_REG_NONE)
+				base = (uint64_t)_nmd_x86_jump_table_displacement(&instruction);
+			else
+				return false;
+			has_base = true;
+		}
+
+		if (!has_bound && copied == index_reg)
+		{
+			/* Before the bounds check, the index may be copied from another register(e.g. 'mov eax, edi' or 'movzx eax, al'). */
+			index_reg = _nmd_x86_jump_table_copied_gpr(&instruction);
+			if (index_reg == _NMD_NO_GPR)
+				return false;
+		}
+	}
+
+	if (!has_base || !has_bound || bound == 0 || bound > _NMD_JUMP_TABLE_MAX_ENTRIES)
+		return false;
+
+	table->num_entries = (uint32_t)bound;
+	table->table = base + (uint64_t)load_disp;
+	if (table->type != NMD_X86_JUMP_TABLE_ENTRY_ABSOLUTE)
+		table->base = base;
+
+	if (rd->mode != NMD_X86_MODE_64)
+	{
+		table->table &= 0xffffffff;
+		table->base &= 0xffffffff;
+	}
+
+	return true;
+}
+
+/*
+Reads the targets of a jump table from the mapped image. Returns the number of entries that lie inside one of the regions, stopping at the
+end of the region that contains the table. Only the first 'max_targets' targets are stored.
+Parameters:
+ - table       [in]  A pointer to a table recognized by nmd_x86_resolve_jump_table().
+ - regions     [in]  A pointer to an array of regions of the image the table may be in, e.g. the sections returned by nmd_x86_elf_get_executable_sections()
+                     and the read-only data. Only 'code', 'size' and 'address' are used.
+ - num_regions [in]  The number of elements in 'regions'.
+ - targets     [out] A pointer to an array that receives the addresses. May be null if 'max_targets' is zero.
+ - max_targets [in]  The number of elements in 'targets'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_jump_table_read(const nmd_x86_jump_table* table, const nmd_x86_code_section* regions, size_t num_regions, uint64_t* targets, size_t max_targets)
+{
+	size_t num_readable, i;
+	const uint8_t* const data = _nmd_x86_jump_table_find_data(table, regions, num_regions, &num_readable);
+
+	for (i = 0; i < num_readable && i < max_targets; i++)
+		targets[i] = _nmd_x86_jump_table_entry(table, data + i * table->entry_size);
+
+	return num_readable;
+}
+
+/* Returns true if 'offset' is one of the 'num_failed' offsets in 'failed'. */
+_NMD_FORCE_INLINE bool _nmd_x86_jump_table_has_failed(const uint32_t* failed, size_t num_failed, size_t offset)
+{
+	size_t i;
+	for (i = 0; i < num_failed; i++)
+	{
+		if (failed[i] == offset)
+			return true;
+	}
+
+	return false;
+}
+
+/*
+Runs a recursive descent and resolves the jump tables of the indirect jumps it finds. The targets of every table whose entries are all inside
+the regions are queued and the descent is run again, until the new code has no more tables. Resolved jumps end their block with
+'NMD_X86_BLOCK_END_JUMP_TABLE' in the code map, so they are not analyzed again. Indirect jumps that are not tables are remembered at the end of
+the queue(in up to half of it, the descent uses the rest), so they aren't analyzed again either. The first round scans the whole code map and
+the next ones only the range their descent explored. Only the few instructions before each indirect jump are decoded, the rest of the code is
+only visited through the code map. Returns the number of tables, which may be larger than 'max_tables'; only the first 'max_tables' are stored,
+in the order they were found.
+Parameters:
+ - rd          [in/out] A pointer to a variable initialized by nmd_x86_recursive_descent_init() whose entry points were added.
+ - address     [in]     The runtime address of the recursive descent's buffer.
+ - regions     [in]     A pointer to an array of regions of the image the tables may be in, see nmd_x86_jump_table_read().
+ - num_regions [in]     The number of elements in 'regions'.
+ - tables      [out]    A pointer to an array of 'nmd_x86_jump_table' that receives the tables. May be null if 'max_tables' is zero.
+ - max_tables  [in]     The number of elements in 'tables'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_recursive_descent_resolve_jump_tables(nmd_x86_recursive_descent* rd, uint64_t address, const nmd_x86_code_section* regions, size_t num_regions, nmd_x86_jump_table* tables, size_t max_tables)
+{
+	const size_t queue_capacity = rd->queue_capacity;
+	size_t offset, num_readable, i, num_tables = 0, num_failed = 0, begin = 0, end = rd->buffer_size;
+	size_t changed_begin = rd->changed_begin, changed_end = rd->changed_end;
+	nmd_x86_jump_table table;
+	const uint8_t* data;
+	bool found, first_round = true;
+
+	do
+	{
+		nmd_x86_recursive_descent_run(rd);
+		found = false;
+
+		/* After the first round only the code explored by the last descent(and the targets queued before it) can have new indirect jumps.
+		The changed range is collected here and restored at the end, so the caller still sees every offset the rounds changed. */
+		if (!first_round)
+		{
+			begin = rd->changed_begin;
+			end = rd->changed_end;
+		}
+		first_round = false;
+		if (rd->changed_begin < changed_begin)
+			changed_begin = rd->changed_begin;
+		if (rd->changed_end > changed_end)
+			changed_end = rd->changed_end;
+		rd->changed_begin = rd->buffer_size;
+		rd->changed_end = 0;
+
+		for (offset = begin; offset < end; offset++)
+		{
+			if (!(rd->code_map[offset] & NMD_X86_CODE_MAP_LENGTH_MASK) || _NMD_CODE_MAP_END(rd->code_map[offset]) != NMD_X86_BLOCK_END_INDIRECT)
+				continue;
+
+			if (_nmd_x86_jump_table_has_failed(rd->queue + rd->queue_capacity, num_failed, offset))
+				continue;
+
+			data = 0;
+			if (nmd_x86_resolve_jump_table(rd, address, offset, &table))
+				data = _nmd_x86_jump_table_find_data(&table, regions, num_regions, &num_readable);
+
+			if (!data || num_readable != table.num_entries)
+			{
+				/* The queue is shrunk by one element to keep the site, unless that would take a slot in use or more than half of the queue */
+				if (num_failed < queue_capacity / 2 && rd->queue_size < rd->queue_capacity)
+				{
+					rd->queue[--rd->queue_capacity] = (uint32_t)offset;
+					num_failed++;
+				}
+				continue;
+			}
+
+			rd->code_map[offset] = (uint8_t)((rd->code_map[offset] & ~NMD_X86_CODE_MAP_END_MASK) | (NMD_X86_BLOCK_END_JUMP_TABLE << NMD_X86_CODE_MAP_END_SHIFT));
+			for (i = 0; i < num_readable; i++)
+				_nmd_x86_add_target(rd, (int64_t)(_nmd_x86_jump_table_entry(&table, data + i * table.entry_size) - address));
+
+			if (num_tables < max_tables)
+				tables[num_tables] = table;
+			num_tables++;
+			found = true;
+		}
+	} while (found);
+
+	rd->queue_capacity = queue_capacity;
+	rd->changed_begin = changed_begin;
+	rd->changed_end = changed_end;
+
+	return num_tables;
+}
@@ -1,8 +1,8 @@
 #include "nmd_common.h"
 
-NMD_ASSEMBLY_API bool _nmd_ldisasm_decode_modrm(const uint8_t** p_buffer, size_t* p_buffer_size, bool address_prefix, NMD_X86_MODE mode, nmd_x86_modrm* p_modrm)
+_NMD_FORCE_INLINE bool _nmd_ldisasm_decode_modrm(const uint8_t** p_buffer, size_t* p_buffer_size, bool address_prefix, NMD_X86_MODE mode, nmd_x86_modrm* p_modrm, bool padded)
 {
-	_NMD_READ_BYTE(*p_buffer, *p_buffer_size, (*p_modrm).modrm);
+	_NMD_READ_BYTE_PADDED(padded, *p_buffer, *p_buffer_size, (*p_modrm).modrm);
     
 	bool has_sib = false;
 	size_t disp_size = 0;
@@ -36,7 +36,7 @@ NMD_ASSEMBLY_API bool _nmd_ldisasm_decode_modrm(const uint8_t** p_buffer, size_t
 			if (p_modrm->modrm < 0xC0 && p_modrm->fields.rm == 0b100 && (!address_prefix || (address_prefix && mode == NMD_X86_MODE_64)))
 			{
 				has_sib = true;
-                _NMD_READ_BYTE(*p_buffer, *p_buffer_size, sib);
+                _NMD_READ_BYTE_PADDED(padded, *p_buffer, *p_buffer_size, sib);
 			}
 
 			if (p_modrm->fields.mod == 0b01) /* disp8 (ModR/M) */
@@ -49,7 +49,7 @@ NMD_ASSEMBLY_API bool _nmd_ldisasm_decode_modrm(const uint8_t** p_buffer, size_t
 	}
     
     /* Make sure we can read 'instruction->disp_mask' bytes from the buffer */
-    if (*p_buffer_size < disp_size)
+    if (!padded && *p_buffer_size < disp_size)
 		return false;
     
     /* Increment the buffer and decrement the buffer's size */
@@ -59,14 +59,18 @@ NMD_ASSEMBLY_API bool _nmd_ldisasm_decode_modrm(const uint8_t** p_buffer, size_t
 	return true;
 }
 
+/* The padded length disassembler falls back to a length disassembler with bounds checks. With 'NMD_ASSEMBLY_ENABLE_STATS' it must not count the instruction, nmd_x86_ldisasm_padded() already does. */
+#ifdef NMD_ASSEMBLY_ENABLE_STATS
+NMD_ASSEMBLY_API size_t _nmd_x86_ldisasm(const void* const buffer, size_t buffer_size, const NMD_X86_MODE mode);
+#define _NMD_X86_LDISASM_FALLBACK _nmd_x86_ldisasm
+#else
+#define _NMD_X86_LDISASM_FALLBACK nmd_x86_ldisasm
+#endif /* NMD_ASSEMBLY_ENABLE_STATS */
+
 /*
-Returns the length of the instruction if it is valid, zero otherwise.
-Parameters:
- - buffer      [in] A pointer to a buffer containing an encoded instruction.
- - buffer_size [in] The size of the buffer in bytes.
- - mode        [in] The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+Implementation of nmd_x86_ldisasm() and nmd_x86_ldisasm_padded(). If 'padded' is true, at least 'buffer_size' bytes must be readable.
 */
-NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_size, const NMD_X86_MODE mode)
+_NMD_FORCE_INLINE size_t _nmd_x86_ldisasm_inline(const void* const buffer, size_t buffer_size, const NMD_X86_MODE mode, bool padded)
 {
 	bool operand_prefix = false;
 	bool address_prefix = false;
@@ -87,7 +91,10 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 	buffer iterator to read data from the buffer, however before accessing it
 	make sure to check 'buffer_size' to see if we can safely access it. Then,
 	after reading data from the buffer we increment 'b' and decrement 'buffer_size'.
-	Helper macros: _NMD_READ_BYTE()
+	Helper macros: _NMD_LDISASM_READ_BYTE_PADDED()
+
+	If 'padded' is true the caller guarantees that 'buffer_size'(15) bytes can
+	be read, so the bounds checks are skipped.
 	*/
     
     /* Set buffer iterator */
@@ -127,24 +134,28 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 
 	/* Calculate the number of prefixes based on how much the iterator moved */
 	const size_t num_prefixes = (uint8_t)((ptrdiff_t)(b)-(ptrdiff_t)(buffer));
+
+	/* With too many prefixes the rest of the instruction may extend past the guaranteed bytes, decode it with bounds checks. */
+	if (padded && num_prefixes > NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - _NMD_X86_MAXIMUM_NON_PREFIX_LENGTH)
+		return _NMD_X86_LDISASM_FALLBACK(buffer, NMD_X86_MAXIMUM_INSTRUCTION_LENGTH, mode);
     
     /* Opcode byte. This variable is used because 'op' is simpler than 'instruction->opcode' */
 	uint8_t op;
-	_NMD_READ_BYTE(b, buffer_size, op);
+	_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, op);
     
 	if (op == 0x0F) /* 2 or 3 byte opcode */
 	{
-		_NMD_READ_BYTE(b, buffer_size, op);
+		_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, op);
         
 		if (op == 0x38 || op == 0x3A) /* 3 byte opcode */
 		{
 			const bool is_opcode_map38 = op == 0x38;
 			opcode_size = 3;
             
-            _NMD_READ_BYTE(b, buffer_size, op);
+            _NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, op);
             
-			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm))
-				return 0;
+			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm, padded))
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
 			has_modrm = true;
 
 			if (is_opcode_map38)
@@ -152,93 +163,95 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 #ifndef NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK
 				if (op == 0x36)
 				{
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPCODE);
 				}
 				else if (op <= 0xb || (op >= 0x1c && op <= 0x1e))
 				{
 					if (simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else if (op >= 0xc8 && op <= 0xcd)
 				{
 					if (simd_prefix)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else if (op == 0x10 || op == 0x14 || op == 0x15 || op == 0x17 || (op >= 0x20 && op <= 0x25) || op == 0x28 || op == 0x29 || op == 0x2b || _NMD_R(op) == 3 || op == 0x40 || op == 0x41 || op == 0xcf || (op >= 0xdb && op <= 0xdf))
 				{
 					if (simd_prefix != NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else if (op == 0x2a || (op >= 0x80 && op <= 0x82))
 				{
 					if (modrm.fields.mod == 0b11 || simd_prefix != NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				}
 				else if (op == 0xf0 || op == 0xf1)
 				{
 					if (modrm.fields.mod == 0b11 && (simd_prefix == NMD_X86_PREFIXES_NONE || simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE))
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 					else if (simd_prefix == NMD_X86_PREFIXES_REPEAT)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else if (op == 0xf5 || op == 0xf8)
 				{
 					if (simd_prefix != NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE || modrm.fields.mod == 0b11)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				}
 				else if (op == 0xf6)
 				{
 					if (simd_prefix == NMD_X86_PREFIXES_NONE && modrm.fields.mod == 0b11)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 					else if (simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else if (op == 0xf9)
 				{
 					if (simd_prefix != NMD_X86_PREFIXES_NONE || modrm.fields.mod == 0b11)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				}
 				else
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPCODE);
 #endif /* NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK */
 			}
 			else /* 0x3a */
 			{
-                /* "Read" the immediate byte */
-                uint8_t imm;
-                _NMD_READ_BYTE(b, buffer_size, imm);
+                /* Skip the immediate byte */
+                if (!padded && buffer_size < 1)
+                    _NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
+                b++;
+                buffer_size--;
                 
 #ifndef NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK
 				if ((op >= 0x8 && op <= 0xe) || (op >= 0x14 && op <= 0x17) || (op >= 0x20 && op <= 0x22) || (op >= 0x40 && op <= 0x42) || op == 0x44 || (op >= 0x60 && op <= 0x63) || op == 0xdf || op == 0xce || op == 0xcf)
 				{
 					if (simd_prefix != NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else if (op == 0x0f || op == 0xcc)
 				{
 					if (simd_prefix)
-						return 0;
+						_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 				}
 				else
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPCODE);
 #endif /* NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK */
 			}
 		}
 		else if (op == 0x0f) /* 3DNow! opcode map*/
 		{
 #ifndef NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_3DNOW
-			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm))
-				return false;
+			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm, padded))
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
 			
             uint8_t imm;
-			_NMD_READ_BYTE(b, buffer_size, imm);
+			_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, imm);
             
 #ifndef NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK
 			if (!_nmd_find_byte(_nmd_valid_3DNow_opcodes, sizeof(_nmd_valid_3DNow_opcodes), imm))
-				return false;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_3DNOW);
 #endif /*NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK */
 #else /* NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_3DNOW */
-			return false;
+			_NMD_LDISASM_REJECT(NMD_X86_REJECTION_3DNOW);
 #endif /* NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_3DNOW */
 		}
 		else /* 2 byte opcode. */
@@ -249,143 +262,143 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 			if (op >= 0x20 && op <= 0x23)
             {				
                 has_modrm = true;
-                _NMD_READ_BYTE(b, buffer_size, modrm.modrm);
+                _NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, modrm.modrm);
             }
 			else if (op < 4 || (_NMD_R(op) != 3 && _NMD_R(op) > 0 && _NMD_R(op) < 7) || (op >= 0xD0 && op != 0xFF) || (_NMD_R(op) == 7 && _NMD_C(op) != 7) || _NMD_R(op) == 9 || _NMD_R(op) == 0xB || (_NMD_R(op) == 0xC && _NMD_C(op) < 8) || (_NMD_R(op) == 0xA && (op % 8) >= 3) || op == 0x0ff || op == 0x00 || op == 0x0d)
 			{
-				if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm))
-					return 0;
+				if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm, padded))
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
 				has_modrm = true;
 			}
 
 #ifndef NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK
 			if (_nmd_find_byte(_nmd_invalid_op2, sizeof(_nmd_invalid_op2), op))
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPCODE);
 			else if (op == 0xc7)
 			{
 				if ((!simd_prefix && (modrm.fields.mod == 0b11 ? modrm.fields.reg <= 0b101 : modrm.fields.reg == 0b000 || modrm.fields.reg == 0b010)) || (simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO && (modrm.fields.mod == 0b11 || modrm.fields.reg != 0b001)) || ((simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE || simd_prefix == NMD_X86_PREFIXES_REPEAT) && (modrm.fields.mod == 0b11 ? modrm.fields.reg <= (simd_prefix == NMD_X86_PREFIXES_REPEAT ? 0b110 : 0b101) : (modrm.fields.reg != 0b001 && modrm.fields.reg != 0b110))))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0x00)
 			{
 				if (modrm.fields.reg >= 0b110)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0x01)
 			{
 				if ((modrm.fields.mod == 0b11 ? (( (simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO || simd_prefix == NMD_X86_PREFIXES_REPEAT) && ((modrm.modrm >= 0xc0 && modrm.modrm <= 0xc5) || (modrm.modrm >= 0xc8 && modrm.modrm <= 0xcb) || (modrm.modrm >= 0xcf && modrm.modrm <= 0xd1) || (modrm.modrm >= 0xd4 && modrm.modrm <= 0xd7) || modrm.modrm == 0xee || modrm.modrm == 0xef || modrm.modrm == 0xfa || modrm.modrm == 0xfb)) || (modrm.fields.reg == 0b000 && modrm.fields.rm >= 0b110) || (modrm.fields.reg == 0b001 && modrm.fields.rm >= 0b100 && modrm.fields.rm <= 0b110) || (modrm.fields.reg == 0b010 && (modrm.fields.rm == 0b010 || modrm.fields.rm == 0b011)) || (modrm.fields.reg == 0b101 && modrm.fields.rm < 0b110 && (!repeat_prefix || (simd_prefix == NMD_X86_PREFIXES_REPEAT && (modrm.fields.rm != 0b000 && modrm.fields.rm != 0b010)))) || (modrm.fields.reg == 0b111 && (modrm.fields.rm > 0b101 || (mode != NMD_X86_MODE_64 && modrm.fields.rm == 0b000)))) : (!repeat_prefix && modrm.fields.reg == 0b101)))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0x1A || op == 0x1B)
 			{
 				if (modrm.fields.mod == 0b11)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0x20 || op == 0x22)
 			{
 				if (modrm.fields.reg == 0b001 || modrm.fields.reg >= 0b101)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op >= 0x24 && op <= 0x27)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPCODE);
 			else if (op >= 0x3b && op <= 0x3f)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPCODE);
 			else if (_NMD_R(op) == 5)
 			{
 				if ((op == 0x50 && modrm.fields.mod != 0b11) || (simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE && (op == 0x52 || op == 0x53)) || (simd_prefix == NMD_X86_PREFIXES_REPEAT && (op == 0x50 || (op >= 0x54 && op <= 0x57))) || (repeat_not_zero_prefix && (op == 0x50 || (op >= 0x52 && op <= 0x57) || op == 0x5b)))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (_NMD_R(op) == 6)
 			{
 				if ((!(simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE || simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO) && (op == 0x6c || op == 0x6d)) || (simd_prefix == NMD_X86_PREFIXES_REPEAT && op != 0x6f) || repeat_not_zero_prefix)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op == 0x78 || op == 0x79)
 			{
 				if ((((simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE && op == 0x78) && !(modrm.fields.mod == 0b11 && modrm.fields.reg == 0b000)) || ((simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO) && modrm.fields.mod != 0b11)) || (simd_prefix == NMD_X86_PREFIXES_REPEAT))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0x7c || op == 0x7d)
 			{
 				if (simd_prefix == NMD_X86_PREFIXES_REPEAT || !(simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE || simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op == 0x7e || op == 0x7f)
 			{
 				if (repeat_not_zero_prefix)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op >= 0x71 && op <= 0x73)
 			{
 				if ((simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO) || modrm.modrm <= 0xcf || (modrm.modrm >= 0xe8 && modrm.modrm <= 0xef))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0x73)
 			{
 				if (modrm.modrm >= 0xe0 && modrm.modrm <= 0xe8)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0xa6)
 			{
 				if (modrm.modrm != 0xc0 && modrm.modrm != 0xc8 && modrm.modrm != 0xd0)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0xa7)
 			{
 				if (!(modrm.fields.mod == 0b11 && modrm.fields.reg <= 0b101 && modrm.fields.rm == 0b000))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0xae)
 			{
 				if (((!simd_prefix && modrm.fields.mod == 0b11 && modrm.fields.reg <= 0b100) || (simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO && !(modrm.fields.mod == 0b11 && modrm.fields.reg == 0b110)) || (simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE && (modrm.fields.reg < 0b110 || (modrm.fields.mod == 0b11 && modrm.fields.reg == 0b111))) || (simd_prefix == NMD_X86_PREFIXES_REPEAT && (modrm.fields.reg != 0b100 && modrm.fields.reg != 0b110) && !(modrm.fields.mod == 0b11 && modrm.fields.reg == 0b101))))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0xb8)
 			{
 				if (!repeat_prefix)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op == 0xba)
 			{
 				if (modrm.fields.reg <= 0b011)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op == 0xd0)
 			{
 				if (!simd_prefix || simd_prefix == NMD_X86_PREFIXES_REPEAT)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op == 0xe0)
 			{
 				if (simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op == 0xf0)
 			{
 				if (simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO ? modrm.fields.mod == 0b11 : true)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO)
 			{
 				if ((op >= 0x13 && op <= 0x17 && !(op == 0x16 && simd_prefix == NMD_X86_PREFIXES_REPEAT)) || op == 0x28 || op == 0x29 || op == 0x2e || op == 0x2f || (op <= 0x76 && op >= 0x74))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_SIMD_PREFIX);
 			}
 			else if (op == 0x71 || op == 0x72 || (op == 0x73 && !(simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE)))
 			{
 				if ((modrm.modrm >= 0xd8 && modrm.modrm <= 0xdf) || modrm.modrm >= 0xf8)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (op >= 0xc3 && op <= 0xc6)
 			{
 				if ((op == 0xc5 && modrm.fields.mod != 0b11) || (simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO) || (op == 0xc3 && simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 			else if (_NMD_R(op) >= 0xd && _NMD_C(op) != 0 && op != 0xff && ((_NMD_C(op) == 6 && _NMD_R(op) != 0xf) ? (!simd_prefix || (_NMD_R(op) == 0xD && (simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO) ? modrm.fields.mod != 0b11 : false)) : (simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO || ((_NMD_C(op) == 7 && _NMD_R(op) != 0xe) ? modrm.fields.mod != 0b11 : false))))
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			else if (has_modrm && modrm.fields.mod == 0b11)
 			{
 				if (op == 0xb2 || op == 0xb4 || op == 0xb5 || op == 0xc3 || op == 0xe7 || op == 0x2b || (simd_prefix == NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE && (op == 0x12 || op == 0x16)) || (!(simd_prefix == NMD_X86_PREFIXES_REPEAT || simd_prefix == NMD_X86_PREFIXES_REPEAT_NOT_ZERO) && (op == 0x13 || op == 0x17)))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 			}
 #endif /* NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK */
 
@@ -398,8 +411,8 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 				imm_mask = 2;
             
             /* Make sure we can "read" 'imm_mask' bytes from the buffer */
-            if (buffer_size < imm_mask)
-                return false;
+            if (!padded && buffer_size < imm_mask)
+                _NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
             
             /* Increment the buffer and decrement the buffer's size */
             b += imm_mask;
@@ -413,8 +426,8 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 		/* Check for ModR/M, SIB and displacement */
 		if (_NMD_R(op) == 8 || _nmd_find_byte(_nmd_op1_modrm, sizeof(_nmd_op1_modrm), op) || (_NMD_R(op) < 4 && (_NMD_C(op) < 4 || (_NMD_C(op) >= 8 && _NMD_C(op) < 0xC))) || (_NMD_R(op) == 0xD && _NMD_C(op) >= 8)/* || ((op == 0xc4 || op == 0xc5) && remaining_size > 1 && ((nmd_x86_modrm*)(b + 1))->fields.mod != 0b11)*/)
 		{
-			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm))
-				return 0;
+			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm, padded))
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
 			has_modrm = true;
 		}
 
@@ -422,47 +435,47 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 		if (op == 0xC6 || op == 0xC7)
 		{
 			if ((modrm.fields.reg != 0b000 && modrm.fields.reg != 0b111) || (modrm.fields.reg == 0b111 && (modrm.fields.mod != 0b11 || modrm.fields.rm != 0b000)))
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0x8f)
 		{
 			if (modrm.fields.reg != 0b000)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0xfe)
 		{
 			if (modrm.fields.reg >= 0b010)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0xff)
 		{
 			if (modrm.fields.reg == 0b111 || (modrm.fields.mod == 0b11 && (modrm.fields.reg == 0b011 || modrm.fields.reg == 0b101)))
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0x8c)
 		{
 			if (modrm.fields.reg >= 0b110)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0x8e)
 		{
 			if (modrm.fields.reg == 0b001 || modrm.fields.reg >= 0b110)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0x62)
 		{
 			if (mode == NMD_X86_MODE_64)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_MODE);
 		}
 		else if (op == 0x8d)
 		{
 			if (modrm.fields.mod == 0b11)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 		}
 		else if (op == 0xc4 || op == 0xc5)
 		{
 			if (mode == NMD_X86_MODE_64 && has_modrm && modrm.fields.mod != 0b11)
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_MODE);
 		}
 		else if (op >= 0xd8 && op <= 0xdf)
 		{
@@ -470,34 +483,34 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 			{
 			case 0xd9:
 				if ((modrm.fields.reg == 0b001 && modrm.fields.mod != 0b11) || (modrm.modrm > 0xd0 && modrm.modrm < 0xd8) || modrm.modrm == 0xe2 || modrm.modrm == 0xe3 || modrm.modrm == 0xe6 || modrm.modrm == 0xe7 || modrm.modrm == 0xef)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				break;
 			case 0xda:
 				if (modrm.modrm >= 0xe0 && modrm.modrm != 0xe9)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				break;
 			case 0xdb:
 				if (((modrm.fields.reg == 0b100 || modrm.fields.reg == 0b110) && modrm.fields.mod != 0b11) || (modrm.modrm >= 0xe5 && modrm.modrm <= 0xe7) || modrm.modrm >= 0xf8)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				break;
 			case 0xdd:
 				if ((modrm.fields.reg == 0b101 && modrm.fields.mod != 0b11) || _NMD_R(modrm.modrm) == 0xf)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				break;
 			case 0xde:
 				if (modrm.modrm == 0xd8 || (modrm.modrm >= 0xda && modrm.modrm <= 0xdf))
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				break;
 			case 0xdf:
 				if ((modrm.modrm >= 0xe1 && modrm.modrm <= 0xe7) || modrm.modrm >= 0xf8)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_OPERANDS);
 				break;
 			}
 		}
 		else if (mode == NMD_X86_MODE_64)
 		{
 			if (op == 0x6 || op == 0x7 || op == 0xe || op == 0x16 || op == 0x17 || op == 0x1e || op == 0x1f || op == 0x27 || op == 0x2f || op == 0x37 || op == 0x3f || (op >= 0x60 && op <= 0x62) || op == 0x82 || op == 0xce || (op >= 0xd4 && op <= 0xd6))
-				return 0;
+				_NMD_LDISASM_REJECT(NMD_X86_REJECTION_MODE);
 		}
 #endif /* NMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_VALIDITY_CHECK */
 
@@ -505,31 +518,27 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 		/* Check if instruction is VEX */
 		if ((op == 0xc4 || op == 0xc5) && !has_modrm)
 		{
-			const uint8_t byte0 = op;
-            
-            uint8_t byte1;
-			_NMD_READ_BYTE(b, buffer_size, byte1);
+			uint8_t byte, map = 1;
+			_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, byte);
 
-			if (byte0 == 0xc4)
+			if (op == 0xc4)
 			{
-				uint8_t byte2;
-				_NMD_READ_BYTE(b, buffer_size, byte2);
+				map = (uint8_t)(byte & 0b00011111);
+				_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, byte);
+			}
 
-                _NMD_READ_BYTE(b, buffer_size, op);
+			_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, op);
 
-				if (op == 0x0c || op == 0x0d || op == 0x40 || op == 0x41 || op == 0x17 || op == 0x21 || op == 0x42)
-				{
-                    uint8_t imm;
-                    _NMD_READ_BYTE(b, buffer_size, imm);
-                }
-			}
-			else /* 0xc5 */
+			/* vzeroupper and vzeroall are the only VEX instructions without a ModR/M byte. */
+			if (!(map == 1 && op == 0x77))
 			{
-				_NMD_READ_BYTE(b, buffer_size, op);
+				if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm, padded))
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
 			}
 
-			if (!_nmd_ldisasm_decode_modrm(&b, &buffer_size, address_prefix, mode, &modrm))
-				return false;
+			/* The instructions of the 0F3A map and the shifts, shuffles and compares of the 0F map have an imm8 after the ModR/M byte. */
+			if (map == 3 || (map == 1 && ((op >= 0x70 && op <= 0x73) || op == 0xc2 || (op >= 0xc4 && op <= 0xc6))))
+				_NMD_LDISASM_READ_BYTE_PADDED(padded, b, buffer_size, byte);
 			has_modrm = true;
 		}
 		else
@@ -557,7 +566,7 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 			else if (op == 0xEA || op == 0x9A) /* imm32,48 */
 			{
 				if (mode == NMD_X86_MODE_64)
-					return 0;
+					_NMD_LDISASM_REJECT(NMD_X86_REJECTION_MODE);
 				imm_mask = (operand_prefix ? 4 : 6);
 			}
 			else if (op == 0xC2 || op == 0xCA) /* imm16 */
@@ -566,8 +575,8 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 				imm_mask = 3;
             
             /* Make sure we can "read" 'imm_mask' bytes from the buffer */
-            if (buffer_size < imm_mask)
-                return false;
+            if (!padded && buffer_size < imm_mask)
+                _NMD_LDISASM_REJECT(NMD_X86_REJECTION_TRUNCATED);
             
             /* Increment the buffer and decrement the buffer's size */
             b += imm_mask;
@@ -580,8 +589,167 @@ NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_
 		if (!(has_modrm && modrm.fields.mod != 0b11 &&
 			((opcode_size == 1 && (op == 0x86 || op == 0x87 || (_NMD_R(op) < 4 && (op % 8) < 2 && op < 0x38) || ((op >= 0x80 && op <= 0x83) && modrm.fields.reg != 0b111) || (op >= 0xfe && modrm.fields.reg < 2) || ((op == 0xf6 || op == 0xf7) && (modrm.fields.reg == 0b010 || modrm.fields.reg == 0b011)))) ||
 				(opcode_size == 2 && (_nmd_find_byte(_nmd_two_opcodes, sizeof(_nmd_two_opcodes), op) || op == 0xab || (op == 0xba && modrm.fields.reg != 0b100) || (op == 0xc7 && modrm.fields.reg == 0b001))))))
-			return 0;
+			_NMD_LDISASM_REJECT(NMD_X86_REJECTION_LOCK);
 	}
 
 	return (size_t)((ptrdiff_t)(b) - (ptrdiff_t)(buffer));
-}
\ No newline at end of file
+}
+
+/*
+Returns the length of the instruction if it is valid, zero otherwise.
+Parameters:
+ - buffer      [in] A pointer to a buffer containing an encoded instruction.
+ - buffer_size [in] The size of the buffer in bytes.
+ - mode        [in] The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_ldisasm(const void* const buffer, size_t buffer_size, const NMD_X86_MODE mode)
+{
+	return _NMD_COUNT_LENGTH(_nmd_x86_ldisasm_inline(buffer, buffer_size, mode, false));
+}
+
+#ifdef NMD_ASSEMBLY_ENABLE_STATS
+/* Same as nmd_x86_ldisasm() but the result is not counted. */
+NMD_ASSEMBLY_API size_t _nmd_x86_ldisasm(const void* const buffer, size_t buffer_size, const NMD_X86_MODE mode)
+{
+	return _nmd_x86_ldisasm_inline(buffer, buffer_size, mode, false);
+}
+#endif /* NMD_ASSEMBLY_ENABLE_STATS */
+
+/*
+Returns the length of the instruction if it is valid, zero otherwise. Behaves exactly like nmd_x86_ldisasm() with 'buffer_size'
+equal to 'NMD_X86_MAXIMUM_INSTRUCTION_LENGTH', but doesn't check the buffer's bounds for every byte it reads.
+The caller must guarantee that at least 'NMD_X86_MAXIMUM_INSTRUCTION_LENGTH'(15) bytes starting at 'buffer' can be read.
+Parameters:
+ - buffer [in] A pointer to a buffer containing an encoded instruction. At least 15 bytes must be readable.
+ - mode   [in] The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_ldisasm_padded(const void* const buffer, const NMD_X86_MODE mode)
+{
+	return _NMD_COUNT_LENGTH(_nmd_x86_ldisasm_inline(buffer, NMD_X86_MAXIMUM_INSTRUCTION_LENGTH, mode, true));
+}
+
+/* Returns true if 'b' alone is a valid instruction in 'mode' regardless of the bytes that follow it. Only a subset of the one-byte
+instructions is covered(inc/dec in 16 and 32-bit mode, push/pop, nop/xchg/cbw/cwd, ret, leave and int3), the rest goes through the length disassembler. */
+_NMD_FORCE_INLINE bool _nmd_x86_is_single_byte_instruction(uint8_t b, const NMD_X86_MODE mode)
+{
+	const uint8_t first_push_pop = mode == NMD_X86_MODE_64 ? 0x50 : 0x40;
+	return (uint8_t)(b - first_push_pop) <= 0x5f - first_push_pop || (uint8_t)(b - 0x90) <= 0x09 || b == 0xc3 || b == 0xc9 || b == 0xcc;
+}
+
+#if defined(_NMD_SSE2)
+/* SSE2 version of _nmd_x86_is_single_byte_instruction() for 16 bytes. Returns a mask where bit 'i' is set if 'buffer[i]' is a single-byte instruction. */
+_NMD_FORCE_INLINE uint32_t _nmd_x86_classify_single_byte_sse2(const uint8_t* buffer, const __m128i first_push_pop, const __m128i num_push_pop)
+{
+	const __m128i x = _mm_loadu_si128((const __m128i*)buffer);
+	const __m128i push_pop = _mm_sub_epi8(x, first_push_pop);
+	const __m128i nop_xchg = _mm_sub_epi8(x, _mm_set1_epi8((char)0x90));
+	__m128i mask = _mm_cmpeq_epi8(_mm_min_epu8(push_pop, num_push_pop), push_pop);
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(_mm_min_epu8(nop_xchg, _mm_set1_epi8(0x09)), nop_xchg));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(x, _mm_set1_epi8((char)0xc3)));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(x, _mm_set1_epi8((char)0xc9)));
+	mask = _mm_or_si128(mask, _mm_cmpeq_epi8(x, _mm_set1_epi8((char)0xcc)));
+	return (uint32_t)_mm_movemask_epi8(mask);
+}
+#endif /* _NMD_SSE2 */
+
+/* Classifies up to 32 bytes. Returns a mask where bit 'i' is set if 'buffer[i]' is a single-byte instruction(see _nmd_x86_is_single_byte_instruction()). */
+_NMD_FORCE_INLINE uint32_t _nmd_x86_classify_single_byte(const uint8_t* buffer, size_t buffer_size, const NMD_X86_MODE mode)
+{
+	uint32_t mask = 0;
+	size_t i;
+
+#if defined(_NMD_AVX2)
+	if (buffer_size >= 32)
+	{
+		const __m256i x = _mm256_loadu_si256((const __m256i*)buffer);
+		const __m256i push_pop = _mm256_sub_epi8(x, _mm256_set1_epi8(mode == NMD_X86_MODE_64 ? 0x50 : 0x40));
+		const __m256i nop_xchg = _mm256_sub_epi8(x, _mm256_set1_epi8((char)0x90));
+		__m256i result = _mm256_cmpeq_epi8(_mm256_min_epu8(push_pop, _mm256_set1_epi8(mode == NMD_X86_MODE_64 ? 0x0f : 0x1f)), push_pop);
+		result = _mm256_or_si256(result, _mm256_cmpeq_epi8(_mm256_min_epu8(nop_xchg, _mm256_set1_epi8(0x09)), nop_xchg));
+		result = _mm256_or_si256(result, _mm256_cmpeq_epi8(x, _mm256_set1_epi8((char)0xc3)));
+		result = _mm256_or_si256(result, _mm256_cmpeq_epi8(x, _mm256_set1_epi8((char)0xc9)));
+		result = _mm256_or_si256(result, _mm256_cmpeq_epi8(x, _mm256_set1_epi8((char)0xcc)));
+		return (uint32_t)_mm256_movemask_epi8(result);
+	}
+#elif defined(_NMD_SSE2)
+	if (buffer_size >= 32)
+	{
+		const __m128i first_push_pop = _mm_set1_epi8(mode == NMD_X86_MODE_64 ? 0x50 : 0x40);
+		const __m128i num_push_pop = _mm_set1_epi8(mode == NMD_X86_MODE_64 ? 0x0f : 0x1f);
+		return _nmd_x86_classify_single_byte_sse2(buffer, first_push_pop, num_push_pop) | (_nmd_x86_classify_single_byte_sse2(buffer + 16, first_push_pop, num_push_pop) << 16);
+	}
+#endif
+
+	for (i = 0; i < buffer_size && i < 32; i++)
+	{
+		if (_nmd_x86_is_single_byte_instruction(buffer[i], mode))
+			mask |= (uint32_t)1 << i;
+	}
+
+	return mask;
+}
+
+/*
+Performs a linear sweep over a buffer and marks the offset of every instruction in a bitmap. Bit 'offset % 32' of 'boundary_bitmap[offset / 32]'
+is set if an instruction starts at 'offset'. A byte where no valid instruction starts is marked as a one-byte instruction and the sweep continues
+at the next byte, so the result is exactly the same as calling nmd_x86_ldisasm() in a loop and advancing by 'length ? length : 1'.
+Runs of single-byte instructions(e.g. int3/nop padding or push/pop sequences) are detected 32 bytes at a time using SSE2/AVX2 when available,
+every other instruction, including all of the 0F, 0F38 and 0F3A maps, is measured by the length disassembler, which skips the bounds checks
+while at least 15 bytes are left.
+Returns the number of bits set.
+Parameters:
+ - buffer          [in]  A pointer to a buffer containing encoded instructions.
+ - buffer_size     [in]  The size of the buffer in bytes.
+ - mode            [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - boundary_bitmap [out] A pointer to an array of '(buffer_size + 31) / 32' elements that receives the bitmap. Every element is written.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_ldisasm_bulk(const void* const buffer, size_t buffer_size, const NMD_X86_MODE mode, uint32_t* boundary_bitmap)
+{
+	const uint8_t* const b = (const uint8_t*)buffer;
+	size_t i, offset = 0, window = 0, window_end = 0, num_instructions = 0, length;
+	uint32_t mask = 0, bits;
+
+	for (i = 0; i < (buffer_size + 31) / 32; i++)
+		boundary_bitmap[i] = 0;
+
+	while (offset < buffer_size)
+	{
+		/* The SIMD classifier only finds one-byte opcodes, so it is used to extend a run that starts with one. Code without such runs
+		(e.g. mostly 0F, 0F38 and 0F3A instructions) is not classified at all and costs a single comparison per instruction. */
+		if (_nmd_x86_is_single_byte_instruction(b[offset], mode))
+		{
+			/* Classify the next 32 bytes once the sweep leaves the current window */
+			if (offset >= window_end)
+			{
+				window = offset;
+				window_end = offset + 32;
+				mask = _nmd_x86_classify_single_byte(b + offset, buffer_size - offset, mode);
+			}
+
+			bits = mask >> (offset - window);
+			do
+			{
+				boundary_bitmap[offset / 32] |= (uint32_t)1 << (offset % 32);
+				offset++;
+				num_instructions++;
+				bits >>= 1;
+#ifdef NMD_ASSEMBLY_ENABLE_STATS
+				_nmd_x86_stats.ldisasm_lengths[1]++;
+#endif /* NMD_ASSEMBLY_ENABLE_STATS */
+			} while (bits & 1);
+			continue;
+		}
+
+		boundary_bitmap[offset / 32] |= (uint32_t)1 << (offset % 32);
+		num_instructions++;
+
+		if (buffer_size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+			length = _NMD_COUNT_LENGTH(_nmd_x86_ldisasm_inline(b + offset, NMD_X86_MAXIMUM_INSTRUCTION_LENGTH, mode, true));
+		else
+			length = nmd_x86_ldisasm(b + offset, buffer_size - offset, mode);
+
+		offset += length ? length : 1;
+	}
+
+	return num_instructions;
+}
@@ -0,0 +1,240 @@
+#include "nmd_common.h"
+
+/* The operands give the registers, the cpu flags the status flags, the group finds calls and interrupts. */
+#define _NMD_LIVENESS_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_OPERANDS | NMD_X86_DECODER_FLAGS_CPU_FLAGS | NMD_X86_DECODER_FLAGS_GROUP)
+
+/* Returns true if the count of a shift or rotation may be zero, in which case no flag is written. */
+_NMD_FORCE_INLINE bool _nmd_x86_liveness_may_shift_by_zero(const nmd_x86_instruction* instruction)
+{
+	const uint8_t op = instruction->opcode;
+	const uint64_t count_mask = instruction->prefixes & NMD_X86_PREFIXES_REX_W ? 63 : 31;
+
+	if (instruction->opcode_map == NMD_X86_OPCODE_MAP_DEFAULT)
+		return op == 0xd2 || op == 0xd3 || ((op == 0xc0 || op == 0xc1) && !(instruction->immediate & count_mask));
+	else if (instruction->opcode_map == NMD_X86_OPCODE_MAP_0F)
+		return op == 0xa5 || op == 0xad || ((op == 0xa4 || op == 0xac) && !(instruction->immediate & count_mask)); /* shld, shrd */
+	else
+		return false;
+}
+
+/*
+Computes the registers and flags an instruction reads('used') before writing the ones it writes('defined'). The decoder's masks are completed
+with the carry read by 'adc', 'sbb', 'rcl' and 'rcr' and the direction flag read by string instructions. Zero idioms read nothing, calls and
+interrupts read what is live at an exit, and a shift whose count may be zero doesn't define the flags. An instruction whose masks are
+incomplete('regs_incomplete') reads every register, so no register is reported dead before it.
+*/
+NMD_ASSEMBLY_API void _nmd_x86_liveness_use_def(const nmd_x86_instruction* instruction, uint64_t exit_regs, uint32_t exit_flags, nmd_x86_instruction_liveness* liveness)
+{
+	const uint8_t op = instruction->opcode;
+	const uint8_t reg = instruction->modrm.fields.reg;
+	uint64_t used = instruction->regs_read & ~NMD_X86_REG_MASK_RIP;
+	uint32_t used_flags = instruction->tested_flags.eflags & NMD_X86_LIVENESS_FLAGS;
+	uint32_t defined_flags = (instruction->modified_flags.eflags | instruction->set_flags.eflags | instruction->cleared_flags.eflags | instruction->undefined_flags.eflags) & NMD_X86_LIVENESS_FLAGS;
+	uint8_t operand_reg;
+
+	if (instruction->encoding == NMD_X86_ENCODING_LEGACY && instruction->opcode_map == NMD_X86_OPCODE_MAP_DEFAULT)
+	{
+		if (((op & 0xf0) == 0x10 && (op & 7) < 6) || (op >= 0x80 && op <= 0x83 && (reg == 0b010 || reg == 0b011))) /* adc, sbb */
+			used_flags |= NMD_X86_EFLAGS_CF;
+		else if ((op == 0xc0 || op == 0xc1 || (op >= 0xd0 && op <= 0xd3)) && (reg == 0b010 || reg == 0b011)) /* rcl, rcr */
+			used_flags |= NMD_X86_EFLAGS_CF;
+		else if ((op >= 0x6c && op <= 0x6f) || (op >= 0xa4 && op <= 0xa7) || (op >= 0xaa && op <= 0xaf)) /* ins, outs, movs, cmps, stos, lods, scas */
+			used_flags |= NMD_X86_EFLAGS_DF;
+	}
+
+	if (_nmd_x86_liveness_may_shift_by_zero(instruction))
+		defined_flags = 0;
+
+	/* 'xor eax, eax' and 'sub rax, rax' don't depend on the register, unless only a part of it is written. */
+	if (_nmd_x86_is_zero_idiom(instruction))
+	{
+		operand_reg = instruction->operands[0].fields.reg;
+		if ((operand_reg >= NMD_X86_REG_EAX && operand_reg <= NMD_X86_REG_R15) || (operand_reg >= NMD_X86_REG_R8D && operand_reg <= NMD_X86_REG_R15D))
+			used &= ~nmd_x86_get_register_mask((NMD_X86_REG)operand_reg);
+	}
+
+	if (instruction->regs_incomplete)
+		used |= NMD_X86_LIVENESS_REGS;
+
+	/* The code that runs during a call or an interrupt is unknown. */
+	if ((instruction->group & (NMD_GROUP_CALL | NMD_GROUP_INT)) || (instruction->opcode_map == NMD_X86_OPCODE_MAP_0F && (op == 0x05 || op == 0x34)))
+	{
+		used |= exit_regs;
+		used_flags |= exit_flags;
+	}
+
+	liveness->regs_in = used;
+	liveness->regs_out = instruction->regs_written & ~NMD_X86_REG_MASK_RIP;
+	liveness->flags_in = used_flags;
+	liveness->flags_out = defined_flags;
+}
+
+/* Returns true if control may leave the block to code that is not one of its successors in the graph. */
+_NMD_FORCE_INLINE bool _nmd_x86_liveness_reaches_exit(const nmd_x86_basic_block* block, size_t num_blocks)
+{
+	switch (block->type)
+	{
+	case NMD_X86_BLOCK_END_FALLTHROUGH: return block->successors[0] >= num_blocks;
+	case NMD_X86_BLOCK_END_JUMP: return block->successors[1] >= num_blocks;
+	case NMD_X86_BLOCK_END_CONDITIONAL: return block->successors[0] >= num_blocks || block->successors[1] >= num_blocks;
+	default: return true;
+	}
+}
+
+/*
+Computes which registers and status flags are live(may be read before being written) before and after every instruction of the basic blocks.
+Each block is decoded once to find the registers its instructions read and write('regs_read', 'regs_written', 'tested_flags', 'modified_flags'
+and the other cpu flags), then a backward dataflow over the graph with a worklist finds the live registers at the boundaries of the blocks,
+and a last pass over the stored masks gives the ones of each instruction. Registers written partially(e.g. 'al') and conditionally('cmovcc')
+count as read. At returns, indirect jumps, traps, branches out of the buffer, calls and interrupts, the registers in 'exit_regs' and the flags
+in 'exit_flags' are live; 'NMD_X86_LIVENESS_REGS' and 'NMD_X86_LIVENESS_FLAGS' are the safe choice when the calling convention is unknown.
+Then nmd_x86_liveness_dead_registers() and nmd_x86_liveness_live_flags() answer in constant time for any offset. Returns the number of
+instructions.
+Parameters:
+ - buffer          [in]  A pointer to the buffer the blocks were built from.
+ - buffer_size     [in]  The size of the buffer in bytes.
+ - mode            [in]  The architecture mode. A member of 'NMD_X86_MODE'.
+ - blocks          [in]  A pointer to an array of blocks returned by nmd_x86_build_basic_blocks().
+ - cfg             [in]  A pointer to the graph of the blocks built by nmd_x86_cfg_build().
+ - exit_regs       [in]  A mask of the registers live where control leaves the known code. See 'NMD_X86_REG_MASK_XXX'.
+ - exit_flags      [in]  A mask of the flags live where control leaves the known code. See 'NMD_X86_LIVENESS_FLAGS'.
+ - block_liveness  [out] A pointer to an array of 'cfg->num_blocks' elements that receives the liveness at the boundaries of each block.
+ - instructions    [out] A pointer to an array with an element per instruction of the blocks(the sum of their 'num_instructions') that
+                         receives the liveness of each instruction, in the order of the blocks.
+ - instruction_map [out] A pointer to an array of 'buffer_size' elements that receives the index in 'instructions' of the instruction that starts
+                         at each offset, or 'NMD_X86_LIVENESS_NO_INSTRUCTION'.
+ - workspace       [in]  A pointer to an array of 'NMD_X86_LIVENESS_WORKSPACE_SIZE(cfg->num_blocks)' elements used as temporary memory.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_liveness_analyze(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const nmd_x86_basic_block* blocks, const nmd_x86_cfg* cfg, uint64_t exit_regs, uint32_t exit_flags, nmd_x86_block_liveness* block_liveness, nmd_x86_instruction_liveness* instructions, uint32_t* instruction_map, uint32_t* workspace)
+{
+	const size_t num_blocks = cfg->num_blocks;
+	uint32_t* const stack = workspace;
+	uint32_t* const in_stack = workspace + num_blocks;
+	const uint8_t* const b = (const uint8_t*)buffer;
+	nmd_x86_instruction instruction;
+	nmd_x86_block_liveness* block;
+	nmd_x86_instruction_liveness* current;
+	size_t i, k, offset, depth, num_instructions = 0;
+	uint64_t regs_in, regs;
+	uint32_t flags_in, flags, predecessor;
+
+	for (offset = 0; offset < buffer_size; offset++)
+		instruction_map[offset] = NMD_X86_LIVENESS_NO_INSTRUCTION;
+
+	/* Registers read before being written in each block('used') and registers written('defined') */
+	for (i = 0; i < num_blocks; i++)
+	{
+		block = &block_liveness[i];
+		block->regs_used = block->regs_defined = block->regs_in = block->regs_out = 0;
+		block->flags_used = block->flags_defined = block->flags_in = block->flags_out = 0;
+		block->first_instruction = (uint32_t)num_instructions;
+
+		for (offset = blocks[i].begin; offset < blocks[i].end; offset += instruction.length)
+		{
+			if (!nmd_x86_decode(b + offset, buffer_size - offset, &instruction, mode, _NMD_LIVENESS_DECODER_FLAGS))
+				break;
+
+			current = &instructions[num_instructions];
+			_nmd_x86_liveness_use_def(&instruction, exit_regs, exit_flags, current);
+			block->regs_used |= current->regs_in & ~block->regs_defined;
+			block->regs_defined |= current->regs_out;
+			block->flags_used |= current->flags_in & ~block->flags_defined;
+			block->flags_defined |= current->flags_out;
+
+			instruction_map[offset] = (uint32_t)num_instructions++;
+		}
+
+		block->num_instructions = (uint32_t)num_instructions - block->first_instruction;
+		stack[i] = (uint32_t)i;
+		in_stack[i] = 1;
+	}
+
+	/* Backward dataflow. The last blocks are on top of the stack, so most blocks see their successors' final values the first time. */
+	depth = num_blocks;
+	while (depth > 0)
+	{
+		i = stack[--depth];
+		in_stack[i] = 0;
+		block = &block_liveness[i];
+
+		regs = 0;
+		flags = 0;
+		if (_nmd_x86_liveness_reaches_exit(&blocks[i], num_blocks))
+		{
+			regs = exit_regs;
+			flags = exit_flags;
+		}
+		for (k = cfg->successor_offsets[i]; k < cfg->successor_offsets[i + 1]; k++)
+		{
+			regs |= block_liveness[cfg->successors[k]].regs_in;
+			flags |= block_liveness[cfg->successors[k]].flags_in;
+		}
+
+		block->regs_out = regs;
+		block->flags_out = flags;
+		regs_in = block->regs_used | (regs & ~block->regs_defined);
+		flags_in = block->flags_used | (flags & ~block->flags_defined);
+		if (regs_in == block->regs_in && flags_in == block->flags_in)
+			continue;
+
+		block->regs_in = regs_in;
+		block->flags_in = flags_in;
+		for (k = cfg->predecessor_offsets[i]; k < cfg->predecessor_offsets[i + 1]; k++)
+		{
+			predecessor = cfg->predecessors[k];
+			if (!in_stack[predecessor])
+			{
+				in_stack[predecessor] = 1;
+				stack[depth++] = predecessor;
+			}
+		}
+	}
+
+	/* The instructions of each block, backwards from the block's live-out sets. Their use and def masks are replaced. */
+	for (i = 0; i < num_blocks; i++)
+	{
+		block = &block_liveness[i];
+		regs = block->regs_out;
+		flags = block->flags_out;
+		for (k = block->first_instruction + block->num_instructions; k > block->first_instruction; k--)
+		{
+			current = &instructions[k - 1];
+			regs_in = current->regs_in | (regs & ~current->regs_out);
+			flags_in = current->flags_in | (flags & ~current->flags_out);
+			current->regs_out = regs;
+			current->flags_out = flags;
+			current->regs_in = regs = regs_in;
+			current->flags_in = flags = flags_in;
+		}
+	}
+
+	return num_instructions;
+}
+
+/*
+Returns a mask of the registers that are dead before the instruction at 'offset'(their value is never read), so instrumentation inserted there
+may use them as scratch registers. Returns zero if no instruction starts at 'offset'. Runs in constant time.
+Parameters:
+ - instructions    [in] A pointer to the instructions filled by nmd_x86_liveness_analyze().
+ - instruction_map [in] A pointer to the map filled by nmd_x86_liveness_analyze().
+ - offset          [in] The offset of an instruction in the buffer.
+*/
+NMD_ASSEMBLY_API uint64_t nmd_x86_liveness_dead_registers(const nmd_x86_instruction_liveness* instructions, const uint32_t* instruction_map, size_t offset)
+{
+	const uint32_t index = instruction_map[offset];
+	return index == NMD_X86_LIVENESS_NO_INSTRUCTION ? 0 : ~instructions[index].regs_in & ~NMD_X86_REG_MASK_RIP;
+}
+
+/*
+Returns a mask of the status flags that are live before the instruction at 'offset', zero if instrumentation inserted there may change the flags
+without saving them. Returns 'NMD_X86_LIVENESS_FLAGS' if no instruction starts at 'offset'. Runs in constant time.
+Parameters:
+ - instructions    [in] A pointer to the instructions filled by nmd_x86_liveness_analyze().
+ - instruction_map [in] A pointer to the map filled by nmd_x86_liveness_analyze().
+ - offset          [in] The offset of an instruction in the buffer.
+*/
+NMD_ASSEMBLY_API uint32_t nmd_x86_liveness_live_flags(const nmd_x86_instruction_liveness* instructions, const uint32_t* instruction_map, size_t offset)
+{
+	const uint32_t index = instruction_map[offset];
+	return index == NMD_X86_LIVENESS_NO_INSTRUCTION ? NMD_X86_LIVENESS_FLAGS : instructions[index].flags_in;
+}
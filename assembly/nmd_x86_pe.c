@@ -0,0 +1,423 @@
+#include "nmd_common.h"
+
+#define _NMD_PE_MACHINE_I386 0x14c
+#define _NMD_PE_MACHINE_AMD64 0x8664
+#define _NMD_PE_MAGIC_PE32 0x10b
+#define _NMD_PE_MAGIC_PE32_PLUS 0x20b
+#define _NMD_PE_SECTION_HEADER_SIZE 40
+#define _NMD_PE_SECTION_CODE 0x20
+#define _NMD_PE_SECTION_EXECUTE 0x20000000
+#define _NMD_PE_DIRECTORY_EXPORT 0
+#define _NMD_PE_DIRECTORY_IMPORT 1
+#define _NMD_PE_EXPORT_DIRECTORY_SIZE 40
+#define _NMD_PE_IMPORT_DESCRIPTOR_SIZE 20
+
+/* Finds the file offset of 'rva' and the number of bytes of file data from there to the end of its section(or of the headers). */
+NMD_ASSEMBLY_API bool _nmd_x86_pe_rva_to_offset(const nmd_x86_pe* pe, uint32_t rva, size_t* offset, size_t* available)
+{
+	size_t i;
+
+	if (rva < pe->headers_size)
+	{
+		*offset = rva;
+		*available = pe->headers_size - rva;
+		return true;
+	}
+
+	for (i = 0; i < pe->num_sections; i++)
+	{
+		const uint8_t* const header = pe->image + pe->section_headers + i * _NMD_PE_SECTION_HEADER_SIZE;
+		const uint32_t address = (uint32_t)_nmd_x86_read_le(header + 12, 4);
+		const size_t raw_offset = (size_t)_nmd_x86_read_le(header + 20, 4);
+		size_t raw_size = (size_t)_nmd_x86_read_le(header + 16, 4);
+
+		if (raw_offset >= pe->image_size)
+			continue;
+		raw_size = _NMD_MIN(raw_size, pe->image_size - raw_offset);
+
+		if (rva >= address && rva - address < raw_size)
+		{
+			*offset = raw_offset + (rva - address);
+			*available = raw_size - (rva - address);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Returns a pointer to the null-terminated string at 'rva', or null if the string does not end inside the file data of its section. */
+NMD_ASSEMBLY_API const char* _nmd_x86_pe_string(const nmd_x86_pe* pe, uint32_t rva)
+{
+	size_t offset, available, i;
+	if (!_nmd_x86_pe_rva_to_offset(pe, rva, &offset, &available))
+		return 0;
+
+	for (i = 0; i < available; i++)
+	{
+		if (pe->image[offset + i] == '\0')
+			return (const char*)pe->image + offset;
+	}
+
+	return 0;
+}
+
+/* Reads a little-endian integer of 'size' bytes at 'rva'. Returns false if it is not inside the file. */
+NMD_ASSEMBLY_API bool _nmd_x86_pe_read(const nmd_x86_pe* pe, uint32_t rva, size_t size, uint64_t* value)
+{
+	const uint8_t* const p = (const uint8_t*)nmd_x86_pe_rva_to_pointer(pe, rva, size);
+	if (!p)
+		return false;
+	*value = _nmd_x86_read_le(p, size);
+	return true;
+}
+
+/* Sorts symbols by RVA with heapsort, which needs no extra memory. */
+NMD_ASSEMBLY_API void _nmd_x86_pe_sort_symbols(nmd_x86_pe_symbol* symbols, size_t num_symbols)
+{
+	size_t start = num_symbols / 2, end = num_symbols, root, child;
+	nmd_x86_pe_symbol temp;
+
+	while (end > 1)
+	{
+		if (start > 0)
+			start--;
+		else
+		{
+			end--;
+			temp = symbols[0], symbols[0] = symbols[end], symbols[end] = temp;
+		}
+
+		for (root = start; (child = 2 * root + 1) < end; root = child)
+		{
+			if (child + 1 < end && symbols[child + 1].rva > symbols[child].rva)
+				child++;
+			if (symbols[root].rva >= symbols[child].rva)
+				break;
+			temp = symbols[root], symbols[root] = symbols[child], symbols[child] = temp;
+		}
+	}
+}
+
+/*
+Parses the headers of a PE32 or PE32+ file for x86 or x86-64. Nothing is copied: 'pe', the sections and the symbols point into 'image',
+which must stay valid while they are used. The file is read as it is on disk, it doesn't need to be loaded. Returns true if the file is
+an x86 PE whose section table is inside the image.
+Parameters:
+ - image      [in]  A pointer to the contents of the file(e.g. a read-only memory mapping of the file).
+ - image_size [in]  The size of the file in bytes.
+ - pe         [out] A pointer to a variable of type 'nmd_x86_pe'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_pe_parse(const void* image, size_t image_size, nmd_x86_pe* pe)
+{
+	const uint8_t* const b = (const uint8_t*)image;
+	const uint8_t* optional_header;
+	size_t nt_headers, optional_header_size, directories, num_directories;
+	uint16_t machine, magic;
+	uint64_t value, functions;
+
+	if (image_size < 64 || b[0] != 'M' || b[1] != 'Z')
+		return false;
+
+	nt_headers = (size_t)_nmd_x86_read_le(b + 60, 4);
+	if (nt_headers > image_size - 24 || b[nt_headers] != 'P' || b[nt_headers + 1] != 'E' || b[nt_headers + 2] != 0 || b[nt_headers + 3] != 0)
+		return false;
+
+	machine = (uint16_t)_nmd_x86_read_le(b + nt_headers + 4, 2);
+	optional_header_size = (size_t)_nmd_x86_read_le(b + nt_headers + 20, 2);
+	if (optional_header_size < 96 || optional_header_size > image_size - nt_headers - 24)
+		return false;
+
+	optional_header = b + nt_headers + 24;
+	magic = (uint16_t)_nmd_x86_read_le(optional_header, 2);
+	if (machine == _NMD_PE_MACHINE_AMD64 && magic == _NMD_PE_MAGIC_PE32_PLUS && optional_header_size >= 112)
+	{
+		pe->mode = NMD_X86_MODE_64;
+		pe->image_base = _nmd_x86_read_le(optional_header + 24, 8);
+		num_directories = (size_t)_nmd_x86_read_le(optional_header + 108, 4);
+		directories = 112;
+	}
+	else if (machine == _NMD_PE_MACHINE_I386 && magic == _NMD_PE_MAGIC_PE32)
+	{
+		pe->mode = NMD_X86_MODE_32;
+		pe->image_base = _nmd_x86_read_le(optional_header + 28, 4);
+		num_directories = (size_t)_nmd_x86_read_le(optional_header + 92, 4);
+		directories = 96;
+	}
+	else
+		return false;
+
+	pe->image = b;
+	pe->image_size = image_size;
+	pe->entry = (uint32_t)_nmd_x86_read_le(optional_header + 16, 4);
+	pe->headers_size = (uint32_t)_NMD_MIN(_nmd_x86_read_le(optional_header + 60, 4), image_size);
+	pe->section_headers = nt_headers + 24 + optional_header_size;
+	pe->num_sections = (size_t)_nmd_x86_read_le(b + nt_headers + 6, 2);
+	if (pe->num_sections * _NMD_PE_SECTION_HEADER_SIZE > image_size - pe->section_headers)
+		return false;
+
+	/* Directories that don't fit in the optional header are treated as missing. */
+	num_directories = _NMD_MIN(num_directories, (optional_header_size - directories) / 8);
+	pe->export_directory = pe->export_directory_size = pe->import_directory = pe->import_directory_size = 0;
+	if (num_directories > _NMD_PE_DIRECTORY_EXPORT)
+	{
+		pe->export_directory = (uint32_t)_nmd_x86_read_le(optional_header + directories + _NMD_PE_DIRECTORY_EXPORT * 8, 4);
+		pe->export_directory_size = (uint32_t)_nmd_x86_read_le(optional_header + directories + _NMD_PE_DIRECTORY_EXPORT * 8 + 4, 4);
+	}
+	if (num_directories > _NMD_PE_DIRECTORY_IMPORT)
+	{
+		pe->import_directory = (uint32_t)_nmd_x86_read_le(optional_header + directories + _NMD_PE_DIRECTORY_IMPORT * 8, 4);
+		pe->import_directory_size = (uint32_t)_nmd_x86_read_le(optional_header + directories + _NMD_PE_DIRECTORY_IMPORT * 8 + 4, 4);
+	}
+
+	/* The export address table must be inside the file, so 'num_exports' can be trusted to allocate memory for nmd_x86_pe_get_exports(). */
+	pe->num_exports = 0;
+	if (pe->export_directory && nmd_x86_pe_rva_to_pointer(pe, pe->export_directory, _NMD_PE_EXPORT_DIRECTORY_SIZE) && _nmd_x86_pe_read(pe, pe->export_directory + 20, 4, &value) &&
+		_nmd_x86_pe_read(pe, pe->export_directory + 28, 4, &functions) && value <= image_size / 4 && nmd_x86_pe_rva_to_pointer(pe, (uint32_t)functions, (size_t)value * 4))
+		pe->num_exports = (uint32_t)value;
+
+	return true;
+}
+
+/*
+Returns a pointer to the file data of the range ['rva', 'rva' + 'size'), or null if the range is not entirely inside the file data of one
+section or of the headers(e.g. uninitialized data).
+Parameters:
+ - pe   [in] A pointer to a variable parsed by nmd_x86_pe_parse().
+ - rva  [in] A relative virtual address.
+ - size [in] The number of bytes that must be readable.
+*/
+NMD_ASSEMBLY_API const void* nmd_x86_pe_rva_to_pointer(const nmd_x86_pe* pe, uint32_t rva, size_t size)
+{
+	size_t offset, available;
+	if (!_nmd_x86_pe_rva_to_offset(pe, rva, &offset, &available) || size > available)
+		return 0;
+	return pe->image + offset;
+}
+
+/*
+Finds the executable sections of a parsed PE file(the sections with the 'IMAGE_SCN_MEM_EXECUTE' or 'IMAGE_SCN_CNT_CODE' characteristic).
+Only the part of a section that is stored in the file is returned. Returns the number of executable sections, which may be larger than
+'max_sections'; only the first 'max_sections' are stored.
+Parameters:
+ - pe           [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - sections     [out] A pointer to an array of 'nmd_x86_code_section' that receives the sections. May be null if 'max_sections' is zero.
+ - max_sections [in]  The number of elements in 'sections'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_pe_get_executable_sections(const nmd_x86_pe* pe, nmd_x86_code_section* sections, size_t max_sections)
+{
+	size_t i, num_executable = 0;
+
+	for (i = 0; i < pe->num_sections; i++)
+	{
+		const uint8_t* const header = pe->image + pe->section_headers + i * _NMD_PE_SECTION_HEADER_SIZE;
+		const size_t virtual_size = (size_t)_nmd_x86_read_le(header + 8, 4), raw_offset = (size_t)_nmd_x86_read_le(header + 20, 4);
+		size_t size = (size_t)_nmd_x86_read_le(header + 16, 4);
+
+		if (!(_nmd_x86_read_le(header + 36, 4) & (_NMD_PE_SECTION_EXECUTE | _NMD_PE_SECTION_CODE)) || raw_offset >= pe->image_size)
+			continue;
+
+		/* The raw size is rounded up to the file alignment, the virtual size is the real size unless it is zero. */
+		if (virtual_size)
+			size = _NMD_MIN(size, virtual_size);
+		size = _NMD_MIN(size, pe->image_size - raw_offset);
+
+		if (num_executable < max_sections)
+		{
+			nmd_x86_code_section* const section = &sections[num_executable];
+			section->name = (const char*)header;
+			for (section->name_length = 0; section->name_length < 8 && header[section->name_length]; section->name_length++);
+			section->code = pe->image + raw_offset;
+			section->size = size;
+			section->address = pe->image_base + _nmd_x86_read_le(header + 12, 4);
+			section->mode = pe->mode;
+		}
+		num_executable++;
+	}
+
+	return num_executable;
+}
+
+/* Fills the symbol of the function at 'index' of the export address table. Returns false if the function is not exported. */
+NMD_ASSEMBLY_API bool _nmd_x86_pe_export(const nmd_x86_pe* pe, uint32_t index, nmd_x86_pe_symbol* symbol)
+{
+	uint64_t functions, base, rva, name;
+	if (!_nmd_x86_pe_read(pe, pe->export_directory + 28, 4, &functions) || !_nmd_x86_pe_read(pe, (uint32_t)functions + index * 4, 4, &rva) || !rva ||
+		!_nmd_x86_pe_read(pe, pe->export_directory + 16, 4, &base) || !_nmd_x86_pe_read(pe, pe->export_directory + 12, 4, &name))
+		return false;
+
+	symbol->module = _nmd_x86_pe_string(pe, (uint32_t)name);
+	symbol->name = 0;
+	symbol->rva = (uint32_t)rva;
+	symbol->ordinal = (uint16_t)(base + index);
+
+	/* An address inside the export directory is the name of the function this one is forwarded to(e.g. "NTDLL.RtlAllocateHeap"). */
+	symbol->forwarder = rva >= pe->export_directory && rva - pe->export_directory < pe->export_directory_size ? _nmd_x86_pe_string(pe, (uint32_t)rva) : 0;
+
+	return true;
+}
+
+/*
+Fills an array with the exports of a PE file sorted by RVA, so it can be searched with nmd_x86_pe_find_symbol(). Pass at least
+'pe->num_exports' elements to get all exports. Returns the number of exports stored.
+Parameters:
+ - pe          [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - exports     [out] A pointer to an array of 'nmd_x86_pe_symbol' that receives the exports.
+ - max_exports [in]  The number of elements in 'exports'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_pe_get_exports(const nmd_x86_pe* pe, nmd_x86_pe_symbol* exports, size_t max_exports)
+{
+	size_t num_exports = 0, low, high, mid;
+	uint64_t names, ordinals, num_names, name, ordinal, base;
+	uint32_t i;
+
+	for (i = 0; i < pe->num_exports && num_exports < max_exports; i++)
+	{
+		if (_nmd_x86_pe_export(pe, i, &exports[num_exports]))
+			num_exports++;
+	}
+
+	/* The exports are stored in the order of their ordinals, so the one of each name can be found with a binary search. */
+	if (num_exports && _nmd_x86_pe_read(pe, pe->export_directory + 24, 4, &num_names) && _nmd_x86_pe_read(pe, pe->export_directory + 32, 4, &names) &&
+		_nmd_x86_pe_read(pe, pe->export_directory + 36, 4, &ordinals) && _nmd_x86_pe_read(pe, pe->export_directory + 16, 4, &base))
+	{
+		for (i = 0; i < num_names; i++)
+		{
+			if (!_nmd_x86_pe_read(pe, (uint32_t)names + i * 4, 4, &name) || !_nmd_x86_pe_read(pe, (uint32_t)ordinals + i * 2, 2, &ordinal))
+				break;
+
+			ordinal = (uint16_t)(base + ordinal);
+			for (low = 0, high = num_exports; low < high;)
+			{
+				mid = (low + high) / 2;
+				if (exports[mid].ordinal < ordinal)
+					low = mid + 1;
+				else
+					high = mid;
+			}
+
+			if (low < num_exports && exports[low].ordinal == ordinal)
+				exports[low].name = _nmd_x86_pe_string(pe, (uint32_t)name);
+		}
+	}
+
+	_nmd_x86_pe_sort_symbols(exports, num_exports);
+	return num_exports;
+}
+
+/*
+Finds an export by name with a binary search over the export name table, which the PE format requires to be sorted. Needs no index.
+Returns false if the name is not exported.
+Parameters:
+ - pe     [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - name   [in]  The name of the export.
+ - symbol [out] A pointer to a variable that receives the export.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_pe_find_export(const nmd_x86_pe* pe, const char* name, nmd_x86_pe_symbol* symbol)
+{
+	uint64_t names, ordinals, num_names, name_rva, ordinal;
+	size_t low = 0, high, mid, i;
+	const char* other;
+
+	if (!pe->num_exports || !_nmd_x86_pe_read(pe, pe->export_directory + 24, 4, &num_names) || !_nmd_x86_pe_read(pe, pe->export_directory + 32, 4, &names) ||
+		!_nmd_x86_pe_read(pe, pe->export_directory + 36, 4, &ordinals))
+		return false;
+
+	high = (size_t)num_names;
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+		if (!_nmd_x86_pe_read(pe, (uint32_t)(names + mid * 4), 4, &name_rva) || !(other = _nmd_x86_pe_string(pe, (uint32_t)name_rva)))
+			return false;
+
+		for (i = 0; name[i] && name[i] == other[i]; i++);
+		if (name[i] == other[i])
+		{
+			if (!_nmd_x86_pe_read(pe, (uint32_t)(ordinals + mid * 2), 2, &ordinal) || !_nmd_x86_pe_export(pe, (uint32_t)ordinal, symbol))
+				return false;
+			symbol->name = other;
+			return true;
+		}
+		else if ((uint8_t)name[i] < (uint8_t)other[i])
+			high = mid;
+		else
+			low = mid + 1;
+	}
+
+	return false;
+}
+
+/*
+Fills an array with the imports of a PE file sorted by the RVA of their import address table slot, so the target of an indirect call
+or jump(e.g. 'call [__imp_CreateFileW]') can be found with nmd_x86_pe_find_symbol(). Returns the number of imports, which may be larger
+than 'max_imports'; only the first 'max_imports' are stored.
+Parameters:
+ - pe          [in]  A pointer to a variable parsed by nmd_x86_pe_parse().
+ - imports     [out] A pointer to an array of 'nmd_x86_pe_symbol' that receives the imports. May be null if 'max_imports' is zero.
+ - max_imports [in]  The number of elements in 'imports'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_pe_get_imports(const nmd_x86_pe* pe, nmd_x86_pe_symbol* imports, size_t max_imports)
+{
+	const size_t thunk_size = pe->mode == NMD_X86_MODE_64 ? 8 : 4;
+	const uint64_t ordinal_flag = (uint64_t)1 << (thunk_size * 8 - 1);
+	size_t num_imports = 0;
+	uint32_t descriptor, i;
+	uint64_t lookup, iat, name, thunk, hint;
+
+	for (descriptor = pe->import_directory; pe->import_directory; descriptor += _NMD_PE_IMPORT_DESCRIPTOR_SIZE)
+	{
+		if (!_nmd_x86_pe_read(pe, descriptor, 4, &lookup) || !_nmd_x86_pe_read(pe, descriptor + 12, 4, &name) || !_nmd_x86_pe_read(pe, descriptor + 16, 4, &iat) || (!name && !iat))
+			break;
+
+		/* Without a lookup table the names are read from the import address table, which holds them as long as the file is not bound. */
+		if (!lookup)
+			lookup = iat;
+
+		for (i = 0; _nmd_x86_pe_read(pe, (uint32_t)lookup + i * (uint32_t)thunk_size, thunk_size, &thunk) && thunk; i++)
+		{
+			if (num_imports < max_imports)
+			{
+				nmd_x86_pe_symbol* const symbol = &imports[num_imports];
+				symbol->module = _nmd_x86_pe_string(pe, (uint32_t)name);
+				symbol->rva = (uint32_t)iat + i * (uint32_t)thunk_size;
+				symbol->forwarder = 0;
+				if (thunk & ordinal_flag)
+				{
+					symbol->name = 0;
+					symbol->ordinal = (uint16_t)thunk;
+				}
+				else
+				{
+					symbol->name = _nmd_x86_pe_string(pe, (uint32_t)thunk + 2);
+					symbol->ordinal = _nmd_x86_pe_read(pe, (uint32_t)thunk, 2, &hint) ? (uint16_t)hint : 0;
+				}
+			}
+			num_imports++;
+		}
+	}
+
+	_nmd_x86_pe_sort_symbols(imports, _NMD_MIN(num_imports, max_imports));
+	return num_imports;
+}
+
+/*
+Finds the symbol at an RVA with a binary search. Returns a pointer to the symbol, or null if there's none at 'rva'.
+Parameters:
+ - symbols     [in] A pointer to an array filled by nmd_x86_pe_get_exports() or nmd_x86_pe_get_imports().
+ - num_symbols [in] The number of elements in 'symbols'.
+ - rva         [in] The RVA of an export, or of an import address table slot.
+*/
+NMD_ASSEMBLY_API const nmd_x86_pe_symbol* nmd_x86_pe_find_symbol(const nmd_x86_pe_symbol* symbols, size_t num_symbols, uint32_t rva)
+{
+	size_t low = 0, high = num_symbols, mid;
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+		if (symbols[mid].rva < rva)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low < num_symbols && symbols[low].rva == rva ? &symbols[low] : 0;
+}
@@ -0,0 +1,574 @@
+#include "nmd_common.h"
+
+/* The recursive descent needs the group to follow branches and the instruction's id to detect traps. */
+#define _NMD_RECURSIVE_DESCENT_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_GROUP)
+
+#define _NMD_CODE_MAP_END(entry) ((entry) >> NMD_X86_CODE_MAP_END_SHIFT)
+
+/* True if the decoder already visited the offset(an instruction starts there or decoding failed there). */
+#define _NMD_CODE_MAP_IS_EXPLORED(entry) ((entry) & (NMD_X86_CODE_MAP_LENGTH_MASK | NMD_X86_CODE_MAP_END_MASK))
+
+/* Returns the offset a relative branch targets. */
+NMD_ASSEMBLY_API int64_t _nmd_x86_get_branch_target(const nmd_x86_instruction* instruction, size_t offset)
+{
+	int64_t displacement;
+	if (instruction->imm_mask == NMD_X86_IMM8)
+		displacement = (int8_t)instruction->immediate;
+	else if (instruction->imm_mask == NMD_X86_IMM16)
+		displacement = (int16_t)instruction->immediate;
+	else
+		displacement = (int32_t)instruction->immediate;
+
+	return (int64_t)offset + instruction->length + displacement;
+}
+
+/* Extends the range of the code map changed by a recursive descent to include ['begin', 'end'). */
+_NMD_FORCE_INLINE void _nmd_x86_mark_changed(nmd_x86_recursive_descent* rd, size_t begin, size_t end)
+{
+	if (begin < rd->changed_begin)
+		rd->changed_begin = begin;
+	if (end > rd->changed_end)
+		rd->changed_end = end;
+}
+
+/* Marks 'target' as the start of a basic block and queues it if it wasn't explored yet. Targets outside the buffer are ignored. */
+NMD_ASSEMBLY_API void _nmd_x86_add_target(nmd_x86_recursive_descent* rd, int64_t target)
+{
+	uint8_t* entry;
+
+	if (target < 0 || (uint64_t)target >= rd->buffer_size)
+		return;
+
+	entry = &rd->code_map[target];
+	if (*entry & NMD_X86_CODE_MAP_LEADER)
+		return;
+
+	*entry |= NMD_X86_CODE_MAP_LEADER;
+	_nmd_x86_mark_changed(rd, (size_t)target, (size_t)target + 1);
+	if (_NMD_CODE_MAP_IS_EXPLORED(*entry))
+		return;
+
+	/* If the queue is full the target is still marked in the code map, nmd_x86_recursive_descent_run() finds it later */
+	if (rd->queue_size < rd->queue_capacity)
+		rd->queue[rd->queue_size++] = (uint32_t)target;
+	else
+		rd->queue_overflow = true;
+}
+
+/* Decodes the instruction at 'offset', stores its length and how it ends the block in the code map and queues its branch target. Returns its length, or zero if it's invalid. */
+_NMD_FORCE_INLINE size_t _nmd_x86_explore_instruction(nmd_x86_recursive_descent* rd, size_t offset, uint8_t* end)
+{
+	const uint8_t* const b = (const uint8_t*)rd->buffer;
+	nmd_x86_instruction instruction;
+	bool valid;
+
+	if (rd->buffer_size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+		valid = nmd_x86_decode_padded(b + offset, &instruction, (NMD_X86_MODE)rd->mode, _NMD_RECURSIVE_DESCENT_DECODER_FLAGS);
+	else
+		valid = nmd_x86_decode(b + offset, rd->buffer_size - offset, &instruction, (NMD_X86_MODE)rd->mode, _NMD_RECURSIVE_DESCENT_DECODER_FLAGS);
+
+	if (!valid)
+	{
+		*end = NMD_X86_BLOCK_END_INVALID;
+		rd->code_map[offset] |= NMD_X86_BLOCK_END_INVALID << NMD_X86_CODE_MAP_END_SHIFT;
+		return 0;
+	}
+
+	*end = NMD_X86_BLOCK_END_FALLTHROUGH;
+	if (instruction.group & NMD_GROUP_RET)
+		*end = NMD_X86_BLOCK_END_RET;
+	else if (instruction.group & NMD_GROUP_BRANCH)
+	{
+		if (instruction.group & NMD_GROUP_RELATIVE_ADDRESSING)
+		{
+			_nmd_x86_add_target(rd, _nmd_x86_get_branch_target(&instruction, offset));
+
+			/* Calls don't end the block. 'xbegin' is unconditional but continues at the next instruction as well. */
+			if (!(instruction.group & NMD_GROUP_CALL))
+				*end = (instruction.group & NMD_GROUP_JUMP && instruction.group & NMD_GROUP_UNCONDITIONAL_BRANCH) ? NMD_X86_BLOCK_END_JUMP : NMD_X86_BLOCK_END_CONDITIONAL;
+		}
+		else if (!(instruction.group & NMD_GROUP_CALL))
+			*end = NMD_X86_BLOCK_END_INDIRECT;
+	}
+	else if (instruction.id == NMD_X86_INSTRUCTION_INT3 || instruction.id == NMD_X86_INSTRUCTION_HLT || instruction.id == NMD_X86_INSTRUCTION_UD0 || instruction.id == NMD_X86_INSTRUCTION_UD1 || instruction.id == NMD_X86_INSTRUCTION_UD2)
+		*end = NMD_X86_BLOCK_END_TRAP;
+
+	rd->code_map[offset] |= (uint8_t)(instruction.length | (*end << NMD_X86_CODE_MAP_END_SHIFT));
+
+	if (*end == NMD_X86_BLOCK_END_CONDITIONAL && offset + instruction.length < rd->buffer_size)
+		rd->code_map[offset + instruction.length] |= NMD_X86_CODE_MAP_LEADER;
+
+	return instruction.length;
+}
+
+/* Returns true if an explored instruction that falls through ends at 'offset'. Instructions start at most 14 bytes before it. */
+_NMD_FORCE_INLINE bool _nmd_x86_is_fallen_into(const uint8_t* code_map, size_t offset)
+{
+	size_t i = offset > NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - 1 ? offset - (NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - 1) : 0;
+	for (; i < offset; i++)
+	{
+		if (i + (code_map[i] & NMD_X86_CODE_MAP_LENGTH_MASK) == offset && (_NMD_CODE_MAP_END(code_map[i]) == NMD_X86_BLOCK_END_FALLTHROUGH || _NMD_CODE_MAP_END(code_map[i]) == NMD_X86_BLOCK_END_CONDITIONAL))
+			return true;
+	}
+
+	return false;
+}
+
+/*
+Decodes instructions from 'offset' until the control flow leaves the straight line or reaches code that was already explored. If 'patched' is
+true, the instructions that start inside the decoded ones may have been reached by falling through bytes that changed, so they are forgotten
+unless they are branch targets or another explored instruction still falls into them.
+*/
+NMD_ASSEMBLY_API void _nmd_x86_explore(nmd_x86_recursive_descent* rd, size_t offset, bool patched)
+{
+	const size_t start = offset;
+	size_t length, i;
+	uint8_t end;
+
+	while (offset < rd->buffer_size && !_NMD_CODE_MAP_IS_EXPLORED(rd->code_map[offset]))
+	{
+		length = _nmd_x86_explore_instruction(rd, offset, &end);
+		if (length == 0)
+		{
+			_nmd_x86_mark_changed(rd, start, offset + 1);
+			return;
+		}
+
+		if (patched)
+		{
+			for (i = offset + 1; i < offset + length && i < rd->buffer_size; i++)
+			{
+				if (!(rd->code_map[i] & NMD_X86_CODE_MAP_LEADER) && !_nmd_x86_is_fallen_into(rd->code_map, i))
+					rd->code_map[i] = 0;
+			}
+		}
+
+		offset += length;
+
+		if (end != NMD_X86_BLOCK_END_FALLTHROUGH && end != NMD_X86_BLOCK_END_CONDITIONAL)
+		{
+			_nmd_x86_mark_changed(rd, start, offset);
+			return;
+		}
+	}
+
+	/* The straight line reached code that was already explored, which becomes a block of its own */
+	if (offset != start && offset < rd->buffer_size)
+	{
+		rd->code_map[offset] |= NMD_X86_CODE_MAP_LEADER;
+		_nmd_x86_mark_changed(rd, start, offset + 1);
+	}
+	else
+		_nmd_x86_mark_changed(rd, start, offset);
+}
+
+/*
+Initializes a recursive descent. The code map is cleared.
+Parameters:
+ - rd             [out] A pointer to a variable of type 'nmd_x86_recursive_descent'.
+ - buffer         [in]  A pointer to a buffer containing code. Offsets in the code map and in basic blocks are relative to it.
+ - buffer_size    [in]  The buffer's size in bytes. Must be less than 4GB.
+ - mode           [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - code_map       [out] A pointer to an array of 'buffer_size' bytes that receives the state of every offset. See 'NMD_X86_CODE_MAP'.
+ - queue          [in]  A pointer to an array of offsets used as the work queue.
+ - queue_capacity [in]  The number of elements in 'queue'. Any size works, a bigger queue avoids rescanning the code map when it overflows.
+*/
+NMD_ASSEMBLY_API void nmd_x86_recursive_descent_init(nmd_x86_recursive_descent* rd, const void* buffer, size_t buffer_size, NMD_X86_MODE mode, uint8_t* code_map, uint32_t* queue, size_t queue_capacity)
+{
+	size_t i;
+
+	rd->buffer = buffer;
+	rd->buffer_size = buffer_size;
+	rd->mode = (uint8_t)mode;
+	rd->code_map = code_map;
+	rd->queue = queue;
+	rd->queue_capacity = queue_capacity;
+	rd->queue_size = 0;
+	rd->queue_overflow = false;
+	rd->changed_begin = buffer_size;
+	rd->changed_end = 0;
+
+	for (i = 0; i < buffer_size; i++)
+		code_map[i] = 0;
+}
+
+/*
+Adds an entry point(e.g. a function or the program's entry point) to the work queue.
+Parameters:
+ - rd     [in/out] A pointer to a variable initialized by nmd_x86_recursive_descent_init().
+ - offset [in]     The entry point's offset in the buffer.
+*/
+NMD_ASSEMBLY_API void nmd_x86_recursive_descent_add_entry(nmd_x86_recursive_descent* rd, size_t offset)
+{
+	_nmd_x86_add_target(rd, (int64_t)offset);
+}
+
+/*
+Follows the control flow from the queued entry points until all reachable code is explored. Every byte is decoded at most once.
+Jump, branch and call targets are queued, the code after a call is assumed to be reachable and the code after a 'ret', an unconditional
+or indirect jump, 'int3', 'hlt' and 'ud0/1/2' is not. The result is stored in the code map, use nmd_x86_build_basic_blocks() to obtain the blocks.
+Parameters:
+ - rd [in/out] A pointer to a variable initialized by nmd_x86_recursive_descent_init().
+*/
+NMD_ASSEMBLY_API void nmd_x86_recursive_descent_run(nmd_x86_recursive_descent* rd)
+{
+	size_t offset;
+
+	for (;;)
+	{
+		while (rd->queue_size > 0)
+			_nmd_x86_explore(rd, rd->queue[--rd->queue_size], false);
+
+		if (!rd->queue_overflow)
+			return;
+
+		/* Some targets didn't fit in the queue. They are block starts that weren't explored yet. */
+		rd->queue_overflow = false;
+		for (offset = 0; offset < rd->buffer_size; offset++)
+		{
+			if (rd->code_map[offset] & NMD_X86_CODE_MAP_LEADER && !_NMD_CODE_MAP_IS_EXPLORED(rd->code_map[offset]))
+				_nmd_x86_explore(rd, offset, false);
+		}
+	}
+}
+
+/*
+Merges the code map of a recursive descent into another one of the same buffer. This allows disjoint sets of entry points to be explored
+by different threads, each one with its own code map, and the blocks to be built from the merged map.
+Parameters:
+ - code_map    [in/out] A pointer to the code map that receives the result.
+ - other       [in]     A pointer to the code map to be merged.
+ - buffer_size [in]     The buffer's size in bytes.
+*/
+NMD_ASSEMBLY_API void nmd_x86_code_map_merge(uint8_t* code_map, const uint8_t* other, size_t buffer_size)
+{
+	size_t offset, next;
+
+	for (offset = 0; offset < buffer_size; offset++)
+	{
+		/* An instruction that only 'other' explored and that falls into code already explored in 'code_map' joins two straight lines,
+		so the instruction after it must start a block. */
+		if (other[offset] & NMD_X86_CODE_MAP_LENGTH_MASK && !(code_map[offset] & NMD_X86_CODE_MAP_LENGTH_MASK))
+		{
+			const uint8_t end = _NMD_CODE_MAP_END(other[offset]);
+			next = offset + (other[offset] & NMD_X86_CODE_MAP_LENGTH_MASK);
+			if ((end == NMD_X86_BLOCK_END_FALLTHROUGH || end == NMD_X86_BLOCK_END_CONDITIONAL) && next < buffer_size && code_map[next] & NMD_X86_CODE_MAP_LENGTH_MASK)
+				code_map[next] |= NMD_X86_CODE_MAP_LEADER;
+		}
+	}
+
+	for (offset = 0; offset < buffer_size; offset++)
+		code_map[offset] |= other[offset];
+}
+
+/* Returns the index of the block that begins at 'offset', or 'NMD_X86_INVALID_BLOCK'. */
+NMD_ASSEMBLY_API uint32_t _nmd_x86_find_block(const nmd_x86_basic_block* blocks, size_t num_blocks, uint32_t offset)
+{
+	size_t low = 0, high = num_blocks;
+	while (low < high)
+	{
+		const size_t middle = low + (high - low) / 2;
+		if (blocks[middle].begin < offset)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low < num_blocks && blocks[low].begin == offset ? (uint32_t)low : NMD_X86_INVALID_BLOCK;
+}
+
+/* Builds the blocks whose first instruction starts in ['begin', 'end') like nmd_x86_build_basic_blocks(), but the successors are offsets. */
+NMD_ASSEMBLY_API size_t _nmd_x86_build_blocks_in_range(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, size_t begin, size_t end, nmd_x86_basic_block* blocks, size_t max_blocks)
+{
+	const uint8_t* const b = (const uint8_t*)buffer;
+	size_t offset, last, next, num_blocks = 0, num_instructions;
+	nmd_x86_instruction instruction;
+	uint8_t type;
+
+	for (offset = begin; offset < end; offset++)
+	{
+		if (!(code_map[offset] & NMD_X86_CODE_MAP_LEADER) || !(code_map[offset] & NMD_X86_CODE_MAP_LENGTH_MASK))
+			continue;
+
+		/* Follow the straight line until an instruction ends the block or the next instruction starts another one */
+		last = offset;
+		num_instructions = 1;
+		for (;;)
+		{
+			next = last + (code_map[last] & NMD_X86_CODE_MAP_LENGTH_MASK);
+			type = _NMD_CODE_MAP_END(code_map[last]);
+			if (type != NMD_X86_BLOCK_END_FALLTHROUGH || next >= buffer_size || !(code_map[next] & NMD_X86_CODE_MAP_LENGTH_MASK) || code_map[next] & NMD_X86_CODE_MAP_LEADER)
+				break;
+			last = next;
+			num_instructions++;
+		}
+
+		if (num_blocks < max_blocks)
+		{
+			nmd_x86_basic_block* const block = &blocks[num_blocks];
+			block->begin = (uint32_t)offset;
+			block->end = (uint32_t)next;
+			block->num_instructions = (uint16_t)(num_instructions > 0xffff ? 0xffff : num_instructions);
+			block->successors[0] = block->successors[1] = NMD_X86_INVALID_BLOCK;
+
+			if (type == NMD_X86_BLOCK_END_FALLTHROUGH && next < buffer_size && _NMD_CODE_MAP_END(code_map[next]) == NMD_X86_BLOCK_END_INVALID && !(code_map[next] & NMD_X86_CODE_MAP_LENGTH_MASK))
+				type = NMD_X86_BLOCK_END_INVALID;
+			block->type = type;
+
+			if ((type == NMD_X86_BLOCK_END_FALLTHROUGH || type == NMD_X86_BLOCK_END_CONDITIONAL) && next < buffer_size)
+				block->successors[0] = (uint32_t)next;
+
+			if (type == NMD_X86_BLOCK_END_JUMP || type == NMD_X86_BLOCK_END_CONDITIONAL)
+			{
+				int64_t target;
+				nmd_x86_decode(b + last, buffer_size - last, &instruction, mode, NMD_X86_DECODER_FLAGS_MINIMAL);
+				target = _nmd_x86_get_branch_target(&instruction, last);
+				if (target >= 0 && (uint64_t)target < buffer_size)
+					block->successors[1] = (uint32_t)target;
+			}
+		}
+
+		num_blocks++;
+	}
+
+	return num_blocks;
+}
+
+/*
+Builds the basic blocks described by a code map. The blocks are sorted by their offset. Returns the number of blocks, which may be greater
+than 'max_blocks', in which case only the first 'max_blocks' blocks are written and successors past them are 'NMD_X86_INVALID_BLOCK'.
+Parameters:
+ - buffer      [in]  A pointer to the buffer passed to nmd_x86_recursive_descent_init().
+ - buffer_size [in]  The buffer's size in bytes.
+ - mode        [in]  The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - code_map    [in]  A pointer to the code map filled by nmd_x86_recursive_descent_run().
+ - blocks      [out] A pointer to an array of 'nmd_x86_basic_block' that receives the blocks.
+ - max_blocks  [in]  The number of elements in 'blocks'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_build_basic_blocks(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, nmd_x86_basic_block* blocks, size_t max_blocks)
+{
+	const size_t num_blocks = _nmd_x86_build_blocks_in_range(buffer, buffer_size, mode, code_map, 0, buffer_size, blocks, max_blocks);
+	size_t i;
+
+	/* Convert the successors' offsets into indices */
+	for (i = 0; i < num_blocks && i < max_blocks; i++)
+	{
+		if (blocks[i].successors[0] != NMD_X86_INVALID_BLOCK)
+			blocks[i].successors[0] = _nmd_x86_find_block(blocks, _NMD_MIN(num_blocks, max_blocks), blocks[i].successors[0]);
+		if (blocks[i].successors[1] != NMD_X86_INVALID_BLOCK)
+			blocks[i].successors[1] = _nmd_x86_find_block(blocks, _NMD_MIN(num_blocks, max_blocks), blocks[i].successors[1]);
+	}
+
+	return num_blocks;
+}
+
+/*
+Updates the code map of a recursive descent after the bytes in ['begin', 'end') of its buffer were changed(e.g. patched in place). Only the
+explored instructions that overlap the range are decoded again: the straight line is decoded from the first of them until it reaches an
+instruction that is still valid, instructions that only fell through the old bytes are forgotten, branch targets among them are explored again
+and new branch targets are explored as usual. Code that only the old bytes reached is kept. The range of offsets whose state changed is stored
+in 'changed_begin' and 'changed_end' for nmd_x86_update_basic_blocks() and nmd_x86_xref_update(). Returns false if no explored instruction
+overlaps the range, in which case nothing changed.
+Parameters:
+ - rd            [in/out] A pointer to a recursive descent after nmd_x86_recursive_descent_run(), whose buffer contains the new bytes.
+ - begin         [in]     The offset of the first changed byte.
+ - end           [in]     The offset one past the last changed byte.
+ - changed_begin [out]    A pointer to a variable that receives the first offset whose state changed.
+ - changed_end   [out]    A pointer to a variable that receives the offset one past the last offset whose state changed.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_recursive_descent_patch(nmd_x86_recursive_descent* rd, size_t begin, size_t end, size_t* changed_begin, size_t* changed_end)
+{
+	uint8_t* const code_map = rd->code_map;
+	size_t offset, length, first = rd->buffer_size, forgotten_end = 0;
+
+	rd->changed_begin = rd->buffer_size;
+	rd->changed_end = 0;
+	*changed_begin = *changed_end = 0;
+	if (end > rd->buffer_size)
+		end = rd->buffer_size;
+
+	/* Forget the instructions that overlap the range. Instructions start at most 14 bytes before it. */
+	for (offset = begin > NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - 1 ? begin - (NMD_X86_MAXIMUM_INSTRUCTION_LENGTH - 1) : 0; offset < end; offset++)
+	{
+		length = code_map[offset] & NMD_X86_CODE_MAP_LENGTH_MASK;
+		if (!_NMD_CODE_MAP_IS_EXPLORED(code_map[offset]) || (offset < begin && offset + length <= begin))
+			continue;
+
+		if (first == rd->buffer_size)
+			first = offset;
+		forgotten_end = _NMD_MAX(forgotten_end, offset + _NMD_MAX(length, 1));
+
+		/* Other instructions still jump to the branch targets, so they are explored again. */
+		if (code_map[offset] & NMD_X86_CODE_MAP_LEADER && offset != first)
+		{
+			code_map[offset] = 0;
+			_nmd_x86_add_target(rd, (int64_t)offset);
+		}
+		else
+			code_map[offset] &= NMD_X86_CODE_MAP_LEADER;
+	}
+
+	if (first == rd->buffer_size)
+		return false;
+
+	_nmd_x86_mark_changed(rd, first, forgotten_end);
+	_nmd_x86_explore(rd, first, true);
+	nmd_x86_recursive_descent_run(rd);
+
+	*changed_begin = rd->changed_begin;
+	*changed_end = rd->changed_end;
+	return true;
+}
+
+/* Returns the index of the first block whose first instruction starts at or after 'offset'. */
+_NMD_FORCE_INLINE size_t _nmd_x86_lower_bound_block(const nmd_x86_basic_block* blocks, size_t num_blocks, size_t offset)
+{
+	size_t low = 0, high = num_blocks, middle;
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (blocks[middle].begin < offset)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+/* Returns the target of the branch that ends 'block', or -1. The last instruction is found by following the lengths in the code map. */
+_NMD_FORCE_INLINE int64_t _nmd_x86_get_block_target(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, const nmd_x86_basic_block* block)
+{
+	nmd_x86_instruction instruction;
+	size_t last = block->begin;
+
+	while (last + (code_map[last] & NMD_X86_CODE_MAP_LENGTH_MASK) < block->end && (code_map[last] & NMD_X86_CODE_MAP_LENGTH_MASK))
+		last += code_map[last] & NMD_X86_CODE_MAP_LENGTH_MASK;
+
+	if (!nmd_x86_decode((const uint8_t*)buffer + last, buffer_size - last, &instruction, mode, NMD_X86_DECODER_FLAGS_MINIMAL))
+		return -1;
+	return _nmd_x86_get_branch_target(&instruction, last);
+}
+
+/*
+Updates the basic blocks built by nmd_x86_build_basic_blocks() after nmd_x86_recursive_descent_patch(). Only the blocks that overlap the
+changed range(or end where it begins) are built again, in 'workspace', and replace the old ones in place; the other blocks are moved and
+their successors renumbered. Only a kept block whose branch target wasn't a block is decoded again, in case the target now starts one.
+Decoding scales with the changed range, but finding the overlapping blocks, renumbering and moving are linear in the number of blocks, and
+so is rebuilding the control flow graph with nmd_x86_cfg_build() afterwards. Returns the new number of blocks, or zero if the new blocks
+don't fit in 'workspace' or the result doesn't fit in 'max_blocks', in which case 'blocks' is not modified.
+Parameters:
+ - buffer         [in]     A pointer to the buffer passed to nmd_x86_recursive_descent_init().
+ - buffer_size    [in]     The buffer's size in bytes.
+ - mode           [in]     The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - code_map       [in]     A pointer to the code map updated by nmd_x86_recursive_descent_patch().
+ - changed_begin  [in]     The first offset whose state changed.
+ - changed_end    [in]     The offset one past the last offset whose state changed.
+ - blocks         [in/out] A pointer to the blocks of the code map before the patch.
+ - num_blocks     [in]     The number of blocks before the patch.
+ - max_blocks     [in]     The number of elements in 'blocks'.
+ - workspace      [in]     A pointer to an array used as temporary storage for the new blocks of the changed range.
+ - workspace_size [in]     The number of elements in 'workspace'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_update_basic_blocks(const void* buffer, size_t buffer_size, NMD_X86_MODE mode, const uint8_t* code_map, size_t changed_begin, size_t changed_end, nmd_x86_basic_block* blocks, size_t num_blocks, size_t max_blocks, nmd_x86_basic_block* workspace, size_t workspace_size)
+{
+	size_t first, last, range_begin = changed_begin, range_end = changed_end, num_new, i, k;
+	uint32_t successor;
+	ptrdiff_t delta;
+	int64_t target;
+
+	if (changed_begin >= changed_end)
+		return num_blocks;
+
+	/*
+	The old blocks [first, last) overlap the changed range or end where it begins. They're built again with the range. A block that starts
+	inside an instruction of another one makes the ends unsorted, so every block before the range is checked.
+	*/
+	first = _nmd_x86_lower_bound_block(blocks, num_blocks, changed_begin);
+	for (i = first; i > 0; i--)
+	{
+		if (blocks[i - 1].end >= changed_begin)
+			first = i - 1;
+	}
+	if (first < num_blocks)
+		range_begin = _NMD_MIN(range_begin, blocks[first].begin);
+	for (last = first; last < num_blocks && blocks[last].begin < range_end; last++)
+		range_end = _NMD_MAX(range_end, blocks[last].end);
+
+	num_new = _nmd_x86_build_blocks_in_range(buffer, buffer_size, mode, code_map, range_begin, range_end, workspace, workspace_size);
+	delta = (ptrdiff_t)num_new - (ptrdiff_t)(last - first);
+	if (num_new > workspace_size || (size_t)((ptrdiff_t)num_blocks + delta) > max_blocks)
+		return 0;
+
+	/* Renumber the successors of the blocks that are kept while the old blocks of the range can still be looked up. */
+	for (i = 0; i < num_blocks; i++)
+	{
+		if (i == first)
+			i = last;
+		if (i >= num_blocks)
+			break;
+
+		for (k = 0; k < 2; k++)
+		{
+			successor = blocks[i].successors[k];
+			if (successor == NMD_X86_INVALID_BLOCK)
+			{
+				if (k == 1 && (blocks[i].type == NMD_X86_BLOCK_END_JUMP || blocks[i].type == NMD_X86_BLOCK_END_CONDITIONAL))
+				{
+					target = _nmd_x86_get_block_target(buffer, buffer_size, mode, code_map, &blocks[i]);
+					if (target >= (int64_t)range_begin && target < (int64_t)range_end)
+					{
+						successor = _nmd_x86_find_block(workspace, num_new, (uint32_t)target);
+						blocks[i].successors[k] = successor == NMD_X86_INVALID_BLOCK ? successor : (uint32_t)(first + successor);
+					}
+				}
+			}
+			else if (successor >= last)
+				blocks[i].successors[k] = (uint32_t)((ptrdiff_t)successor + delta);
+			else if (successor >= first)
+			{
+				successor = _nmd_x86_find_block(workspace, num_new, blocks[successor].begin);
+				blocks[i].successors[k] = successor == NMD_X86_INVALID_BLOCK ? successor : (uint32_t)(first + successor);
+			}
+		}
+	}
+
+	/* The successors of the new blocks are offsets, in the range or in the blocks that are kept. */
+	for (i = 0; i < num_new; i++)
+	{
+		for (k = 0; k < 2; k++)
+		{
+			successor = workspace[i].successors[k];
+			if (successor == NMD_X86_INVALID_BLOCK)
+				continue;
+
+			if (successor >= range_begin && successor < range_end)
+			{
+				successor = _nmd_x86_find_block(workspace, num_new, successor);
+				workspace[i].successors[k] = successor == NMD_X86_INVALID_BLOCK ? successor : (uint32_t)(first + successor);
+			}
+			else
+			{
+				successor = _nmd_x86_find_block(blocks, num_blocks, successor);
+				workspace[i].successors[k] = successor == NMD_X86_INVALID_BLOCK || successor < first ? successor : (uint32_t)((ptrdiff_t)successor + delta);
+			}
+		}
+	}
+
+	/* Move the blocks after the range and copy the new ones. */
+	if (delta > 0)
+	{
+		for (i = num_blocks; i > last; i--)
+			blocks[i - 1 + delta] = blocks[i - 1];
+	}
+	else if (delta < 0)
+	{
+		for (i = last; i < num_blocks; i++)
+			blocks[(ptrdiff_t)i + delta] = blocks[i];
+	}
+
+	for (i = 0; i < num_new; i++)
+		blocks[first + i] = workspace[i];
+
+	return (size_t)((ptrdiff_t)num_blocks + delta);
+}
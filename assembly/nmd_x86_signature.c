@@ -0,0 +1,556 @@
+#include "nmd_common.h"
+
+/* The size of the buffer that receives a token of a query, including the null terminator. */
+#define _NMD_SIGNATURE_MAX_TOKEN 24
+
+/* The names of the register classes in the order of 'NMD_X86_SIGNATURE_REG', starting at 'NMD_X86_SIGNATURE_REG_ANY'. */
+NMD_ASSEMBLY_API const char* const _nmd_x86_signature_classes[] = { "reg", "reg8", "reg16", "reg32", "reg64", "sreg", "cr", "dr", "mm", "xmm", "ymm", "zmm", "k", "st" };
+
+_NMD_FORCE_INLINE const char* _nmd_x86_signature_skip_spaces(const char* s)
+{
+	while (*s == ' ' || *s == '\t')
+		s++;
+	return s;
+}
+
+/* Copies the letters, digits and underscores at '*s' to 'token' in lowercase and advances '*s' past them. Returns the length of the token, or zero if there's none or it's too long. */
+NMD_ASSEMBLY_API size_t _nmd_x86_signature_read_token(const char** s, char* token)
+{
+	const char* p = *s;
+	size_t length = 0;
+
+	for (; _NMD_IS_UPPERCASE(*p) || _NMD_IS_LOWERCASE(*p) || _NMD_IS_DECIMAL_NUMBER(*p) || *p == '_'; p++)
+	{
+		if (length == _NMD_SIGNATURE_MAX_TOKEN - 1)
+			return 0;
+		token[length++] = (char)_NMD_TOLOWER(*p);
+	}
+
+	token[length] = '\0';
+	*s = p;
+	return length;
+}
+
+/* Returns 'n' if 'token' is 'prefix' followed by a decimal number 'n' smaller than 'count'(e.g. "xmm12"), otherwise -1. */
+NMD_ASSEMBLY_API int _nmd_x86_signature_numbered(const char* token, const char* prefix, int count)
+{
+	int n = 0;
+
+	for (; *prefix; token++, prefix++)
+	{
+		if (*token != *prefix)
+			return -1;
+	}
+
+	/* No leading zeros. */
+	if (!*token || (token[0] == '0' && token[1]))
+		return -1;
+
+	for (; *token; token++)
+	{
+		if (!_NMD_IS_DECIMAL_NUMBER(*token) || n >= count)
+			return -1;
+		n = n * 10 + (*token - '0');
+	}
+
+	return n < count ? n : -1;
+}
+
+/* Returns the member of 'NMD_X86_REG' or 'NMD_X86_SIGNATURE_REG' named 'token', or 'NMD_X86_REG_NONE' if there's none. */
+NMD_ASSEMBLY_API uint8_t _nmd_x86_signature_parse_reg(const char* token)
+{
+	const char* const* const gprs[] = { _nmd_reg8, _nmd_reg16, _nmd_reg32, _nmd_reg64, _nmd_regrx, _nmd_regrxb, _nmd_regrxw, _nmd_regrxd };
+	const uint8_t gpr_bases[] = { NMD_X86_REG_AL, NMD_X86_REG_AX, NMD_X86_REG_EAX, NMD_X86_REG_RAX, NMD_X86_REG_R8, NMD_X86_REG_R8B, NMD_X86_REG_R8W, NMD_X86_REG_R8D };
+	const char* const prefixes[] = { "cr", "dr", "mm", "xmm", "ymm", "zmm", "k", "st" };
+	const uint8_t prefix_bases[] = { NMD_X86_REG_CR0, NMD_X86_REG_DR0, NMD_X86_REG_MM0, NMD_X86_REG_XMM0, NMD_X86_REG_YMM0, NMD_X86_REG_ZMM0, NMD_X86_REG_K0, NMD_X86_REG_ST0 };
+	const int prefix_counts[] = { 16, 16, 8, 32, 32, 32, 8, 8 };
+	size_t i, k;
+	int n;
+
+	for (i = 0; i < _NMD_NUM_ELEMENTS(gprs); i++)
+	{
+		for (k = 0; k < 8; k++)
+		{
+			if (_nmd_strcmp(token, gprs[i][k]))
+				return (uint8_t)(gpr_bases[i] + k);
+		}
+	}
+
+	for (i = 0; i < _NMD_NUM_ELEMENTS(_nmd_segment_reg); i++)
+	{
+		if (_nmd_strcmp(token, _nmd_segment_reg[i]))
+			return (uint8_t)(NMD_X86_REG_ES + i);
+	}
+
+	for (i = 0; i < _NMD_NUM_ELEMENTS(prefixes); i++)
+	{
+		if ((n = _nmd_x86_signature_numbered(token, prefixes[i], prefix_counts[i])) >= 0)
+			return (uint8_t)(prefix_bases[i] + n);
+	}
+
+	for (i = 0; i < _NMD_NUM_ELEMENTS(_nmd_x86_signature_classes); i++)
+	{
+		if (_nmd_strcmp(token, _nmd_x86_signature_classes[i]))
+			return (uint8_t)(NMD_X86_SIGNATURE_REG_ANY + i);
+	}
+
+	/* SDM notation for the general purpose register classes. 'r8' is the register, not the class. */
+	if (_nmd_strcmp(token, "r16"))
+		return NMD_X86_SIGNATURE_REG_GPR16;
+	else if (_nmd_strcmp(token, "r32"))
+		return NMD_X86_SIGNATURE_REG_GPR32;
+	else if (_nmd_strcmp(token, "r64"))
+		return NMD_X86_SIGNATURE_REG_GPR64;
+	else if (_nmd_strcmp(token, "ip"))
+		return NMD_X86_REG_IP;
+	else if (_nmd_strcmp(token, "eip"))
+		return NMD_X86_REG_EIP;
+	else if (_nmd_strcmp(token, "rip"))
+		return NMD_X86_REG_RIP;
+
+	return NMD_X86_REG_NONE;
+}
+
+/* Returns the member of 'NMD_X86_INSTRUCTION' named 'token', or 'NMD_X86_INSTRUCTION_INVALID' if there's none. */
+NMD_ASSEMBLY_API uint16_t _nmd_x86_signature_find_instruction(const char* token)
+{
+	const char* name = _nmd_x86_instruction_names;
+	uint16_t id;
+
+	for (id = 0; id < NMD_X86_NUM_INSTRUCTIONS; id++)
+	{
+		/* 'invalid' is not a name that can be searched for. */
+		if (id != NMD_X86_INSTRUCTION_INVALID && _nmd_strcmp(token, name))
+			return id;
+
+		while (*name++);
+	}
+
+	return NMD_X86_INSTRUCTION_INVALID;
+}
+
+/* Parses the number in 'token', which must start with a digit and be fully consumed. */
+_NMD_FORCE_INLINE bool _nmd_x86_signature_parse_number(const char* token, size_t length, int64_t* num)
+{
+	return _NMD_IS_DECIMAL_NUMBER(token[0]) && _nmd_parse_number(token, num) == length;
+}
+
+/* Parses the terms of a memory operand pattern. '*s' points past the '['. */
+NMD_ASSEMBLY_API bool _nmd_x86_signature_parse_memory(const char** s, nmd_x86_signature_operand* operand)
+{
+	char token[_NMD_SIGNATURE_MAX_TOKEN];
+	const char* p = _nmd_x86_signature_skip_spaces(*s);
+	bool is_negative = false, has_disp = false;
+	size_t length;
+	int64_t num;
+	uint8_t reg;
+
+	operand->type = NMD_X86_OPERAND_TYPE_MEMORY;
+
+	if (*p == '?' && *_nmd_x86_signature_skip_spaces(p + 1) == ']')
+	{
+		operand->reg = NMD_X86_SIGNATURE_REG_OPTIONAL;
+		operand->index = NMD_X86_SIGNATURE_REG_OPTIONAL;
+		operand->scale = NMD_X86_SIGNATURE_ANY_SCALE;
+		*s = _nmd_x86_signature_skip_spaces(p + 1) + 1;
+		return true;
+	}
+
+	/* An omitted displacement must be zero. */
+	operand->has_value = true;
+
+	for (;;)
+	{
+		p = _nmd_x86_signature_skip_spaces(p);
+		if (*p == '?')
+		{
+			if (is_negative || has_disp)
+				return false;
+			has_disp = true;
+			operand->has_value = false;
+			p++;
+		}
+		else if (!(length = _nmd_x86_signature_read_token(&p, token)))
+			return false;
+		else if (_NMD_IS_DECIMAL_NUMBER(token[0]))
+		{
+			if (has_disp || !_nmd_x86_signature_parse_number(token, length, &num))
+				return false;
+			has_disp = true;
+			operand->value = is_negative ? -num : num;
+		}
+		else
+		{
+			if (is_negative || (reg = _nmd_x86_signature_parse_reg(token)) == NMD_X86_REG_NONE)
+				return false;
+
+			p = _nmd_x86_signature_skip_spaces(p);
+			if (*p == '*')
+			{
+				if (operand->index != NMD_X86_REG_NONE)
+					return false;
+				operand->index = reg;
+
+				p = _nmd_x86_signature_skip_spaces(p + 1);
+				if (*p == '?')
+				{
+					operand->scale = NMD_X86_SIGNATURE_ANY_SCALE;
+					p++;
+				}
+				else
+				{
+					if (!(length = _nmd_x86_signature_read_token(&p, token)) || !_nmd_x86_signature_parse_number(token, length, &num))
+						return false;
+
+					switch (num)
+					{
+					case 1: operand->scale = 0; break;
+					case 2: operand->scale = 1; break;
+					case 4: operand->scale = 2; break;
+					case 8: operand->scale = 3; break;
+					default: return false;
+					}
+				}
+			}
+			else if (operand->reg == NMD_X86_REG_NONE)
+				operand->reg = reg;
+			else if (operand->index == NMD_X86_REG_NONE)
+				operand->index = reg;
+			else
+				return false;
+		}
+
+		p = _nmd_x86_signature_skip_spaces(p);
+		if (*p == ']')
+		{
+			*s = p + 1;
+			return true;
+		}
+		else if (*p != '+' && *p != '-')
+			return false;
+
+		is_negative = *p++ == '-';
+	}
+}
+
+/* Parses an operand pattern at '*s' and advances '*s' past it. */
+NMD_ASSEMBLY_API bool _nmd_x86_signature_parse_operand(const char** s, nmd_x86_signature_operand* operand)
+{
+	char token[_NMD_SIGNATURE_MAX_TOKEN];
+	const char* p = *s;
+	bool is_negative = false;
+	size_t length;
+	int64_t num;
+
+	operand->type = NMD_X86_OPERAND_TYPE_NONE;
+	operand->reg = NMD_X86_REG_NONE;
+	operand->index = NMD_X86_REG_NONE;
+	operand->scale = 0;
+	operand->has_value = false;
+	operand->value = 0;
+
+	if (*p == '?')
+	{
+		*s = p + 1;
+		return true;
+	}
+	else if (*p == '[')
+	{
+		*s = p + 1;
+		return _nmd_x86_signature_parse_memory(s, operand);
+	}
+	else if (*p == '-')
+	{
+		is_negative = true;
+		p = _nmd_x86_signature_skip_spaces(p + 1);
+	}
+
+	if (!(length = _nmd_x86_signature_read_token(&p, token)))
+		return false;
+	*s = p;
+
+	if (_NMD_IS_DECIMAL_NUMBER(token[0]))
+	{
+		if (!_nmd_x86_signature_parse_number(token, length, &num))
+			return false;
+		operand->type = NMD_X86_OPERAND_TYPE_IMMEDIATE;
+		operand->has_value = true;
+		operand->value = is_negative ? -num : num;
+		return true;
+	}
+	else if (is_negative)
+		return false;
+	else if (_nmd_strcmp(token, "imm"))
+	{
+		operand->type = NMD_X86_OPERAND_TYPE_IMMEDIATE;
+		return true;
+	}
+
+	operand->type = NMD_X86_OPERAND_TYPE_REGISTER;
+	operand->reg = _nmd_x86_signature_parse_reg(token);
+	return operand->reg != NMD_X86_REG_NONE;
+}
+
+/* Parses the element at '*s' and advances '*s' to the ';' that ends it or to the end of the query. */
+NMD_ASSEMBLY_API bool _nmd_x86_signature_parse_element(const char** s, nmd_x86_signature_element* element)
+{
+	char token[_NMD_SIGNATURE_MAX_TOKEN];
+	const char* p = _nmd_x86_signature_skip_spaces(*s);
+
+	element->num_operands = NMD_X86_SIGNATURE_ANY_OPERANDS;
+
+	if (*p == '?')
+	{
+		element->id = NMD_X86_INSTRUCTION_INVALID;
+		p++;
+	}
+	else if (!_nmd_x86_signature_read_token(&p, token) || (element->id = _nmd_x86_signature_find_instruction(token)) == NMD_X86_INSTRUCTION_INVALID)
+		return false;
+
+	p = _nmd_x86_signature_skip_spaces(p);
+	if (*p && *p != ';')
+	{
+		element->num_operands = 0;
+		for (;;)
+		{
+			if (element->num_operands == NMD_X86_SIGNATURE_MAX_OPERANDS || !_nmd_x86_signature_parse_operand(&p, &element->operands[element->num_operands]))
+				return false;
+			element->num_operands++;
+
+			p = _nmd_x86_signature_skip_spaces(p);
+			if (*p != ',')
+				break;
+			p = _nmd_x86_signature_skip_spaces(p + 1);
+		}
+
+		if (*p && *p != ';')
+			return false;
+	}
+
+	*s = p;
+	return true;
+}
+
+/*
+Compiles a signature query. Returns the number of elements, or zero if the query is not valid or 'max_elements' is too small.
+Parameters:
+ - query        [in]  A null-terminated string. See the 'Signatures' section at the top of this file for the syntax.
+ - elements     [out] A pointer to an array of 'nmd_x86_signature_element' that receives the compiled elements.
+ - max_elements [in]  The number of elements in 'elements'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_signature_compile(const char* query, nmd_x86_signature_element* elements, size_t max_elements)
+{
+	size_t num_elements = 0;
+
+	for (;;)
+	{
+		if (num_elements == max_elements || !_nmd_x86_signature_parse_element(&query, &elements[num_elements]))
+			return 0;
+		num_elements++;
+
+		if (*query == '\0')
+			return num_elements;
+		query++; /* ';' */
+	}
+}
+
+/* Returns true if 'reg' is 'pattern' or belongs to it. 'pattern' is a member of 'NMD_X86_REG' or 'NMD_X86_SIGNATURE_REG'. */
+NMD_ASSEMBLY_API bool _nmd_x86_signature_match_reg(uint8_t pattern, uint8_t reg)
+{
+	switch (pattern)
+	{
+	case NMD_X86_SIGNATURE_REG_ANY:      return reg != NMD_X86_REG_NONE;
+	case NMD_X86_SIGNATURE_REG_GPR8:     return (reg >= NMD_X86_REG_AL && reg <= NMD_X86_REG_BH) || (reg >= NMD_X86_REG_R8B && reg <= NMD_X86_REG_R15B);
+	case NMD_X86_SIGNATURE_REG_GPR16:    return (reg >= NMD_X86_REG_AX && reg <= NMD_X86_REG_DI) || (reg >= NMD_X86_REG_R8W && reg <= NMD_X86_REG_R15W);
+	case NMD_X86_SIGNATURE_REG_GPR32:    return (reg >= NMD_X86_REG_EAX && reg <= NMD_X86_REG_EDI) || (reg >= NMD_X86_REG_R8D && reg <= NMD_X86_REG_R15D);
+	case NMD_X86_SIGNATURE_REG_GPR64:    return reg >= NMD_X86_REG_RAX && reg <= NMD_X86_REG_R15;
+	case NMD_X86_SIGNATURE_REG_SREG:     return reg >= NMD_X86_REG_ES && reg <= NMD_X86_REG_GS;
+	case NMD_X86_SIGNATURE_REG_CR:       return reg >= NMD_X86_REG_CR0 && reg <= NMD_X86_REG_CR15;
+	case NMD_X86_SIGNATURE_REG_DR:       return reg >= NMD_X86_REG_DR0 && reg <= NMD_X86_REG_DR15;
+	case NMD_X86_SIGNATURE_REG_MM:       return reg >= NMD_X86_REG_MM0 && reg <= NMD_X86_REG_MM7;
+	case NMD_X86_SIGNATURE_REG_XMM:      return reg >= NMD_X86_REG_XMM0 && reg <= NMD_X86_REG_XMM31;
+	case NMD_X86_SIGNATURE_REG_YMM:      return reg >= NMD_X86_REG_YMM0 && reg <= NMD_X86_REG_YMM31;
+	case NMD_X86_SIGNATURE_REG_ZMM:      return reg >= NMD_X86_REG_ZMM0 && reg <= NMD_X86_REG_ZMM31;
+	case NMD_X86_SIGNATURE_REG_K:        return reg >= NMD_X86_REG_K0 && reg <= NMD_X86_REG_K7;
+	case NMD_X86_SIGNATURE_REG_ST:       return reg >= NMD_X86_REG_ST0 && reg <= NMD_X86_REG_ST7;
+	case NMD_X86_SIGNATURE_REG_OPTIONAL: return true;
+	default:                             return reg == pattern;
+	}
+}
+
+/* Returns true if an explicit operand of 'instruction' matches an operand pattern. */
+NMD_ASSEMBLY_API bool _nmd_x86_signature_match_operand(const nmd_x86_signature_operand* pattern, const nmd_x86_instruction* instruction, const nmd_x86_operand* operand)
+{
+	uint64_t mask;
+	int64_t disp;
+
+	if (pattern->type == NMD_X86_OPERAND_TYPE_NONE)
+		return true;
+	else if (pattern->type != operand->type)
+		return false;
+
+	if (pattern->type == NMD_X86_OPERAND_TYPE_REGISTER)
+		return _nmd_x86_signature_match_reg(pattern->reg, operand->fields.reg);
+	else if (pattern->type == NMD_X86_OPERAND_TYPE_IMMEDIATE)
+	{
+		if (!pattern->has_value)
+			return true;
+		else if (!instruction->imm_mask)
+			return operand->fields.imm == pattern->value;
+
+		/* Compare with the width of the encoded immediate, so both -1 and 0xff match the imm8 'ff'. */
+		mask = instruction->imm_mask >= 8 ? (uint64_t)(-1) : ((uint64_t)1 << (instruction->imm_mask * 8)) - 1;
+		return ((uint64_t)pattern->value & mask) == (instruction->immediate & mask);
+	}
+
+	/* NMD_X86_OPERAND_TYPE_MEMORY */
+	if (!_nmd_x86_signature_match_reg(pattern->reg, operand->fields.mem.base) || !_nmd_x86_signature_match_reg(pattern->index, operand->fields.mem.index))
+		return false;
+	else if (operand->fields.mem.index != NMD_X86_REG_NONE && pattern->scale != NMD_X86_SIGNATURE_ANY_SCALE && pattern->scale != operand->fields.mem.scale)
+		return false;
+	else if (!pattern->has_value)
+		return true;
+
+	switch (instruction->disp_mask)
+	{
+	case NMD_X86_DISP8:  disp = (int8_t)instruction->displacement; break;
+	case NMD_X86_DISP16: disp = (int16_t)instruction->displacement; break;
+	case NMD_X86_DISP32: disp = (int32_t)instruction->displacement; break;
+	default:             disp = operand->fields.mem.disp; break;
+	}
+
+	return disp == pattern->value;
+}
+
+/* Returns true if 'instruction' matches an element. */
+NMD_ASSEMBLY_API bool _nmd_x86_signature_match_element(const nmd_x86_signature_element* element, const nmd_x86_instruction* instruction)
+{
+	size_t i, num_explicit = 0;
+
+	if (!instruction->valid || (element->id != NMD_X86_INSTRUCTION_INVALID && element->id != instruction->id))
+		return false;
+	else if (element->num_operands == NMD_X86_SIGNATURE_ANY_OPERANDS)
+		return true;
+
+	for (i = 0; i < instruction->num_operands; i++)
+	{
+		if (instruction->operands[i].is_implicit)
+			continue;
+
+		if (num_explicit == element->num_operands || !_nmd_x86_signature_match_operand(&element->operands[num_explicit], instruction, &instruction->operands[i]))
+			return false;
+		num_explicit++;
+	}
+
+	return num_explicit == element->num_operands;
+}
+
+/*
+Returns true if the instructions starting at 'instructions' match a signature.
+Parameters:
+ - signature        [in] A pointer to a variable of type 'nmd_x86_signature'.
+ - instructions     [in] A pointer to an array of instructions decoded with 'NMD_X86_DECODER_FLAGS_INSTRUCTION_ID' and 'NMD_X86_DECODER_FLAGS_OPERANDS'.
+ - num_instructions [in] The number of elements in 'instructions'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_signature_matches(const nmd_x86_signature* signature, const nmd_x86_instruction* instructions, size_t num_instructions)
+{
+	size_t i;
+
+	if (signature->num_elements == 0 || signature->num_elements > num_instructions)
+		return false;
+
+	for (i = 0; i < signature->num_elements; i++)
+	{
+		if (!_nmd_x86_signature_match_element(&signature->elements[i], &instructions[i]))
+			return false;
+	}
+
+	return true;
+}
+
+/*
+Indexes signatures by the id of their first element. The set points to 'signatures' and 'memory', which must stay valid while it is used.
+Parameters:
+ - set            [out] A pointer to a variable of type 'nmd_x86_signature_set'.
+ - signatures     [in]  A pointer to an array of signatures.
+ - num_signatures [in]  The number of elements in 'signatures'.
+ - memory         [in]  A pointer to an array of 'NMD_X86_SIGNATURE_SET_MEMORY_SIZE(num_signatures)' elements that receives the index.
+*/
+NMD_ASSEMBLY_API void nmd_x86_signature_set_init(nmd_x86_signature_set* set, const nmd_x86_signature* signatures, size_t num_signatures, uint32_t* memory)
+{
+	uint32_t* const offsets = memory;
+	uint32_t* const order = memory + NMD_X86_NUM_INSTRUCTIONS + 1;
+	size_t i, id;
+
+	for (i = 0; i <= NMD_X86_NUM_INSTRUCTIONS; i++)
+		offsets[i] = 0;
+
+	/* Counting sort by the id of the first element. Signatures without elements go to the wildcard bucket, where they never match. */
+	for (i = 0; i < num_signatures; i++)
+		offsets[signatures[i].num_elements ? signatures[i].elements[0].id : NMD_X86_INSTRUCTION_INVALID]++;
+
+	for (i = 1; i < NMD_X86_NUM_INSTRUCTIONS; i++)
+		offsets[i] += offsets[i - 1];
+	offsets[NMD_X86_NUM_INSTRUCTIONS] = (uint32_t)num_signatures;
+
+	/* Filling the buckets from the end keeps the signatures of a bucket in ascending order and leaves 'offsets[id]' at the start of the bucket. */
+	for (i = num_signatures; i > 0; i--)
+	{
+		id = signatures[i - 1].num_elements ? signatures[i - 1].elements[0].id : NMD_X86_INSTRUCTION_INVALID;
+		order[--offsets[id]] = (uint32_t)(i - 1);
+	}
+
+	set->signatures = signatures;
+	set->num_signatures = num_signatures;
+	set->offsets = offsets;
+	set->order = order;
+}
+
+/*
+Finds every match of every signature of a set in a stream of decoded instructions in one pass. Returns the number of matches, which may
+be larger than 'max_matches'; only the first 'max_matches' are stored. Matches are sorted by instruction, then by signature.
+Parameters:
+ - set              [in]  A pointer to a set initialized by nmd_x86_signature_set_init().
+ - instructions     [in]  A pointer to an array of instructions decoded with 'NMD_X86_DECODER_FLAGS_INSTRUCTION_ID' and 'NMD_X86_DECODER_FLAGS_OPERANDS'(e.g. by nmd_x86_decode_buffer()).
+ - num_instructions [in]  The number of elements in 'instructions'.
+ - matches          [out] A pointer to an array of 'nmd_x86_signature_match' that receives the matches. May be null if 'max_matches' is zero.
+ - max_matches      [in]  The number of elements in 'matches'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_signature_scan(const nmd_x86_signature_set* set, const nmd_x86_instruction* instructions, size_t num_instructions, nmd_x86_signature_match* matches, size_t max_matches)
+{
+	size_t i, num_matches = 0;
+	uint32_t wildcard, wildcard_end, candidate, candidate_end, signature;
+
+	for (i = 0; i < num_instructions; i++)
+	{
+		if (!instructions[i].valid)
+			continue;
+
+		/* The candidates are the signatures that start with the instruction's id and the ones that start with '?'. Both buckets are merged so
+		   the matches of an instruction are sorted by signature. Instructions without an id only have the wildcard candidates. */
+		wildcard = set->offsets[NMD_X86_INSTRUCTION_INVALID];
+		wildcard_end = set->offsets[NMD_X86_INSTRUCTION_INVALID + 1];
+		candidate = set->offsets[instructions[i].id];
+		candidate_end = instructions[i].id == NMD_X86_INSTRUCTION_INVALID ? candidate : set->offsets[instructions[i].id + 1];
+
+		while (wildcard < wildcard_end || candidate < candidate_end)
+		{
+			if (candidate == candidate_end || (wildcard < wildcard_end && set->order[wildcard] < set->order[candidate]))
+				signature = set->order[wildcard++];
+			else
+				signature = set->order[candidate++];
+
+			if (nmd_x86_signature_matches(&set->signatures[signature], instructions + i, num_instructions - i))
+			{
+				if (num_matches < max_matches)
+				{
+					matches[num_matches].signature = signature;
+					matches[num_matches].instruction = (uint32_t)i;
+				}
+				num_matches++;
+			}
+		}
+	}
+
+	return num_matches;
+}
@@ -0,0 +1,65 @@
+#include "nmd_common.h"
+
+#ifdef NMD_ASSEMBLY_ENABLE_STATS
+_NMD_FORCE_INLINE void _nmd_x86_stats_count_decoded(const nmd_x86_instruction* instruction)
+{
+	uint32_t prefixes = instruction->prefixes;
+	uint8_t opcode_map = instruction->opcode_map;
+	size_t i;
+
+	/* The decoder reports VEX instructions in the default map, count them in the map selected by VEX.m_mmmm(1 = 0F, 2 = 0F38, 3 = 0F3A). */
+	if (instruction->encoding == NMD_X86_ENCODING_VEX)
+		opcode_map = (uint8_t)(instruction->vex.m_mmmm >= 1 && instruction->vex.m_mmmm <= 3 ? NMD_X86_OPCODE_MAP_DEFAULT + instruction->vex.m_mmmm : NMD_X86_OPCODE_MAP_NONE);
+
+	_nmd_x86_stats.num_decoded++;
+	_nmd_x86_stats.opcode_maps[opcode_map]++;
+	_nmd_x86_stats.encodings[instruction->encoding]++;
+	_nmd_x86_stats.lengths[instruction->length]++;
+
+	for (i = 0; prefixes; i++, prefixes >>= 1)
+	{
+		if (prefixes & 1)
+			_nmd_x86_stats.prefixes[i]++;
+	}
+}
+
+_NMD_FORCE_INLINE size_t _nmd_x86_stats_count_length(size_t length)
+{
+	_nmd_x86_stats.ldisasm_lengths[length]++;
+	return length;
+}
+
+/*
+Copies the counters of the calling thread. Only available if 'NMD_ASSEMBLY_ENABLE_STATS' is defined.
+Parameters:
+ - stats [out] A pointer to a variable of type 'nmd_x86_stats' that receives the counters.
+*/
+NMD_ASSEMBLY_API void nmd_x86_stats_snapshot(nmd_x86_stats* stats)
+{
+	*stats = _nmd_x86_stats;
+}
+
+/* Sets the counters of the calling thread to zero. Only available if 'NMD_ASSEMBLY_ENABLE_STATS' is defined. */
+NMD_ASSEMBLY_API void nmd_x86_stats_reset(void)
+{
+	size_t i = 0;
+	for (; i < sizeof(nmd_x86_stats); i++)
+		((uint8_t*)(&_nmd_x86_stats))[i] = 0x00;
+}
+
+/*
+Adds every counter of 'stats' to 'total', e.g. to combine the snapshots of several threads. Only available if 'NMD_ASSEMBLY_ENABLE_STATS' is defined.
+Parameters:
+ - total [in/out] A pointer to a variable of type 'nmd_x86_stats' that receives the sums.
+ - stats [in]     A pointer to a snapshot.
+*/
+NMD_ASSEMBLY_API void nmd_x86_stats_add(nmd_x86_stats* total, const nmd_x86_stats* stats)
+{
+	/* The structure only has 'uint64_t' counters. */
+	uint64_t* const p = (uint64_t*)total;
+	const uint64_t* const q = (const uint64_t*)stats;
+	size_t i = 0;
+	for (; i < sizeof(nmd_x86_stats) / sizeof(uint64_t); i++)
+		p[i] += q[i];
+}
+#endif /* NMD_ASSEMBLY_ENABLE_STATS */
@@ -0,0 +1,166 @@
+#include "nmd_common.h"
+
+#define _NMD_SWEEP_SET_BIT(bitmap, offset) ((bitmap)[(offset) / 32] |= (uint32_t)1 << ((offset) % 32))
+#define _NMD_SWEEP_CLEAR_BIT(bitmap, offset) ((bitmap)[(offset) / 32] &= ~((uint32_t)1 << ((offset) % 32)))
+#define _NMD_SWEEP_TEST_BIT(bitmap, offset) (((bitmap)[(offset) / 32] >> ((offset) % 32)) & 1)
+
+/* Returns the number of bytes the linear sweep advances at 'offset': the instruction's length, or one if the instruction is invalid. */
+_NMD_FORCE_INLINE size_t _nmd_x86_sweep_step(const uint8_t* buffer, size_t buffer_size, size_t offset, NMD_X86_MODE mode, uint32_t flags)
+{
+	nmd_x86_instruction instruction;
+	bool valid;
+
+	if (buffer_size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+		valid = nmd_x86_decode_padded(buffer + offset, &instruction, mode, flags);
+	else
+		valid = nmd_x86_decode(buffer + offset, buffer_size - offset, &instruction, mode, flags);
+
+	return valid ? instruction.length : 1;
+}
+
+/*
+Splits a buffer into chunks for nmd_x86_sweep_decode_chunk(). Every chunk begins at a multiple of 32 bytes so that chunks never share an element of
+the boundary bitmap. Returns the number of chunks used, which may be less than 'num_chunks' if the buffer is small.
+Parameters:
+ - buffer_size [in]  The buffer's size in bytes.
+ - chunks      [out] A pointer to an array of 'nmd_x86_sweep_chunk' that receives the chunks.
+ - num_chunks  [in]  The number of elements in 'chunks'. Usually the number of worker threads.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_sweep_split(size_t buffer_size, nmd_x86_sweep_chunk* chunks, size_t num_chunks)
+{
+	size_t i, chunk_size, offset = 0;
+
+	if (!num_chunks)
+		return 0;
+
+	chunk_size = ((buffer_size + num_chunks - 1) / num_chunks + 31) & ~(size_t)31;
+	if (chunk_size < 32)
+		chunk_size = 32;
+
+	for (i = 0; i < num_chunks && offset < buffer_size; i++)
+	{
+		chunks[i].begin = offset;
+		chunks[i].end = buffer_size - offset > chunk_size ? offset + chunk_size : buffer_size;
+		chunks[i].start = chunks[i].next = offset;
+		chunks[i].num_instructions = 0;
+		offset = chunks[i].end;
+	}
+
+	return i;
+}
+
+/*
+Performs a speculative linear sweep over a chunk. The sweep starts at a heuristic resynchronization point near the chunk's beginning: the
+first offset after a 'ret', 'int3' or 'nop' in the first 15 bytes(these usually end a function or its padding), or the chunk's beginning
+otherwise. Only the elements of 'boundary_bitmap' that cover the chunk are written, so different chunks can be decoded concurrently by
+different threads. The result is only final after nmd_x86_sweep_merge().
+Parameters:
+ - buffer          [in]     A pointer to the whole buffer.
+ - buffer_size     [in]     The whole buffer's size in bytes.
+ - mode            [in]     The architecture mode. 'NMD_X86_MODE_32', 'NMD_X86_MODE_64' or 'NMD_X86_MODE_16'.
+ - flags           [in]     A mask of 'NMD_X86_DECODER_FLAGS_XXX' that specifies which features the decoder is allowed to use. If uncertain, use 'NMD_X86_DECODER_FLAGS_MINIMAL'.
+ - chunk           [in/out] A pointer to a chunk returned by nmd_x86_sweep_split().
+ - boundary_bitmap [out]    A pointer to an array of '(buffer_size + 31) / 32' elements shared by all chunks.
+*/
+NMD_ASSEMBLY_API void nmd_x86_sweep_decode_chunk(const void* const buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t flags, nmd_x86_sweep_chunk* chunk, uint32_t* boundary_bitmap)
+{
+	const uint8_t* const b = (const uint8_t*)buffer;
+	size_t i, offset;
+
+	for (i = chunk->begin / 32; i < (chunk->end + 31) / 32; i++)
+		boundary_bitmap[i] = 0;
+
+	/* The sweep over the first chunk starts at the beginning of the buffer, which is a real instruction boundary */
+	offset = chunk->begin;
+	if (offset > 0)
+	{
+		for (i = offset; i < offset + NMD_X86_MAXIMUM_INSTRUCTION_LENGTH && i < chunk->end; i++)
+		{
+			if (b[i - 1] == 0xc3 || b[i - 1] == 0xcc || b[i - 1] == 0x90)
+			{
+				offset = i;
+				break;
+			}
+		}
+	}
+
+	chunk->start = offset;
+	chunk->num_instructions = 0;
+	while (offset < chunk->end)
+	{
+		_NMD_SWEEP_SET_BIT(boundary_bitmap, offset);
+		chunk->num_instructions++;
+		offset += _nmd_x86_sweep_step(b, buffer_size, offset, mode, flags);
+	}
+	chunk->next = offset;
+}
+
+/*
+Merges chunks decoded by nmd_x86_sweep_decode_chunk() so that 'boundary_bitmap' becomes identical to the result of a sequential linear sweep
+(see nmd_x86_ldisasm_bulk()). The chunks are visited in order: the offset where the previous chunk's sweep continues is the real entry
+point of the next chunk. If the speculative sweep already has an instruction there, the chunk is left as is without decoding anything.
+Otherwise the chunk is decoded sequentially from there, replacing the speculative boundaries, until the sweep reaches an offset that the
+speculative sweep also marked, after which both sweeps are identical. Usually this takes a few instructions per chunk. Returns the number
+of bits set.
+Parameters:
+ - buffer          [in]     A pointer to the whole buffer.
+ - buffer_size     [in]     The whole buffer's size in bytes.
+ - mode            [in]     The architecture mode. Must be the same as in nmd_x86_sweep_decode_chunk().
+ - flags           [in]     A mask of 'NMD_X86_DECODER_FLAGS_XXX'. Must be the same as in nmd_x86_sweep_decode_chunk().
+ - chunks          [in/out] A pointer to the array of chunks returned by nmd_x86_sweep_split(), all of them decoded.
+ - num_chunks      [in]     The number of chunks.
+ - boundary_bitmap [in/out] A pointer to the bitmap passed to nmd_x86_sweep_decode_chunk().
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_sweep_merge(const void* const buffer, size_t buffer_size, NMD_X86_MODE mode, uint32_t flags, nmd_x86_sweep_chunk* chunks, size_t num_chunks, uint32_t* boundary_bitmap)
+{
+	const uint8_t* const b = (const uint8_t*)buffer;
+	size_t i, offset, cleared, num_instructions = 0;
+
+	for (i = 0; i < num_chunks; i++)
+	{
+		nmd_x86_sweep_chunk* const chunk = &chunks[i];
+
+		/* The real sweep enters the chunk here */
+		offset = i == 0 ? chunk->begin : chunks[i - 1].next;
+
+		/* Remove the speculative boundaries before the first offset both sweeps share and mark the real ones. The
+		   speculative sweep is already correct when it has an instruction at the entry point. */
+		cleared = chunk->start;
+		while (offset < chunk->end && !(offset >= chunk->start && _NMD_SWEEP_TEST_BIT(boundary_bitmap, offset)))
+		{
+			for (; cleared < offset; cleared++)
+			{
+				if (_NMD_SWEEP_TEST_BIT(boundary_bitmap, cleared))
+				{
+					_NMD_SWEEP_CLEAR_BIT(boundary_bitmap, cleared);
+					chunk->num_instructions--;
+				}
+			}
+
+			_NMD_SWEEP_SET_BIT(boundary_bitmap, offset);
+			chunk->num_instructions++;
+			if (cleared <= offset)
+				cleared = offset + 1;
+
+			offset += _nmd_x86_sweep_step(b, buffer_size, offset, mode, flags);
+		}
+
+		/* Remove the speculative boundaries left before the offset where the sweeps meet(or the whole chunk if they don't), including those covered by the previous chunk's last instruction */
+		for (; cleared < offset && cleared < chunk->end; cleared++)
+		{
+			if (_NMD_SWEEP_TEST_BIT(boundary_bitmap, cleared))
+			{
+				_NMD_SWEEP_CLEAR_BIT(boundary_bitmap, cleared);
+				chunk->num_instructions--;
+			}
+		}
+
+		/* The chunk was decoded entirely without converging */
+		if (offset >= chunk->end)
+			chunk->next = offset;
+
+		num_instructions += chunk->num_instructions;
+	}
+
+	return num_instructions;
+}
@@ -0,0 +1,1163 @@
+/* This file was generated by generate_tables.py from x86_opcodes.txt. Do not modify it manually. */
+
+#include "nmd_common.h"
+
+NMD_ASSEMBLY_API const _nmd_x86_opcode_properties _nmd_x86_opcode_map_default[256] = {
+	/* 00 */ { NMD_X86_INSTRUCTION_ADD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 01 */ { NMD_X86_INSTRUCTION_ADD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 02 */ { NMD_X86_INSTRUCTION_ADD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 03 */ { NMD_X86_INSTRUCTION_ADD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 04 */ { NMD_X86_INSTRUCTION_ADD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 05 */ { NMD_X86_INSTRUCTION_ADD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 06 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 07 */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 08 */ { NMD_X86_INSTRUCTION_OR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 09 */ { NMD_X86_INSTRUCTION_OR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0A */ { NMD_X86_INSTRUCTION_OR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0B */ { NMD_X86_INSTRUCTION_OR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0C */ { NMD_X86_INSTRUCTION_OR, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 0D */ { NMD_X86_INSTRUCTION_OR, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 0E */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 10 */ { NMD_X86_INSTRUCTION_ADC, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 11 */ { NMD_X86_INSTRUCTION_ADC, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 12 */ { NMD_X86_INSTRUCTION_ADC, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 13 */ { NMD_X86_INSTRUCTION_ADC, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 14 */ { NMD_X86_INSTRUCTION_ADC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 15 */ { NMD_X86_INSTRUCTION_ADC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 16 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 17 */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 18 */ { NMD_X86_INSTRUCTION_SBB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 19 */ { NMD_X86_INSTRUCTION_SBB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1A */ { NMD_X86_INSTRUCTION_SBB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1B */ { NMD_X86_INSTRUCTION_SBB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1C */ { NMD_X86_INSTRUCTION_SBB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 1D */ { NMD_X86_INSTRUCTION_SBB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 1E */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1F */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 20 */ { NMD_X86_INSTRUCTION_AND, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 21 */ { NMD_X86_INSTRUCTION_AND, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 22 */ { NMD_X86_INSTRUCTION_AND, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 23 */ { NMD_X86_INSTRUCTION_AND, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 24 */ { NMD_X86_INSTRUCTION_AND, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 25 */ { NMD_X86_INSTRUCTION_AND, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 26 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 27 */ { NMD_X86_INSTRUCTION_DAA, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 28 */ { NMD_X86_INSTRUCTION_SUB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 29 */ { NMD_X86_INSTRUCTION_SUB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2A */ { NMD_X86_INSTRUCTION_SUB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2B */ { NMD_X86_INSTRUCTION_SUB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2C */ { NMD_X86_INSTRUCTION_SUB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 2D */ { NMD_X86_INSTRUCTION_SUB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 2E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2F */ { NMD_X86_INSTRUCTION_DAS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 30 */ { NMD_X86_INSTRUCTION_XOR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 31 */ { NMD_X86_INSTRUCTION_XOR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 32 */ { NMD_X86_INSTRUCTION_XOR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 33 */ { NMD_X86_INSTRUCTION_XOR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 34 */ { NMD_X86_INSTRUCTION_XOR, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 35 */ { NMD_X86_INSTRUCTION_XOR, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 36 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 37 */ { NMD_X86_INSTRUCTION_AAA, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 38 */ { NMD_X86_INSTRUCTION_CMP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 39 */ { NMD_X86_INSTRUCTION_CMP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3A */ { NMD_X86_INSTRUCTION_CMP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3B */ { NMD_X86_INSTRUCTION_CMP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3C */ { NMD_X86_INSTRUCTION_CMP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 3D */ { NMD_X86_INSTRUCTION_CMP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 3E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3F */ { NMD_X86_INSTRUCTION_AAS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 40 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 41 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 42 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 43 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 44 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 45 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 46 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 47 */ { NMD_X86_INSTRUCTION_INC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 48 */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 49 */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4A */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4B */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4C */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4D */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4E */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4F */ { NMD_X86_INSTRUCTION_DEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 50 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 51 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 52 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 53 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 54 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 55 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 56 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 57 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 58 */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 59 */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5A */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5B */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5C */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5D */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5E */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5F */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 60 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 61 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 62 */ { NMD_X86_INSTRUCTION_BOUND, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 63 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 64 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 65 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 66 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 67 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 68 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 69 */ { NMD_X86_INSTRUCTION_IMUL, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 6A */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6B */ { NMD_X86_INSTRUCTION_IMUL, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6C */ { NMD_X86_INSTRUCTION_INSB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6E */ { NMD_X86_INSTRUCTION_OUTSB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6F */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 70 */ { NMD_X86_INSTRUCTION_JO, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 71 */ { NMD_X86_INSTRUCTION_JNO, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 72 */ { NMD_X86_INSTRUCTION_JB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 73 */ { NMD_X86_INSTRUCTION_JNB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 74 */ { NMD_X86_INSTRUCTION_JZ, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 75 */ { NMD_X86_INSTRUCTION_JNZ, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 76 */ { NMD_X86_INSTRUCTION_JBE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 77 */ { NMD_X86_INSTRUCTION_JA, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 78 */ { NMD_X86_INSTRUCTION_JS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 79 */ { NMD_X86_INSTRUCTION_JNS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 7A */ { NMD_X86_INSTRUCTION_JP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 7B */ { NMD_X86_INSTRUCTION_JNP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 7C */ { NMD_X86_INSTRUCTION_JL, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 7D */ { NMD_X86_INSTRUCTION_JGE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 7E */ { NMD_X86_INSTRUCTION_JLE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 7F */ { NMD_X86_INSTRUCTION_JG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 80 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 81 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* 82 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 83 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 84 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 85 */ { NMD_X86_INSTRUCTION_TEST, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 86 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 87 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 88 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 89 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8A */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8B */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8C */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8D */ { NMD_X86_INSTRUCTION_LEA, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_GROUP, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8E */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8F */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 90 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 91 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 92 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 93 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 94 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 95 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 96 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 97 */ { NMD_X86_INSTRUCTION_XCHG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 98 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 99 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9A */ { NMD_X86_INSTRUCTION_CALL, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_FAR, 0, NMD_GROUP_CALL | NMD_GROUP_UNCONDITIONAL_BRANCH },
+	/* 9B */ { NMD_X86_INSTRUCTION_FWAIT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9C */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9E */ { NMD_X86_INSTRUCTION_SAHF, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9F */ { NMD_X86_INSTRUCTION_LAHF, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A0 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_MOFFS, 0, NMD_GROUP_NONE },
+	/* A1 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_MOFFS, 0, NMD_GROUP_NONE },
+	/* A2 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_MOFFS, 0, NMD_GROUP_NONE },
+	/* A3 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_MOFFS, 0, NMD_GROUP_NONE },
+	/* A4 */ { NMD_X86_INSTRUCTION_MOVSB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A5 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A6 */ { NMD_X86_INSTRUCTION_CMPSB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A8 */ { NMD_X86_INSTRUCTION_TEST, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* A9 */ { NMD_X86_INSTRUCTION_TEST, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* AA */ { NMD_X86_INSTRUCTION_STOSB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AB */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AC */ { NMD_X86_INSTRUCTION_LODSB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AD */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AE */ { NMD_X86_INSTRUCTION_SCASB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AF */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B0 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B1 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B2 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B3 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B4 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B5 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B6 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B7 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* B8 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* B9 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* BA */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* BB */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* BC */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* BD */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* BE */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* BF */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IV, 0, NMD_GROUP_NONE },
+	/* C0 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C1 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C2 */ { NMD_X86_INSTRUCTION_RET, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IW, 0, NMD_GROUP_RET },
+	/* C3 */ { NMD_X86_INSTRUCTION_RET, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_RET },
+	/* C4 */ { NMD_X86_INSTRUCTION_LES, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C5 */ { NMD_X86_INSTRUCTION_LDS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID | _NMD_OPCODE_DECODER_GROUP, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_NONE },
+	/* C8 */ { NMD_X86_INSTRUCTION_ENTER, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_ENTER, 0, NMD_GROUP_NONE },
+	/* C9 */ { NMD_X86_INSTRUCTION_LEAVE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CA */ { NMD_X86_INSTRUCTION_RETF, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IW, 0, NMD_GROUP_RET },
+	/* CB */ { NMD_X86_INSTRUCTION_RETF, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_RET },
+	/* CC */ { NMD_X86_INSTRUCTION_INT3, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_INT },
+	/* CD */ { NMD_X86_INSTRUCTION_INT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_INT },
+	/* CE */ { NMD_X86_INSTRUCTION_INTO, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_INT },
+	/* CF */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_RET | NMD_GROUP_INT },
+	/* D0 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D1 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D2 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D3 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D4 */ { NMD_X86_INSTRUCTION_AAM, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* D5 */ { NMD_X86_INSTRUCTION_AAD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* D6 */ { NMD_X86_INSTRUCTION_SALC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D7 */ { NMD_X86_INSTRUCTION_XLAT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D8 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D9 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DA */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DB */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DC */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DD */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DE */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DF */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E0 */ { NMD_X86_INSTRUCTION_LOOPNE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* E1 */ { NMD_X86_INSTRUCTION_LOOPE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* E2 */ { NMD_X86_INSTRUCTION_LOOP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* E3 */ { NMD_X86_INSTRUCTION_JRCXZ, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* E4 */ { NMD_X86_INSTRUCTION_IN, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* E5 */ { NMD_X86_INSTRUCTION_IN, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* E6 */ { NMD_X86_INSTRUCTION_OUT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* E7 */ { NMD_X86_INSTRUCTION_OUT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* E8 */ { NMD_X86_INSTRUCTION_CALL, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_CALL | NMD_GROUP_UNCONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* E9 */ { NMD_X86_INSTRUCTION_JMP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IZ, 0, NMD_GROUP_JUMP | NMD_GROUP_UNCONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* EA */ { NMD_X86_INSTRUCTION_LJMP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_FAR, 0, NMD_GROUP_JUMP | NMD_GROUP_UNCONDITIONAL_BRANCH },
+	/* EB */ { NMD_X86_INSTRUCTION_JMP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_JUMP | NMD_GROUP_UNCONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* EC */ { NMD_X86_INSTRUCTION_IN, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* ED */ { NMD_X86_INSTRUCTION_IN, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EE */ { NMD_X86_INSTRUCTION_OUT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EF */ { NMD_X86_INSTRUCTION_OUT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F1 */ { NMD_X86_INSTRUCTION_INT1, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_INT },
+	/* F2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F4 */ { NMD_X86_INSTRUCTION_HLT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* F5 */ { NMD_X86_INSTRUCTION_CMC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_GRP3, 0, NMD_GROUP_NONE },
+	/* F7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_GRP3, 0, NMD_GROUP_NONE },
+	/* F8 */ { NMD_X86_INSTRUCTION_CLC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F9 */ { NMD_X86_INSTRUCTION_STC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FA */ { NMD_X86_INSTRUCTION_CLI, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FB */ { NMD_X86_INSTRUCTION_STI, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FC */ { NMD_X86_INSTRUCTION_CLD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FD */ { NMD_X86_INSTRUCTION_STD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FE */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FF */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID | _NMD_OPCODE_DECODER_GROUP, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+};
+
+NMD_ASSEMBLY_API const _nmd_x86_opcode_properties _nmd_x86_opcode_map_0f[256] = {
+	/* 00 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 01 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID | _NMD_OPCODE_DECODER_GROUP, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 02 */ { NMD_X86_INSTRUCTION_LAR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 03 */ { NMD_X86_INSTRUCTION_LSL, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 04 */ { NMD_X86_INSTRUCTION_BLCFILL, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 05 */ { NMD_X86_INSTRUCTION_SYSCALL, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 06 */ { NMD_X86_INSTRUCTION_CLTS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 07 */ { NMD_X86_INSTRUCTION_SYSRET, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 08 */ { NMD_X86_INSTRUCTION_INVD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 09 */ { NMD_X86_INSTRUCTION_WBINVD, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 0A */ { NMD_X86_INSTRUCTION_BLCI, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0B */ { NMD_X86_INSTRUCTION_UD2, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0E */ { NMD_X86_INSTRUCTION_FEMMS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 10 */ { NMD_X86_INSTRUCTION_VMOVUPS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 11 */ { NMD_X86_INSTRUCTION_VMPSADBW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 12 */ { NMD_X86_INSTRUCTION_VMPTRLD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 13 */ { NMD_X86_INSTRUCTION_VMPTRST, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 14 */ { NMD_X86_INSTRUCTION_VMREAD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 15 */ { NMD_X86_INSTRUCTION_VMULPD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 16 */ { NMD_X86_INSTRUCTION_VMULPS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 17 */ { NMD_X86_INSTRUCTION_VMULSD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 18 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 19 */ { NMD_X86_INSTRUCTION_NOP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1A */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1B */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1C */ { NMD_X86_INSTRUCTION_NOP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1D */ { NMD_X86_INSTRUCTION_NOP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1E */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1F */ { NMD_X86_INSTRUCTION_NOP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 20 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 21 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 22 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 23 */ { NMD_X86_INSTRUCTION_MOV, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 24 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 25 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 26 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 27 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 28 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 29 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2A */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2B */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2C */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2E */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2F */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 30 */ { NMD_X86_INSTRUCTION_WRMSR, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 31 */ { NMD_X86_INSTRUCTION_RDTSC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 32 */ { NMD_X86_INSTRUCTION_RDMSR, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 33 */ { NMD_X86_INSTRUCTION_RDPMC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 34 */ { NMD_X86_INSTRUCTION_SYSENTER, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 35 */ { NMD_X86_INSTRUCTION_SYSEXIT, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 36 */ { NMD_X86_INSTRUCTION_BLCIC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 37 */ { NMD_X86_INSTRUCTION_GETSEC, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_PRIVILEGE },
+	/* 38 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 39 */ { NMD_X86_INSTRUCTION_CMOVNO, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3B */ { NMD_X86_INSTRUCTION_CMOVAE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3C */ { NMD_X86_INSTRUCTION_CMOVE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3D */ { NMD_X86_INSTRUCTION_CMOVNE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3E */ { NMD_X86_INSTRUCTION_CMOVBE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3F */ { NMD_X86_INSTRUCTION_CMOVA, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 40 */ { NMD_X86_INSTRUCTION_CMOVO, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 41 */ { NMD_X86_INSTRUCTION_CMOVNO, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 42 */ { NMD_X86_INSTRUCTION_CMOVB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 43 */ { NMD_X86_INSTRUCTION_CMOVAE, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 44 */ { NMD_X86_INSTRUCTION_CMOVE, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 45 */ { NMD_X86_INSTRUCTION_CMOVNE, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 46 */ { NMD_X86_INSTRUCTION_CMOVBE, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 47 */ { NMD_X86_INSTRUCTION_CMOVA, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 48 */ { NMD_X86_INSTRUCTION_CMOVS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 49 */ { NMD_X86_INSTRUCTION_CMOVNS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4A */ { NMD_X86_INSTRUCTION_CMOVP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4B */ { NMD_X86_INSTRUCTION_CMOVNP, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4C */ { NMD_X86_INSTRUCTION_CMOVL, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4D */ { NMD_X86_INSTRUCTION_CMOVGE, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4E */ { NMD_X86_INSTRUCTION_CMOVLE, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4F */ { NMD_X86_INSTRUCTION_CMOVG, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 50 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 51 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 52 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 53 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 54 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 55 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 56 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 57 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 58 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 59 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5A */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5B */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5C */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5E */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5F */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 60 */ { NMD_X86_INSTRUCTION_PUNPCKLBW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 61 */ { NMD_X86_INSTRUCTION_PUNPCKLWD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 62 */ { NMD_X86_INSTRUCTION_PUNPCKLDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 63 */ { NMD_X86_INSTRUCTION_PACKSSWB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 64 */ { NMD_X86_INSTRUCTION_PCMPGTB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 65 */ { NMD_X86_INSTRUCTION_PCMPGTW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 66 */ { NMD_X86_INSTRUCTION_PCMPGTD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 67 */ { NMD_X86_INSTRUCTION_PACKUSWB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 68 */ { NMD_X86_INSTRUCTION_PUNPCKHBW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 69 */ { NMD_X86_INSTRUCTION_PUNPCKHWD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6A */ { NMD_X86_INSTRUCTION_PUNPCKHDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6B */ { NMD_X86_INSTRUCTION_PACKSSDW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6C */ { NMD_X86_INSTRUCTION_PUNPCKLQDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6D */ { NMD_X86_INSTRUCTION_PUNPCKHQDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6E */ { NMD_X86_INSTRUCTION_MOVD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6F */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 70 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 71 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 72 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 73 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 74 */ { NMD_X86_INSTRUCTION_PCMPEQB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 75 */ { NMD_X86_INSTRUCTION_PCMPEQW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 76 */ { NMD_X86_INSTRUCTION_PCMPEQD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 77 */ { NMD_X86_INSTRUCTION_EMMS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 78 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_EXTRQ, 0, NMD_GROUP_NONE },
+	/* 79 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7A */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7B */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7C */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7E */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7F */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 80 */ { NMD_X86_INSTRUCTION_JO, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 81 */ { NMD_X86_INSTRUCTION_JNO, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 82 */ { NMD_X86_INSTRUCTION_JB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 83 */ { NMD_X86_INSTRUCTION_JNB, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 84 */ { NMD_X86_INSTRUCTION_JZ, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 85 */ { NMD_X86_INSTRUCTION_JNZ, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 86 */ { NMD_X86_INSTRUCTION_JBE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 87 */ { NMD_X86_INSTRUCTION_JA, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 88 */ { NMD_X86_INSTRUCTION_JS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 89 */ { NMD_X86_INSTRUCTION_JNS, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 8A */ { NMD_X86_INSTRUCTION_JP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 8B */ { NMD_X86_INSTRUCTION_JNP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 8C */ { NMD_X86_INSTRUCTION_JL, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 8D */ { NMD_X86_INSTRUCTION_JGE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 8E */ { NMD_X86_INSTRUCTION_JLE, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 8F */ { NMD_X86_INSTRUCTION_JG, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_JZ, 0, NMD_GROUP_JUMP | NMD_GROUP_CONDITIONAL_BRANCH | NMD_GROUP_RELATIVE_ADDRESSING },
+	/* 90 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 91 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 92 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 93 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 94 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 95 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 96 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 97 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 98 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 99 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9A */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9B */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9C */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9D */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9E */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9F */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A0 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A1 */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A2 */ { NMD_X86_INSTRUCTION_CPUID, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A3 */ { NMD_X86_INSTRUCTION_BLCMSK, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A4 */ { NMD_X86_INSTRUCTION_PMULDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* A5 */ { NMD_X86_INSTRUCTION_PCMPEQQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A8 */ { NMD_X86_INSTRUCTION_PUSH, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A9 */ { NMD_X86_INSTRUCTION_POP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AA */ { NMD_X86_INSTRUCTION_RSM, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AB */ { NMD_X86_INSTRUCTION_BTS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AC */ { NMD_X86_INSTRUCTION_SHRD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* AD */ { NMD_X86_INSTRUCTION_SHRD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AE */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AF */ { NMD_X86_INSTRUCTION_IMUL, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B0 */ { NMD_X86_INSTRUCTION_CMPXCHG, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B1 */ { NMD_X86_INSTRUCTION_CMPXCHG, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B2 */ { NMD_X86_INSTRUCTION_LSS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B3 */ { NMD_X86_INSTRUCTION_BTR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B4 */ { NMD_X86_INSTRUCTION_LFS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B5 */ { NMD_X86_INSTRUCTION_LGS, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B6 */ { NMD_X86_INSTRUCTION_MOVZX, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B7 */ { NMD_X86_INSTRUCTION_MOVZX, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B8 */ { NMD_X86_INSTRUCTION_POPCNT, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B9 */ { NMD_X86_INSTRUCTION_UD1, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BA */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* BB */ { NMD_X86_INSTRUCTION_BTC, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BC */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BD */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BE */ { NMD_X86_INSTRUCTION_MOVSX, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BF */ { NMD_X86_INSTRUCTION_MOVSX, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C0 */ { NMD_X86_INSTRUCTION_XADD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C1 */ { NMD_X86_INSTRUCTION_XADD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C2 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C3 */ { NMD_X86_INSTRUCTION_MOVNTI, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C4 */ { NMD_X86_INSTRUCTION_PINSRW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C5 */ { NMD_X86_INSTRUCTION_PEXTRW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* C7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C8 */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C9 */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CA */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CB */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CC */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CD */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CE */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CF */ { NMD_X86_INSTRUCTION_BSWAP, _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D0 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D1 */ { NMD_X86_INSTRUCTION_PSRLW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D2 */ { NMD_X86_INSTRUCTION_PSRLD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D3 */ { NMD_X86_INSTRUCTION_PSRLQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D4 */ { NMD_X86_INSTRUCTION_PADDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D5 */ { NMD_X86_INSTRUCTION_PMULLW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D7 */ { NMD_X86_INSTRUCTION_PMOVMSKB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D8 */ { NMD_X86_INSTRUCTION_PSUBUSB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D9 */ { NMD_X86_INSTRUCTION_PSUBUSW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DA */ { NMD_X86_INSTRUCTION_PMINUB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DB */ { NMD_X86_INSTRUCTION_PAND, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DC */ { NMD_X86_INSTRUCTION_PADDUSB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DD */ { NMD_X86_INSTRUCTION_PADDUSW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DE */ { NMD_X86_INSTRUCTION_PMAXUB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DF */ { NMD_X86_INSTRUCTION_PANDN, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E0 */ { NMD_X86_INSTRUCTION_PAVGB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E1 */ { NMD_X86_INSTRUCTION_PSRAW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E2 */ { NMD_X86_INSTRUCTION_PSRAD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E3 */ { NMD_X86_INSTRUCTION_PAVGW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E4 */ { NMD_X86_INSTRUCTION_PMULHUW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E5 */ { NMD_X86_INSTRUCTION_PMULHW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E8 */ { NMD_X86_INSTRUCTION_PSUBSB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E9 */ { NMD_X86_INSTRUCTION_PSUBSW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EA */ { NMD_X86_INSTRUCTION_PMINSW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EB */ { NMD_X86_INSTRUCTION_POR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EC */ { NMD_X86_INSTRUCTION_PADDSB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* ED */ { NMD_X86_INSTRUCTION_PADDSW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EE */ { NMD_X86_INSTRUCTION_PMAXSW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EF */ { NMD_X86_INSTRUCTION_PXOR, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F0 */ { NMD_X86_INSTRUCTION_LDDQU, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F1 */ { NMD_X86_INSTRUCTION_PSLLW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F2 */ { NMD_X86_INSTRUCTION_PSLLD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F3 */ { NMD_X86_INSTRUCTION_PSLLQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F4 */ { NMD_X86_INSTRUCTION_PMULUDQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F5 */ { NMD_X86_INSTRUCTION_PMADDWD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F6 */ { NMD_X86_INSTRUCTION_PSADBW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F7 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F8 */ { NMD_X86_INSTRUCTION_PSUBB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F9 */ { NMD_X86_INSTRUCTION_PSUBW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FA */ { NMD_X86_INSTRUCTION_PSUBD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FB */ { NMD_X86_INSTRUCTION_PSUBQ, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FC */ { NMD_X86_INSTRUCTION_PADDB, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FD */ { NMD_X86_INSTRUCTION_PADDW, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FE */ { NMD_X86_INSTRUCTION_PADDD, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FF */ { NMD_X86_INSTRUCTION_UD0, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+};
+
+NMD_ASSEMBLY_API const _nmd_x86_opcode_properties _nmd_x86_opcode_map_0f38[256] = {
+	/* 00 */ { NMD_X86_INSTRUCTION_PSHUFB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 01 */ { NMD_X86_INSTRUCTION_PHADDW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 02 */ { NMD_X86_INSTRUCTION_PHADDD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 03 */ { NMD_X86_INSTRUCTION_PHADDSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 04 */ { NMD_X86_INSTRUCTION_PMADDUBSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 05 */ { NMD_X86_INSTRUCTION_PHSUBW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 06 */ { NMD_X86_INSTRUCTION_PHSUBD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 07 */ { NMD_X86_INSTRUCTION_PHSUBSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 08 */ { NMD_X86_INSTRUCTION_PSIGNB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 09 */ { NMD_X86_INSTRUCTION_PSIGNW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0A */ { NMD_X86_INSTRUCTION_PSIGND, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0B */ { NMD_X86_INSTRUCTION_PMULHRSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0C */ { NMD_X86_INSTRUCTION_PABSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0D */ { NMD_X86_INSTRUCTION_PABSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0E */ { NMD_X86_INSTRUCTION_PABSD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 0F */ { NMD_X86_INSTRUCTION_PMOVSXBW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 10 */ { NMD_X86_INSTRUCTION_PBLENDVB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 11 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 12 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 13 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 14 */ { NMD_X86_INSTRUCTION_BLENDVPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 15 */ { NMD_X86_INSTRUCTION_BLENDVPD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 16 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 17 */ { NMD_X86_INSTRUCTION_PTEST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 18 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 19 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1C */ { NMD_X86_INSTRUCTION_PABSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 1D */ { NMD_X86_INSTRUCTION_PABSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 1E */ { NMD_X86_INSTRUCTION_PABSD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP | _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 1F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 20 */ { NMD_X86_INSTRUCTION_PMOVSXBW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 21 */ { NMD_X86_INSTRUCTION_PMOVSXBD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 22 */ { NMD_X86_INSTRUCTION_PMOVSXBQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 23 */ { NMD_X86_INSTRUCTION_PMOVSXWD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 24 */ { NMD_X86_INSTRUCTION_PMOVSXWQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 25 */ { NMD_X86_INSTRUCTION_PMOVZXDQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 26 */ { NMD_X86_INSTRUCTION_CPUID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 27 */ { NMD_X86_INSTRUCTION_BLCMSK, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 28 */ { NMD_X86_INSTRUCTION_PMULDQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 29 */ { NMD_X86_INSTRUCTION_PCMPEQQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 2A */ { NMD_X86_INSTRUCTION_MOVNTDQA, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 2B */ { NMD_X86_INSTRUCTION_PACKUSDW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 2C */ { NMD_X86_INSTRUCTION_PMOVZXBW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2D */ { NMD_X86_INSTRUCTION_PMOVZXBD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2E */ { NMD_X86_INSTRUCTION_PMOVZXBQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2F */ { NMD_X86_INSTRUCTION_PMOVZXWD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 30 */ { NMD_X86_INSTRUCTION_PMOVZXBW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 31 */ { NMD_X86_INSTRUCTION_PMOVZXBD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 32 */ { NMD_X86_INSTRUCTION_PMOVZXBQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 33 */ { NMD_X86_INSTRUCTION_PMOVZXWD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 34 */ { NMD_X86_INSTRUCTION_PMOVZXWQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 35 */ { NMD_X86_INSTRUCTION_PMOVSXDQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 36 */ { NMD_X86_INSTRUCTION_BLCS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 37 */ { NMD_X86_INSTRUCTION_PCMPGTQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 38 */ { NMD_X86_INSTRUCTION_PMINSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 39 */ { NMD_X86_INSTRUCTION_PMINSD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 3A */ { NMD_X86_INSTRUCTION_PMINUW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 3B */ { NMD_X86_INSTRUCTION_PMINUD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 3C */ { NMD_X86_INSTRUCTION_PMAXSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 3D */ { NMD_X86_INSTRUCTION_PMAXSD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 3E */ { NMD_X86_INSTRUCTION_PMAXUW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 3F */ { NMD_X86_INSTRUCTION_PMAXUD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 40 */ { NMD_X86_INSTRUCTION_PMULLD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 41 */ { NMD_X86_INSTRUCTION_PHMINPOSUW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 42 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 43 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 44 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 45 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 46 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 47 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 48 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 49 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 4F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 50 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 51 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 52 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 53 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 54 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 55 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 56 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 57 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 58 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 59 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 60 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 61 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 62 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 63 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 64 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 65 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 66 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 67 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 68 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 69 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 6F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 70 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 71 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 72 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 73 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 74 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 75 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 76 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 77 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 78 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 79 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 80 */ { NMD_X86_INSTRUCTION_INVEPT, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 81 */ { NMD_X86_INSTRUCTION_INVVPID, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 82 */ { NMD_X86_INSTRUCTION_INVPCID, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 83 */ { NMD_X86_INSTRUCTION_SHA1NEXTE, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 84 */ { NMD_X86_INSTRUCTION_SHA1MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 85 */ { NMD_X86_INSTRUCTION_SHA1MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 86 */ { NMD_X86_INSTRUCTION_SHA256RNDS2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 87 */ { NMD_X86_INSTRUCTION_SHA256MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 88 */ { NMD_X86_INSTRUCTION_SHA256MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 89 */ { NMD_X86_INSTRUCTION_AESIMC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8A */ { NMD_X86_INSTRUCTION_AESENC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8B */ { NMD_X86_INSTRUCTION_AESENCLAST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8C */ { NMD_X86_INSTRUCTION_AESDEC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8D */ { NMD_X86_INSTRUCTION_AESDECLAST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8E */ { NMD_X86_INSTRUCTION_ROUNDPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8F */ { NMD_X86_INSTRUCTION_ROUNDPD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 90 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 91 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 92 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 93 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 94 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 95 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 96 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 97 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 98 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 99 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C0 */ { NMD_X86_INSTRUCTION_PMINUD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C1 */ { NMD_X86_INSTRUCTION_PMAXSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C2 */ { NMD_X86_INSTRUCTION_PMAXSD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C3 */ { NMD_X86_INSTRUCTION_PMAXUW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C4 */ { NMD_X86_INSTRUCTION_PMAXUD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C5 */ { NMD_X86_INSTRUCTION_INVEPT, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C6 */ { NMD_X86_INSTRUCTION_INVVPID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C7 */ { NMD_X86_INSTRUCTION_INVPCID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C8 */ { NMD_X86_INSTRUCTION_SHA1NEXTE, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* C9 */ { NMD_X86_INSTRUCTION_SHA1MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* CA */ { NMD_X86_INSTRUCTION_SHA1MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* CB */ { NMD_X86_INSTRUCTION_SHA256RNDS2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* CC */ { NMD_X86_INSTRUCTION_SHA256MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* CD */ { NMD_X86_INSTRUCTION_SHA256MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* CE */ { NMD_X86_INSTRUCTION_AESIMC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CF */ { NMD_X86_INSTRUCTION_AESENC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* D0 */ { NMD_X86_INSTRUCTION_PMAXUW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D1 */ { NMD_X86_INSTRUCTION_PMAXUD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D2 */ { NMD_X86_INSTRUCTION_INVEPT, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D3 */ { NMD_X86_INSTRUCTION_INVVPID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D4 */ { NMD_X86_INSTRUCTION_INVPCID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D5 */ { NMD_X86_INSTRUCTION_SHA1NEXTE, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D6 */ { NMD_X86_INSTRUCTION_SHA1MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D7 */ { NMD_X86_INSTRUCTION_SHA1MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D8 */ { NMD_X86_INSTRUCTION_SHA256RNDS2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D9 */ { NMD_X86_INSTRUCTION_SHA256MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DA */ { NMD_X86_INSTRUCTION_SHA256MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DB */ { NMD_X86_INSTRUCTION_AESIMC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* DC */ { NMD_X86_INSTRUCTION_AESENC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* DD */ { NMD_X86_INSTRUCTION_AESENCLAST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* DE */ { NMD_X86_INSTRUCTION_AESDEC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* DF */ { NMD_X86_INSTRUCTION_AESDECLAST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* E0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* ED */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F0 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F1 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F5 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* F6 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_VALIDITY | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F8 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* F9 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_MEMORY_ONLY, _NMD_OPCODE_IMM_NONE, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* FA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+};
+
+NMD_ASSEMBLY_API const _nmd_x86_opcode_properties _nmd_x86_opcode_map_0f3a[256] = {
+	/* 00 */ { NMD_X86_INSTRUCTION_SHA256RNDS2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 01 */ { NMD_X86_INSTRUCTION_SHA256MSG1, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 02 */ { NMD_X86_INSTRUCTION_SHA256MSG2, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 03 */ { NMD_X86_INSTRUCTION_AESIMC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 04 */ { NMD_X86_INSTRUCTION_AESENC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 05 */ { NMD_X86_INSTRUCTION_AESENCLAST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 06 */ { NMD_X86_INSTRUCTION_AESDEC, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 07 */ { NMD_X86_INSTRUCTION_AESDECLAST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 08 */ { NMD_X86_INSTRUCTION_ROUNDPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 09 */ { NMD_X86_INSTRUCTION_ROUNDPD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0A */ { NMD_X86_INSTRUCTION_ROUNDSS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0B */ { NMD_X86_INSTRUCTION_ROUNDSD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0C */ { NMD_X86_INSTRUCTION_BLENDPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0D */ { NMD_X86_INSTRUCTION_BLENDPD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0E */ { NMD_X86_INSTRUCTION_PBLENDW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 0F */ { NMD_X86_INSTRUCTION_PALIGNR, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* 10 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 11 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 12 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 13 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 14 */ { NMD_X86_INSTRUCTION_PEXTRB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 15 */ { NMD_X86_INSTRUCTION_PEXTRW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 16 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 17 */ { NMD_X86_INSTRUCTION_EXTRACTPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 18 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 19 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 1F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 20 */ { NMD_X86_INSTRUCTION_PINSRB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 21 */ { NMD_X86_INSTRUCTION_INSERTPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 22 */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM | _NMD_OPCODE_DECODER_ID, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 23 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 24 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 25 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 26 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 27 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 28 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 29 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 2F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 30 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 31 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 32 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 33 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 34 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 35 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 36 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 37 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 38 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 39 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 3F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 40 */ { NMD_X86_INSTRUCTION_DPPS, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 41 */ { NMD_X86_INSTRUCTION_DPPD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 42 */ { NMD_X86_INSTRUCTION_MPSADBW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 43 */ { NMD_X86_INSTRUCTION_VPCMPGTQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 44 */ { NMD_X86_INSTRUCTION_PCLMULQDQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 45 */ { NMD_X86_INSTRUCTION_PCMPESTRM, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 46 */ { NMD_X86_INSTRUCTION_PCMPESTRI, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 47 */ { NMD_X86_INSTRUCTION_PCMPISTRM, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 48 */ { NMD_X86_INSTRUCTION_PCMPISTRI, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 49 */ { NMD_X86_INSTRUCTION_PSRLW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 4A */ { NMD_X86_INSTRUCTION_PSRLD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 4B */ { NMD_X86_INSTRUCTION_PSRLQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 4C */ { NMD_X86_INSTRUCTION_PADDQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 4D */ { NMD_X86_INSTRUCTION_PMULLW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 4E */ { NMD_X86_INSTRUCTION_BOUND, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 4F */ { NMD_X86_INSTRUCTION_PMOVMSKB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 50 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 51 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 52 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 53 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 54 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 55 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 56 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 57 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 58 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 59 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 5F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 60 */ { NMD_X86_INSTRUCTION_PCMPESTRM, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 61 */ { NMD_X86_INSTRUCTION_PCMPESTRI, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 62 */ { NMD_X86_INSTRUCTION_PCMPISTRM, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 63 */ { NMD_X86_INSTRUCTION_PCMPISTRI, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* 64 */ { NMD_X86_INSTRUCTION_PSRLW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 65 */ { NMD_X86_INSTRUCTION_PSRLD, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 66 */ { NMD_X86_INSTRUCTION_PSRLQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 67 */ { NMD_X86_INSTRUCTION_PADDQ, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 68 */ { NMD_X86_INSTRUCTION_PMULLW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 69 */ { NMD_X86_INSTRUCTION_BOUND, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6A */ { NMD_X86_INSTRUCTION_PMOVMSKB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6B */ { NMD_X86_INSTRUCTION_PSUBUSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6C */ { NMD_X86_INSTRUCTION_PSUBUSW, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6D */ { NMD_X86_INSTRUCTION_PMINUB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6E */ { NMD_X86_INSTRUCTION_PAND, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 6F */ { NMD_X86_INSTRUCTION_PADDUSB, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, 0, NMD_GROUP_NONE },
+	/* 70 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 71 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 72 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 73 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 74 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 75 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 76 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 77 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 78 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 79 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 7F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 80 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 81 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 82 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 83 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 84 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 85 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 86 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 87 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 88 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 89 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 8F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 90 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 91 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 92 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 93 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 94 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 95 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 96 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 97 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 98 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 99 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9A */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9B */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9C */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9D */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9E */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* 9F */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* A9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* AF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* B9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* BF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* C9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CC */ { NMD_X86_INSTRUCTION_SHA1RNDS4, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_NP, NMD_GROUP_NONE },
+	/* CD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* CE */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* CF */ { NMD_X86_INSTRUCTION_INVALID, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* D0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* D9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* DF */ { NMD_X86_INSTRUCTION_AESKEYGENASSIST, _NMD_OPCODE_MODRM, _NMD_OPCODE_IMM_IB, _NMD_SIMD_66, NMD_GROUP_NONE },
+	/* E0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* E9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* ED */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* EF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F0 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F1 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F2 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F3 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F4 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F5 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F6 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F7 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F8 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* F9 */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FA */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FB */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FC */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FD */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FE */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+	/* FF */ { NMD_X86_INSTRUCTION_INVALID, 0, _NMD_OPCODE_IMM_NONE, 0, NMD_GROUP_NONE },
+};
+
+/* The names of the members of 'NMD_X86_INSTRUCTION' in lowercase, in the order of the enumeration and separated by null characters. */
+NMD_ASSEMBLY_API const char _nmd_x86_instruction_names[] =
+	"invalid\0add\0or\0adc\0sbb\0and\0sub\0xor\0cmp\0rol\0ror\0rcl\0rcr\0shl\0shr\0aaa\0sar\0test\0blsfill\0not\0neg\0mul\0"
+	"imul\0div\0idiv\0inc\0dec\0call\0lcall\0jmp\0ljmp\0push\0jo\0jno\0jb\0jnb\0jz\0jnz\0jbe\0ja\0js\0jns\0jp\0jnp\0jl\0jge\0"
+	"jle\0jg\0fadd\0fmul\0fcom\0fcomp\0fsub\0fsubr\0fdiv\0fdivr\0fld\0adox\0fst\0fstp\0fldenv\0fldcw\0fnstenv\0fnstcw\0fchs\0"
+	"fabs\0aas\0adcx\0ftst\0fxam\0ret\0enter\0fld1\0fldl2t\0fldl2e\0fldpi\0fldlg2\0fldln2\0fldz\0fnop\0f2xm1\0fyl2x\0fptan\0"
+	"fpatan\0fxtract\0fprem1\0fdecstp\0fincstp\0fprem\0fyl2xp1\0fsqrt\0fsincos\0frndint\0fscale\0fsin\0fcos\0fiadd\0fimul\0"
+	"ficom\0ficomp\0fisub\0fisubr\0fidiv\0fidivr\0fcmovb\0fcmove\0fcmovbe\0fcmovu\0fild\0fisttp\0fist\0fistp\0fbld\0"
+	"aeskeygenassist\0fbstp\0andn\0fcmovnb\0fcmovne\0fcmovnbe\0fcmovnu\0fnclex\0fucomi\0fcomi\0faddp\0fmulp\0movapd\0bndcn\0"
+	"fsubrp\0fsubp\0fdivrp\0fdivp\0int1\0bsr\0addsubpd\0hlt\0cmc\0addsubps\0blendvpd\0clc\0stc\0cli\0sti\0cld\0std\0aam\0aad\0"
+	"salc\0xlat\0loopne\0loope\0loop\0jrcxz\0sldt\0str\0lldt\0ltr\0verr\0verw\0sgdt\0sidt\0lgdt\0lidt\0smsw\0clwb\0lmsw\0"
+	"invlpg\0vmcall\0vmlaunch\0vmresume\0vmxoff\0monitor\0mwait\0clac\0stac\0cbw\0cmpsb\0cmpsq\0encls\0xgetbv\0xsetbv\0arpl\0"
+	"bextr\0vmfunc\0xend\0xtest\0enclu\0vmrun\0vmmcall\0vmload\0vmsave\0stgi\0clgi\0skinit\0invlpga\0lar\0lsl\0blcfill\0"
+	"syscall\0clts\0sysret\0invd\0wbinvd\0blci\0ud2\0prefetchw\0femms\0wrmsr\0rdtsc\0rdmsr\0rdpmc\0sysenter\0sysexit\0blcic\0"
+	"getsec\0cmovo\0cmovno\0cmovb\0cmovae\0cmove\0cmovne\0cmovbe\0cmova\0cmovs\0cmovns\0cmovp\0cmovnp\0cmovl\0cmovge\0cmovle\0"
+	"cmovg\0seto\0setno\0setb\0setae\0sete\0setne\0setbe\0seta\0sets\0setns\0setp\0setnp\0setl\0setge\0setle\0setg\0lss\0btr\0"
+	"lfs\0lgs\0bt\0btc\0bts\0pshufb\0phaddw\0phaddd\0phaddsw\0pmaddubsw\0phsubw\0phsubd\0phsubsw\0psignb\0psignw\0psignd\0"
+	"pmulhrsw\0pabsb\0pabsw\0pabsd\0pmovsxbw\0pmovsxbd\0pmovsxbq\0pmovsxwd\0pmovsxwq\0pmovzxdq\0cpuid\0blcmsk\0pmuldq\0"
+	"pcmpeqq\0movntdqa\0packusdw\0pmovzxbw\0pmovzxbd\0pmovzxbq\0pmovzxwd\0pmovzxwq\0pmovsxdq\0blcs\0pcmpgtq\0pminsb\0pminsd\0"
+	"pminuw\0pminud\0pmaxsb\0pmaxsd\0pmaxuw\0pmaxud\0invept\0invvpid\0invpcid\0sha1nexte\0sha1msg1\0sha1msg2\0sha256rnds2\0"
+	"sha256msg1\0sha256msg2\0aesimc\0aesenc\0aesenclast\0aesdec\0aesdeclast\0roundps\0roundpd\0roundss\0roundsd\0blendps\0"
+	"blendpd\0pblendw\0palignr\0dpps\0dppd\0mpsadbw\0vpcmpgtq\0pclmulqdq\0pcmpestrm\0pcmpestri\0pcmpistrm\0pcmpistri\0psrlw\0"
+	"psrld\0psrlq\0paddq\0pmullw\0bound\0pmovmskb\0psubusb\0psubusw\0pminub\0pand\0paddusb\0paddusw\0pmaxub\0pandn\0pavgb\0"
+	"psraw\0psrad\0pavgw\0pmulhuw\0pmulhw\0cqo\0crc32\0psubsb\0psubsw\0pminsw\0por\0paddsb\0paddsw\0pmaxsw\0pxor\0lddqu\0"
+	"psllw\0pslld\0psllq\0pmuludq\0pmaddwd\0psadbw\0bswap\0psubb\0psubw\0psubd\0psubq\0paddb\0paddw\0paddd\0movnti\0pinsrw\0"
+	"pextrw\0fxsave\0fxrstor\0ldmxcsr\0stmxcsr\0xsave\0xrstor\0xsaveopt\0clflush\0rdfsbase\0rdgsbase\0wrfsbase\0wrgsbase\0"
+	"cmpxchg\0lfence\0mfence\0sfence\0pcmpeqb\0pcmpeqw\0pcmpeqd\0movmskps\0sqrtps\0rsqrtps\0rcpps\0andps\0andnps\0orps\0xorps\0"
+	"addps\0mulps\0cvtps2pd\0cvtdq2ps\0subps\0minps\0divps\0maxps\0movmskpd\0sqrtpd\0bndldx\0bndstx\0andpd\0andnpd\0orpd\0"
+	"xorpd\0addpd\0mulpd\0cvtpd2ps\0cvtps2dq\0subpd\0minpd\0divpd\0maxpd\0bndmov\0sqrtss\0rsqrtss\0rcpss\0cmpxchg16b\0daa\0"
+	"cwd\0insd\0addss\0mulss\0cvtss2sd\0cvttps2dq\0subss\0minss\0divss\0maxss\0bndcl\0sqrtsd\0bndcu\0bndmk\0cmpxchg8b\0das\0"
+	"cwde\0insw\0addsd\0mulsd\0cvtsd2ss\0fcomip\0subsd\0minsd\0divsd\0maxsd\0punpcklbw\0punpcklwd\0punpckldq\0packsswb\0"
+	"pcmpgtb\0pcmpgtw\0pcmpgtd\0packuswb\0punpckhbw\0punpckhwd\0punpckhdq\0packssdw\0punpcklqdq\0punpckhqdq\0vpshufb\0vphaddw\0"
+	"vphaddd\0vphaddsw\0vpmaddubsw\0vphsubw\0vphsubd\0vphsubsw\0vpsignb\0vpsignw\0vpsignd\0vpmulhrsw\0vphaddwq\0vphadddq\0"
+	"blsi\0blsic\0blsmsk\0blsr\0bsf\0bzhi\0cdq\0cdqe\0clflushopt\0cmpsw\0comisd\0comiss\0cvtdq2pd\0cvtpd2dq\0cvtsd2si\0"
+	"cvtsi2sd\0cvtsi2ss\0cvtss2si\0cvttpd2dq\0cvttsd2si\0cvttss2si\0data16\0extractps\0extrq\0fcompp\0ffree\0fninit\0fnstsw\0"
+	"ffreep\0frstor\0fnsave\0fsetpm\0fxrstor64\0fxsave64\0movaps\0vmovapd\0vmovaps\0haddpd\0haddps\0hsubpd\0hsubps\0in\0insb\0"
+	"insertps\0insertq\0int\0int3\0into\0iret\0iretd\0iretq\0ucomisd\0ucomiss\0vcomisd\0vcomiss\0vcvtsd2ss\0vcvtsi2sd\0"
+	"vcvtsi2ss\0vcvtss2sd\0vcvttsd2si\0vcvttsd2usi\0vcvttss2si\0vcvttss2usi\0vcvtusi2sd\0vcvtusi2ss\0vucomisd\0vucomiss\0jcxz\0"
+	"jecxz\0kandb\0kandd\0kandnb\0kandnd\0kandnq\0kandnw\0kandq\0kandw\0kmovb\0kmovd\0kmovq\0kmovw\0knotb\0knotd\0knotq\0"
+	"knotw\0korb\0kord\0korq\0kortestb\0kortestd\0kortestq\0kortestw\0korw\0kshiftlb\0kshiftld\0kshiftlq\0kshiftlw\0kshiftrb\0"
+	"kshiftrd\0kshiftrq\0kshiftrw\0kunpckbw\0kxnorb\0kxnord\0kxnorq\0kxnorw\0kxorb\0kxord\0kxorq\0kxorw\0lahf\0lds\0lea\0"
+	"leave\0les\0lodsb\0lodsd\0lodsq\0lodsw\0retf\0xadd\0lzcnt\0maskmovdqu\0cvtpd2pi\0cvtpi2pd\0cvtpi2ps\0cvtps2pi\0cvttpd2pi\0"
+	"cvttps2pi\0emms\0maskmovq\0movd\0movdq2q\0movntq\0movq2dq\0movq\0pshufw\0montmul\0mov\0movabs\0movbe\0movddup\0movdqa\0"
+	"movdqu\0movhlps\0movhpd\0movhps\0movlhps\0movlpd\0movlps\0movntdq\0movntpd\0movntps\0movntsd\0movntss\0movsb\0movsd\0"
+	"movshdup\0movsldup\0movsq\0movss\0movsw\0movsx\0movsxd\0movupd\0movups\0movzx\0mulx\0nop\0out\0outsb\0outsd\0outsw\0"
+	"pause\0pavgusb\0pblendvb\0pcommit\0pdep\0pext\0pextrb\0pextrd\0pextrq\0pf2id\0pf2iw\0pfacc\0pfadd\0blendvps\0pfcmpeq\0"
+	"pfcmpge\0pfcmpgt\0pfmax\0pfmin\0pfmul\0pfnacc\0pfpnacc\0pfrcpit1\0pfrcpit2\0pfrcp\0pfrsqit1\0pfrsqrt\0pfsubr\0pfsub\0"
+	"phminposuw\0pi2fd\0pi2fw\0pinsrb\0pinsrd\0pinsrq\0pmulhrw\0pmulld\0pop\0popa\0popad\0popcnt\0popf\0popfd\0popfq\0"
+	"prefetch\0prefetchnta\0prefetcht0\0prefetcht1\0prefetcht2\0pshufd\0pshufhw\0pshuflw\0pslldq\0psrldq\0pswapd\0ptest\0"
+	"pusha\0pushad\0pushf\0pushfd\0pushfq\0rdrand\0rdpid\0rdseed\0rdtscp\0rorx\0rsm\0sahf\0sal\0sarx\0scasb\0scasd\0scasq\0"
+	"scasw\0sha1rnds4\0shld\0shlx\0shrd\0shrx\0shufpd\0shufps\0stosb\0stosd\0stosq\0stosw\0fstpnce\0fxch\0swapgs\0t1mskc\0"
+	"tzcnt\0tzmsk\0fucomip\0fucompp\0fucomp\0fucom\0ud1\0unpckhpd\0unpckhps\0unpcklpd\0unpcklps\0vaddpd\0vaddps\0vaddsd\0"
+	"vaddss\0vaddsubpd\0vaddsubps\0vaesdeclast\0vaesdec\0vaesenclast\0vaesenc\0vaesimc\0vaeskeygenassist\0valignd\0valignq\0"
+	"vandnpd\0vandnps\0vandpd\0vandps\0vblendmpd\0vblendmps\0vblendpd\0vblendps\0vblendvpd\0vblendvps\0vbroadcastf128\0"
+	"vbroadcasti32x4\0vbroadcasti64x4\0vbroadcastsd\0vbroadcastss\0vcompresspd\0vcompressps\0vcvtdq2pd\0vcvtdq2ps\0vcvtpd2dqx\0"
+	"vcvtpd2dq\0vcvtpd2psx\0vcvtpd2ps\0vcvtpd2udq\0vcvtph2ps\0vcvtps2dq\0vcvtps2pd\0vcvtps2ph\0vcvtps2udq\0vcvtsd2si\0"
+	"vcvtsd2usi\0vcvtss2si\0vcvtss2usi\0vcvttpd2dqx\0vcvttpd2dq\0vcvttpd2udq\0vcvttps2dq\0vcvttps2udq\0vcvtudq2pd\0vcvtudq2ps\0"
+	"vdivpd\0vdivps\0vdivsd\0vdivss\0vdppd\0vdpps\0vexp2pd\0vexp2ps\0vexpandpd\0vexpandps\0vextractf128\0vextractf32x4\0"
+	"vextractf64x4\0vextracti128\0vextracti32x4\0vextracti64x4\0vextractps\0vfmadd132pd\0vfmadd132ps\0vfmaddpd\0vfmadd213pd\0"
+	"vfmadd231pd\0vfmaddps\0vfmadd213ps\0vfmadd231ps\0vfmaddsd\0vfmadd213sd\0vfmadd132sd\0vfmadd231sd\0vfmaddss\0vfmadd213ss\0"
+	"vfmadd132ss\0vfmadd231ss\0vfmaddsub132pd\0vfmaddsub132ps\0vfmaddsubpd\0vfmaddsub213pd\0vfmaddsub231pd\0vfmaddsubps\0"
+	"vfmaddsub213ps\0vfmaddsub231ps\0vfmsub132pd\0vfmsub132ps\0vfmsubadd132pd\0vfmsubadd132ps\0vfmsubaddpd\0vfmsubadd213pd\0"
+	"vfmsubadd231pd\0vfmsubaddps\0vfmsubadd213ps\0vfmsubadd231ps\0vfmsubpd\0vfmsub213pd\0vfmsub231pd\0vfmsubps\0vfmsub213ps\0"
+	"vfmsub231ps\0vfmsubsd\0vfmsub213sd\0vfmsub132sd\0vfmsub231sd\0vfmsubss\0vfmsub213ss\0vfmsub132ss\0vfmsub231ss\0"
+	"vfnmadd132pd\0vfnmadd132ps\0vfnmaddpd\0vfnmadd213pd\0vfnmadd231pd\0vfnmaddps\0vfnmadd213ps\0vfnmadd231ps\0vfnmaddsd\0"
+	"vfnmadd213sd\0vfnmadd132sd\0vfnmadd231sd\0vfnmaddss\0vfnmadd213ss\0vfnmadd132ss\0vfnmadd231ss\0vfnmsub132pd\0"
+	"vfnmsub132ps\0vfnmsubpd\0vfnmsub213pd\0vfnmsub231pd\0vfnmsubps\0vfnmsub213ps\0vfnmsub231ps\0vfnmsubsd\0vfnmsub213sd\0"
+	"vfnmsub132sd\0vfnmsub231sd\0vfnmsubss\0vfnmsub213ss\0vfnmsub132ss\0vfnmsub231ss\0vfrczpd\0vfrczps\0vfrczsd\0vfrczss\0"
+	"vorpd\0vorps\0vxorpd\0vxorps\0vgatherdpd\0vgatherdps\0vgatherpf0dpd\0vgatherpf0dps\0vgatherpf0qpd\0vgatherpf0qps\0"
+	"vgatherpf1dpd\0vgatherpf1dps\0vgatherpf1qpd\0vgatherpf1qps\0vgatherqpd\0vgatherqps\0vhaddpd\0vhaddps\0vhsubpd\0vhsubps\0"
+	"vinsertf128\0vinsertf32x4\0vinsertf32x8\0vinsertf64x2\0vinsertf64x4\0vinserti128\0vinserti32x4\0vinserti32x8\0"
+	"vinserti64x2\0vinserti64x4\0vinsertps\0vlddqu\0vldmxcsr\0vmaskmovdqu\0vmaskmovpd\0vmaskmovps\0vmaxpd\0vmaxps\0vmaxsd\0"
+	"vmaxss\0vmclear\0vminpd\0vminps\0vminsd\0vminss\0vmovq\0vmovddup\0vmovd\0vmovdqa32\0vmovdqa64\0vmovdqa\0vmovdqu16\0"
+	"vmovdqu32\0vmovdqu64\0vmovdqu8\0vmovdqu\0vmovhlps\0vmovhpd\0vmovhps\0vmovlhps\0vmovlpd\0vmovlps\0vmovmskpd\0vmovmskps\0"
+	"vmovntdqa\0vmovntdq\0vmovntpd\0vmovntps\0vmovsd\0vmovshdup\0vmovsldup\0vmovss\0vmovupd\0vmovups\0vmpsadbw\0vmptrld\0"
+	"vmptrst\0vmread\0vmulpd\0vmulps\0vmulsd\0vmulss\0vmwrite\0vmxon\0vpabsb\0vpabsd\0vpabsq\0vpabsw\0vpackssdw\0vpacksswb\0"
+	"vpackusdw\0vpackuswb\0vpaddb\0vpaddd\0vpaddq\0vpaddsb\0vpaddsw\0vpaddusb\0vpaddusw\0vpaddw\0vpalignr\0vpandd\0vpandnd\0"
+	"vpandnq\0vpandn\0vpandq\0vpand\0vpavgb\0vpavgw\0vpblendd\0vpblendmb\0vpblendmd\0vpblendmq\0vpblendmw\0vpblendvb\0"
+	"vpblendw\0vpbroadcastb\0vpbroadcastd\0vpbroadcastmb2q\0vpbroadcastmw2d\0vpbroadcastq\0vpbroadcastw\0vpclmulqdq\0vpcmov\0"
+	"vpcmpb\0vpcmpd\0vpcmpeqb\0vpcmpeqd\0vpcmpeqq\0vpcmpeqw\0vpcmpestri\0vpcmpestrm\0vpcmpgtb\0vpcmpgtd\0vpcmpgtw\0vpcmpistri\0"
+	"vpcmpistrm\0vpcmpq\0vpcmpub\0vpcmpud\0vpcmpuq\0vpcmpuw\0vpcmpw\0vpcomb\0vpcomd\0vpcompressd\0vpcompressq\0vpcomq\0"
+	"vpcomub\0vpcomud\0vpcomuq\0vpcomuw\0vpcomw\0vpconflictd\0vpconflictq\0vperm2f128\0vperm2i128\0vpermd\0vpermi2d\0"
+	"vpermi2pd\0vpermi2ps\0vpermi2q\0vpermil2pd\0vpermil2ps\0vpermilpd\0vpermilps\0vpermpd\0vpermps\0vpermq\0vpermt2d\0"
+	"vpermt2pd\0vpermt2ps\0vpermt2q\0vpexpandd\0vpexpandq\0vpextrb\0vpextrd\0vpextrq\0vpextrw\0vpgatherdd\0vpgatherdq\0"
+	"vpgatherqd\0vpgatherqq\0vphaddbd\0vphaddbq\0vphaddbw\0vphaddubd\0vphaddubq\0vphaddubw\0vphaddudq\0vphadduwd\0vphadduwq\0"
+	"vphaddwd\0vphminposuw\0vphsubbw\0vphsubdq\0vphsubwd\0vpinsrb\0vpinsrd\0vpinsrq\0vpinsrw\0vplzcntd\0vplzcntq\0vpmacsdd\0"
+	"vpmacsdqh\0vpmacsdql\0vpmacssdd\0vpmacssdqh\0vpmacssdql\0vpmacsswd\0vpmacssww\0vpmacswd\0vpmacsww\0vpmadcsswd\0vpmadcswd\0"
+	"vpmaddwd\0vpmaskmovd\0vpmaskmovq\0vpmaxsb\0vpmaxsd\0vpmaxsq\0vpmaxsw\0vpmaxub\0vpmaxud\0vpmaxuq\0vpmaxuw\0vpminsb\0"
+	"vpminsd\0vpminsq\0vpminsw\0vpminub\0vpminud\0vpminuq\0vpminuw\0vpmovdb\0vpmovdw\0vpmovm2b\0vpmovm2d\0vpmovm2q\0vpmovm2w\0"
+	"vpmovmskb\0vpmovqb\0vpmovqd\0vpmovqw\0vpmovsdb\0vpmovsdw\0vpmovsqb\0vpmovsqd\0vpmovsqw\0vpmovsxbd\0vpmovsxbq\0vpmovsxbw\0"
+	"vpmovsxdq\0vpmovsxwd\0vpmovsxwq\0vpmovusdb\0vpmovusdw\0vpmovusqb\0vpmovusqd\0vpmovusqw\0vpmovzxbd\0vpmovzxbq\0vpmovzxbw\0"
+	"vpmovzxdq\0vpmovzxwd\0vpmovzxwq\0vpmuldq\0vpmulhuw\0vpmulhw\0vpmulld\0vpmullq\0vpmullw\0vpmuludq\0vpord\0vporq\0vpor\0"
+	"vpperm\0vprotb\0vprotd\0vprotq\0vprotw\0vpsadbw\0vpscatterdd\0vpscatterdq\0vpscatterqd\0vpscatterqq\0vpshab\0vpshad\0"
+	"vpshaq\0vpshaw\0vpshlb\0vpshld\0vpshlq\0vpshlw\0vpshufd\0vpshufhw\0vpshuflw\0vpslldq\0vpslld\0vpsllq\0vpsllvd\0vpsllvq\0"
+	"vpsllw\0vpsrad\0vpsraq\0vpsravd\0vpsravq\0vpsraw\0vpsrldq\0vpsrld\0vpsrlq\0vpsrlvd\0vpsrlvq\0vpsrlw\0vpsubb\0vpsubd\0"
+	"vpsubq\0vpsubsb\0vpsubsw\0vpsubusb\0vpsubusw\0vpsubw\0vptestmd\0vptestmq\0vptestnmd\0vptestnmq\0vptest\0vpunpckhbw\0"
+	"vpunpckhdq\0vpunpckhqdq\0vpunpckhwd\0vpunpcklbw\0vpunpckldq\0vpunpcklqdq\0vpunpcklwd\0vpxord\0vpxorq\0vpxor\0vrcp14pd\0"
+	"vrcp14ps\0vrcp14sd\0vrcp14ss\0vrcp28pd\0vrcp28ps\0vrcp28sd\0vrcp28ss\0vrcpps\0vrcpss\0vrndscalepd\0vrndscaleps\0"
+	"vrndscalesd\0vrndscaless\0vroundpd\0vroundps\0vroundsd\0vroundss\0vrsqrt14pd\0vrsqrt14ps\0vrsqrt14sd\0vrsqrt14ss\0"
+	"vrsqrt28pd\0vrsqrt28ps\0vrsqrt28sd\0vrsqrt28ss\0vrsqrtps\0vrsqrtss\0vscatterdpd\0vscatterdps\0vscatterpf0dpd\0"
+	"vscatterpf0dps\0vscatterpf0qpd\0vscatterpf0qps\0vscatterpf1dpd\0vscatterpf1dps\0vscatterpf1qpd\0vscatterpf1qps\0"
+	"vscatterqpd\0vscatterqps\0vshufpd\0vshufps\0vsqrtpd\0vsqrtps\0vsqrtsd\0vsqrtss\0vstmxcsr\0vsubpd\0vsubps\0vsubsd\0vsubss\0"
+	"vtestpd\0vtestps\0vunpckhpd\0vunpckhps\0vunpcklpd\0vunpcklps\0vzeroall\0vzeroupper\0fwait\0xabort\0xacquire\0xbegin\0"
+	"xchg\0xcryptcbc\0xcryptcfb\0xcryptctr\0xcryptecb\0xcryptofb\0xrelease\0xrstor64\0xrstors\0xrstors64\0xsave64\0xsavec\0"
+	"xsavec64\0xsaveopt64\0xsaves\0xsaves64\0xsha1\0xsha256\0xstore\0fdisi8087_nop\0feni8087_nop\0cmpss\0cmpeqss\0cmpltss\0"
+	"cmpless\0cmpunordss\0cmpneqss\0cmpnltss\0cmpnless\0cmpordss\0cmpsd\0cmpeqsd\0cmpltsd\0cmplesd\0cmpunordsd\0cmpneqsd\0"
+	"cmpnltsd\0cmpnlesd\0cmpordsd\0cmpps\0cmpeqps\0cmpltps\0cmpleps\0cmpunordps\0cmpneqps\0cmpnltps\0cmpnleps\0cmpordps\0"
+	"cmppd\0cmpeqpd\0cmpltpd\0cmplepd\0cmpunordpd\0cmpneqpd\0cmpnltpd\0cmpnlepd\0cmpordpd\0vcmpss\0vcmpeqss\0vcmpltss\0"
+	"vcmpless\0vcmpunordss\0vcmpneqss\0vcmpnltss\0vcmpnless\0vcmpordss\0vcmpeq_uqss\0vcmpngess\0vcmpngtss\0vcmpfalsess\0"
+	"vcmpneq_oqss\0vcmpgess\0vcmpgtss\0vcmptruess\0vcmpeq_osss\0vcmplt_oqss\0vcmple_oqss\0vcmpunord_sss\0vcmpneq_usss\0"
+	"vcmpnlt_uqss\0vcmpnle_uqss\0vcmpord_sss\0vcmpeq_usss\0vcmpnge_uqss\0vcmpngt_uqss\0vcmpfalse_osss\0vcmpneq_osss\0"
+	"vcmpge_oqss\0vcmpgt_oqss\0vcmptrue_usss\0vcmpsd\0vcmpeqsd\0vcmpltsd\0vcmplesd\0vcmpunordsd\0vcmpneqsd\0vcmpnltsd\0"
+	"vcmpnlesd\0vcmpordsd\0vcmpeq_uqsd\0vcmpngesd\0vcmpngtsd\0vcmpfalsesd\0vcmpneq_oqsd\0vcmpgesd\0vcmpgtsd\0vcmptruesd\0"
+	"vcmpeq_ossd\0vcmplt_oqsd\0vcmple_oqsd\0vcmpunord_ssd\0vcmpneq_ussd\0vcmpnlt_uqsd\0vcmpnle_uqsd\0vcmpord_ssd\0vcmpeq_ussd\0"
+	"vcmpnge_uqsd\0vcmpngt_uqsd\0vcmpfalse_ossd\0vcmpneq_ossd\0vcmpge_oqsd\0vcmpgt_oqsd\0vcmptrue_ussd\0vcmpps\0vcmpeqps\0"
+	"vcmpltps\0vcmpleps\0vcmpunordps\0vcmpneqps\0vcmpnltps\0vcmpnleps\0vcmpordps\0vcmpeq_uqps\0vcmpngeps\0vcmpngtps\0"
+	"vcmpfalseps\0vcmpneq_oqps\0vcmpgeps\0vcmpgtps\0vcmptrueps\0vcmpeq_osps\0vcmplt_oqps\0vcmple_oqps\0vcmpunord_sps\0"
+	"vcmpneq_usps\0vcmpnlt_uqps\0vcmpnle_uqps\0vcmpord_sps\0vcmpeq_usps\0vcmpnge_uqps\0vcmpngt_uqps\0vcmpfalse_osps\0"
+	"vcmpneq_osps\0vcmpge_oqps\0vcmpgt_oqps\0vcmptrue_usps\0vcmppd\0vcmpeqpd\0vcmpltpd\0vcmplepd\0vcmpunordpd\0vcmpneqpd\0"
+	"vcmpnltpd\0vcmpnlepd\0vcmpordpd\0vcmpeq_uqpd\0vcmpngepd\0vcmpngtpd\0vcmpfalsepd\0vcmpneq_oqpd\0vcmpgepd\0vcmpgtpd\0"
+	"vcmptruepd\0vcmpeq_ospd\0vcmplt_oqpd\0vcmple_oqpd\0vcmpunord_spd\0vcmpneq_uspd\0vcmpnlt_uqpd\0vcmpnle_uqpd\0vcmpord_spd\0"
+	"vcmpeq_uspd\0vcmpnge_uqpd\0vcmpngt_uqpd\0vcmpfalse_ospd\0vcmpneq_ospd\0vcmpge_oqpd\0vcmpgt_oqpd\0vcmptrue_uspd\0ud0\0"
+	"endbr32\0endbr64\0";
@@ -0,0 +1,836 @@
+#include "nmd_common.h"
+
+/* With a memory operand the operation is done by the load or store unit, no other uop is executed(e.g. 'mov eax, [rax]'). */
+#define _NMD_TIMING_MOVE (1 << 0)
+
+/* The pseudo register of the arithmetic flags in the dependency model. Registers use the bits of 'NMD_X86_REG_MASK_XXX'. */
+#define _NMD_TIMING_FLAGS 64
+
+/* The number of iterations simulated to find the dependencies carried from one iteration to the next. */
+#define _NMD_TIMING_ITERATIONS 16
+
+typedef struct _nmd_x86_timing_entry
+{
+	uint16_t id;                    /* A member of 'NMD_X86_INSTRUCTION'. */
+	uint16_t reciprocal_throughput; /* In hundredths of a cycle. */
+	uint8_t latency;
+	uint8_t uops;
+	uint8_t ports;
+	uint8_t flags;                  /* A mask of '_NMD_TIMING_XXX'. */
+} _nmd_x86_timing_entry;
+
+/*
+Skylake timings of the register forms, sorted by id for binary search. Values are taken from the 64-bit variants and ports are the bits
+of 0x01(port 0), 0x02(port 1), 0x20(port 5) and 0x40(port 6). Branches have no latency because they are predicted. Instructions that are
+not listed are assumed to be a simple integer operation. The VEX entries are the ids of '_nmd_x86_vex_instructions' in the decoder.
+*/
+NMD_ASSEMBLY_API const _nmd_x86_timing_entry _nmd_x86_skylake_timings[] = {
+	{ NMD_X86_INSTRUCTION_ADD, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_OR, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_ADC, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SBB, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_AND, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_SUB, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_XOR, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_CMP, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_ROL, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_ROR, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SHL, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SHR, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SAR, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_TEST, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_NOT, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_NEG, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_MUL, 100, 4, 2, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_IMUL, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_DIV, 2100, 35, 36, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_IDIV, 2400, 42, 57, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_INC, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_DEC, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_CALL, 200, 0, 1, 0x40, 0 },
+	{ NMD_X86_INSTRUCTION_JMP, 100, 0, 1, 0x40, 0 },
+	{ NMD_X86_INSTRUCTION_PUSH, 50, 0, 0, 0x00, 0 },
+	{ NMD_X86_INSTRUCTION_JO, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JNO, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JB, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JNB, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JZ, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JNZ, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JBE, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JA, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JS, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JNS, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JP, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JNP, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JL, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JGE, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JLE, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_JG, 50, 0, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_ADOX, 100, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_ADCX, 100, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_RET, 100, 0, 1, 0x40, 0 },
+	{ NMD_X86_INSTRUCTION_ANDN, 50, 1, 1, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_MOVAPD, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_BSR, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_CMC, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_CLC, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_STC, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_CBW, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_BEXTR, 50, 2, 2, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVO, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVNO, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVB, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVAE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVNE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVBE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVA, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVS, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVNS, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVP, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVNP, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVL, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVGE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVLE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CMOVG, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETO, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETNO, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETB, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETAE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETNE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETBE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETA, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETS, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETNS, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETP, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETNP, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETL, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETGE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETLE, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SETG, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_BT, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_PSHUFB, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PMADDUBSW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PABSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PABSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PABSD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMULDQ, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPEQQ, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PACKUSDW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPGTQ, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_AESENC, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_AESENCLAST, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_AESDEC, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_AESDECLAST, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_ROUNDPS, 100, 8, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_ROUNDPD, 100, 8, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_ROUNDSS, 100, 8, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_ROUNDSD, 100, 8, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_BLENDPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_BLENDPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PALIGNR, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPGTQ, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PCLMULQDQ, 100, 7, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PSRLW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSRLD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSRLQ, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PADDQ, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PMULLW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMOVMSKB, 100, 2, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBUSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBUSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMINUB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PAND, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PADDUSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PADDUSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMAXUB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PANDN, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PAVGB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSRAW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSRAD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PAVGW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMULHUW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMULHW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CQO, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CRC32, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMINSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_POR, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PADDSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PADDSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMAXSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PXOR, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PSLLW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSLLD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSLLQ, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMULUDQ, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PMADDWD, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PSADBW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_BSWAP, 50, 2, 2, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBB, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBW, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PSUBQ, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PADDB, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PADDW, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PADDD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPEQB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPEQW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPEQD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MOVMSKPS, 100, 2, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_SQRTPS, 300, 12, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_ANDPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_ANDNPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_ORPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_XORPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_ADDPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MULPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTPS2PD, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTDQ2PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_SUBPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MINPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_DIVPS, 300, 11, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_MAXPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MOVMSKPD, 100, 2, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_SQRTPD, 600, 18, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_ANDPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_ANDNPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_ORPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_XORPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_ADDPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MULPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTPD2PS, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTPS2DQ, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_SUBPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MINPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_DIVPD, 400, 14, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_MAXPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_SQRTSS, 300, 12, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_CWD, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_ADDSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MULSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTSS2SD, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTTPS2DQ, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_SUBSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MINSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_DIVSS, 300, 11, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_MAXSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_SQRTSD, 600, 18, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_CWDE, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_ADDSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MULSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTSD2SS, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_SUBSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MINSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_DIVSD, 400, 14, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_MAXSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKLBW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKLWD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKLDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PACKSSWB, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPGTB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPGTW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PCMPGTD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_PACKUSWB, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKHBW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKHWD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKHDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PACKSSDW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKLQDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PUNPCKHQDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPSHUFB, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPMADDUBSW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_BLSI, 50, 1, 1, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_BLSMSK, 50, 1, 1, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_BLSR, 50, 1, 1, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_BSF, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_BZHI, 50, 1, 1, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_CDQ, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_CDQE, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_COMISD, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_COMISS, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_CVTDQ2PD, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTPD2DQ, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTSD2SI, 100, 6, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTSI2SD, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTSI2SS, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTSS2SI, 100, 6, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTTPD2DQ, 100, 5, 2, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_CVTTSD2SI, 100, 6, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_CVTTSS2SI, 100, 6, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_MOVAPS, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVAPD, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVAPS, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_INSERTPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_UCOMISD, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_UCOMISS, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VCOMISD, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VCOMISS, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VUCOMISD, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VUCOMISS, 100, 3, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_LEA, 25, 1, 1, 0x63, 0 },
+	{ NMD_X86_INSTRUCTION_LZCNT, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_MOVD, 100, 2, 1, 0x21, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVQ, 100, 2, 1, 0x21, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOV, 25, 1, 1, 0x63, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVDQA, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVDQU, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVHLPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_MOVLHPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_MOVSS, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVSX, 25, 1, 1, 0x63, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVSXD, 25, 1, 1, 0x63, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVUPD, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVUPS, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MOVZX, 25, 1, 1, 0x63, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_MULX, 100, 4, 2, 0x22, 0 },
+	{ NMD_X86_INSTRUCTION_NOP, 25, 0, 1, 0x00, 0 },
+	{ NMD_X86_INSTRUCTION_PDEP, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_PEXT, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_PMULLD, 100, 10, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_POP, 50, 0, 0, 0x00, 0 },
+	{ NMD_X86_INSTRUCTION_POPCNT, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_PSHUFD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PSHUFHW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PSHUFLW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PSLLDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PSRLDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_PTEST, 100, 3, 2, 0x21, 0 },
+	{ NMD_X86_INSTRUCTION_RORX, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SARX, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SHLX, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SHRX, 50, 1, 1, 0x41, 0 },
+	{ NMD_X86_INSTRUCTION_SHUFPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_SHUFPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_TZCNT, 100, 3, 1, 0x02, 0 },
+	{ NMD_X86_INSTRUCTION_UNPCKHPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_UNPCKHPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_UNPCKLPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_UNPCKLPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VADDPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VADDPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VADDSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VADDSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VAESDECLAST, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VAESDEC, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VAESENCLAST, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VAESENC, 100, 4, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VANDNPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VANDNPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VANDPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VANDPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VBLENDPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VBLENDPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VBROADCASTSD, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VBROADCASTSS, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VDIVPD, 400, 14, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VDIVPS, 300, 11, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VDIVSD, 400, 14, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VDIVSS, 300, 11, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VEXTRACTF128, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VEXTRACTI128, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD132PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD132PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD213PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD231PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD213PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD231PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD213SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD132SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD231SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD213SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD132SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMADD231SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB132PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB132PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB213PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB231PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB213PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB231PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB213SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB132SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB231SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB213SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB132SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFMSUB231SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD132PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD132PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD213PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD231PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD213PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD231PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD213SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD132SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD231SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD213SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD132SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMADD231SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB132PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB132PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB213PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB231PD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB213PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB231PS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB213SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB132SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB231SD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB213SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB132SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VFNMSUB231SS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VORPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VORPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VXORPD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VXORPS, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VINSERTF128, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VINSERTI128, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VINSERTPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VMAXPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMAXPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMAXSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMAXSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMINPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMINPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMINSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMINSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMOVDQA, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVDQU, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVMSKPD, 100, 2, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VMOVMSKPS, 100, 2, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VMOVSD, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVSS, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVUPD, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMOVUPS, 33, 1, 1, 0x23, _NMD_TIMING_MOVE },
+	{ NMD_X86_INSTRUCTION_VMULPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMULPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMULSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VMULSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPABSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPABSD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPABSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPACKSSDW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPACKSSWB, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPACKUSDW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPACKUSWB, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDB, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDQ, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDUSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDUSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPADDW, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPALIGNR, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPANDN, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPAND, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPAVGB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPAVGW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPBROADCASTB, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPBROADCASTD, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPBROADCASTQ, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPBROADCASTW, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPCLMULQDQ, 100, 7, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPEQB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPEQD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPEQQ, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPEQW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPGTB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPGTD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPCMPGTW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPERM2F128, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERM2I128, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERMD, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERMILPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERMILPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERMPD, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERMPS, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPERMQ, 100, 3, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPMADDWD, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMAXSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMAXUB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMINSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMINUB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMOVMSKB, 100, 2, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VPMULDQ, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMULHUW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMULHW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMULLD, 100, 10, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMULLW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPMULUDQ, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPOR, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPSADBW, 50, 5, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSHUFD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPSHUFHW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPSHUFLW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPSLLD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSLLQ, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSLLW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSRAD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSRAW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSRLD, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSRLQ, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSRLW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBB, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBD, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBQ, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBUSB, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBUSW, 50, 1, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VPSUBW, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VPTEST, 100, 3, 2, 0x21, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKHBW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKHDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKHQDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKHWD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKLBW, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKLDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKLQDQ, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPUNPCKLWD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VPXOR, 33, 1, 1, 0x23, 0 },
+	{ NMD_X86_INSTRUCTION_VROUNDPD, 100, 8, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VROUNDPS, 100, 8, 2, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VSHUFPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VSHUFPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VSQRTPD, 600, 18, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VSQRTPS, 300, 12, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VSQRTSD, 600, 18, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VSQRTSS, 300, 12, 1, 0x01, 0 },
+	{ NMD_X86_INSTRUCTION_VSUBPD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VSUBPS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VSUBSD, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VSUBSS, 50, 4, 1, 0x03, 0 },
+	{ NMD_X86_INSTRUCTION_VUNPCKHPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VUNPCKHPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VUNPCKLPD, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VUNPCKLPS, 100, 1, 1, 0x20, 0 },
+	{ NMD_X86_INSTRUCTION_VZEROUPPER, 100, 0, 4, 0x00, 0 },
+	{ NMD_X86_INSTRUCTION_XCHG, 100, 2, 3, 0x63, 0 },
+};
+
+/* Returns true if the instruction sets its destination to a constant independent of the source('xor eax, eax', 'pxor xmm0, xmm0', ...). */
+NMD_ASSEMBLY_API bool _nmd_x86_is_zero_idiom(const nmd_x86_instruction* instruction)
+{
+	switch (instruction->id)
+	{
+	case NMD_X86_INSTRUCTION_XOR: case NMD_X86_INSTRUCTION_SUB:
+	case NMD_X86_INSTRUCTION_XORPS: case NMD_X86_INSTRUCTION_XORPD: case NMD_X86_INSTRUCTION_PXOR:
+	case NMD_X86_INSTRUCTION_PSUBB: case NMD_X86_INSTRUCTION_PSUBW: case NMD_X86_INSTRUCTION_PSUBD: case NMD_X86_INSTRUCTION_PSUBQ:
+	case NMD_X86_INSTRUCTION_PCMPEQB: case NMD_X86_INSTRUCTION_PCMPEQW: case NMD_X86_INSTRUCTION_PCMPEQD:
+		return instruction->operands[0].type == NMD_X86_OPERAND_TYPE_REGISTER && instruction->operands[1].type == NMD_X86_OPERAND_TYPE_REGISTER &&
+			nmd_x86_get_register_mask((NMD_X86_REG)instruction->operands[0].fields.reg) == nmd_x86_get_register_mask((NMD_X86_REG)instruction->operands[1].fields.reg);
+	default:
+		return false;
+	}
+}
+
+/* Returns true if the instruction's memory operands are accessed(unlike the ones of 'lea' and 'nop'). */
+_NMD_FORCE_INLINE bool _nmd_x86_accesses_memory(const nmd_x86_instruction* instruction)
+{
+	return instruction->id != NMD_X86_INSTRUCTION_LEA && instruction->id != NMD_X86_INSTRUCTION_NOP;
+}
+
+/* Returns true if the stack pointer is updated by the stack engine, so the update adds no latency. */
+_NMD_FORCE_INLINE bool _nmd_x86_uses_stack_engine(const nmd_x86_instruction* instruction)
+{
+	return instruction->id == NMD_X86_INSTRUCTION_PUSH || instruction->id == NMD_X86_INSTRUCTION_POP || instruction->id == NMD_X86_INSTRUCTION_CALL || instruction->id == NMD_X86_INSTRUCTION_RET;
+}
+
+/* Adds 'amount' to the least busy ports of 'port_mask', raising the lowest ones first so that the uops are spread evenly. */
+NMD_ASSEMBLY_API void _nmd_x86_distribute_uops(uint32_t* port_pressure, uint8_t port_mask, uint32_t amount)
+{
+	while (amount)
+	{
+		uint32_t lowest = 0xffffffff, next = 0xffffffff, num_lowest = 0, share, extra;
+		size_t i;
+
+		for (i = 0; i < NMD_X86_NUM_PORTS; i++)
+		{
+			if (!(port_mask & (1 << i)))
+				continue;
+			if (port_pressure[i] < lowest)
+			{
+				next = lowest;
+				lowest = port_pressure[i];
+				num_lowest = 1;
+			}
+			else if (port_pressure[i] == lowest)
+				num_lowest++;
+			else if (port_pressure[i] < next)
+				next = port_pressure[i];
+		}
+
+		if (!num_lowest)
+			return;
+
+		if (next != 0xffffffff && (next - lowest) * num_lowest < amount)
+		{
+			/* Raise the lowest ports to the next level */
+			for (i = 0; i < NMD_X86_NUM_PORTS; i++)
+			{
+				if ((port_mask & (1 << i)) && port_pressure[i] == lowest)
+					port_pressure[i] = next;
+			}
+			amount -= (next - lowest) * num_lowest;
+		}
+		else
+		{
+			/* Spend what's left on the lowest ports */
+			share = amount / num_lowest;
+			extra = amount % num_lowest;
+			for (i = 0; i < NMD_X86_NUM_PORTS; i++)
+			{
+				if ((port_mask & (1 << i)) && port_pressure[i] == lowest)
+				{
+					port_pressure[i] += share + (extra ? 1 : 0);
+					if (extra)
+						extra--;
+				}
+			}
+			amount = 0;
+		}
+	}
+}
+
+/*
+Returns the timing of an instruction on a microarchitecture. The instruction must have been decoded with at least 'NMD_X86_DECODER_FLAGS_INSTRUCTION_ID'
+and 'NMD_X86_DECODER_FLAGS_OPERANDS'. Loads and stores are derived from the memory operands. Returns false if the instruction is not in the
+timing table, in which case 'timing' describes a simple integer operation, or if the microarchitecture is not supported.
+Parameters:
+ - instruction       [in]  A pointer to a decoded instruction.
+ - microarchitecture [in]  A member of 'NMD_X86_MICROARCHITECTURE'.
+ - timing            [out] A pointer to a variable of type 'nmd_x86_instruction_timing'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_get_instruction_timing(const nmd_x86_instruction* instruction, NMD_X86_MICROARCHITECTURE microarchitecture, nmd_x86_instruction_timing* timing)
+{
+	const _nmd_x86_timing_entry* entry = 0;
+	size_t low = 0, high = _NMD_NUM_ELEMENTS(_nmd_x86_skylake_timings), i;
+
+	timing->reciprocal_throughput = 25;
+	timing->latency = 1;
+	timing->load_latency = 0;
+	timing->uops = 1;
+	timing->ports = 0x63;
+	timing->loads = 0;
+	timing->stores = 0;
+
+	if (microarchitecture != NMD_X86_MICROARCHITECTURE_SKYLAKE)
+		return false;
+
+	while (low < high)
+	{
+		const size_t middle = (low + high) / 2;
+		if (_nmd_x86_skylake_timings[middle].id < instruction->id)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	if (low < _NMD_NUM_ELEMENTS(_nmd_x86_skylake_timings) && _nmd_x86_skylake_timings[low].id == instruction->id)
+	{
+		entry = &_nmd_x86_skylake_timings[low];
+		timing->reciprocal_throughput = entry->reciprocal_throughput;
+		timing->latency = entry->latency;
+		timing->uops = entry->uops;
+		timing->ports = entry->ports;
+	}
+
+	if (_nmd_x86_is_zero_idiom(instruction))
+	{
+		/* Executed by the renamer */
+		timing->latency = 0;
+		timing->ports = 0;
+	}
+	else if (instruction->id == NMD_X86_INSTRUCTION_LEA && instruction->num_operands >= 2 && instruction->operands[1].fields.mem.base != NMD_X86_REG_NONE &&
+		instruction->operands[1].fields.mem.index != NMD_X86_REG_NONE && instruction->operands[1].fields.mem.disp)
+	{
+		/* A three component address is computed by the slow LEA unit */
+		timing->reciprocal_throughput = 100;
+		timing->latency = 3;
+		timing->ports = 0x02;
+	}
+
+	if (_nmd_x86_accesses_memory(instruction))
+	{
+		for (i = 0; i < NMD_X86_MAXIMUM_NUM_OPERANDS; i++)
+		{
+			if (instruction->operands[i].type != NMD_X86_OPERAND_TYPE_MEMORY)
+				continue;
+			if (instruction->operands[i].action & NMD_X86_OPERAND_ACTION_ANY_READ)
+				timing->loads++;
+			if (instruction->operands[i].action & NMD_X86_OPERAND_ACTION_ANY_WRITE)
+				timing->stores++;
+		}
+	}
+
+	if (timing->loads)
+		timing->load_latency = (uint8_t)(instruction->regs_written >> NMD_X86_REG_MASK_VECTOR0_BIT ? 6 : 5);
+
+	if (entry && (entry->flags & _NMD_TIMING_MOVE) && (timing->loads || timing->stores))
+	{
+		timing->latency = 0;
+		timing->uops = 0;
+	}
+
+	timing->fused_uops = (uint8_t)(timing->uops + timing->stores + (timing->uops == 0 ? timing->loads : 0));
+	return entry != 0;
+}
+
+/*
+Estimates the execution of a basic block that runs in a loop, like a static pipeline analyzer. The instructions must have been decoded
+with 'NMD_X86_DECODER_FLAGS_ALL'; dependencies are taken from 'regs_read', 'regs_written' and the cpu flags. The model assumes that
+branches are predicted, memory accesses hit the L1 cache and stores don't forward to later loads. Returns false if the microarchitecture
+is not supported.
+Parameters:
+ - instructions      [in]  A pointer to an array of the instructions of the block.
+ - num_instructions  [in]  The number of instructions.
+ - microarchitecture [in]  A member of 'NMD_X86_MICROARCHITECTURE'.
+ - block             [out] A pointer to a variable of type 'nmd_x86_block_timing'.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_analyze_block_timing(const nmd_x86_instruction* instructions, size_t num_instructions, NMD_X86_MICROARCHITECTURE microarchitecture, nmd_x86_block_timing* block)
+{
+	uint32_t ready[_NMD_TIMING_FLAGS + 1], fused_uops = 0, iteration_end = 0, end_of_first_half = 0;
+	nmd_x86_instruction_timing timing;
+	size_t i, k, iteration;
+
+	block->cycles_per_iteration = 0;
+	block->front_end_cycles = 0;
+	block->port_cycles = 0;
+	block->throughput_cycles = 0;
+	block->dependency_cycles = 0;
+	block->critical_path = 0;
+	for (i = 0; i < NMD_X86_NUM_PORTS; i++)
+		block->port_pressure[i] = 0;
+	block->num_uops = 0;
+	block->num_estimated = 0;
+	block->bottleneck = NMD_X86_BOTTLENECK_NONE;
+	block->bottleneck_port = 0;
+
+	if (microarchitecture != NMD_X86_MICROARCHITECTURE_SKYLAKE)
+		return false;
+
+	/* Resources */
+	for (i = 0; i < num_instructions; i++)
+	{
+		size_t num_ports = 0;
+
+		if (!nmd_x86_get_instruction_timing(&instructions[i], microarchitecture, &timing))
+			block->num_estimated++;
+
+		fused_uops += timing.fused_uops;
+		_nmd_x86_distribute_uops(block->port_pressure, timing.ports, timing.uops * 100);
+		_nmd_x86_distribute_uops(block->port_pressure, 0x0c, timing.loads * 100);
+		_nmd_x86_distribute_uops(block->port_pressure, 0x8c, timing.stores * 100);
+		block->port_pressure[4] += timing.stores * 100;
+
+		for (k = 0; k < NMD_X86_NUM_PORTS; k++)
+			num_ports += (timing.ports >> k) & 1;
+
+		/* The instruction can't start more often than its uops can be spread over its ports(e.g. a division) */
+		if (timing.uops && timing.ports && timing.reciprocal_throughput * num_ports > timing.uops * 100)
+			block->throughput_cycles += timing.reciprocal_throughput;
+	}
+
+	block->num_uops = fused_uops;
+	block->front_end_cycles = fused_uops * 100 / 4;
+	for (i = 0; i < NMD_X86_NUM_PORTS; i++)
+	{
+		if (block->port_pressure[i] > block->port_cycles)
+		{
+			block->port_cycles = block->port_pressure[i];
+			block->bottleneck_port = (uint8_t)i;
+		}
+	}
+
+	/* Dependencies. Every instruction starts as soon as its inputs are ready, so after a few iterations the end of an
+	   iteration advances by the latency of the longest chain carried through the loop. */
+	for (k = 0; k <= _NMD_TIMING_FLAGS; k++)
+		ready[k] = 0;
+
+	for (iteration = 1; iteration <= _NMD_TIMING_ITERATIONS; iteration++)
+	{
+		for (i = 0; i < num_instructions; i++)
+		{
+			const nmd_x86_instruction* const instruction = &instructions[i];
+			uint64_t read = instruction->regs_read & ~NMD_X86_REG_MASK_RIP, written = instruction->regs_written & ~NMD_X86_REG_MASK_RIP, address = 0;
+			uint32_t start = 0, finish;
+
+			nmd_x86_get_instruction_timing(instruction, microarchitecture, &timing);
+
+			if (timing.load_latency)
+			{
+				for (k = 0; k < NMD_X86_MAXIMUM_NUM_OPERANDS; k++)
+				{
+					if (instruction->operands[k].type == NMD_X86_OPERAND_TYPE_MEMORY && (instruction->operands[k].action & NMD_X86_OPERAND_ACTION_ANY_READ))
+						address |= nmd_x86_get_register_mask((NMD_X86_REG)instruction->operands[k].fields.mem.base) | nmd_x86_get_register_mask((NMD_X86_REG)instruction->operands[k].fields.mem.index);
+				}
+			}
+
+			if (_nmd_x86_is_zero_idiom(instruction))
+				read = 0;
+			if (_nmd_x86_uses_stack_engine(instruction))
+			{
+				read &= ~NMD_X86_REG_MASK_RSP;
+				written &= ~NMD_X86_REG_MASK_RSP;
+			}
+
+			for (k = 0; read | address; k++, read >>= 1, address >>= 1)
+			{
+				if ((read & 1) && ready[k] > start)
+					start = ready[k];
+				if ((address & 1) && ready[k] + timing.load_latency > start)
+					start = ready[k] + timing.load_latency;
+			}
+			if (instruction->tested_flags.eflags && ready[_NMD_TIMING_FLAGS] > start)
+				start = ready[_NMD_TIMING_FLAGS];
+
+			/* Memory operands that are not addressed by a register are loaded from the start */
+			if (timing.load_latency && start < timing.load_latency)
+				start = timing.load_latency;
+
+			finish = start + timing.latency;
+			for (k = 0; written; k++, written >>= 1)
+			{
+				if (written & 1)
+					ready[k] = finish;
+			}
+			if (instruction->modified_flags.eflags | instruction->set_flags.eflags | instruction->cleared_flags.eflags | instruction->undefined_flags.eflags)
+				ready[_NMD_TIMING_FLAGS] = finish;
+
+			if (finish > iteration_end)
+				iteration_end = finish;
+		}
+
+		if (iteration == 1)
+			block->critical_path = iteration_end;
+		else if (iteration == _NMD_TIMING_ITERATIONS / 2)
+			end_of_first_half = iteration_end;
+	}
+
+	block->dependency_cycles = (iteration_end - end_of_first_half) * 100 / (_NMD_TIMING_ITERATIONS / 2);
+
+	/* The bound that limits the loop. Later bounds win ties because they are harder to avoid. */
+	if (block->front_end_cycles >= block->cycles_per_iteration && block->front_end_cycles)
+	{
+		block->cycles_per_iteration = block->front_end_cycles;
+		block->bottleneck = NMD_X86_BOTTLENECK_FRONT_END;
+	}
+	if (block->port_cycles >= block->cycles_per_iteration && block->port_cycles)
+	{
+		block->cycles_per_iteration = block->port_cycles;
+		block->bottleneck = NMD_X86_BOTTLENECK_PORTS;
+	}
+	if (block->throughput_cycles >= block->cycles_per_iteration && block->throughput_cycles)
+	{
+		block->cycles_per_iteration = block->throughput_cycles;
+		block->bottleneck = NMD_X86_BOTTLENECK_THROUGHPUT;
+	}
+	if (block->dependency_cycles >= block->cycles_per_iteration && block->dependency_cycles)
+	{
+		block->cycles_per_iteration = block->dependency_cycles;
+		block->bottleneck = NMD_X86_BOTTLENECK_DEPENDENCY;
+	}
+
+	return true;
+}
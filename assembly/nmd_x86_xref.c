@@ -0,0 +1,434 @@
+#include "nmd_common.h"
+
+/* The operands are only decoded for the instructions that have a memory reference, to tell reads from writes. */
+#define _NMD_XREF_DECODER_FLAGS (NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_GROUP)
+
+/* Returns true if the ModR/M memory operand of an instruction refers to a fixed address(RIP-relative or absolute) and stores it in 'target'. */
+NMD_ASSEMBLY_API bool _nmd_x86_xref_memory_target(const nmd_x86_instruction* instruction, uint64_t address, uint64_t* target)
+{
+	const bool address_size_override = (instruction->prefixes & NMD_X86_PREFIXES_ADDRESS_SIZE_OVERRIDE) != 0;
+
+	if (!instruction->has_modrm || instruction->modrm.fields.mod != 0b00)
+		return false;
+
+	/* 16-bit addressing: '[disp16]'. */
+	if ((instruction->mode == NMD_X86_MODE_16 && !address_size_override) || (instruction->mode == NMD_X86_MODE_32 && address_size_override))
+	{
+		if (instruction->modrm.fields.rm != 0b110)
+			return false;
+		*target = (uint16_t)instruction->displacement;
+		return true;
+	}
+
+	if (!instruction->has_sib && instruction->modrm.fields.rm == 0b101)
+	{
+		if (instruction->mode == NMD_X86_MODE_64) /* RIP-relative */
+			*target = address + instruction->length + (uint64_t)(int64_t)(int32_t)instruction->displacement;
+		else
+			*target = instruction->displacement;
+	}
+	else if (instruction->has_sib && instruction->sib.fields.base == 0b101 && instruction->sib.fields.index == 0b100 && !(instruction->prefixes & NMD_X86_PREFIXES_REX_X))
+	{
+		/* '[disp32]' encoded with a SIB byte, which is absolute in 64-bit mode. */
+		*target = instruction->mode == NMD_X86_MODE_64 ? (uint64_t)(int64_t)(int32_t)instruction->displacement : instruction->displacement;
+	}
+	else
+		return false;
+
+	if (instruction->mode == NMD_X86_MODE_64 && address_size_override)
+		*target &= 0xffffffff;
+
+	return true;
+}
+
+/* Returns 'NMD_X86_XREF_TYPE_WRITE' if the instruction writes to its memory operand, otherwise 'NMD_X86_XREF_TYPE_READ'. Decodes the operands. */
+NMD_ASSEMBLY_API uint8_t _nmd_x86_xref_memory_type(nmd_x86_instruction* instruction)
+{
+	size_t i;
+
+	if (!nmd_x86_decode_operands(instruction))
+		return NMD_X86_XREF_TYPE_READ;
+
+	for (i = 0; i < instruction->num_operands; i++)
+	{
+		if (instruction->operands[i].type == NMD_X86_OPERAND_TYPE_MEMORY && !instruction->operands[i].is_implicit)
+			return (uint8_t)(instruction->operands[i].action & NMD_X86_OPERAND_ACTION_ANY_WRITE ? NMD_X86_XREF_TYPE_WRITE : NMD_X86_XREF_TYPE_READ);
+	}
+
+	return NMD_X86_XREF_TYPE_READ;
+}
+
+/* Stores a cross-reference if there's room and counts it. */
+_NMD_FORCE_INLINE void _nmd_x86_xref_add(nmd_x86_xref* xrefs, size_t max_xrefs, size_t* num_xrefs, uint32_t source, uint64_t target, uint8_t type)
+{
+	if (*num_xrefs < max_xrefs)
+	{
+		xrefs[*num_xrefs].target = target;
+		xrefs[*num_xrefs].source = source;
+		xrefs[*num_xrefs].type = type;
+	}
+	(*num_xrefs)++;
+}
+
+/*
+Collects the cross-references of the instructions that start in ['begin', 'end') of a section, decoding each instruction once: relative
+branches('NMD_GROUP_RELATIVE_ADDRESSING'), RIP-relative and absolute memory operands, and immediates of 32 or 64 bits that point into the image.
+Returns the number of cross-references, which may be larger than 'max_xrefs'; only the first 'max_xrefs' are stored, sorted by source.
+Parameters:
+ - section         [in]  A pointer to the section, see nmd_x86_elf_get_executable_sections() and nmd_x86_pe_get_executable_sections().
+ - image_base      [in]  The lowest address of the image. Sources are stored relative to it, so the image must be smaller than 4GiB.
+ - image_size      [in]  The size of the image in bytes. Immediates in ['image_base', 'image_base' + 'image_size') are references.
+ - boundary_bitmap [in]  A bitmap that marks the start of every instruction of the section(see nmd_x86_ldisasm_bulk() and nmd_x86_sweep_merge()),
+                         or null to sweep linearly from 'begin', skipping bytes that cannot be decoded one at a time.
+ - begin           [in]  The offset of the first byte of the range.
+ - end             [in]  The offset one past the last byte of the range. Instructions may extend past it.
+ - xrefs           [out] A pointer to an array of 'nmd_x86_xref' that receives the cross-references. May be null if 'max_xrefs' is zero.
+ - max_xrefs       [in]  The number of elements in 'xrefs'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_collect(const nmd_x86_code_section* section, uint64_t image_base, uint64_t image_size, const uint32_t* boundary_bitmap, size_t begin, size_t end, nmd_x86_xref* xrefs, size_t max_xrefs)
+{
+	const NMD_X86_MODE mode = (NMD_X86_MODE)section->mode;
+	nmd_x86_instruction instruction;
+	size_t offset = begin, num_xrefs = 0;
+	uint64_t address, target;
+	uint32_t source;
+	bool valid;
+
+	if (end > section->size)
+		end = section->size;
+
+	while (offset < end)
+	{
+		if (boundary_bitmap && !((boundary_bitmap[offset / 32] >> (offset % 32)) & 1))
+		{
+			/* Skip the elements of the bitmap without instructions. */
+			if (offset % 32 == 0 && boundary_bitmap[offset / 32] == 0)
+				offset += 32;
+			else
+				offset++;
+			continue;
+		}
+
+		if (section->size - offset >= NMD_X86_MAXIMUM_INSTRUCTION_LENGTH)
+			valid = nmd_x86_decode_padded(section->code + offset, &instruction, mode, _NMD_XREF_DECODER_FLAGS);
+		else
+			valid = nmd_x86_decode(section->code + offset, section->size - offset, &instruction, mode, _NMD_XREF_DECODER_FLAGS);
+
+		if (!valid)
+		{
+			offset++;
+			continue;
+		}
+
+		address = section->address + offset;
+		source = (uint32_t)(address - image_base);
+
+		if (instruction.group & NMD_GROUP_RELATIVE_ADDRESSING && instruction.group & (NMD_GROUP_BRANCH | NMD_GROUP_CALL))
+		{
+			target = address + (uint64_t)_nmd_x86_get_branch_target(&instruction, 0);
+			if (mode != NMD_X86_MODE_64)
+				target &= 0xffffffff;
+			_nmd_x86_xref_add(xrefs, max_xrefs, &num_xrefs, source, target, (uint8_t)(instruction.group & NMD_GROUP_CALL ? NMD_X86_XREF_TYPE_CALL : NMD_X86_XREF_TYPE_JUMP));
+		}
+		else if (instruction.opcode_map == NMD_X86_OPCODE_MAP_DEFAULT && instruction.encoding == NMD_X86_ENCODING_LEGACY && instruction.opcode >= 0xa0 && instruction.opcode <= 0xa3)
+		{
+			/* mov al/ax/eax/rax, moffs and mov moffs, al/ax/eax/rax: the address is the immediate. */
+			target = instruction.imm_mask == NMD_X86_IMM64 ? instruction.immediate : (instruction.imm_mask == NMD_X86_IMM32 ? (uint32_t)instruction.immediate : (uint16_t)instruction.immediate);
+			_nmd_x86_xref_add(xrefs, max_xrefs, &num_xrefs, source, target, (uint8_t)(instruction.opcode <= 0xa1 ? NMD_X86_XREF_TYPE_READ : NMD_X86_XREF_TYPE_WRITE));
+		}
+		else
+		{
+			if (instruction.id != NMD_X86_INSTRUCTION_NOP && _nmd_x86_xref_memory_target(&instruction, address, &target))
+			{
+				const uint8_t type = (uint8_t)(instruction.id == NMD_X86_INSTRUCTION_LEA ? NMD_X86_XREF_TYPE_ADDRESS : _nmd_x86_xref_memory_type(&instruction));
+				_nmd_x86_xref_add(xrefs, max_xrefs, &num_xrefs, source, target, type);
+			}
+
+			/* Smaller immediates are rarely addresses. */
+			if (instruction.imm_mask == NMD_X86_IMM32 || instruction.imm_mask == NMD_X86_IMM64)
+			{
+				target = instruction.imm_mask == NMD_X86_IMM64 ? instruction.immediate : (uint32_t)instruction.immediate;
+				if (target >= image_base && target - image_base < image_size)
+					_nmd_x86_xref_add(xrefs, max_xrefs, &num_xrefs, source, target, NMD_X86_XREF_TYPE_ADDRESS);
+			}
+		}
+
+		offset += instruction.length;
+	}
+
+	return num_xrefs;
+}
+
+/* Returns true if 'a' goes after 'b' in the order by source or in the order by target. */
+_NMD_FORCE_INLINE bool _nmd_x86_xref_greater(const nmd_x86_xref* a, const nmd_x86_xref* b, bool by_target)
+{
+	if (by_target && a->target != b->target)
+		return a->target > b->target;
+	return a->source > b->source;
+}
+
+/*
+Copies cross-references sorted by source and sorts the copy by target. Equal targets keep their order, so they stay sorted by source.
+Parameters:
+ - xrefs     [in]  A pointer to an array of cross-references sorted by source.
+ - num_xrefs [in]  The number of elements in 'xrefs'.
+ - sorted    [out] A pointer to an array of 'num_xrefs' elements that receives the sorted cross-references.
+ - workspace [in]  A pointer to an array of 'num_xrefs' elements used as temporary storage.
+*/
+NMD_ASSEMBLY_API void nmd_x86_xref_sort_by_target(const nmd_x86_xref* xrefs, size_t num_xrefs, nmd_x86_xref* sorted, nmd_x86_xref* workspace)
+{
+	const nmd_x86_xref* in = xrefs;
+	nmd_x86_xref* out = sorted;
+	size_t width, left, middle, right, i, k, n, passes = 0;
+
+	/* Bottom-up merge sort. The first pass reads 'xrefs', the following ones alternate between 'sorted' and 'workspace', so the number of
+	   passes decides where the first pass writes to make the last one end in 'sorted'. */
+	for (width = 1; width < num_xrefs; width *= 2)
+		passes++;
+	if (passes % 2 == 0)
+		out = workspace;
+
+	if (passes == 0)
+	{
+		for (i = 0; i < num_xrefs; i++)
+			sorted[i] = xrefs[i];
+		return;
+	}
+
+	for (width = 1; width < num_xrefs; width *= 2)
+	{
+		for (left = 0; left < num_xrefs; left += 2 * width)
+		{
+			middle = _NMD_MIN(left + width, num_xrefs);
+			right = _NMD_MIN(left + 2 * width, num_xrefs);
+			for (i = left, k = middle, n = left; n < right; n++)
+			{
+				if (i < middle && (k == right || !_nmd_x86_xref_greater(&in[i], &in[k], true)))
+					out[n] = in[i++];
+				else
+					out[n] = in[k++];
+			}
+		}
+
+		in = out;
+		out = out == sorted ? workspace : sorted;
+	}
+}
+
+/*
+Merges sorted runs(e.g. one per thread) into one array. Returns the number of cross-references.
+Parameters:
+ - runs      [in/out] A pointer to an array of runs, all sorted by source or all sorted by target. They are advanced past the merged elements, so they are empty on return.
+ - num_runs  [in]     The number of elements in 'runs'.
+ - by_target [in]     False if the runs are sorted by source, true if they are sorted by target.
+ - xrefs     [out]    A pointer to an array that receives the merged cross-references. It must be large enough for all of them.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_merge(nmd_x86_xref_run* runs, size_t num_runs, bool by_target, nmd_x86_xref* xrefs)
+{
+	size_t i, total = 0, num_xrefs, best;
+	const nmd_x86_xref* candidate;
+	const nmd_x86_xref* smallest;
+
+	for (i = 0; i < num_runs; i++)
+		total += runs[i].num_xrefs;
+
+	/* Every element is taken from the run whose first element is the smallest(the first such run on ties, which keeps the merge stable).
+	   The runs are few(usually one per thread), so they're compared linearly. */
+	for (num_xrefs = 0; num_xrefs < total; num_xrefs++)
+	{
+		smallest = 0;
+		best = 0;
+		for (i = 0; i < num_runs; i++)
+		{
+			if (runs[i].num_xrefs == 0)
+				continue;
+
+			candidate = runs[i].xrefs;
+			if (!smallest || _nmd_x86_xref_greater(smallest, candidate, by_target))
+			{
+				smallest = candidate;
+				best = i;
+			}
+		}
+
+		xrefs[num_xrefs] = *smallest;
+		runs[best].xrefs++;
+		runs[best].num_xrefs--;
+	}
+
+	return total;
+}
+
+/*
+Initializes an index over cross-references. The index points to the arrays, which must stay valid while it is used.
+Parameters:
+ - index      [out] A pointer to a variable of type 'nmd_x86_xref_index'.
+ - image_base [in]  The image base passed to nmd_x86_xref_collect().
+ - by_source  [in]  A pointer to the cross-references sorted by source.
+ - by_target  [in]  A pointer to the same cross-references sorted by target, see nmd_x86_xref_sort_by_target().
+ - num_xrefs  [in]  The number of elements of both arrays.
+*/
+NMD_ASSEMBLY_API void nmd_x86_xref_index_init(nmd_x86_xref_index* index, uint64_t image_base, const nmd_x86_xref* by_source, const nmd_x86_xref* by_target, size_t num_xrefs)
+{
+	index->image_base = image_base;
+	index->by_source = by_source;
+	index->by_target = by_target;
+	index->num_xrefs = num_xrefs;
+}
+
+/* Returns the index of the first cross-reference sorted by source whose source is not smaller than 'source'. */
+_NMD_FORCE_INLINE size_t _nmd_x86_xref_lower_bound_source(const nmd_x86_xref* xrefs, size_t num_xrefs, uint64_t source)
+{
+	size_t low = 0, high = num_xrefs, middle;
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (xrefs[middle].source < source)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	return low;
+}
+
+/*
+Updates an index in place after the instructions that start in ['begin', 'end') of a section changed, e.g. with the range returned by
+nmd_x86_recursive_descent_patch(). The cross-references from the range are replaced by the ones collected again from it, which is the only
+decoding: they are spliced into 'by_source' and merged into 'by_target', moving the other elements without sorting them again. Decoding
+scales with the range, but the update is linear in the number of cross-references: 'by_target' is filtered and merged as a whole and the
+elements of 'by_source' after the range are moved. Returns false
+if the new cross-references don't fit in 'max_new_xrefs' or the result doesn't fit in 'max_xrefs', in which case nothing is modified.
+Parameters:
+ - index           [in/out] A pointer to an index initialized with 'by_source' and 'by_target'.
+ - section         [in]     A pointer to the section that contains the new bytes.
+ - image_size      [in]     The image size passed to nmd_x86_xref_collect().
+ - boundary_bitmap [in]     A bitmap that marks the start of every instruction of the section after the change, or null. See nmd_x86_xref_collect().
+ - begin           [in]     The offset of the first byte of the range.
+ - end             [in]     The offset one past the last byte of the range.
+ - by_source       [in/out] A pointer to the cross-references sorted by source that the index points to.
+ - by_target       [in/out] A pointer to the cross-references sorted by target that the index points to.
+ - max_xrefs       [in]     The number of elements of 'by_source' and of 'by_target'.
+ - workspace       [in]     A pointer to an array of '3 * max_new_xrefs' elements used as temporary storage.
+ - max_new_xrefs   [in]     The maximum number of cross-references from the range.
+*/
+NMD_ASSEMBLY_API bool nmd_x86_xref_update(nmd_x86_xref_index* index, const nmd_x86_code_section* section, uint64_t image_size, const uint32_t* boundary_bitmap, size_t begin, size_t end, nmd_x86_xref* by_source, nmd_x86_xref* by_target, size_t max_xrefs, nmd_x86_xref* workspace, size_t max_new_xrefs)
+{
+	const uint64_t first_source = section->address + begin - index->image_base;
+	const uint64_t last_source = section->address + end - index->image_base;
+	const size_t num_new = nmd_x86_xref_collect(section, index->image_base, image_size, boundary_bitmap, begin, end, workspace, max_new_xrefs);
+	const nmd_x86_xref* const sorted = workspace + num_new;
+	size_t low, high, num_xrefs, num_kept, i, k, n;
+
+	if (num_new > max_new_xrefs)
+		return false;
+
+	low = _nmd_x86_xref_lower_bound_source(by_source, index->num_xrefs, first_source);
+	high = _nmd_x86_xref_lower_bound_source(by_source, index->num_xrefs, last_source);
+	num_xrefs = index->num_xrefs - (high - low) + num_new;
+	if (num_xrefs > max_xrefs)
+		return false;
+
+	nmd_x86_xref_sort_by_target(workspace, num_new, workspace + num_new, workspace + 2 * num_new);
+
+	/* By target: drop the old cross-references of the range, then merge the new ones from the back. Sources never compare equal. */
+	for (i = 0, num_kept = 0; i < index->num_xrefs; i++)
+	{
+		if (by_target[i].source < first_source || by_target[i].source >= last_source)
+			by_target[num_kept++] = by_target[i];
+	}
+
+	for (i = num_kept, n = num_new, k = num_xrefs; n > 0;)
+	{
+		if (i > 0 && _nmd_x86_xref_greater(&by_target[i - 1], &sorted[n - 1], true))
+			by_target[--k] = by_target[--i];
+		else
+			by_target[--k] = sorted[--n];
+	}
+
+	/* By source: the range is contiguous, so the elements after it are moved and the new ones copied. */
+	if (num_new > high - low)
+	{
+		for (i = index->num_xrefs; i > high; i--)
+			by_source[i - 1 + num_new - (high - low)] = by_source[i - 1];
+	}
+	else if (num_new < high - low)
+	{
+		for (i = high; i < index->num_xrefs; i++)
+			by_source[i - (high - low) + num_new] = by_source[i];
+	}
+
+	for (i = 0; i < num_new; i++)
+		by_source[low + i] = workspace[i];
+
+	nmd_x86_xref_index_init(index, index->image_base, by_source, by_target, num_xrefs);
+	return true;
+}
+
+/*
+Finds the cross-references from the instruction at an address with a binary search. Returns their number.
+Parameters:
+ - index   [in]  A pointer to an index initialized by nmd_x86_xref_index_init().
+ - address [in]  The address of the instruction.
+ - xrefs   [out] A pointer to a variable that receives a pointer to the first cross-reference in 'by_source'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_find_from(const nmd_x86_xref_index* index, uint64_t address, const nmd_x86_xref** xrefs)
+{
+	size_t low = 0, high = index->num_xrefs, middle, last;
+	uint32_t source;
+
+	*xrefs = index->by_source;
+	if (address < index->image_base || address - index->image_base > 0xffffffff)
+		return 0;
+	source = (uint32_t)(address - index->image_base);
+
+	/* The first element whose source is not smaller. */
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (index->by_source[middle].source < source)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	*xrefs = index->by_source + low;
+	for (last = low; last < index->num_xrefs && index->by_source[last].source == source; last++);
+	return last - low;
+}
+
+/*
+Finds the cross-references to an address with a binary search(e.g. the callers of a function). Returns their number.
+Parameters:
+ - index   [in]  A pointer to an index initialized by nmd_x86_xref_index_init().
+ - address [in]  The referenced address.
+ - xrefs   [out] A pointer to a variable that receives a pointer to the first cross-reference in 'by_target'.
+*/
+NMD_ASSEMBLY_API size_t nmd_x86_xref_find_to(const nmd_x86_xref_index* index, uint64_t address, const nmd_x86_xref** xrefs)
+{
+	size_t low = 0, high = index->num_xrefs, middle, first;
+
+	/* The first element whose target is not smaller, then the first one whose target is larger. */
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (index->by_target[middle].target < address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	first = low;
+	high = index->num_xrefs;
+	while (low < high)
+	{
+		middle = low + (high - low) / 2;
+		if (index->by_target[middle].target <= address)
+			low = middle + 1;
+		else
+			high = middle;
+	}
+
+	*xrefs = index->by_target + first;
+	return low - first;
+}
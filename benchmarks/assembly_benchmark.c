@@ -0,0 +1,432 @@
+/* Benchmark suite of the decoder, formatter, assembler, length disassembler and interpreter. Every function is measured on a set of reproducible corpora:
+random instruction streams for each opcode map(generated with a fixed seed, so they are identical on every machine) and the .text section
+of an ELF file on the build machine(by default the benchmark's own executable). The results are printed as a table and optionally written
+as JSON so that regressions can be tracked. The interpreter is measured on a single counting loop('interpreter_loop'). The formatter and
+the assembler are not measured on the VEX corpus because the formatter doesn't support VEX instructions.
+Build: gcc -O2 -std=c89 benchmarks/assembly_benchmark.c -o assembly_benchmark
+Usage: assembly_benchmark [--json output.json] [--elf path]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+#define RANDOM_CORPUS_SIZE (512 * 1024)
+#define MAX_TEXT_SIZE NMD_BENCHMARK_CORPUS_SIZE
+#define MAX_FORMATTED_INSTRUCTIONS 32768
+#define MAX_RESULTS 128
+
+#define RANDOM_MAP_VEX 0xff
+
+typedef struct corpus
+{
+	char name[32];
+	unsigned char* code; /* Followed by 'NMD_BENCHMARK_PADDING' zero bytes. */
+	size_t size;
+	bool formattable; /* False if the formatter doesn't support the corpus' encoding(VEX). nmd_x86_format() and nmd_x86_assemble() are not measured then. */
+} corpus;
+
+typedef struct result
+{
+	const char* corpus;
+	const char* function;
+	const char* variant;
+	size_t instructions; /* The number of instructions processed in all iterations. */
+	double seconds;
+} result;
+
+static result results[MAX_RESULTS];
+static size_t num_results;
+
+/* Keeps the compiler from removing the formatter's work. */
+static volatile unsigned char sink;
+
+/* xorshift64, so the random corpora don't depend on the C library. */
+static uint64_t random_state = 0x2545f4914f6cdd1d;
+static unsigned char next_random(void)
+{
+	random_state ^= random_state << 13;
+	random_state ^= random_state >> 7;
+	random_state ^= random_state << 17;
+	return (unsigned char)(random_state >> 32);
+}
+
+/* Fills a corpus with random valid instructions of an opcode map('NMD_X86_OPCODE_MAP_XXX' for legacy encodings or 'RANDOM_MAP_VEX'). */
+static void generate_random_corpus(corpus* c, const char* name, uint8_t map)
+{
+	static const unsigned char legacy_prefixes[] = { 0, 0, 0, 0, 0x66, 0xf2, 0xf3, 0x67 };
+	nmd_x86_instruction instruction;
+	unsigned char buffer[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH];
+	size_t length, i;
+
+	strcpy(c->name, name);
+	c->code = (unsigned char*)calloc(RANDOM_CORPUS_SIZE + NMD_BENCHMARK_PADDING, 1);
+	c->size = 0;
+	c->formattable = map != RANDOM_MAP_VEX;
+
+	while (c->size + NMD_X86_MAXIMUM_INSTRUCTION_LENGTH <= RANDOM_CORPUS_SIZE)
+	{
+		length = 0;
+		if (map == RANDOM_MAP_VEX)
+		{
+			buffer[length++] = 0xc4;
+			buffer[length++] = (unsigned char)((next_random() & 0xe0) | (1 + next_random() % 3));
+			buffer[length++] = next_random();
+		}
+		else
+		{
+			if ((buffer[length] = legacy_prefixes[next_random() % sizeof(legacy_prefixes)]) != 0)
+				length++;
+			if (next_random() & 1)
+				buffer[length++] = (unsigned char)(0x40 | (next_random() & 0xf));
+			if (map != NMD_X86_OPCODE_MAP_DEFAULT)
+				buffer[length++] = 0x0f;
+			if (map == NMD_X86_OPCODE_MAP_0F38)
+				buffer[length++] = 0x38;
+			else if (map == NMD_X86_OPCODE_MAP_0F3A)
+				buffer[length++] = 0x3a;
+		}
+
+		for (i = length; i < sizeof(buffer); i++)
+			buffer[i] = next_random();
+
+		if (!nmd_x86_decode(buffer, sizeof(buffer), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL))
+			continue;
+		if (map == RANDOM_MAP_VEX ? instruction.encoding != NMD_X86_ENCODING_VEX : (instruction.encoding != NMD_X86_ENCODING_LEGACY || instruction.opcode_map != map))
+			continue;
+
+		memcpy(c->code + c->size, buffer, instruction.length);
+		c->size += instruction.length;
+	}
+}
+
+/* Reads a little-endian integer of 'size' bytes. */
+static uint64_t read_integer(const unsigned char* p, size_t size)
+{
+	uint64_t value = 0;
+	while (size--)
+		value = (value << 8) | p[size];
+	return value;
+}
+
+/* Loads the .text section of an ELF32 or ELF64 file. Returns false if the file can't be read or has no .text section. */
+static bool load_elf_text(corpus* c, const char* path)
+{
+	FILE* file = fopen(path, "rb");
+	unsigned char* image;
+	long file_size;
+	uint64_t section_offset, string_table_offset;
+	size_t section_size, num_sections, string_table_index, i;
+	bool is_64;
+
+	if (!file)
+		return false;
+
+	fseek(file, 0, SEEK_END);
+	file_size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	if (file_size < 64 || !(image = (unsigned char*)malloc((size_t)file_size)))
+	{
+		fclose(file);
+		return false;
+	}
+	if (fread(image, 1, (size_t)file_size, file) != (size_t)file_size || memcmp(image, "\x7f" "ELF", 4) != 0 || image[5] != 1)
+	{
+		fclose(file);
+		free(image);
+		return false;
+	}
+	fclose(file);
+
+	is_64 = image[4] == 2;
+	section_offset = is_64 ? read_integer(image + 0x28, 8) : read_integer(image + 0x20, 4);
+	section_size = (size_t)read_integer(image + (is_64 ? 0x3a : 0x2e), 2);
+	num_sections = (size_t)read_integer(image + (is_64 ? 0x3c : 0x30), 2);
+	string_table_index = (size_t)read_integer(image + (is_64 ? 0x3e : 0x32), 2);
+
+	if (string_table_index >= num_sections || section_offset + num_sections * section_size > (uint64_t)file_size)
+	{
+		free(image);
+		return false;
+	}
+
+	string_table_offset = read_integer(image + section_offset + string_table_index * section_size + (is_64 ? 0x18 : 0x10), is_64 ? 8 : 4);
+	for (i = 0; i < num_sections; i++)
+	{
+		const unsigned char* const header = image + section_offset + i * section_size;
+		const uint64_t name = string_table_offset + read_integer(header, 4);
+		const uint64_t offset = read_integer(header + (is_64 ? 0x18 : 0x10), is_64 ? 8 : 4);
+		uint64_t size = read_integer(header + (is_64 ? 0x20 : 0x14), is_64 ? 8 : 4);
+
+		if (name + 6 > (uint64_t)file_size || memcmp(image + name, ".text", 6) != 0 || offset + size > (uint64_t)file_size || size == 0)
+			continue;
+
+		if (size > MAX_TEXT_SIZE)
+			size = MAX_TEXT_SIZE;
+
+		strcpy(c->name, "elf_text");
+		c->formattable = true;
+		c->code = (unsigned char*)calloc((size_t)size + NMD_BENCHMARK_PADDING, 1);
+		memcpy(c->code, image + offset, (size_t)size);
+		c->size = (size_t)size;
+		free(image);
+		return true;
+	}
+
+	free(image);
+	return false;
+}
+
+static void record(const corpus* c, const char* function, const char* variant, size_t instructions, double seconds)
+{
+	result* const r = &results[num_results++];
+	r->corpus = c->name;
+	r->function = function;
+	r->variant = variant;
+	r->instructions = instructions;
+	r->seconds = seconds > 0 ? seconds : 1e-9;
+
+	printf("%-14s %-18s %-16s %10.2f M instructions/s %8.2f ns/instruction\n", c->name, function, variant, instructions / r->seconds / 1e6, r->seconds * 1e9 / instructions);
+}
+
+static void benchmark_decode(const corpus* c, const char* variant, uint32_t flags)
+{
+	nmd_x86_instruction instruction;
+	size_t i, offset, count = 0;
+	double start = nmd_benchmark_time();
+
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+	{
+		for (offset = 0; offset < c->size; count++)
+			offset += nmd_x86_decode(c->code + offset, c->size - offset, &instruction, NMD_X86_MODE_64, flags) ? instruction.length : 1;
+	}
+
+	record(c, "nmd_x86_decode", variant, count, nmd_benchmark_time() - start);
+}
+
+static void benchmark_ldisasm(const corpus* c)
+{
+	size_t i, offset, length, count = 0;
+	double start = nmd_benchmark_time();
+
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+	{
+		for (offset = 0; offset < c->size; count++)
+		{
+			length = nmd_x86_ldisasm(c->code + offset, c->size - offset, NMD_X86_MODE_64);
+			offset += length ? length : 1;
+		}
+	}
+
+	record(c, "nmd_x86_ldisasm", "default", count, nmd_benchmark_time() - start);
+}
+
+static void benchmark_ldisasm_bulk(const corpus* c)
+{
+	uint32_t* const bitmap = (uint32_t*)malloc((c->size + 31) / 32 * sizeof(uint32_t));
+	size_t i, count = 0;
+	double start = nmd_benchmark_time();
+
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+		count += nmd_x86_ldisasm_bulk(c->code, c->size, NMD_X86_MODE_64, bitmap);
+
+	record(c, "nmd_x86_ldisasm_bulk", "default", count, nmd_benchmark_time() - start);
+	free(bitmap);
+}
+
+/* Decodes the first instructions of the corpus for the formatter and the assembler. Returns the number of instructions. */
+static size_t decode_instructions(const corpus* c, nmd_x86_instruction* instructions)
+{
+	size_t offset = 0, count = 0;
+	while (offset < c->size && count < MAX_FORMATTED_INSTRUCTIONS)
+	{
+		if (nmd_x86_decode(c->code + offset, c->size - offset, &instructions[count], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL))
+			offset += instructions[count++].length;
+		else
+			offset++;
+	}
+	return count;
+}
+
+static void benchmark_format(const corpus* c, const nmd_x86_instruction* instructions, size_t num_instructions, const char* variant, uint32_t flags)
+{
+	char buffer[256];
+	size_t i, k;
+	double start = nmd_benchmark_time();
+
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+	{
+		for (k = 0; k < num_instructions; k++)
+		{
+			nmd_x86_format(&instructions[k], buffer, NMD_X86_INVALID_RUNTIME_ADDRESS, flags);
+			sink = (unsigned char)buffer[0];
+		}
+	}
+
+	if (num_instructions)
+		record(c, "nmd_x86_format", variant, num_instructions * NMD_BENCHMARK_ITERATIONS, nmd_benchmark_time() - start);
+}
+
+/* Assembles the formatted instructions that the assembler supports(checked once before measuring). */
+static void benchmark_assemble(const corpus* c, const nmd_x86_instruction* instructions, size_t num_instructions)
+{
+	char* strings = (char*)malloc(num_instructions * 128);
+	unsigned char buffer[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH];
+	size_t i, k, num_strings = 0;
+	double start;
+
+	for (k = 0; k < num_instructions; k++)
+	{
+		nmd_x86_format(&instructions[k], strings + num_strings * 128, NMD_X86_INVALID_RUNTIME_ADDRESS, NMD_X86_FORMAT_FLAGS_DEFAULT);
+		if (nmd_x86_assemble(strings + num_strings * 128, buffer, sizeof(buffer), NMD_X86_INVALID_RUNTIME_ADDRESS, NMD_X86_MODE_64, 0))
+			num_strings++;
+	}
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+	{
+		for (k = 0; k < num_strings; k++)
+			nmd_x86_assemble(strings + k * 128, buffer, sizeof(buffer), NMD_X86_INVALID_RUNTIME_ADDRESS, NMD_X86_MODE_64, 0);
+	}
+
+	if (num_strings)
+		record(c, "nmd_x86_assemble", "default", num_strings * NMD_BENCHMARK_ITERATIONS, nmd_benchmark_time() - start);
+	free(strings);
+}
+
+/* Runs 'xor eax,eax; mov ecx,100000000; add eax,ecx; dec ecx; jnz -6; hlt' in the interpreter(300000002 instructions). */
+static void benchmark_interpreter(void)
+{
+	static const unsigned char loop[] = { 0x31, 0xc0, 0xb9, 0x00, 0xe1, 0xf5, 0x05, 0x01, 0xc8, 0xff, 0xc9, 0x75, 0xfa, 0xf4 };
+	static uint8_t code_page[4096], stack_page[4096];
+	static nmd_x86_interpreter_block blocks[64];
+	static nmd_x86_micro_op uops[1024];
+	static uint32_t block_map[128];
+	static corpus loop_corpus = { "interpreter_loop", 0, 0, false };
+	nmd_x86_page pages[2];
+	nmd_x86_page_table page_table;
+	nmd_x86_interpreter it;
+	double start;
+
+	memset(code_page, 0xcc, sizeof(code_page));
+	memcpy(code_page, loop, sizeof(loop));
+	pages[0].address = 0x1000;
+	pages[0].data = code_page;
+	pages[0].writable = false;
+	pages[1].address = 0x2000;
+	pages[1].data = stack_page;
+	pages[1].writable = true;
+	page_table.pages = pages;
+	page_table.num_pages = 2;
+
+	nmd_x86_interpreter_init(&it, nmd_x86_page_table_translate, &page_table, blocks, 64, uops, 1024, block_map, 128);
+	it.rip = 0x1000;
+	it.regs[NMD_X86_GPR_RSP] = 0x3000;
+
+	start = nmd_benchmark_time();
+	if (nmd_x86_interpreter_run(&it, (uint64_t)-1) != NMD_X86_INTERPRETER_EXIT_UNSUPPORTED || it.num_instructions != 300000002)
+		fprintf(stderr, "the interpreter stopped after %lu instructions\n", (unsigned long)it.num_instructions);
+	record(&loop_corpus, "nmd_x86_interpreter_run", "default", (size_t)it.num_instructions, nmd_benchmark_time() - start);
+}
+
+static bool write_json(const char* path, const corpus* corpora, size_t num_corpora)
+{
+	FILE* file = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+	size_t i;
+
+	if (!file)
+		return false;
+
+	fprintf(file, "{\n  \"iterations\": %d,\n  \"corpora\": [\n", NMD_BENCHMARK_ITERATIONS);
+	for (i = 0; i < num_corpora; i++)
+		fprintf(file, "    { \"name\": \"%s\", \"bytes\": %lu }%s\n", corpora[i].name, (unsigned long)corpora[i].size, i + 1 < num_corpora ? "," : "");
+
+	fprintf(file, "  ],\n  \"results\": [\n");
+	for (i = 0; i < num_results; i++)
+	{
+		const result* const r = &results[i];
+		fprintf(file, "    { \"corpus\": \"%s\", \"function\": \"%s\", \"variant\": \"%s\", \"instructions\": %lu, \"seconds\": %.6f, \"instructions_per_second\": %.0f, \"ns_per_instruction\": %.3f }%s\n",
+			r->corpus, r->function, r->variant, (unsigned long)r->instructions, r->seconds, r->instructions / r->seconds, r->seconds * 1e9 / r->instructions, i + 1 < num_results ? "," : "");
+	}
+	fprintf(file, "  ]\n}\n");
+
+	if (file != stdout)
+		fclose(file);
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	static const struct { const char* name; uint32_t flags; } decoder_variants[] = {
+		{ "minimal", NMD_X86_DECODER_FLAGS_MINIMAL },
+		{ "instruction_id", NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID },
+		{ "operands", NMD_X86_DECODER_FLAGS_MINIMAL | NMD_X86_DECODER_FLAGS_INSTRUCTION_ID | NMD_X86_DECODER_FLAGS_OPERANDS },
+		{ "all", NMD_X86_DECODER_FLAGS_ALL },
+	};
+	static const struct { const char* name; uint32_t flags; } format_variants[] = {
+		{ "default", NMD_X86_FORMAT_FLAGS_DEFAULT },
+		{ "uppercase_bytes", NMD_X86_FORMAT_FLAGS_DEFAULT | NMD_X86_FORMAT_FLAGS_UPPERCASE | NMD_X86_FORMAT_FLAGS_BYTES | NMD_X86_FORMAT_FLAGS_POINTER_SIZE },
+		{ "decimal_spaces", NMD_X86_FORMAT_FLAGS_COMMA_SPACES | NMD_X86_FORMAT_FLAGS_OPERATOR_SPACES | NMD_X86_FORMAT_FLAGS_POINTER_SIZE | NMD_X86_FORMAT_FLAGS_SCALE_ONE },
+	};
+	const char* json_path = 0;
+	const char* elf_path = "/proc/self/exe";
+	corpus corpora[6];
+	size_t num_corpora = 0, num_instructions, i, k;
+	nmd_x86_instruction* instructions = (nmd_x86_instruction*)malloc(MAX_FORMATTED_INSTRUCTIONS * sizeof(nmd_x86_instruction));
+
+	for (i = 1; i < (size_t)argc; i++)
+	{
+		if (strcmp(argv[i], "--json") == 0 && i + 1 < (size_t)argc)
+			json_path = argv[++i];
+		else if (strcmp(argv[i], "--elf") == 0 && i + 1 < (size_t)argc)
+			elf_path = argv[++i];
+		else
+		{
+			fprintf(stderr, "usage: %s [--json output.json] [--elf path]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	generate_random_corpus(&corpora[num_corpora++], "random_default", NMD_X86_OPCODE_MAP_DEFAULT);
+	generate_random_corpus(&corpora[num_corpora++], "random_0f", NMD_X86_OPCODE_MAP_0F);
+	generate_random_corpus(&corpora[num_corpora++], "random_0f38", NMD_X86_OPCODE_MAP_0F38);
+	generate_random_corpus(&corpora[num_corpora++], "random_0f3a", NMD_X86_OPCODE_MAP_0F3A);
+	generate_random_corpus(&corpora[num_corpora++], "random_vex", RANDOM_MAP_VEX);
+	if (load_elf_text(&corpora[num_corpora], elf_path))
+		num_corpora++;
+	else
+		fprintf(stderr, "could not load the .text section of '%s', skipping the ELF corpus\n", elf_path);
+
+	for (i = 0; i < num_corpora; i++)
+	{
+		const corpus* const c = &corpora[i];
+
+		for (k = 0; k < sizeof(decoder_variants) / sizeof(decoder_variants[0]); k++)
+			benchmark_decode(c, decoder_variants[k].name, decoder_variants[k].flags);
+
+		benchmark_ldisasm(c);
+		benchmark_ldisasm_bulk(c);
+
+		if (!c->formattable)
+			continue;
+
+		num_instructions = decode_instructions(c, instructions);
+		for (k = 0; k < sizeof(format_variants) / sizeof(format_variants[0]); k++)
+			benchmark_format(c, instructions, num_instructions, format_variants[k].name, format_variants[k].flags);
+
+		benchmark_assemble(c, instructions, num_instructions);
+	}
+
+	benchmark_interpreter();
+
+	if (json_path && !write_json(json_path, corpora, num_corpora))
+	{
+		fprintf(stderr, "could not write '%s'\n", json_path);
+		return 1;
+	}
+
+	for (i = 0; i < num_corpora; i++)
+		free(corpora[i].code);
+	free(instructions);
+	return 0;
+}
@@ -0,0 +1,82 @@
+/* Measures the time and memory used by the control flow graph analyses on a synthetic function with a large number of blocks. The function is a
+chain of blocks with nested loops(conditional branches backwards) and if-then blocks(conditional branches forwards).
+Build: gcc -O2 -std=c89 benchmarks/cfg_benchmark.c -o cfg_benchmark
+Usage: cfg_benchmark [number of blocks]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+#define DEFAULT_NUM_BLOCKS (1024 * 1024)
+
+static void generate(nmd_x86_basic_block* blocks, size_t num_blocks)
+{
+	size_t i;
+	srand(1);
+	for (i = 0; i < num_blocks; i++)
+	{
+		const int r = rand() % 8;
+		blocks[i].successors[0] = i + 1 < num_blocks ? (uint32_t)(i + 1) : NMD_X86_INVALID_BLOCK;
+		blocks[i].successors[1] = NMD_X86_INVALID_BLOCK;
+		if (r == 0 && i >= 64)
+			blocks[i].successors[1] = (uint32_t)(i - 1 - rand() % 64);
+		else if (r == 1 && i + 8 < num_blocks)
+			blocks[i].successors[1] = (uint32_t)(i + 2 + rand() % 6);
+	}
+}
+
+static void report(const char* name, double elapsed, size_t num_blocks)
+{
+	printf("%-16s %8.2f ms %8.2f ns/block\n", name, elapsed * 1e3, elapsed * 1e9 / num_blocks);
+}
+
+int main(int argc, char* argv[])
+{
+	const size_t num_blocks = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : DEFAULT_NUM_BLOCKS;
+	nmd_x86_basic_block* blocks = (nmd_x86_basic_block*)malloc(num_blocks * sizeof(nmd_x86_basic_block));
+	uint32_t* memory = (uint32_t*)malloc(NMD_X86_CFG_MEMORY_SIZE(num_blocks) * sizeof(uint32_t));
+	uint32_t* workspace = (uint32_t*)malloc(NMD_X86_CFG_WORKSPACE_SIZE(num_blocks) * sizeof(uint32_t));
+	uint32_t* idom = (uint32_t*)malloc(num_blocks * sizeof(uint32_t));
+	uint32_t* ipdom = (uint32_t*)malloc(num_blocks * sizeof(uint32_t));
+	uint32_t* loop_header = (uint32_t*)malloc(num_blocks * sizeof(uint32_t));
+	uint32_t* loop_parent = (uint32_t*)malloc(num_blocks * sizeof(uint32_t));
+	nmd_x86_cfg cfg;
+	size_t num_loops = 0;
+	double start;
+
+	if (num_blocks == 0)
+		return 1;
+
+	generate(blocks, num_blocks);
+
+	start = nmd_benchmark_time();
+	nmd_x86_cfg_build(&cfg, blocks, num_blocks, memory);
+	report("build", nmd_benchmark_time() - start, num_blocks);
+
+	start = nmd_benchmark_time();
+	nmd_x86_cfg_dominators(&cfg, 0, idom, workspace);
+	report("dominators", nmd_benchmark_time() - start, num_blocks);
+
+	start = nmd_benchmark_time();
+	nmd_x86_cfg_post_dominators(&cfg, ipdom, workspace);
+	report("post-dominators", nmd_benchmark_time() - start, num_blocks);
+
+	start = nmd_benchmark_time();
+	num_loops = nmd_x86_cfg_loops(&cfg, 0, idom, loop_header, loop_parent, workspace);
+	report("loops", nmd_benchmark_time() - start, num_blocks);
+
+	printf("%u blocks, %u edges, %u loops\n", (unsigned)num_blocks, (unsigned)cfg.num_edges, (unsigned)num_loops);
+	printf("memory: graph %.1f MB, workspace %.1f MB, results %.1f MB(%u bytes per block in total)\n",
+		NMD_X86_CFG_MEMORY_SIZE(num_blocks) * 4 / 1e6, NMD_X86_CFG_WORKSPACE_SIZE(num_blocks) * 4 / 1e6, num_blocks * 16 / 1e6,
+		(unsigned)((NMD_X86_CFG_MEMORY_SIZE(num_blocks) + NMD_X86_CFG_WORKSPACE_SIZE(num_blocks) + num_blocks * 4) * 4 / num_blocks));
+
+	free(loop_parent);
+	free(loop_header);
+	free(ipdom);
+	free(idom);
+	free(workspace);
+	free(memory);
+	free(blocks);
+	return 0;
+}
@@ -0,0 +1,67 @@
+/* Compares the throughput of nmd_x86_decode_buffer() against calling nmd_x86_decode() in a loop.
+Build: gcc -O2 -std=c89 benchmarks/decode_buffer_benchmark.c -o decode_buffer_benchmark
+Usage: decode_buffer_benchmark [raw code file]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+#define NUM_INSTRUCTIONS 4096
+
+static nmd_x86_instruction instructions[NUM_INSTRUCTIONS];
+
+static size_t decode_loop(const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	size_t offset = 0, count = 0;
+	while (offset < corpus_size)
+	{
+		nmd_x86_instruction* const instruction = &instructions[count % NUM_INSTRUCTIONS];
+		if (nmd_x86_decode(corpus + offset, corpus_size - offset, instruction, NMD_X86_MODE_64, flags))
+			offset += instruction->length;
+		else
+			offset++;
+		count++;
+	}
+
+	return count;
+}
+
+static size_t decode_buffer(const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	size_t offset = 0, count = 0, num_bytes;
+	while (offset < corpus_size)
+	{
+		count += nmd_x86_decode_buffer(corpus + offset, corpus_size - offset, instructions, NUM_INSTRUCTIONS, NMD_X86_MODE_64, flags, &num_bytes);
+		offset += num_bytes;
+	}
+
+	return count;
+}
+
+static void run(const char* name, size_t(*function)(const unsigned char*, size_t, uint32_t), const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	size_t i, count = 0;
+	double start, elapsed;
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+		count += function(corpus, corpus_size, flags);
+	elapsed = nmd_benchmark_time() - start;
+
+	printf("%-32s %10.2f M instructions/s %8.2f MB/s\n", name, count / elapsed / 1e6, (double)corpus_size * NMD_BENCHMARK_ITERATIONS / elapsed / 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+	size_t corpus_size;
+	unsigned char* corpus = nmd_benchmark_load_corpus(argc, argv, &corpus_size);
+
+	run("nmd_x86_decode() MINIMAL", decode_loop, corpus, corpus_size, NMD_X86_DECODER_FLAGS_MINIMAL);
+	run("nmd_x86_decode_buffer() MINIMAL", decode_buffer, corpus, corpus_size, NMD_X86_DECODER_FLAGS_MINIMAL);
+	run("nmd_x86_decode() ALL", decode_loop, corpus, corpus_size, NMD_X86_DECODER_FLAGS_ALL);
+	run("nmd_x86_decode_buffer() ALL", decode_buffer, corpus, corpus_size, NMD_X86_DECODER_FLAGS_ALL);
+
+	free(corpus);
+	return 0;
+}
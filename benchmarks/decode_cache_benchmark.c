@@ -0,0 +1,98 @@
+/* Compares nmd_x86_decode() against nmd_x86_decode_cached() with several capacities on a trace that resembles single-stepping: most steps
+execute a few hot loops of consecutive instructions many times, the rest run through random cold code. Every step decodes with all features.
+Build: gcc -O2 -std=c89 benchmarks/decode_cache_benchmark.c -o decode_cache_benchmark
+Usage: decode_cache_benchmark [raw code file]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+#define TRACE_LENGTH (1024 * 1024)
+#define NUM_HOT_LOOPS 512
+#define RUNTIME_ADDRESS 0x400000
+
+/* Builds a trace of instruction offsets. Returns its length. */
+static size_t build_trace(const unsigned char* corpus, size_t corpus_size, uint32_t* trace)
+{
+	size_t num_offsets = 0, offset = 0, length = 0, i, k, hot[NUM_HOT_LOOPS];
+	uint32_t* offsets = (uint32_t*)malloc(corpus_size * sizeof(uint32_t));
+
+	while (offset < corpus_size)
+	{
+		offsets[num_offsets++] = (uint32_t)offset;
+		length = nmd_x86_ldisasm(corpus + offset, corpus_size - offset, NMD_X86_MODE_64);
+		offset += length ? length : 1;
+	}
+
+	length = 0;
+	srand(1);
+	for (i = 0; i < NUM_HOT_LOOPS; i++)
+		hot[i] = ((size_t)rand() * RAND_MAX + rand()) % num_offsets;
+
+	while (length < TRACE_LENGTH)
+	{
+		/* 90% of the loops are hot. A loop body has 4 to 32 instructions and runs 1 to 64 times. */
+		const size_t first = rand() % 10 ? hot[rand() % NUM_HOT_LOOPS] : ((size_t)rand() * RAND_MAX + rand()) % num_offsets;
+		const size_t body = 4 + rand() % 29, iterations = 1 + rand() % 64;
+		for (i = 0; i < iterations; i++)
+		{
+			for (k = first; k < first + body && k < num_offsets && length < TRACE_LENGTH; k++)
+				trace[length++] = offsets[k];
+		}
+	}
+
+	free(offsets);
+	return length;
+}
+
+int main(int argc, char* argv[])
+{
+	const size_t capacities[] = { 1024, 4096, 16384, 65536 };
+	size_t corpus_size, trace_length, i, c, expected_checksum = 0, checksum;
+	unsigned char* corpus = nmd_benchmark_load_corpus(argc, argv, &corpus_size);
+	uint32_t* trace = (uint32_t*)malloc(TRACE_LENGTH * sizeof(uint32_t));
+	nmd_x86_decode_cache_entry* entries = (nmd_x86_decode_cache_entry*)malloc(capacities[3] * sizeof(nmd_x86_decode_cache_entry));
+	nmd_x86_decode_cache cache;
+	nmd_x86_instruction instruction;
+	double start, elapsed, uncached_elapsed;
+
+	trace_length = build_trace(corpus, corpus_size, trace);
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < trace_length; i++)
+	{
+		if (nmd_x86_decode(corpus + trace[i], corpus_size - trace[i], &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL))
+			expected_checksum += instruction.id + instruction.length + instruction.num_operands;
+	}
+	uncached_elapsed = nmd_benchmark_time() - start;
+	printf("%-14s %8.2f M decodes/s\n", "uncached", trace_length / uncached_elapsed / 1e6);
+
+	for (c = 0; c < 4; c++)
+	{
+		nmd_x86_decode_cache_init(&cache, entries, capacities[c]);
+		checksum = 0;
+
+		start = nmd_benchmark_time();
+		for (i = 0; i < trace_length; i++)
+		{
+			if (nmd_x86_decode_cached(&cache, corpus + trace[i], corpus_size - trace[i], RUNTIME_ADDRESS + trace[i], &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL))
+				checksum += instruction.id + instruction.length + instruction.num_operands;
+		}
+		elapsed = nmd_benchmark_time() - start;
+
+		if (checksum != expected_checksum)
+		{
+			printf("capacity %u: the cached results do not match\n", (unsigned)capacities[c]);
+			return 1;
+		}
+
+		printf("capacity %-5u %8.2f M decodes/s %6.2fx  hit rate %5.1f%%  %u evictions\n", (unsigned)capacities[c], trace_length / elapsed / 1e6,
+			uncached_elapsed / elapsed, 100.0 * cache.hits / (cache.hits + cache.misses), (unsigned)cache.evictions);
+	}
+
+	free(entries);
+	free(trace);
+	free(corpus);
+	return 0;
+}
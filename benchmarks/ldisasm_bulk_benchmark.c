@@ -0,0 +1,68 @@
+/* Compares the throughput of nmd_x86_ldisasm_bulk() against a linear sweep that calls nmd_x86_ldisasm() in a loop, and checks that both produce the same bitmap.
+Build: gcc -O2 -std=c89 benchmarks/ldisasm_bulk_benchmark.c -o ldisasm_bulk_benchmark
+       (add '-mavx2' to use AVX2 instead of SSE2, or '-DNMD_ASSEMBLY_DISABLE_LENGTH_DISASSEMBLER_SIMD' for the scalar implementation)
+Usage: ldisasm_bulk_benchmark [raw code file]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+static size_t ldisasm_loop(const unsigned char* corpus, size_t corpus_size, uint32_t* bitmap)
+{
+	size_t offset = 0, count = 0, length;
+
+	memset(bitmap, 0, (corpus_size + 31) / 32 * sizeof(uint32_t));
+	while (offset < corpus_size)
+	{
+		bitmap[offset / 32] |= (uint32_t)1 << (offset % 32);
+		length = nmd_x86_ldisasm(corpus + offset, corpus_size - offset, NMD_X86_MODE_64);
+		offset += length ? length : 1;
+		count++;
+	}
+
+	return count;
+}
+
+static size_t ldisasm_bulk(const unsigned char* corpus, size_t corpus_size, uint32_t* bitmap)
+{
+	return nmd_x86_ldisasm_bulk(corpus, corpus_size, NMD_X86_MODE_64, bitmap);
+}
+
+static void run(const char* name, size_t(*function)(const unsigned char*, size_t, uint32_t*), const unsigned char* corpus, size_t corpus_size, uint32_t* bitmap)
+{
+	size_t i, count = 0;
+	double start, elapsed;
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+		count += function(corpus, corpus_size, bitmap);
+	elapsed = nmd_benchmark_time() - start;
+
+	printf("%-24s %10.2f M instructions/s %8.2f MB/s\n", name, count / elapsed / 1e6, (double)corpus_size * NMD_BENCHMARK_ITERATIONS / elapsed / 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+	size_t corpus_size, bitmap_size;
+	unsigned char* corpus = nmd_benchmark_load_corpus(argc, argv, &corpus_size);
+	uint32_t* bitmap, *expected_bitmap;
+
+	bitmap_size = (corpus_size + 31) / 32 * sizeof(uint32_t);
+	bitmap = (uint32_t*)malloc(bitmap_size);
+	expected_bitmap = (uint32_t*)malloc(bitmap_size);
+
+	if (ldisasm_loop(corpus, corpus_size, expected_bitmap) != ldisasm_bulk(corpus, corpus_size, bitmap) || memcmp(bitmap, expected_bitmap, bitmap_size) != 0)
+	{
+		printf("nmd_x86_ldisasm_bulk() does not match nmd_x86_ldisasm()\n");
+		return 1;
+	}
+
+	run("nmd_x86_ldisasm() loop", ldisasm_loop, corpus, corpus_size, bitmap);
+	run("nmd_x86_ldisasm_bulk()", ldisasm_bulk, corpus, corpus_size, bitmap);
+
+	free(expected_bitmap);
+	free(bitmap);
+	free(corpus);
+	return 0;
+}
@@ -0,0 +1,153 @@
+/* Helpers shared by the benchmarks in this folder. Benchmarks are regular applications, so unlike
+the libraries they use libc freely.
+
+A benchmark decodes a corpus of x86-64 code. By default the built-in corpus below(compiler
+generated code) is repeated until it fills 'NMD_BENCHMARK_CORPUS_SIZE' bytes. You may pass the
+path of a file containing raw machine code(e.g. a .text section dumped with
+'objcopy -O binary -j .text') as the first command line argument to use it instead.
+*/
+
+#ifndef NMD_BENCHMARK_H
+#define NMD_BENCHMARK_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* The helpers below are static and not every benchmark uses all of them. */
+#if defined(__GNUC__) || defined(__clang__)
+	#define NMD_BENCHMARK_UNUSED __attribute__((unused))
+#else
+	#define NMD_BENCHMARK_UNUSED
+#endif
+
+#ifndef NMD_BENCHMARK_CORPUS_SIZE
+#define NMD_BENCHMARK_CORPUS_SIZE (4 * 1024 * 1024)
+#endif /* NMD_BENCHMARK_CORPUS_SIZE */
+
+/* The corpus is followed by this many zero bytes, so it can be decoded with the padded decoder functions. */
+#define NMD_BENCHMARK_PADDING 15
+
+#ifndef NMD_BENCHMARK_ITERATIONS
+#define NMD_BENCHMARK_ITERATIONS 10
+#endif /* NMD_BENCHMARK_ITERATIONS */
+
+static const unsigned char nmd_benchmark_builtin_corpus[] = {
+	0x53, 0x48, 0x8b, 0x07, 0x48, 0x89, 0xfb, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x17, 0xc6, 0x00,
+	0x5b, 0x48, 0x8b, 0x57, 0x08, 0xf6, 0x02, 0x04, 0x0f, 0x84, 0x12, 0x02, 0x00, 0x00, 0x0f, 0xb6,
+	0x8a, 0x11, 0x01, 0x00, 0x00, 0x89, 0xc8, 0x83, 0xe0, 0x07, 0x3c, 0x05, 0x0f, 0x84, 0xb6, 0x02,
+	0x00, 0x00, 0x80, 0x7a, 0x01, 0x08, 0x48, 0x8d, 0x35, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x2d,
+	0x04, 0x00, 0x00, 0x0f, 0xb6, 0x82, 0x11, 0x01, 0x00, 0x00, 0x83, 0xe0, 0x07, 0x48, 0x8b, 0x04,
+	0xc6, 0x80, 0x38, 0x00, 0x74, 0x2e, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x13, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x8d, 0x4a, 0x01, 0x48, 0x89, 0x0b, 0x0f, 0xb6,
+	0x48, 0xff, 0x88, 0x0a, 0x80, 0x38, 0x00, 0x75, 0xe7, 0x48, 0x8b, 0x53, 0x08, 0x0f, 0xb6, 0x8a,
+	0x11, 0x01, 0x00, 0x00, 0x83, 0xe1, 0x38, 0x80, 0xf9, 0x20, 0x0f, 0x84, 0xf0, 0x02, 0x00, 0x00,
+	0x0f, 0xb7, 0x82, 0x10, 0x01, 0x00, 0x00, 0x66, 0x25, 0xc0, 0x07, 0x66, 0x3d, 0x00, 0x05, 0x74,
+	0x11, 0x48, 0x8b, 0x03, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x13, 0xc6, 0x00, 0x2b, 0x48, 0x8b,
+	0x53, 0x08, 0x80, 0x7a, 0x01, 0x08, 0x48, 0x8d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x2d,
+	0x04, 0x00, 0x00, 0x0f, 0xb6, 0x82, 0x11, 0x01, 0x00, 0x00, 0xc0, 0xe8, 0x03, 0x83, 0xe0, 0x07,
+	0x48, 0x8b, 0x04, 0xc1, 0x80, 0x38, 0x00, 0x74, 0x24, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x13, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x8d, 0x4a, 0x01, 0x48, 0x89, 0x0b, 0x0f, 0xb6,
+	0x48, 0xff, 0x88, 0x0a, 0x80, 0x38, 0x00, 0x75, 0xe7, 0x48, 0x8b, 0x53, 0x08, 0x80, 0xba, 0x11,
+	0x01, 0x00, 0x00, 0x3f, 0x0f, 0x86, 0x26, 0x02, 0x00, 0x00, 0x48, 0x8b, 0x03, 0x48, 0x8d, 0x50,
+	0x01, 0x48, 0x89, 0x13, 0xc6, 0x00, 0x2a, 0x48, 0x8b, 0x43, 0x08, 0x48, 0x8b, 0x13, 0x0f, 0xb6,
+	0x88, 0x11, 0x01, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xc0, 0xe9, 0x06, 0xd3, 0xe0, 0x48,
+	0x8d, 0x4a, 0x01, 0x83, 0xc0, 0x30, 0x48, 0x89, 0x0b, 0x88, 0x02, 0x48, 0x8b, 0x53, 0x08, 0xf6,
+	0x42, 0x09, 0x20, 0x74, 0x12, 0x0f, 0xb6, 0x82, 0x11, 0x01, 0x00, 0x00, 0x83, 0xe0, 0x38, 0x3c,
+	0x20, 0x0f, 0x84, 0x33, 0x02, 0x00, 0x00, 0x0f, 0xb6, 0x82, 0x13, 0x01, 0x00, 0x00, 0x84, 0xc0,
+	0x0f, 0x84, 0x4e, 0x01, 0x00, 0x00, 0x8b, 0xb2, 0x20, 0x01, 0x00, 0x00, 0x85, 0xf6, 0x0f, 0x84,
+	0x54, 0x01, 0x00, 0x00, 0x0f, 0xb6, 0x8a, 0x10, 0x01, 0x00, 0x00, 0x89, 0xcf, 0x83, 0xe7, 0x07,
+	0x40, 0x80, 0xff, 0x05, 0x0f, 0x84, 0x9e, 0x02, 0x00, 0x00, 0x4c, 0x8b, 0x03, 0x45, 0x0f, 0xb6,
+	0x48, 0xff, 0x4c, 0x89, 0xc7, 0x80, 0xf9, 0x3f, 0x77, 0x13, 0x0f, 0xb6, 0x8a, 0x11, 0x01, 0x00,
+	0x00, 0x83, 0xe1, 0x3f, 0x80, 0xf9, 0x25, 0x0f, 0x84, 0xa3, 0x03, 0x00, 0x00, 0x0f, 0xb6, 0xd0,
+	0x4c, 0x89, 0xc7, 0x8d, 0x0c, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xba, 0x01, 0x00, 0x00, 0x00, 0xd3,
+	0xe2, 0x21, 0xf2, 0x41, 0x80, 0x78, 0xff, 0x5b, 0x0f, 0x84, 0x9a, 0x01, 0x00, 0x00, 0x48, 0x8d,
+	0x47, 0x01, 0x48, 0x89, 0x03, 0x85, 0xd2, 0x0f, 0x84, 0x43, 0x03, 0x00, 0x00, 0xc6, 0x07, 0x2d,
+	0x48, 0x8b, 0x53, 0x08, 0x0f, 0xb6, 0x82, 0x13, 0x01, 0x00, 0x00, 0x8b, 0xb2, 0x20, 0x01, 0x00,
+	0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0x3c, 0x04, 0x74, 0x11, 0x8d, 0x0c, 0xc5, 0x00, 0x00, 0x00,
+	0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0xd3, 0xe2, 0x83, 0xea, 0x01, 0xf7, 0xd6, 0x48, 0x89, 0xdf,
+	0x21, 0xd6, 0x48, 0x83, 0xc6, 0x01, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x0b, 0x48, 0x8d,
+	0x41, 0x01, 0x48, 0x89, 0x03, 0xc6, 0x01, 0x5d, 0x5b, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+	0x0f, 0xb6, 0x82, 0x10, 0x01, 0x00, 0x00, 0x89, 0xc1, 0x83, 0xe1, 0xc7, 0x80, 0xf9, 0x05, 0x0f,
+	0x84, 0x12, 0xff, 0xff, 0xff, 0x0f, 0xb7, 0x4a, 0x08, 0x83, 0xe0, 0x07, 0x0f, 0xb6, 0x7a, 0x01,
+	0x89, 0xce, 0x66, 0x81, 0xe6, 0x80, 0x40, 0x66, 0x81, 0xfe, 0x80, 0x40, 0x48, 0x8d, 0x35, 0x00,
+	0x00, 0x00, 0x00, 0x0f, 0x84, 0x37, 0x02, 0x00, 0x00, 0x40, 0x80, 0xff, 0x08, 0x0f, 0x84, 0xcd,
+	0x00, 0x00, 0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x8b, 0x04, 0xc6, 0x80, 0x38, 0x00, 0x0f, 0x84, 0xd4,
+	0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x13, 0x48, 0x83, 0xc0, 0x01, 0x48,
+	0x8d, 0x4a, 0x01, 0x48, 0x89, 0x0b, 0x0f, 0xb6, 0x48, 0xff, 0x88, 0x0a, 0x80, 0x38, 0x00, 0x75,
+	0xe7, 0x48, 0x8b, 0x53, 0x08, 0x0f, 0xb6, 0x82, 0x13, 0x01, 0x00, 0x00, 0x84, 0xc0, 0x0f, 0x85,
+	0xb2, 0xfe, 0xff, 0xff, 0x48, 0x8b, 0x0b, 0x48, 0x8d, 0x41, 0x01, 0x48, 0x89, 0x03, 0xc6, 0x01,
+	0x5d, 0x5b, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x8b, 0x0b, 0x80, 0x79, 0xff, 0x5b, 0x0f,
+	0x84, 0x9f, 0xfe, 0xff, 0xff, 0x48, 0x8d, 0x41, 0x01, 0x48, 0x89, 0x03, 0xc6, 0x01, 0x5d, 0x5b,
+	0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xba, 0x10, 0x01, 0x00, 0x00, 0x3f, 0x0f,
+	0x86, 0x8f, 0xfd, 0xff, 0xff, 0x80, 0x7a, 0x01, 0x08, 0xb9, 0x65, 0x00, 0x00, 0x00, 0x48, 0x8d,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x1d, 0x03, 0x00, 0x00, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+	0x48, 0x8b, 0x13, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x8d, 0x72, 0x01, 0x48, 0x89, 0x33, 0x88, 0x0a,
+	0x0f, 0xb6, 0x08, 0x84, 0xc9, 0x75, 0xe9, 0xe9, 0x4d, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00,
+	0xf6, 0x43, 0x19, 0x20, 0x0f, 0x84, 0x05, 0xfe, 0xff, 0xff, 0xe9, 0xcb, 0xfd, 0xff, 0xff, 0x90,
+	0xf6, 0xc1, 0x80, 0x0f, 0x85, 0x2a, 0xff, 0xff, 0xff, 0x80, 0xe5, 0x40, 0x48, 0x8d, 0x35, 0x00,
+	0x00, 0x00, 0x00, 0x48, 0x8d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x48, 0x0f, 0x45, 0xf1, 0xe9, 0x10,
+	0xff, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x85, 0xd2, 0x0f, 0x85, 0x81, 0xfe, 0xff, 0xff,
+	0x48, 0x89, 0xdf, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x37, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x00,
+	0xf6, 0x42, 0x09, 0x20, 0x0f, 0x84, 0xcd, 0xfd, 0xff, 0xff, 0x48, 0x8b, 0x03, 0x80, 0x78, 0xff,
+	0x5b, 0x74, 0x0d, 0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x13, 0xc6, 0x00, 0x2b, 0x48, 0x8b, 0x03,
+	0x48, 0x8d, 0x50, 0x01, 0x48, 0x89, 0x13, 0xba, 0x31, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x72, 0x48,
+	0x8d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x48, 0x8b, 0x0b, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x8d, 0x71, 0x01, 0x48, 0x89, 0x33, 0x88, 0x11,
+	0x0f, 0xb6, 0x10, 0x84, 0xd2, 0x75, 0xe9, 0x48, 0x8b, 0x53, 0x08, 0x80, 0xba, 0x11, 0x01, 0x00,
+	0x00, 0x3f, 0x0f, 0x86, 0x50, 0x01, 0x00, 0x00, 0x48, 0x8b, 0x03, 0x48, 0x8d, 0x50, 0x01, 0x48,
+	0x89, 0x13, 0xc6, 0x00, 0x2a, 0x48, 0x8b, 0x43, 0x08, 0x48, 0x8b, 0x13, 0x0f, 0xb6, 0x88, 0x11,
+};
+
+/* Loads the corpus. Returns a buffer allocated with malloc() and stores its size(excluding the padding) in 'size'. */
+NMD_BENCHMARK_UNUSED static unsigned char* nmd_benchmark_load_corpus(int argc, char* argv[], size_t* size)
+{
+	unsigned char* corpus;
+	size_t i;
+
+	if (argc > 1)
+	{
+		FILE* file = fopen(argv[1], "rb");
+		long file_size;
+		if (!file)
+		{
+			fprintf(stderr, "could not open '%s'\n", argv[1]);
+			exit(1);
+		}
+
+		fseek(file, 0, SEEK_END);
+		file_size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		if (file_size <= 0 || !(corpus = (unsigned char*)calloc((size_t)file_size + NMD_BENCHMARK_PADDING, 1)) || fread(corpus, 1, (size_t)file_size, file) != (size_t)file_size)
+		{
+			fprintf(stderr, "could not read '%s'\n", argv[1]);
+			exit(1);
+		}
+
+		fclose(file);
+		*size = (size_t)file_size;
+		return corpus;
+	}
+
+	if (!(corpus = (unsigned char*)calloc(NMD_BENCHMARK_CORPUS_SIZE + NMD_BENCHMARK_PADDING, 1)))
+	{
+		fprintf(stderr, "out of memory\n");
+		exit(1);
+	}
+
+	for (i = 0; i < NMD_BENCHMARK_CORPUS_SIZE; i++)
+		corpus[i] = nmd_benchmark_builtin_corpus[i % sizeof(nmd_benchmark_builtin_corpus)];
+
+	*size = NMD_BENCHMARK_CORPUS_SIZE;
+	return corpus;
+}
+
+/* Returns the processor time in seconds. */
+NMD_BENCHMARK_UNUSED static double nmd_benchmark_time(void)
+{
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+#endif /* NMD_BENCHMARK_H */
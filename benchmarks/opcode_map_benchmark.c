@@ -0,0 +1,101 @@
+/* Measures the decoder's throughput for each opcode map.
+Build: gcc -O2 -std=c89 benchmarks/opcode_map_benchmark.c -o opcode_map_benchmark
+Usage: opcode_map_benchmark
+
+For every opcode map a corpus is built from all valid encodings of the form [66h] [0F [38h|3Ah]] opcode [ModR/M],
+which is then decoded repeatedly.
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+/* Builds a corpus for 'opcode_map' in 'corpus'. Returns the corpus' size in bytes. */
+static size_t build_corpus(unsigned char* corpus, size_t corpus_size, uint8_t opcode_map)
+{
+	nmd_x86_instruction instruction;
+	size_t size = 0, previous_size = (size_t)-1;
+	int prefix, op, modrm;
+
+	while (size != previous_size)
+	{
+		previous_size = size;
+		for (prefix = 0; prefix < 2; prefix++)
+		{
+			for (op = 0; op < 256; op++)
+			{
+				for (modrm = 0; modrm < 256; modrm += 7)
+				{
+					unsigned char buffer[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH] = { 0 };
+					size_t length = 0;
+
+					if (prefix)
+						buffer[length++] = 0x66;
+					if (opcode_map != NMD_X86_OPCODE_MAP_DEFAULT)
+						buffer[length++] = 0x0f;
+					if (opcode_map == NMD_X86_OPCODE_MAP_0F38)
+						buffer[length++] = 0x38;
+					else if (opcode_map == NMD_X86_OPCODE_MAP_0F3A)
+						buffer[length++] = 0x3a;
+					buffer[length++] = (unsigned char)op;
+					buffer[length++] = (unsigned char)modrm;
+
+					if (!nmd_x86_decode(buffer, sizeof(buffer), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL) || instruction.opcode_map != opcode_map || size + instruction.length > corpus_size)
+						continue;
+
+					memcpy(corpus + size, instruction.buffer, instruction.length);
+					size += instruction.length;
+
+					if (!instruction.has_modrm)
+						break;
+				}
+			}
+		}
+	}
+
+	return size;
+}
+
+static void run(const char* name, const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	nmd_x86_instruction instruction;
+	size_t i, offset, count = 0;
+	double start, elapsed;
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+	{
+		for (offset = 0; offset < corpus_size; count++)
+			offset += nmd_x86_decode(corpus + offset, corpus_size - offset, &instruction, NMD_X86_MODE_64, flags) ? instruction.length : 1;
+	}
+	elapsed = nmd_benchmark_time() - start;
+
+	printf("%-16s %10.2f M instructions/s\n", name, count / elapsed / 1e6);
+}
+
+int main(void)
+{
+	static const struct { const char* name; uint8_t opcode_map; } maps[] = {
+		{ "default", NMD_X86_OPCODE_MAP_DEFAULT },
+		{ "0F", NMD_X86_OPCODE_MAP_0F },
+		{ "0F38", NMD_X86_OPCODE_MAP_0F38 },
+		{ "0F3A", NMD_X86_OPCODE_MAP_0F3A },
+	};
+	unsigned char* corpus = (unsigned char*)malloc(NMD_BENCHMARK_CORPUS_SIZE);
+	char name[32];
+	size_t i;
+
+	for (i = 0; i < sizeof(maps) / sizeof(maps[0]); i++)
+	{
+		const size_t corpus_size = build_corpus(corpus, NMD_BENCHMARK_CORPUS_SIZE, maps[i].opcode_map);
+
+		sprintf(name, "%s MINIMAL", maps[i].name);
+		run(name, corpus, corpus_size, NMD_X86_DECODER_FLAGS_MINIMAL);
+
+		sprintf(name, "%s ALL", maps[i].name);
+		run(name, corpus, corpus_size, NMD_X86_DECODER_FLAGS_ALL);
+	}
+
+	free(corpus);
+	return 0;
+}
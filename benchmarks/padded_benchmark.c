@@ -0,0 +1,77 @@
+/* Compares the throughput of nmd_x86_decode_padded() and nmd_x86_ldisasm_padded() against their bounds checked counterparts.
+Build: gcc -O2 -std=c89 benchmarks/padded_benchmark.c -o padded_benchmark
+Usage: padded_benchmark [raw code file]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+static size_t decode(const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += nmd_x86_decode(corpus + offset, corpus_size - offset, &instruction, NMD_X86_MODE_64, flags) ? instruction.length : 1;
+
+	return count;
+}
+
+static size_t decode_padded(const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += nmd_x86_decode_padded(corpus + offset, &instruction, NMD_X86_MODE_64, flags) ? instruction.length : 1;
+
+	return count;
+}
+
+static size_t ldisasm(const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	size_t offset = 0, count = 0, length;
+	(void)flags;
+	for (; offset < corpus_size; count++)
+		offset += (length = nmd_x86_ldisasm(corpus + offset, corpus_size - offset, NMD_X86_MODE_64)) ? length : 1;
+
+	return count;
+}
+
+static size_t ldisasm_padded(const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	size_t offset = 0, count = 0, length;
+	(void)flags;
+	for (; offset < corpus_size; count++)
+		offset += (length = nmd_x86_ldisasm_padded(corpus + offset, NMD_X86_MODE_64)) ? length : 1;
+
+	return count;
+}
+
+static void run(const char* name, size_t(*function)(const unsigned char*, size_t, uint32_t), const unsigned char* corpus, size_t corpus_size, uint32_t flags)
+{
+	size_t i, count = 0;
+	double start, elapsed;
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+		count += function(corpus, corpus_size, flags);
+	elapsed = nmd_benchmark_time() - start;
+
+	printf("%-32s %10.2f M instructions/s %8.2f MB/s\n", name, count / elapsed / 1e6, (double)corpus_size * NMD_BENCHMARK_ITERATIONS / elapsed / 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+	size_t corpus_size;
+	unsigned char* corpus = nmd_benchmark_load_corpus(argc, argv, &corpus_size);
+
+	run("nmd_x86_decode() MINIMAL", decode, corpus, corpus_size, NMD_X86_DECODER_FLAGS_MINIMAL);
+	run("nmd_x86_decode_padded() MINIMAL", decode_padded, corpus, corpus_size, NMD_X86_DECODER_FLAGS_MINIMAL);
+	run("nmd_x86_decode() ALL", decode, corpus, corpus_size, NMD_X86_DECODER_FLAGS_ALL);
+	run("nmd_x86_decode_padded() ALL", decode_padded, corpus, corpus_size, NMD_X86_DECODER_FLAGS_ALL);
+	run("nmd_x86_ldisasm()", ldisasm, corpus, corpus_size, 0);
+	run("nmd_x86_ldisasm_padded()", ldisasm_padded, corpus, corpus_size, 0);
+
+	free(corpus);
+	return 0;
+}
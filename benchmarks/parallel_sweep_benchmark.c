@@ -0,0 +1,126 @@
+/* Measures how a parallel linear sweep(nmd_x86_sweep_split(), nmd_x86_sweep_decode_chunk() and nmd_x86_sweep_merge()) scales with the number of
+threads, and checks that its bitmap is identical to the one of a sequential sweep.
+Build: gcc -O2 -std=c89 benchmarks/parallel_sweep_benchmark.c -o parallel_sweep_benchmark -lpthread
+Usage: parallel_sweep_benchmark [raw code file]
+*/
+
+/* clock_gettime() */
+#define _POSIX_C_SOURCE 199309L
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+#include <pthread.h>
+
+#define MAX_THREADS 64
+
+typedef struct worker
+{
+	pthread_t thread;
+	const unsigned char* corpus;
+	size_t corpus_size;
+	nmd_x86_sweep_chunk* chunk;
+	uint32_t* bitmap;
+} worker;
+
+static void* worker_main(void* argument)
+{
+	worker* const w = (worker*)argument;
+	nmd_x86_sweep_decode_chunk(w->corpus, w->corpus_size, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL, w->chunk, w->bitmap);
+	return NULL;
+}
+
+/* clock() measures processor time of all threads, so wall-clock time is used instead. */
+static double wall_time(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t parallel_sweep(const unsigned char* corpus, size_t corpus_size, uint32_t* bitmap, size_t num_threads, size_t* num_repaired)
+{
+	nmd_x86_sweep_chunk chunks[MAX_THREADS];
+	worker workers[MAX_THREADS];
+	size_t i, num_chunks, count;
+
+	num_chunks = nmd_x86_sweep_split(corpus_size, chunks, num_threads);
+	for (i = 0; i < num_chunks; i++)
+	{
+		workers[i].corpus = corpus;
+		workers[i].corpus_size = corpus_size;
+		workers[i].chunk = &chunks[i];
+		workers[i].bitmap = bitmap;
+		pthread_create(&workers[i].thread, NULL, worker_main, &workers[i]);
+	}
+	for (i = 0; i < num_chunks; i++)
+		pthread_join(workers[i].thread, NULL);
+
+	count = nmd_x86_sweep_merge(corpus, corpus_size, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL, chunks, num_chunks, bitmap);
+
+	/* A chunk needed repairs if its speculative sweep didn't start at the real entry point */
+	*num_repaired = 0;
+	for (i = 1; i < num_chunks; i++)
+	{
+		if (chunks[i].start != chunks[i - 1].next)
+			(*num_repaired)++;
+	}
+
+	return count;
+}
+
+static size_t sequential_sweep(const unsigned char* corpus, size_t corpus_size, uint32_t* bitmap)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+
+	memset(bitmap, 0, (corpus_size + 31) / 32 * sizeof(uint32_t));
+	while (offset < corpus_size)
+	{
+		bitmap[offset / 32] |= (uint32_t)1 << (offset % 32);
+		offset += nmd_x86_decode(corpus + offset, corpus_size - offset, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL) ? instruction.length : 1;
+		count++;
+	}
+
+	return count;
+}
+
+int main(int argc, char* argv[])
+{
+	size_t corpus_size, bitmap_size, num_threads, expected_count, count = 0, num_repaired = 0, i;
+	unsigned char* corpus = nmd_benchmark_load_corpus(argc, argv, &corpus_size);
+	uint32_t* bitmap, *expected_bitmap;
+	double start, elapsed, sequential_elapsed;
+
+	bitmap_size = (corpus_size + 31) / 32 * sizeof(uint32_t);
+	bitmap = (uint32_t*)malloc(bitmap_size);
+	expected_bitmap = (uint32_t*)malloc(bitmap_size);
+
+	start = wall_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+		expected_count = sequential_sweep(corpus, corpus_size, expected_bitmap);
+	sequential_elapsed = wall_time() - start;
+	printf("%-12s %8.2f MB/s\n", "sequential", (double)corpus_size * NMD_BENCHMARK_ITERATIONS / sequential_elapsed / 1e6);
+
+	for (num_threads = 1; num_threads <= MAX_THREADS; num_threads *= 2)
+	{
+		start = wall_time();
+		for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+			count = parallel_sweep(corpus, corpus_size, bitmap, num_threads, &num_repaired);
+		elapsed = wall_time() - start;
+
+		if (count != expected_count || memcmp(bitmap, expected_bitmap, bitmap_size) != 0)
+		{
+			printf("%u threads: the parallel sweep does not match the sequential sweep\n", (unsigned)num_threads);
+			return 1;
+		}
+
+		printf("%2u threads   %8.2f MB/s %6.2fx  (%u chunks repaired)\n", (unsigned)num_threads, (double)corpus_size * NMD_BENCHMARK_ITERATIONS / elapsed / 1e6, sequential_elapsed / elapsed, (unsigned)num_repaired);
+	}
+
+	free(expected_bitmap);
+	free(bitmap);
+	free(corpus);
+	return 0;
+}
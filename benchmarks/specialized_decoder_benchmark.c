@@ -0,0 +1,90 @@
+/* Compares the throughput of decoders specialized with NMD_X86_DEFINE_DECODER() against the generic nmd_x86_decode().
+Build: gcc -O2 -std=c89 benchmarks/specialized_decoder_benchmark.c -o specialized_decoder_benchmark
+Usage: specialized_decoder_benchmark [raw code file]
+*/
+
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include "nmd_benchmark.h"
+
+NMD_X86_DEFINE_DECODER(decode64_minimal, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL)
+NMD_X86_DEFINE_DECODER(decode64_all, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)
+NMD_X86_DEFINE_DECODER_PADDED(decode64_padded_minimal, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL)
+
+static size_t generic_minimal(const unsigned char* corpus, size_t corpus_size)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += nmd_x86_decode(corpus + offset, corpus_size - offset, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL) ? instruction.length : 1;
+
+	return count;
+}
+
+static size_t generic_all(const unsigned char* corpus, size_t corpus_size)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += nmd_x86_decode(corpus + offset, corpus_size - offset, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL) ? instruction.length : 1;
+
+	return count;
+}
+
+static size_t specialized_minimal(const unsigned char* corpus, size_t corpus_size)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += decode64_minimal(corpus + offset, corpus_size - offset, &instruction) ? instruction.length : 1;
+
+	return count;
+}
+
+static size_t specialized_all(const unsigned char* corpus, size_t corpus_size)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += decode64_all(corpus + offset, corpus_size - offset, &instruction) ? instruction.length : 1;
+
+	return count;
+}
+
+static size_t specialized_padded_minimal(const unsigned char* corpus, size_t corpus_size)
+{
+	nmd_x86_instruction instruction;
+	size_t offset = 0, count = 0;
+	for (; offset < corpus_size; count++)
+		offset += decode64_padded_minimal(corpus + offset, &instruction) ? instruction.length : 1;
+
+	return count;
+}
+
+static void run(const char* name, size_t(*function)(const unsigned char*, size_t), const unsigned char* corpus, size_t corpus_size)
+{
+	size_t i, count = 0;
+	double start, elapsed;
+
+	start = nmd_benchmark_time();
+	for (i = 0; i < NMD_BENCHMARK_ITERATIONS; i++)
+		count += function(corpus, corpus_size);
+	elapsed = nmd_benchmark_time() - start;
+
+	printf("%-32s %10.2f M instructions/s %8.2f MB/s\n", name, count / elapsed / 1e6, (double)corpus_size * NMD_BENCHMARK_ITERATIONS / elapsed / 1e6);
+}
+
+int main(int argc, char* argv[])
+{
+	size_t corpus_size;
+	unsigned char* corpus = nmd_benchmark_load_corpus(argc, argv, &corpus_size);
+
+	run("nmd_x86_decode() MINIMAL", generic_minimal, corpus, corpus_size);
+	run("specialized MINIMAL", specialized_minimal, corpus, corpus_size);
+	run("specialized padded MINIMAL", specialized_padded_minimal, corpus, corpus_size);
+	run("nmd_x86_decode() ALL", generic_all, corpus, corpus_size);
+	run("specialized ALL", specialized_all, corpus, corpus_size);
+
+	free(corpus);
+	return 0;
+}
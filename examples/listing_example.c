@@ -0,0 +1,140 @@
+/* Prints the disassembly of every executable section of an x86 or x86-64 ELF or PE file. The file is mapped read-only and decoded in place,
+so no part of it is copied to the heap and the peak resident set stays close to the size of the file. In PE files, memory operands that
+refer to an import address table slot(e.g. 'call [rip+x]') are annotated with the name of the imported function.
+Build: gcc -O2 -std=c89 examples/listing_example.c -o listing_example
+Usage: listing_example <elf or pe file>
+*/
+
+#define _POSIX_C_SOURCE 200112L
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define MAX_SECTIONS 64
+
+/* Returns the import whose address table slot is read by the instruction's ModR/M memory operand(e.g. 'call [rip+x]'), or null. */
+static const nmd_x86_pe_symbol* find_import(const nmd_x86_pe* pe, const nmd_x86_pe_symbol* imports, size_t num_imports, const nmd_x86_instruction* instruction, uint64_t address)
+{
+	uint64_t target;
+
+	/* Only '[disp32]' is considered: RIP-relative in 64-bit mode, an absolute address in 32-bit mode. */
+	if (!instruction->has_modrm || instruction->has_sib || instruction->modrm.fields.mod != 0b00 || instruction->modrm.fields.rm != 0b101)
+		return 0;
+
+	if (instruction->mode == NMD_X86_MODE_64)
+		target = address + instruction->length + (int32_t)instruction->displacement;
+	else
+		target = instruction->displacement;
+
+	if (target < pe->image_base || target - pe->image_base > 0xffffffff)
+		return 0;
+
+	return nmd_x86_pe_find_symbol(imports, num_imports, (uint32_t)(target - pe->image_base));
+}
+
+int main(int argc, char* argv[])
+{
+	nmd_x86_code_section sections[MAX_SECTIONS];
+	nmd_x86_section_iterator iterator;
+	nmd_x86_instruction instruction;
+	nmd_x86_pe_symbol* imports = 0;
+	const nmd_x86_pe_symbol* import;
+	nmd_x86_elf elf;
+	nmd_x86_pe pe;
+	bool is_pe = false;
+	char formatted_instruction[128];
+	size_t num_sections, num_imports = 0, i, k;
+	uint64_t address;
+	struct stat st;
+	void* image;
+	int fd;
+
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s <elf or pe file>\n", argv[0]);
+		return 1;
+	}
+
+	fd = open(argv[1], O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0)
+	{
+		fprintf(stderr, "cannot open '%s'\n", argv[1]);
+		return 1;
+	}
+
+	image = mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (image == MAP_FAILED)
+	{
+		fprintf(stderr, "cannot map '%s'\n", argv[1]);
+		return 1;
+	}
+
+	/* The code is read once from the beginning to the end. */
+	posix_madvise(image, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+
+	if (nmd_x86_elf_parse(image, (size_t)st.st_size, &elf))
+		num_sections = nmd_x86_elf_get_executable_sections(&elf, sections, MAX_SECTIONS);
+	else if (nmd_x86_pe_parse(image, (size_t)st.st_size, &pe))
+	{
+		is_pe = true;
+		num_sections = nmd_x86_pe_get_executable_sections(&pe, sections, MAX_SECTIONS);
+		num_imports = nmd_x86_pe_get_imports(&pe, 0, 0);
+		imports = (nmd_x86_pe_symbol*)malloc((num_imports + 1) * sizeof(nmd_x86_pe_symbol));
+		num_imports = imports ? nmd_x86_pe_get_imports(&pe, imports, num_imports) : 0;
+	}
+	else
+	{
+		fprintf(stderr, "'%s' is not an x86 ELF or PE file\n", argv[1]);
+		munmap(image, (size_t)st.st_size);
+		return 1;
+	}
+
+	if (num_sections > MAX_SECTIONS)
+		num_sections = MAX_SECTIONS;
+
+	for (i = 0; i < num_sections; i++)
+	{
+		printf("\nDisassembly of section %.*s(%lu bytes):\n\n", (int)(sections[i].name_length ? sections[i].name_length : 9),
+			sections[i].name_length ? sections[i].name : "<segment>", (unsigned long)sections[i].size);
+
+		nmd_x86_section_iterator_init(&iterator, &sections[i], NMD_X86_DECODER_FLAGS_ALL);
+		while (nmd_x86_section_next_instruction(&iterator, &instruction, &address))
+		{
+			printf("%08lx%08lx: ", (unsigned long)(address >> 32), (unsigned long)(address & 0xffffffff));
+			for (k = 0; k < 10; k++)
+			{
+				if (k < instruction.length)
+					printf("%02x ", instruction.buffer[k]);
+				else
+					printf("   ");
+			}
+
+			if (!instruction.valid)
+			{
+				printf("(bad)\n");
+				continue;
+			}
+
+			nmd_x86_format(&instruction, formatted_instruction, address, NMD_X86_FORMAT_FLAGS_DEFAULT);
+			if (is_pe && (import = find_import(&pe, imports, num_imports, &instruction, address)) != 0)
+			{
+				if (import->name)
+					printf("%s ; %s!%s\n", formatted_instruction, import->module ? import->module : "?", import->name);
+				else
+					printf("%s ; %s!#%u\n", formatted_instruction, import->module ? import->module : "?", (unsigned)import->ordinal);
+			}
+			else
+				printf("%s\n", formatted_instruction);
+		}
+	}
+
+	free(imports);
+	munmap(image, (size_t)st.st_size);
+	return 0;
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+// The statistics counters are tested in their own executable: the implementation is compiled once per program, and assembly_test.cpp
+// must cover the default build without 'NMD_ASSEMBLY_ENABLE_STATS'.
+#define NMD_ASSEMBLY_ENABLE_STATS
+#define NMD_ASSEMBLY_IMPLEMENTATION
+#include "../nmd_assembly.h"
+
+TEST(side_tests_suite, stats_tests)
+{
+	nmd_x86_instruction instruction;
+	nmd_x86_stats stats, other_thread_stats, total;
+
+	nmd_x86_stats_reset();
+	nmd_x86_stats_snapshot(&stats);
+	EXPECT_EQ(stats.num_decoded, 0);
+	EXPECT_EQ(stats.ldisasm_lengths[0], 0);
+
+	/* Valid instructions per opcode map, encoding, length and prefix. */
+	const uint8_t nop[] = { 0x90 }, xchg[] = { 0x66, 0x90 }, pshufb[] = { 0x0f, 0x38, 0x00, 0xc1 }, vzeroupper[] = { 0xc5, 0xf8, 0x77, 0x00 };
+	EXPECT_TRUE(nmd_x86_decode(nop, sizeof(nop), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_TRUE(nmd_x86_decode(xchg, sizeof(xchg), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_TRUE(nmd_x86_decode(pshufb, sizeof(pshufb), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_TRUE(nmd_x86_decode(vzeroupper, sizeof(vzeroupper), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+
+	/* Invalid instructions per reason. */
+	const uint8_t truncated[] = { 0xb8, 0x00 }, mov_cr4[] = { 0x0f, 0x24, 0xc0 }, mov_c7[] = { 0xc7, 0xc8, 0, 0, 0, 0 }, aaa[] = { 0x37 }, lock_nop[] = { 0xf0, 0x90 }, lock_add[] = { 0xf0, 0x01, 0xc0 };
+	EXPECT_FALSE(nmd_x86_decode(truncated, sizeof(truncated), &instruction, NMD_X86_MODE_32, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_decode(pshufb, 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_decode(mov_cr4, sizeof(mov_cr4), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_decode(mov_c7, sizeof(mov_c7), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_decode(aaa, sizeof(aaa), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_decode(lock_nop, sizeof(lock_nop), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_decode(lock_add, sizeof(lock_add), &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+
+	/* The length disassembler. An instruction with many prefixes decoded by nmd_x86_ldisasm_padded() is counted once. */
+	const uint8_t prefixes[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH] = { 0x66, 0x66, 0x66, 0x66, 0x66, 0x90 };
+	EXPECT_EQ(nmd_x86_ldisasm(nop, sizeof(nop), NMD_X86_MODE_64), 1);
+	EXPECT_EQ(nmd_x86_ldisasm(truncated, sizeof(truncated), NMD_X86_MODE_32), 0);
+	EXPECT_EQ(nmd_x86_ldisasm_padded(prefixes, NMD_X86_MODE_64), 6);
+	EXPECT_EQ(nmd_x86_ldisasm(mov_cr4, sizeof(mov_cr4), NMD_X86_MODE_64), 0);
+	EXPECT_EQ(nmd_x86_ldisasm(mov_c7, sizeof(mov_c7), NMD_X86_MODE_64), 0);
+	EXPECT_EQ(nmd_x86_ldisasm(aaa, sizeof(aaa), NMD_X86_MODE_64), 0);
+	EXPECT_EQ(nmd_x86_ldisasm(lock_nop, sizeof(lock_nop), NMD_X86_MODE_64), 0);
+
+	/* nop; nop; aaa(invalid in 64-bit mode); mov rax,rcx. The single-byte instructions found by the SIMD classifier are counted too. */
+	const uint8_t bulk[] = { 0x90, 0x90, 0x37, 0x48, 0x89, 0xc8 };
+	uint32_t bitmap[1];
+	EXPECT_EQ(nmd_x86_ldisasm_bulk(bulk, sizeof(bulk), NMD_X86_MODE_64, bitmap), 4);
+
+	nmd_x86_stats_snapshot(&stats);
+	EXPECT_EQ(stats.num_decoded, 4);
+	EXPECT_EQ(stats.opcode_maps[NMD_X86_OPCODE_MAP_DEFAULT], 2);
+	EXPECT_EQ(stats.opcode_maps[NMD_X86_OPCODE_MAP_0F], 1); /* The VEX instruction is counted in the map selected by its prefix. */
+	EXPECT_EQ(stats.opcode_maps[NMD_X86_OPCODE_MAP_0F38], 1);
+	EXPECT_EQ(stats.encodings[NMD_X86_ENCODING_LEGACY], 3);
+	EXPECT_EQ(stats.encodings[NMD_X86_ENCODING_VEX], 1);
+	EXPECT_EQ(stats.lengths[1], 1);
+	EXPECT_EQ(stats.lengths[2], 1);
+	EXPECT_EQ(stats.lengths[3], 1);
+	EXPECT_EQ(stats.lengths[4], 1);
+	EXPECT_EQ(stats.prefixes[6], 1); /* NMD_X86_PREFIXES_OPERAND_SIZE_OVERRIDE */
+	EXPECT_EQ(stats.prefixes[8], 0); /* NMD_X86_PREFIXES_LOCK */
+
+	EXPECT_EQ(stats.num_rejected, 7);
+	EXPECT_EQ(stats.rejections[NMD_X86_REJECTION_TRUNCATED], 2);
+	EXPECT_EQ(stats.rejections[NMD_X86_REJECTION_OPCODE], 1);
+	EXPECT_EQ(stats.rejections[NMD_X86_REJECTION_OPERANDS], 1);
+	EXPECT_EQ(stats.rejections[NMD_X86_REJECTION_MODE], 1);
+	EXPECT_EQ(stats.rejections[NMD_X86_REJECTION_LOCK], 2);
+
+	EXPECT_EQ(stats.ldisasm_lengths[0], 6);
+	EXPECT_EQ(stats.ldisasm_lengths[1], 3);
+	EXPECT_EQ(stats.ldisasm_lengths[3], 1);
+	EXPECT_EQ(stats.ldisasm_lengths[6], 1);
+	EXPECT_EQ(stats.ldisasm_rejections[NMD_X86_REJECTION_TRUNCATED], 1);
+	EXPECT_EQ(stats.ldisasm_rejections[NMD_X86_REJECTION_OPCODE], 1);
+	EXPECT_EQ(stats.ldisasm_rejections[NMD_X86_REJECTION_OPERANDS], 1);
+	EXPECT_EQ(stats.ldisasm_rejections[NMD_X86_REJECTION_MODE], 2);
+	EXPECT_EQ(stats.ldisasm_rejections[NMD_X86_REJECTION_LOCK], 1);
+
+	/* The counters are per thread. */
+	std::thread thread([&]() {
+		nmd_x86_instruction thread_instruction;
+		nmd_x86_decode(nop, sizeof(nop), &thread_instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL);
+		nmd_x86_stats_snapshot(&other_thread_stats);
+	});
+	thread.join();
+	EXPECT_EQ(other_thread_stats.num_decoded, 1);
+	EXPECT_EQ(other_thread_stats.num_rejected, 0);
+
+	nmd_x86_stats_snapshot(&total);
+	EXPECT_EQ(total.num_decoded, 4);
+	nmd_x86_stats_add(&total, &other_thread_stats);
+	EXPECT_EQ(total.num_decoded, 5);
+	EXPECT_EQ(total.lengths[1], 2);
+	EXPECT_EQ(total.num_rejected, 7);
+
+	nmd_x86_stats_reset();
+	nmd_x86_stats_snapshot(&stats);
+	EXPECT_EQ(stats.num_decoded, 0);
+	EXPECT_EQ(stats.rejections[NMD_X86_REJECTION_TRUNCATED], 0);
+	EXPECT_EQ(stats.ldisasm_rejections[NMD_X86_REJECTION_MODE], 0);
+}
@@ -3,6 +3,10 @@
 #define NMD_ASSEMBLY_IMPLEMENTATION
 #include "../nmd_assembly.h"
 
+#include <string>
+#include <thread>
+#include <vector>
+
 // This is a giant hack so we can use contructors. The structs are just copies.
 #define OP nmd_x86_operand2
 #define MEM nmd_x86_memory_operand2
@@ -72,6 +76,25 @@ struct nmd_x86_instruction2 { bool valid : 1; bool has_modrm : 1; bool has_sib :
 #define MODE_32 NMD_X86_MODE_32
 #define MODE_64 NMD_X86_MODE_64
 
+// glibc's <sys/ucontext.h>(included by gtest) defines the registers of 'gregset_t' with the same names.
+#undef REG_RIP
+#undef REG_RAX
+#undef REG_RCX
+#undef REG_RDX
+#undef REG_RBX
+#undef REG_RSP
+#undef REG_RBP
+#undef REG_RSI
+#undef REG_RDI
+#undef REG_R8
+#undef REG_R9
+#undef REG_R10
+#undef REG_R11
+#undef REG_R12
+#undef REG_R13
+#undef REG_R14
+#undef REG_R15
+
 #define REG_NONE NMD_X86_REG_NONE
 
 #define REG_IP NMD_X86_REG_IP
@@ -987,6 +1010,1785 @@ TEST(side_tests_suite, side_tests)
 	{ SCOPED_TRACE("'4fh REX prefix' MODE:64"); buffer[0] = 0x4f; EXPECT_EQ(nmd_x86_ldisasm(buffer, 1,  MODE_64), 0); EXPECT_EQ(nmd_x86_decode(buffer, 1, &i,  MODE_64, NMD_X86_DECODER_FLAGS_ALL), false); }
 }
 
+TEST(side_tests_suite, decode_buffer_tests)
+{
+	nmd_x86_instruction entries[8];
+	size_t num_bytes;
+	{ SCOPED_TRACE("'nop; into; push es; ret' MODE:64"); const uint8_t buffer[] = { 0x90, 0xce, 0x06, 0xc3 }; EXPECT_EQ(nmd_x86_decode_buffer(buffer, sizeof(buffer), entries, 8, MODE_64, NMD_X86_DECODER_FLAGS_ALL, &num_bytes), 3); EXPECT_EQ(num_bytes, 4); EXPECT_TRUE(entries[0].valid); EXPECT_EQ(entries[0].id, NMD_X86_INSTRUCTION_NOP); EXPECT_FALSE(entries[1].valid); EXPECT_EQ(entries[1].length, 2); EXPECT_EQ(entries[1].buffer[1], 0x06); EXPECT_TRUE(entries[2].valid); EXPECT_EQ(entries[2].id, NMD_X86_INSTRUCTION_RET); }
+	{ SCOPED_TRACE("'nop; nop; nop' MODE:64 (two entries)"); const uint8_t buffer[] = { 0x90, 0x90, 0x90 }; EXPECT_EQ(nmd_x86_decode_buffer(buffer, sizeof(buffer), entries, 2, MODE_64, NMD_X86_DECODER_FLAGS_ALL, &num_bytes), 2); EXPECT_EQ(num_bytes, 2); }
+	{ SCOPED_TRACE("'jmp rel32'(truncated) MODE:64"); const uint8_t buffer[] = { 0xe9, 0xff, 0xff }; EXPECT_EQ(nmd_x86_decode_buffer(buffer, sizeof(buffer), entries, 8, MODE_64, NMD_X86_DECODER_FLAGS_ALL, &num_bytes), 1); EXPECT_EQ(num_bytes, 3); EXPECT_FALSE(entries[0].valid); EXPECT_EQ(entries[0].length, 3); }
+	
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(instructions); i++)
+	{
+		SCOPED_TRACE(instructions[i].s);
+		nmd_x86_instruction instruction;
+		EXPECT_EQ(nmd_x86_decode_buffer(instructions[i].i.buffer, instructions[i].i.length, &instruction, 1, (NMD_X86_MODE)instructions[i].i.mode, NMD_X86_DECODER_FLAGS_ALL, &num_bytes), 1);
+		EXPECT_EQ(instruction.valid, instructions[i].i.valid);
+		if (instruction.valid)
+			compare_instructions(instructions[i].i, instruction);
+	}
+}
+
+TEST(side_tests_suite, lazy_decode_tests)
+{
+	nmd_x86_instruction instruction;
+	const uint32_t flags = NMD_X86_DECODER_FLAGS_ALL & ~(NMD_X86_DECODER_FLAGS_OPERANDS | NMD_X86_DECODER_FLAGS_CPU_FLAGS);
+
+	{ const uint8_t buffer[] = { 0xe9, 0xff, 0xff }; EXPECT_FALSE(nmd_x86_decode(buffer, sizeof(buffer), &instruction, NMD_X86_MODE_64, flags)); EXPECT_FALSE(nmd_x86_decode_operands(&instruction)); EXPECT_FALSE(nmd_x86_decode_cpu_flags(&instruction)); }
+	{ const uint8_t buffer[] = { 0x01, 0xd8 }; EXPECT_TRUE(nmd_x86_decode(buffer, sizeof(buffer), &instruction, NMD_X86_MODE_64, flags)); EXPECT_EQ(instruction.num_operands, 0); EXPECT_EQ(instruction.modified_flags.eflags, 0);
+	  EXPECT_TRUE(nmd_x86_decode_operands(&instruction)); EXPECT_EQ(instruction.num_operands, 2); EXPECT_EQ(instruction.operands[0].fields.reg, NMD_X86_REG_EAX); EXPECT_EQ(instruction.operands[1].fields.reg, NMD_X86_REG_EBX);
+	  EXPECT_TRUE(nmd_x86_decode_cpu_flags(&instruction)); EXPECT_NE(instruction.modified_flags.eflags, 0); }
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(instructions); i++)
+	{
+		SCOPED_TRACE(instructions[i].s);
+		EXPECT_EQ(nmd_x86_decode(instructions[i].i.buffer, instructions[i].i.length, &instruction, (NMD_X86_MODE)instructions[i].i.mode, flags), instructions[i].i.valid);
+		if (instruction.valid)
+		{
+			/* Decoding twice must not accumulate state. */
+			EXPECT_TRUE(nmd_x86_decode_operands(&instruction));
+			EXPECT_TRUE(nmd_x86_decode_operands(&instruction));
+			EXPECT_TRUE(nmd_x86_decode_cpu_flags(&instruction));
+			EXPECT_TRUE(nmd_x86_decode_cpu_flags(&instruction));
+			compare_instructions(instructions[i].i, instruction);
+		}
+	}
+}
+
+TEST(side_tests_suite, padded_decode_tests)
+{
+	nmd_x86_instruction instruction, padded_instruction;
+	uint8_t buffer[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH];
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(instructions); i++)
+	{
+		SCOPED_TRACE(instructions[i].s);
+		memset(buffer, 0xff, sizeof(buffer));
+		memcpy(buffer, instructions[i].i.buffer, instructions[i].i.length);
+
+		const NMD_X86_MODE mode = (NMD_X86_MODE)instructions[i].i.mode;
+		EXPECT_EQ(nmd_x86_decode_padded(buffer, &padded_instruction, mode, NMD_X86_DECODER_FLAGS_ALL), nmd_x86_decode(buffer, sizeof(buffer), &instruction, mode, NMD_X86_DECODER_FLAGS_ALL));
+		EXPECT_EQ(memcmp(&instruction, &padded_instruction, sizeof(instruction)), 0);
+		EXPECT_EQ(nmd_x86_ldisasm_padded(buffer, mode), nmd_x86_ldisasm(buffer, sizeof(buffer), mode));
+	}
+
+	/* Too many prefixes for the rest of the instruction to be read without bounds checks. */
+	{ const uint8_t prefixed[] = { 0x66, 0x66, 0x66, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90 };
+	  EXPECT_TRUE(nmd_x86_decode_padded(prefixed, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); EXPECT_EQ(instruction.length, 14); EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_NOP);
+	  EXPECT_EQ(nmd_x86_ldisasm_padded(prefixed, NMD_X86_MODE_64), 14); }
+}
+
+NMD_X86_DEFINE_DECODER(decode16_all, NMD_X86_MODE_16, NMD_X86_DECODER_FLAGS_ALL)
+NMD_X86_DEFINE_DECODER(decode32_all, NMD_X86_MODE_32, NMD_X86_DECODER_FLAGS_ALL)
+NMD_X86_DEFINE_DECODER(decode64_all, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)
+NMD_X86_DEFINE_DECODER(decode64_minimal, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL)
+NMD_X86_DEFINE_DECODER_PADDED(decode64_padded_minimal, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL)
+
+TEST(side_tests_suite, specialized_decoder_tests)
+{
+	nmd_x86_instruction instruction, specialized_instruction;
+	uint8_t buffer[NMD_X86_MAXIMUM_INSTRUCTION_LENGTH];
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(instructions); i++)
+	{
+		SCOPED_TRACE(instructions[i].s);
+		const NMD_X86_MODE mode = (NMD_X86_MODE)instructions[i].i.mode;
+		const uint8_t* const bytes = instructions[i].i.buffer;
+		const size_t length = instructions[i].i.length;
+
+		bool (*const decode_all)(const void*, size_t, nmd_x86_instruction*) = mode == NMD_X86_MODE_16 ? decode16_all : (mode == NMD_X86_MODE_32 ? decode32_all : decode64_all);
+		EXPECT_EQ(decode_all(bytes, length, &specialized_instruction), nmd_x86_decode(bytes, length, &instruction, mode, NMD_X86_DECODER_FLAGS_ALL));
+		EXPECT_EQ(memcmp(&instruction, &specialized_instruction, sizeof(instruction)), 0);
+
+		if (mode == NMD_X86_MODE_64)
+		{
+			EXPECT_EQ(decode64_minimal(bytes, length, &specialized_instruction), nmd_x86_decode(bytes, length, &instruction, mode, NMD_X86_DECODER_FLAGS_MINIMAL));
+			EXPECT_EQ(memcmp(&instruction, &specialized_instruction, sizeof(instruction)), 0);
+
+			memset(buffer, 0xff, sizeof(buffer));
+			memcpy(buffer, bytes, length);
+			EXPECT_EQ(decode64_padded_minimal(buffer, &specialized_instruction), nmd_x86_decode_padded(buffer, &instruction, mode, NMD_X86_DECODER_FLAGS_MINIMAL));
+			EXPECT_EQ(memcmp(&instruction, &specialized_instruction, sizeof(instruction)), 0);
+		}
+	}
+}
+
+TEST(side_tests_suite, ldisasm_bulk_tests)
+{
+	static uint8_t buffer[64 * 1024];
+	static uint32_t bitmap[(sizeof(buffer) + 31) / 32], expected_bitmap[(sizeof(buffer) + 31) / 32];
+	const NMD_X86_MODE modes[] = { NMD_X86_MODE_16, NMD_X86_MODE_32, NMD_X86_MODE_64 };
+	uint32_t seed = 12345;
+
+	for (size_t m = 0; m < _NMD_NUM_ELEMENTS(modes); m++)
+	{
+		SCOPED_TRACE(modes[m]);
+
+		/* Instructions of the test set, runs of single-byte instructions and random bytes. */
+		size_t size = 0;
+		for (size_t i = 0; size + 64 < sizeof(buffer); i = (i + 1) % _NMD_NUM_ELEMENTS(instructions))
+		{
+			if (instructions[i].i.mode == modes[m])
+			{
+				memcpy(buffer + size, instructions[i].i.buffer, instructions[i].i.length);
+				size += instructions[i].i.length;
+			}
+
+			seed = seed * 1103515245 + 12345;
+			const size_t run = (seed >> 16) % 40;
+			const uint8_t filler[] = { 0xcc, 0x90, 0x55, 0x41, 0xc3 };
+			for (size_t j = 0; j < run; j++)
+				buffer[size++] = (seed >> 8) & 1 ? filler[(seed >> 24) % _NMD_NUM_ELEMENTS(filler)] : (uint8_t)((seed = seed * 1103515245 + 12345) >> 16);
+		}
+
+		/* Every suffix length near the end exercises the bounds-checked path and the scalar classification. */
+		for (size_t end = size - 64; end <= size; end += (end < size - 40 ? 1 : 3))
+		{
+			memset(expected_bitmap, 0, sizeof(expected_bitmap));
+			size_t expected_count = 0;
+			for (size_t offset = 0; offset < end; expected_count++)
+			{
+				expected_bitmap[offset / 32] |= (uint32_t)1 << (offset % 32);
+				const size_t length = nmd_x86_ldisasm(buffer + offset, end - offset, modes[m]);
+				offset += length ? length : 1;
+			}
+
+			memset(bitmap, 0xff, sizeof(bitmap));
+			EXPECT_EQ(nmd_x86_ldisasm_bulk(buffer, end, modes[m], bitmap), expected_count);
+			EXPECT_EQ(memcmp(bitmap, expected_bitmap, (end + 31) / 32 * sizeof(uint32_t)), 0);
+		}
+	}
+
+	{ const uint8_t padding[] = { 0xcc, 0xcc, 0xcc, 0x48, 0x89, 0xe5, 0x90 }; uint32_t word = 0;
+	  EXPECT_EQ(nmd_x86_ldisasm_bulk(padding, sizeof(padding), NMD_X86_MODE_64, &word), 5); EXPECT_EQ(word, 0x4f); }
+}
+
+TEST(side_tests_suite, parallel_sweep_tests)
+{
+	static uint8_t buffer[32 * 1024];
+	static uint32_t bitmap[(sizeof(buffer) + 31) / 32], expected_bitmap[(sizeof(buffer) + 31) / 32];
+	nmd_x86_sweep_chunk chunks[16];
+	nmd_x86_instruction instruction;
+	uint32_t seed = 54321;
+
+	/* Instructions of the test set mixed with random bytes, so that chunks often begin in the middle of an instruction. */
+	size_t size = 0;
+	for (size_t i = 0; size + 64 < sizeof(buffer); i = (i + 1) % _NMD_NUM_ELEMENTS(instructions))
+	{
+		if (instructions[i].i.mode != NMD_X86_MODE_64)
+			continue;
+		memcpy(buffer + size, instructions[i].i.buffer, instructions[i].i.length);
+		size += instructions[i].i.length;
+		seed = seed * 1103515245 + 12345;
+		if ((seed >> 16) % 8 == 0)
+			buffer[size++] = (uint8_t)(seed >> 24);
+	}
+
+	for (size_t end = size - 40; end <= size; end += 13)
+	{
+		memset(expected_bitmap, 0, sizeof(expected_bitmap));
+		size_t expected_count = 0;
+		for (size_t offset = 0; offset < end; expected_count++)
+		{
+			expected_bitmap[offset / 32] |= (uint32_t)1 << (offset % 32);
+			offset += nmd_x86_decode(buffer + offset, end - offset, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL) ? instruction.length : 1;
+		}
+
+		for (size_t num_chunks = 1; num_chunks <= _NMD_NUM_ELEMENTS(chunks); num_chunks = num_chunks * 2 + 1)
+		{
+			SCOPED_TRACE(num_chunks);
+			memset(bitmap, 0xff, sizeof(bitmap));
+			const size_t num_used = nmd_x86_sweep_split(end, chunks, num_chunks);
+			EXPECT_LE(num_used, num_chunks);
+			EXPECT_EQ(chunks[0].begin, 0);
+			EXPECT_EQ(chunks[num_used - 1].end, end);
+
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < num_used; i++)
+				threads.emplace_back([&, i]() { nmd_x86_sweep_decode_chunk(buffer, end, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL, &chunks[i], bitmap); });
+			for (std::thread& thread : threads)
+				thread.join();
+
+			EXPECT_EQ(nmd_x86_sweep_merge(buffer, end, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL, chunks, num_used, bitmap), expected_count);
+			EXPECT_EQ(memcmp(bitmap, expected_bitmap, (end + 31) / 32 * sizeof(uint32_t)), 0);
+		}
+	}
+
+	/* More chunks than 32-byte blocks */
+	{ const uint8_t code[] = { 0x48, 0x89, 0xe5, 0xc3 }; uint32_t word = 0;
+	  EXPECT_EQ(nmd_x86_sweep_split(sizeof(code), chunks, 4), 1);
+	  nmd_x86_sweep_decode_chunk(code, sizeof(code), NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL, &chunks[0], &word);
+	  EXPECT_EQ(nmd_x86_sweep_merge(code, sizeof(code), NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL, chunks, 1, &word), 2); EXPECT_EQ(word, 0x9); }
+}
+
+TEST(side_tests_suite, recursive_descent_tests)
+{
+	const uint8_t code[] = {
+		0x55,                         /* 00: push rbp       */
+		0x31, 0xc0,                   /* 01: xor eax, eax   */
+		0x85, 0xff,                   /* 03: test edi, edi  */
+		0x74, 0x05,                   /* 05: je 0x0c        */
+		0xb8, 0x01, 0x00, 0x00, 0x00, /* 07: mov eax, 1     */
+		0xe8, 0x03, 0x00, 0x00, 0x00, /* 0c: call 0x14      */
+		0x5d,                         /* 11: pop rbp        */
+		0xc3,                         /* 12: ret            */
+		0xff,                         /* 13: data           */
+		0x48, 0xff, 0xc0,             /* 14: inc rax        */
+		0xeb, 0xf3,                   /* 17: jmp 0x0c       */
+		0xff, 0xff                    /* 19: data           */
+	};
+	uint8_t code_map[sizeof(code)];
+	uint32_t queue[16];
+	nmd_x86_basic_block blocks[8];
+	nmd_x86_recursive_descent rd;
+
+	nmd_x86_recursive_descent_init(&rd, code, sizeof(code), NMD_X86_MODE_64, code_map, queue, _NMD_NUM_ELEMENTS(queue));
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+	nmd_x86_recursive_descent_run(&rd);
+	EXPECT_EQ(code_map[0x13], 0);
+	EXPECT_EQ(code_map[0x19], 0);
+	ASSERT_EQ(nmd_x86_build_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, blocks, _NMD_NUM_ELEMENTS(blocks)), 4);
+	EXPECT_EQ(blocks[0].begin, 0x00); EXPECT_EQ(blocks[0].end, 0x07); EXPECT_EQ(blocks[0].num_instructions, 4); EXPECT_EQ(blocks[0].type, NMD_X86_BLOCK_END_CONDITIONAL); EXPECT_EQ(blocks[0].successors[0], 1); EXPECT_EQ(blocks[0].successors[1], 2);
+	EXPECT_EQ(blocks[1].begin, 0x07); EXPECT_EQ(blocks[1].end, 0x0c); EXPECT_EQ(blocks[1].num_instructions, 1); EXPECT_EQ(blocks[1].type, NMD_X86_BLOCK_END_FALLTHROUGH); EXPECT_EQ(blocks[1].successors[0], 2); EXPECT_EQ(blocks[1].successors[1], NMD_X86_INVALID_BLOCK);
+	EXPECT_EQ(blocks[2].begin, 0x0c); EXPECT_EQ(blocks[2].end, 0x13); EXPECT_EQ(blocks[2].num_instructions, 3); EXPECT_EQ(blocks[2].type, NMD_X86_BLOCK_END_RET); EXPECT_EQ(blocks[2].successors[0], NMD_X86_INVALID_BLOCK);
+	EXPECT_EQ(blocks[3].begin, 0x14); EXPECT_EQ(blocks[3].end, 0x19); EXPECT_EQ(blocks[3].num_instructions, 2); EXPECT_EQ(blocks[3].type, NMD_X86_BLOCK_END_JUMP); EXPECT_EQ(blocks[3].successors[0], NMD_X86_INVALID_BLOCK); EXPECT_EQ(blocks[3].successors[1], 2);
+
+	/* An entry point in the middle of a block splits it. A queue of one element overflows. */
+	nmd_x86_recursive_descent_init(&rd, code, sizeof(code), NMD_X86_MODE_64, code_map, queue, 1);
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+	nmd_x86_recursive_descent_add_entry(&rd, 3);
+	EXPECT_TRUE(rd.queue_overflow);
+	nmd_x86_recursive_descent_run(&rd);
+	ASSERT_EQ(nmd_x86_build_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, blocks, _NMD_NUM_ELEMENTS(blocks)), 5);
+	EXPECT_EQ(blocks[0].end, 0x03); EXPECT_EQ(blocks[0].type, NMD_X86_BLOCK_END_FALLTHROUGH); EXPECT_EQ(blocks[0].successors[0], 1);
+	EXPECT_EQ(blocks[1].begin, 0x03); EXPECT_EQ(blocks[1].end, 0x07); EXPECT_EQ(blocks[1].successors[1], 3);
+
+	/* Exploring disjoint entry points on different threads and merging the code maps gives the same blocks as a single exploration. */
+	{
+		static uint8_t buffer[16 * 1024], expected_map[sizeof(buffer)], maps[4][sizeof(buffer)];
+		static nmd_x86_basic_block expected_blocks[4096], merged_blocks[4096];
+		static uint32_t queues[5][256];
+		nmd_x86_recursive_descent rds[4];
+		size_t size = 0;
+		for (size_t i = 0; size + NMD_X86_MAXIMUM_INSTRUCTION_LENGTH < sizeof(buffer); i = (i + 1) % _NMD_NUM_ELEMENTS(instructions))
+		{
+			if (instructions[i].i.mode == NMD_X86_MODE_64)
+			{
+				memcpy(buffer + size, instructions[i].i.buffer, instructions[i].i.length);
+				size += instructions[i].i.length;
+			}
+		}
+
+		nmd_x86_recursive_descent_init(&rd, buffer, size, NMD_X86_MODE_64, expected_map, queues[4], _NMD_NUM_ELEMENTS(queues[4]));
+		for (size_t entry = 0; entry < size; entry += 97)
+			nmd_x86_recursive_descent_add_entry(&rd, entry);
+		nmd_x86_recursive_descent_run(&rd);
+		const size_t num_blocks = nmd_x86_build_basic_blocks(buffer, size, NMD_X86_MODE_64, expected_map, expected_blocks, _NMD_NUM_ELEMENTS(expected_blocks));
+		ASSERT_LE(num_blocks, _NMD_NUM_ELEMENTS(expected_blocks));
+		EXPECT_GT(num_blocks, 100);
+
+		std::vector<std::thread> threads;
+		for (size_t t = 0; t < 4; t++)
+		{
+			threads.emplace_back([&, t]() {
+				nmd_x86_recursive_descent_init(&rds[t], buffer, size, NMD_X86_MODE_64, maps[t], queues[t], _NMD_NUM_ELEMENTS(queues[t]));
+				for (size_t entry = t * 97; entry < size; entry += 4 * 97)
+					nmd_x86_recursive_descent_add_entry(&rds[t], entry);
+				nmd_x86_recursive_descent_run(&rds[t]);
+			});
+		}
+		for (std::thread& thread : threads)
+			thread.join();
+		for (size_t t = 1; t < 4; t++)
+			nmd_x86_code_map_merge(maps[0], maps[t], size);
+
+		EXPECT_EQ(nmd_x86_build_basic_blocks(buffer, size, NMD_X86_MODE_64, maps[0], merged_blocks, _NMD_NUM_ELEMENTS(merged_blocks)), num_blocks);
+		EXPECT_EQ(memcmp(merged_blocks, expected_blocks, num_blocks * sizeof(nmd_x86_basic_block)), 0);
+	}
+}
+
+TEST(side_tests_suite, register_masks_tests)
+{
+	const uint64_t RAX = NMD_X86_REG_MASK_RAX, RCX = NMD_X86_REG_MASK_RCX, RDX = NMD_X86_REG_MASK_RDX, RBX = NMD_X86_REG_MASK_RBX, RSP = NMD_X86_REG_MASK_RSP;
+	const uint64_t RBP = NMD_X86_REG_MASK_RBP, RSI = NMD_X86_REG_MASK_RSI, RDI = NMD_X86_REG_MASK_RDI, RIP = NMD_X86_REG_MASK_RIP;
+	const uint64_t R8 = nmd_x86_get_register_mask(NMD_X86_REG_R8), R9 = nmd_x86_get_register_mask(NMD_X86_REG_R9);
+	const uint64_t SS = nmd_x86_get_register_mask(NMD_X86_REG_SS), DS = nmd_x86_get_register_mask(NMD_X86_REG_DS);
+	const uint64_t XMM0 = nmd_x86_get_register_mask(NMD_X86_REG_XMM0), XMM1 = nmd_x86_get_register_mask(NMD_X86_REG_XMM1), K1 = nmd_x86_get_register_mask(NMD_X86_REG_K1);
+	const struct { const char* buffer; size_t length; uint64_t read, written; } tests[] = {
+		{ "\x50", 1, RAX | RSP | SS, RSP },                                 /* push rax */
+		{ "\x58", 1, RSP | SS, RAX | RSP },                                 /* pop rax */
+		{ "\x48\xf7\xe1", 3, RAX | RCX, RAX | RDX },                        /* mul rcx */
+		{ "\x48\xf7\xf1", 3, RAX | RCX | RDX, RAX | RDX },                  /* div rcx */
+		{ "\xf6\xe1", 2, RAX | RCX, RAX },                                  /* mul cl */
+		{ "\x48\x01\xc8", 3, RAX | RCX, RAX },                              /* add rax, rcx */
+		{ "\x88\xe0", 2, RAX, RAX },                                        /* mov al, ah: the rest of rax is preserved */
+		{ "\x40\x88\xe0", 3, RAX | RSP, RAX },                              /* mov al, spl */
+		{ "\x48\x8d\x04\x24", 4, RSP | SS, RAX },                           /* lea rax, [rsp] */
+		{ "\xf3\x48\xa5", 3, RCX | RSI | RDI, RCX | RSI | RDI },            /* rep movsq */
+		{ "\xaa", 1, RAX | RDI, RDI },                                      /* stosb */
+		{ "\xac", 1, RAX | RSI, RAX | RSI },                                /* lodsb: the rest of rax is preserved */
+		{ "\x66\xad", 2, RAX | RSI, RAX | RSI },                           /* lodsw */
+		{ "\xad", 1, RSI, RAX | RSI },                                      /* lodsd */
+		{ "\x48\xad", 2, RSI, RAX | RSI },                                 /* lodsq */
+		{ "\xc9", 1, RSP | RBP | SS, RSP | RBP },                           /* leave */
+		{ "\xc3", 1, RSP | RIP | SS, RSP | RIP },                           /* ret */
+		{ "\xff\x10", 2, RAX | RSP | DS, RSP | RIP },                       /* call [rax] */
+		{ "\xe2\xfe", 2, RCX, RCX },                                        /* loop */
+		{ "\x48\x0f\xc7\x0f", 4, RAX | RCX | RDX | RBX | RDI | DS, RAX | RDX }, /* cmpxchg16b [rdi] */
+		{ "\x0f\x31", 2, 0, RAX | RDX },                                    /* rdtsc */
+		{ "\xf2\x0f\x58\xc1", 4, XMM0 | XMM1, XMM0 },                       /* addsd xmm0, xmm1 */
+		{ "\x66\x0f\xef\xc1", 4, XMM0 | XMM1, XMM0 },                       /* pxor xmm0, xmm1 */
+		{ "\x0f\x28\xc1", 3, XMM1, XMM0 },                                 /* movaps xmm0, xmm1 */
+		{ "\x0f\x44\xc1", 3, RAX | RCX, RAX },                             /* cmove eax, ecx */
+		{ "\x09\xc8", 2, RAX | RCX, RAX },                                  /* or eax, ecx */
+		{ "\x0a\x02", 2, RAX | RDX | DS, RAX },                             /* or al, [rdx] */
+		{ "\x0c\x01", 2, RAX, RAX },                                        /* or al, 1 */
+		{ "\x19\xc8", 2, RAX | RCX, RAX },                                  /* sbb eax, ecx */
+		{ "\x1b\x02", 2, RAX | RDX | DS, RAX },                             /* sbb eax, [rdx] */
+		{ "\x48\x2b\x37", 3, RSI | RDI | DS, RSI },                         /* sub rsi, [rdi] */
+		{ "\x48\x29\x37", 3, RSI | RDI | DS, 0 },                           /* sub [rdi], rsi */
+		{ "\x39\xc8", 2, RAX | RCX, 0 },                                    /* cmp eax, ecx */
+		{ "\x3b\x0a", 2, RCX | RDX | DS, 0 },                               /* cmp ecx, [rdx] */
+		{ "\x38\xc8", 2, RAX | RCX, 0 },                                    /* cmp al, cl */
+		{ "\x3d\x01\x00\x00\x00", 5, RAX, 0 },                            /* cmp eax, 1 */
+		{ "\x85\xd1", 2, RCX | RDX, 0 },                                    /* test ecx, edx */
+		{ "\x49\x90", 2, RAX | R8, RAX | R8 },                              /* xchg r8, rax */
+		{ "\x49\x91", 2, RAX | R9, RAX | R9 },                              /* xchg r9, rax */
+		{ "\x41\x0f\x94\xc0", 4, R8, R8 },                                 /* setz r8b */
+		{ "\x41\x88\xc0", 3, RAX | R8, R8 },                                /* mov r8b, al */
+		{ "\x44\x88\xc8", 3, RAX | R9, RAX },                               /* mov al, r9b */
+		{ "\x41\xfe\xc0", 3, R8, R8 },                                      /* inc r8b */
+		{ "\x41\x0f\xb6\xc0", 4, R8, RAX },                                /* movzx eax, r8b */
+		{ "\xc5\xf4\x58\xc0", 4, XMM0 | XMM1, XMM0 },                       /* vaddps ymm0, ymm1, ymm0 */
+		{ "\xc4\xc1\x78\x29\x00", 5, XMM0 | R8 | DS, 0 },                  /* vmovaps [r8], xmm0 */
+		{ "\xc5\xf9\x6e\x07", 4, RDI | DS, XMM0 },                          /* vmovd xmm0, [rdi] */
+		{ "\xc4\xe1\xf9\x7e\xc1", 5, XMM0, RCX },                          /* vmovq rcx, xmm0 */
+		{ "\xc4\xe2\x70\xf2\xc2", 5, RCX | RDX, RAX },                     /* andn eax, ecx, edx */
+		{ "\xc4\xe2\xf1\xf7\xc2", 5, RCX | RDX, RAX },                     /* shlx rax, rdx, rcx */
+		{ "\xc4\xe2\xf3\xf6\xc1", 5, RCX | RDX, RAX | RCX },               /* mulx rax, rcx, rcx: rdx is implicit */
+		{ "\xc4\xe3\x79\x16\xc0\x01", 6, XMM0, RAX },                     /* vpextrd eax, xmm0, 1 */
+		{ "\xc5\xf8\x93\xc1", 4, K1, RAX },                                 /* kmovw eax, k1 */
+	};
+	nmd_x86_instruction instruction;
+
+	EXPECT_EQ(nmd_x86_get_register_mask(NMD_X86_REG_AH), RAX);
+	EXPECT_EQ(nmd_x86_get_register_mask(NMD_X86_REG_R9D), nmd_x86_get_register_mask(NMD_X86_REG_R9));
+	EXPECT_EQ(nmd_x86_get_register_mask(NMD_X86_REG_YMM3), nmd_x86_get_register_mask(NMD_X86_REG_XMM3));
+	EXPECT_EQ(nmd_x86_get_register_mask(NMD_X86_REG_XMM31), (uint64_t)1 << 63);
+	EXPECT_EQ(nmd_x86_get_register_mask(NMD_X86_REG_CR0), 0);
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(tests); i++)
+	{
+		ASSERT_TRUE(nmd_x86_decode(tests[i].buffer, tests[i].length, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+		EXPECT_EQ(instruction.regs_read, tests[i].read) << i;
+		EXPECT_EQ(instruction.regs_written, tests[i].written) << i;
+		EXPECT_FALSE(instruction.regs_incomplete) << i;
+	}
+
+	/* The index of a gather is a vector register. */
+	ASSERT_TRUE(nmd_x86_decode("\xc4\xe2\x71\x92\x04\x87", 6, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* vgatherdps xmm0, [rdi+xmm0*4], xmm1 */
+	EXPECT_EQ(instruction.regs_read & ~(SS | DS), XMM0 | XMM1 | RDI);
+	EXPECT_EQ(instruction.regs_written, XMM0 | XMM1);
+	EXPECT_FALSE(instruction.regs_incomplete);
+
+	/* Instructions without decoded operands read every register their fields may name and are marked incomplete. */
+	ASSERT_TRUE(nmd_x86_decode("\xc5\xf1\x73\xf8\x01", 5, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* vpslldq xmm1, xmm0, 1 */
+	EXPECT_TRUE(instruction.regs_incomplete);
+	EXPECT_EQ(instruction.regs_read & (XMM0 | XMM1), XMM0 | XMM1);
+	ASSERT_TRUE(nmd_x86_decode("\x0f\xae\x20", 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* xsave [rax] */
+	EXPECT_TRUE(instruction.regs_incomplete);
+	EXPECT_EQ(instruction.regs_read, RAX | DS);
+	ASSERT_TRUE(nmd_x86_decode("\x0f\x18\x08", 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* prefetcht0 [rax] */
+	EXPECT_FALSE(instruction.regs_incomplete);
+	EXPECT_EQ(instruction.regs_read, RAX | DS);
+
+	/* The masks are only filled with the operands, and nmd_x86_decode_operands() gives the same result. */
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(instructions); i++)
+	{
+		nmd_x86_instruction expected;
+		if (!nmd_x86_decode(instructions[i].i.buffer, instructions[i].i.length, &expected, (NMD_X86_MODE)instructions[i].i.mode, NMD_X86_DECODER_FLAGS_ALL))
+			continue;
+		ASSERT_TRUE(nmd_x86_decode(instructions[i].i.buffer, instructions[i].i.length, &instruction, (NMD_X86_MODE)instructions[i].i.mode, NMD_X86_DECODER_FLAGS_MINIMAL));
+		EXPECT_EQ(instruction.regs_read | instruction.regs_written, 0);
+		ASSERT_TRUE(nmd_x86_decode_operands(&instruction));
+		EXPECT_EQ(instruction.regs_read, expected.regs_read);
+		EXPECT_EQ(instruction.regs_written, expected.regs_written);
+	}
+}
+
+TEST(side_tests_suite, operand_decoding_tests)
+{
+	const uint8_t REG = NMD_X86_OPERAND_TYPE_REGISTER, MEM = NMD_X86_OPERAND_TYPE_MEMORY;
+	const uint8_t R = NMD_X86_OPERAND_ACTION_READ, W = NMD_X86_OPERAND_ACTION_WRITE, RW = NMD_X86_OPERAND_ACTION_READWRITE;
+	/* 'reg' is the register of a register operand and the base of a memory operand. A negative 'num_operands' is not checked. */
+	const struct { const char* buffer; size_t length; int num_operands; int index; uint8_t type; uint8_t reg; uint8_t action; } tests[] = {
+		{ "\x48\x8b\x05\x00\x00\x00\x00", 7, 2, 1, MEM, NMD_X86_REG_RIP, R },     /* mov rax, [rip] */
+		{ "\x67\x8b\x05\x00\x00\x00\x00", 7, 2, 1, MEM, NMD_X86_REG_EIP, R },     /* mov eax, [eip] */
+		{ "\x49\x89\xc0", 3, 2, 0, REG, NMD_X86_REG_R8, W },                    /* mov r8, rax: Ev with REX.B */
+		{ "\x41\x89\xc0", 3, 2, 0, REG, NMD_X86_REG_R8D, W },                   /* mov r8d, eax */
+		{ "\x4c\x89\xc0", 3, 2, 1, REG, NMD_X86_REG_R8, R },                    /* mov rax, r8: Gv with REX.R */
+		{ "\x4d\x89\xc8", 3, 2, 1, REG, NMD_X86_REG_R9, R },                    /* mov r8, r9: REX.R and REX.B */
+		{ "\x4d\x89\xc8", 3, 2, 0, REG, NMD_X86_REG_R8, W },
+		{ "\x41\x0f\x01\xe0", 4, -1, 0, REG, NMD_X86_REG_R8D, W },              /* smsw r8d: Rv with REX.B */
+		{ "\xfe\xc0", 2, 1, 0, REG, NMD_X86_REG_AL, RW },                       /* inc al */
+		{ "\x48\xff\xc9", 3, 1, 0, REG, NMD_X86_REG_RCX, RW },                  /* dec rcx */
+		{ "\xff\xd0", 2, 1, 0, REG, NMD_X86_REG_RAX, R },                       /* call rax */
+		{ "\x41\xff\xe3", 3, 1, 0, REG, NMD_X86_REG_R11, R },                   /* jmp r11 */
+		{ "\xff\x20", 2, 1, 0, MEM, NMD_X86_REG_RAX, R },                       /* jmp [rax] */
+		{ "\x0c\x01", 2, 2, 0, REG, NMD_X86_REG_AL, RW },                       /* or al, 1: the ALU rows are selected by op % 8 */
+		{ "\x1b\x02", 2, 2, 1, MEM, NMD_X86_REG_RDX, R },                       /* sbb eax, [rdx] */
+		{ "\x29\xc8", 2, 2, 1, REG, NMD_X86_REG_ECX, R },                       /* sub eax, ecx */
+		{ "\x3b\x0a", 2, 2, 0, REG, NMD_X86_REG_ECX, R },                       /* cmp ecx, [rdx] */
+		{ "\x85\xd1", 2, 2, 0, REG, NMD_X86_REG_ECX, R },                       /* test ecx, edx */
+		{ "\x49\x91", 2, 2, 0, REG, NMD_X86_REG_R9, RW },                       /* xchg r9, rax */
+		{ "\x41\x90", 2, 2, 0, REG, NMD_X86_REG_R8D, RW },                      /* xchg r8d, eax */
+		{ "\x41\x88\xc0", 3, 2, 0, REG, NMD_X86_REG_R8B, W },                  /* mov r8b, al: Eb with REX.B */
+		{ "\x44\x88\xc8", 3, 2, 1, REG, NMD_X86_REG_R9B, R },                  /* mov al, r9b: Gb with REX.R */
+		{ "\x0f\xb6\xc1", 3, 2, 1, REG, NMD_X86_REG_CL, R },                   /* movzx eax, cl */
+		{ "\x48\x0f\xbf\xc1", 4, 2, 0, REG, NMD_X86_REG_RAX, W },             /* movsx rax, cx */
+		{ "\x0f\x58\xc1", 3, 2, 0, REG, NMD_X86_REG_XMM0, RW },                  /* addps xmm0, xmm1: the destination is also a source */
+		{ "\x66\x0f\x14\xc1", 4, 2, 0, REG, NMD_X86_REG_XMM0, RW },              /* unpcklpd xmm0, xmm1 */
+		{ "\x0f\x28\xc1", 3, 2, 0, REG, NMD_X86_REG_XMM0, W },                   /* movaps xmm0, xmm1 */
+		{ "\x0f\x5a\xc1", 3, 2, 0, REG, NMD_X86_REG_XMM0, W },                   /* cvtps2pd xmm0, xmm1 */
+		{ "\x0f\x2e\xc1", 3, 2, 0, REG, NMD_X86_REG_XMM0, R },                   /* ucomiss xmm0, xmm1 */
+		{ "\x0f\xef\xc1", 3, 2, 0, REG, NMD_X86_REG_MM0, RW },                   /* pxor mm0, mm1 */
+		{ "\x66\x0f\xfe\xc1", 4, 2, 0, REG, NMD_X86_REG_XMM0, RW },              /* paddd xmm0, xmm1 */
+		{ "\x66\x0f\xd7\xc1", 4, 2, 0, REG, NMD_X86_REG_EAX, W },                /* pmovmskb eax, xmm1 */
+		{ "\x0f\x44\xc1", 3, 2, 0, REG, NMD_X86_REG_EAX, R | NMD_X86_OPERAND_ACTION_CONDWRITE }, /* cmove eax, ecx */
+	};
+	nmd_x86_instruction instruction;
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(tests); i++)
+	{
+		ASSERT_TRUE(nmd_x86_decode(tests[i].buffer, tests[i].length, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)) << i;
+		const nmd_x86_operand* operand = &instruction.operands[tests[i].index];
+		if (tests[i].num_operands >= 0)
+			EXPECT_EQ(instruction.num_operands, tests[i].num_operands) << i;
+		EXPECT_EQ(operand->type, tests[i].type) << i;
+		EXPECT_EQ(tests[i].type == MEM ? operand->fields.mem.base : operand->fields.reg, tests[i].reg) << i;
+		EXPECT_EQ(operand->action, tests[i].action) << i;
+	}
+
+	/* Outside of 64-bit mode an indirect call keeps its 32-bit register. */
+	ASSERT_TRUE(nmd_x86_decode("\xff\xd0", 2, &instruction, NMD_X86_MODE_32, NMD_X86_DECODER_FLAGS_ALL)); /* call eax */
+	EXPECT_EQ(instruction.operands[0].fields.reg, NMD_X86_REG_EAX);
+}
+
+TEST(side_tests_suite, vex_decoding_tests)
+{
+	/* The length of a VEX instruction: vzeroupper has no ModR/M byte and only the 0F3A map and a few 0F opcodes have an imm8. */
+	const struct { const char* buffer; size_t length; } lengths[] = {
+		{ "\xc5\xf8\x77", 3 },                 /* vzeroupper */
+		{ "\xc5\xfc\x77", 3 },                 /* vzeroall */
+		{ "\xc5\xf0\x58\xc2", 4 },             /* vaddps xmm0, xmm1, xmm2 */
+		{ "\xc5\xf9\x70\xc1\x1b", 5 },         /* vpshufd xmm0, xmm1, 0x1b */
+		{ "\xc5\xf0\xc2\xc2\x00", 5 },         /* vcmpps xmm0, xmm1, xmm2, 0 */
+		{ "\xc5\xf0\xc6\xc2\x00", 5 },         /* vshufps xmm0, xmm1, xmm2, 0 */
+		{ "\xc4\xe2\x79\x00\xc1", 5 },         /* vpshufb xmm0, xmm0, xmm1 */
+		{ "\xc4\xe2\x75\xb8\x44\x24\x08", 7 }, /* vfmadd231ps ymm0, ymm1, [rsp+8] */
+		{ "\xc4\xe3\x79\x16\xc0\x01", 6 },     /* vpextrd eax, xmm0, 1 */
+		{ "\xc4\xe3\x75\x0c\xc2\x0f", 6 },     /* vblendps ymm0, ymm1, ymm2, 0xf */
+	};
+	nmd_x86_instruction instruction;
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(lengths); i++)
+	{
+		EXPECT_EQ(nmd_x86_ldisasm(lengths[i].buffer, 15, NMD_X86_MODE_64), lengths[i].length) << i;
+		ASSERT_TRUE(nmd_x86_decode(lengths[i].buffer, 15, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)) << i;
+		EXPECT_EQ(instruction.length, lengths[i].length) << i;
+	}
+
+	/* The two byte form encodes VEX.vvvv as well. */
+	ASSERT_TRUE(nmd_x86_decode("\xc5\xf4\x58\xc2", 4, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* vaddps ymm0, ymm1, ymm2 */
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_VADDPS);
+	ASSERT_EQ(instruction.num_operands, 3);
+	EXPECT_EQ(instruction.operands[0].fields.reg, NMD_X86_REG_YMM0);
+	EXPECT_EQ(instruction.operands[1].fields.reg, NMD_X86_REG_YMM1);
+	EXPECT_EQ(instruction.operands[2].fields.reg, NMD_X86_REG_YMM2);
+	EXPECT_EQ(instruction.operands[0].action, NMD_X86_OPERAND_ACTION_WRITE);
+	EXPECT_EQ(instruction.operands[1].action, NMD_X86_OPERAND_ACTION_READ);
+
+	/* VEX.W selects the FMA instruction and the accumulator is read and written. */
+	ASSERT_TRUE(nmd_x86_decode("\xc4\xe2\xf5\xb8\xc2", 5, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* vfmadd231pd ymm0, ymm1, ymm2 */
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_VFMADD231PD);
+	EXPECT_EQ(instruction.operands[0].action, NMD_X86_OPERAND_ACTION_READWRITE);
+	ASSERT_TRUE(nmd_x86_decode("\xc4\xe2\x75\xb8\xc2", 5, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* vfmadd231ps ymm0, ymm1, ymm2 */
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_VFMADD231PS);
+
+	/* A store writes the memory operand and reads the register. */
+	ASSERT_TRUE(nmd_x86_decode("\xc4\xc1\x7c\x29\x00", 5, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL)); /* vmovaps [r8], ymm0 */
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_VMOVAPS);
+	EXPECT_EQ(instruction.operands[0].type, NMD_X86_OPERAND_TYPE_MEMORY);
+	EXPECT_EQ(instruction.operands[0].fields.mem.base, NMD_X86_REG_R8);
+	EXPECT_EQ(instruction.operands[0].action, NMD_X86_OPERAND_ACTION_WRITE);
+	EXPECT_EQ(instruction.operands[1].fields.reg, NMD_X86_REG_YMM0);
+
+	ASSERT_TRUE(nmd_x86_decode("\xc5\xf8\x77", 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_VZEROUPPER);
+	EXPECT_EQ(instruction.num_operands, 0);
+}
+
+TEST(side_tests_suite, decode_cache_tests)
+{
+	uint8_t code[] = {
+		0x48, 0x89, 0xe5,             /* 1000: mov rbp, rsp */
+		0xb8, 0x01, 0x00, 0x00, 0x00, /* 1003: mov eax, 1   */
+		0x90,                         /* 1008: nop          */
+		0xc3                          /* 1009: ret          */
+	};
+	const uint64_t base = 0x1000;
+	const size_t offsets[] = { 0, 3, 8, 9 };
+	nmd_x86_decode_cache_entry entries[100];
+	nmd_x86_decode_cache cache;
+	nmd_x86_instruction instruction, expected;
+
+	nmd_x86_decode_cache_init(&cache, entries, _NMD_NUM_ELEMENTS(entries));
+	EXPECT_EQ(cache.capacity, 64);
+
+	for (size_t pass = 0; pass < 3; pass++)
+	{
+		for (size_t i = 0; i < _NMD_NUM_ELEMENTS(offsets); i++)
+		{
+			ASSERT_TRUE(nmd_x86_decode_cached(&cache, code + offsets[i], sizeof(code) - offsets[i], base + offsets[i], &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+			ASSERT_TRUE(nmd_x86_decode(code + offsets[i], sizeof(code) - offsets[i], &expected, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+			EXPECT_EQ(memcmp(&instruction, &expected, sizeof(instruction)), 0);
+		}
+	}
+	EXPECT_EQ(cache.misses, 4);
+	EXPECT_EQ(cache.hits, 8);
+	EXPECT_EQ(cache.num_entries, 4);
+
+	/* Different flags are cached separately. Invalid instructions are not cached. */
+	EXPECT_TRUE(nmd_x86_decode_cached(&cache, code, sizeof(code), base, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_MINIMAL));
+	EXPECT_EQ(cache.num_entries, 5);
+	EXPECT_FALSE(nmd_x86_decode_cached(&cache, "\x0f\x0b\xff", 1, 0x2000, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(cache.num_entries, 5);
+
+	/* A patch is detected even without invalidation: 'mov eax, 1' becomes 'mov eax, 2' */
+	code[4] = 0x02;
+	EXPECT_TRUE(nmd_x86_decode_cached(&cache, code + 3, sizeof(code) - 3, base + 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(instruction.immediate, 2);
+	EXPECT_EQ(cache.hits, 8);
+
+	/* A buffer too short for the cached instruction updates its slot instead of adding a second entry for the address. */
+	EXPECT_TRUE(nmd_x86_decode_cached(&cache, code + 8, 1, base + 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_NOP);
+	EXPECT_EQ(cache.num_entries, 5);
+	EXPECT_TRUE(nmd_x86_decode_cached(&cache, code + 8, 1, base + 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(cache.hits, 9);
+	EXPECT_TRUE(nmd_x86_decode_cached(&cache, code + 3, sizeof(code) - 3, base + 3, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(instruction.immediate, 2);
+	EXPECT_EQ(cache.num_entries, 5);
+
+	/* Invalidating the byte at 1004 removes the instruction at 1003 only. A range starting before the buffer removes everything that overlaps it. */
+	nmd_x86_decode_cache_invalidate(&cache, base + 4, 1);
+	EXPECT_EQ(cache.num_entries, 4);
+	nmd_x86_decode_cache_invalidate(&cache, 0, base + 9);
+	EXPECT_EQ(cache.num_entries, 1);
+	EXPECT_TRUE(nmd_x86_decode_cached(&cache, code + 9, 1, base + 9, &instruction, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(cache.hits, 10);
+
+	/* Filling the cache beyond its capacity evicts entries but keeps returning correct results. */
+	nmd_x86_decode_cache_clear(&cache);
+	for (size_t pass = 0; pass < 2; pass++)
+	{
+		for (size_t i = 0; i < _NMD_NUM_ELEMENTS(instructions); i++)
+		{
+			const bool valid = nmd_x86_decode_cached(&cache, instructions[i].i.buffer, instructions[i].i.length, 0x10000 + i * 16, &instruction, (NMD_X86_MODE)instructions[i].i.mode, NMD_X86_DECODER_FLAGS_ALL);
+			ASSERT_EQ(valid, nmd_x86_decode(instructions[i].i.buffer, instructions[i].i.length, &expected, (NMD_X86_MODE)instructions[i].i.mode, NMD_X86_DECODER_FLAGS_ALL));
+			if (valid)
+			{
+				EXPECT_EQ(memcmp(&instruction, &expected, sizeof(instruction)), 0);
+			}
+		}
+	}
+	EXPECT_GT(cache.evictions, 0);
+	EXPECT_LE(cache.num_entries, cache.capacity);
+}
+
+TEST(side_tests_suite, cfg_tests)
+{
+	const uint32_t I = NMD_X86_INVALID_BLOCK, E = NMD_X86_CFG_EXIT;
+	uint32_t memory[NMD_X86_CFG_MEMORY_SIZE(7)], workspace[NMD_X86_CFG_WORKSPACE_SIZE(7)], idom[7], ipdom[7], loop_header[7], loop_parent[7];
+	nmd_x86_basic_block blocks[7];
+	nmd_x86_cfg cfg;
+
+	/* The blocks of the function in recursive_descent_tests: 0 -> {1, 2}, 1 -> 2, 2 returns, 3 -> 2(the callee) */
+	const uint32_t function_successors[4][2] = { { 1, 2 }, { 2, I }, { I, I }, { I, 2 } };
+	for (size_t i = 0; i < 4; i++)
+		blocks[i].successors[0] = function_successors[i][0], blocks[i].successors[1] = function_successors[i][1];
+	nmd_x86_cfg_build(&cfg, blocks, 4, memory);
+	ASSERT_EQ(cfg.num_edges, 4);
+	EXPECT_EQ(cfg.successor_offsets[0], 0); EXPECT_EQ(cfg.successor_offsets[1], 2); EXPECT_EQ(cfg.successor_offsets[2], 3); EXPECT_EQ(cfg.successor_offsets[3], 3); EXPECT_EQ(cfg.successor_offsets[4], 4);
+	EXPECT_EQ(cfg.predecessor_offsets[2], 1); EXPECT_EQ(cfg.predecessor_offsets[3], 4);
+	EXPECT_EQ(cfg.predecessors[1], 0); EXPECT_EQ(cfg.predecessors[2], 1); EXPECT_EQ(cfg.predecessors[3], 3);
+
+	nmd_x86_cfg_dominators(&cfg, 0, idom, workspace);
+	EXPECT_EQ(idom[0], 0); EXPECT_EQ(idom[1], 0); EXPECT_EQ(idom[2], 0); EXPECT_EQ(idom[3], I);
+	nmd_x86_cfg_post_dominators(&cfg, ipdom, workspace);
+	EXPECT_EQ(ipdom[0], 2); EXPECT_EQ(ipdom[1], 2); EXPECT_EQ(ipdom[2], E); EXPECT_EQ(ipdom[3], 2);
+	EXPECT_TRUE(nmd_x86_cfg_dominates(idom, 0, 2));
+	EXPECT_FALSE(nmd_x86_cfg_dominates(idom, 1, 2));
+	EXPECT_TRUE(nmd_x86_cfg_dominates(ipdom, 2, 0));
+	EXPECT_EQ(nmd_x86_cfg_loops(&cfg, 0, idom, loop_header, loop_parent, workspace), 0);
+
+	/* Nested loops: 1 is the outer header, 2 the inner one. 6 is an unreachable infinite loop. Its duplicate edge is stored once. */
+	const uint32_t loop_successors[7][2] = { { 1, I }, { 2, 5 }, { 3, I }, { 4, 2 }, { I, 1 }, { I, I }, { 6, 6 } };
+	for (size_t i = 0; i < 7; i++)
+		blocks[i].successors[0] = loop_successors[i][0], blocks[i].successors[1] = loop_successors[i][1];
+	nmd_x86_cfg_build(&cfg, blocks, 7, memory);
+	EXPECT_EQ(cfg.num_edges, 8);
+
+	nmd_x86_cfg_dominators(&cfg, 0, idom, workspace);
+	const uint32_t expected_idom[7] = { 0, 0, 1, 2, 3, 1, I };
+	const uint32_t expected_ipdom[7] = { 1, 5, 3, 4, 1, E, I };
+	nmd_x86_cfg_post_dominators(&cfg, ipdom, workspace);
+	EXPECT_EQ(nmd_x86_cfg_loops(&cfg, 0, idom, loop_header, loop_parent, workspace), 2);
+	const uint32_t expected_loop_header[7] = { I, 1, 2, 2, 1, I, I };
+	const uint32_t expected_loop_parent[7] = { I, I, 1, I, I, I, I };
+	for (size_t i = 0; i < 7; i++)
+	{
+		EXPECT_EQ(idom[i], expected_idom[i]);
+		EXPECT_EQ(ipdom[i], expected_ipdom[i]);
+		EXPECT_EQ(loop_header[i], expected_loop_header[i]);
+		EXPECT_EQ(loop_parent[i], expected_loop_parent[i]);
+	}
+}
+
+TEST(side_tests_suite, timing_tests)
+{
+	const struct { const char* buffer; size_t length; uint32_t cycles_per_iteration, critical_path; uint8_t bottleneck; } tests[] = {
+		{ "\x48\x01\xc8\x48\x01\xd0\x48\x01\xf0\x48\x01\xf8", 12, 400, 4, NMD_X86_BOTTLENECK_DEPENDENCY }, /* add rax, rcx/rdx/rsi/rdi */
+		{ "\x48\x83\xc0\x01\x48\x83\xc1\x01\x48\x83\xc2\x01\x48\x83\xc6\x01", 16, 100, 1, NMD_X86_BOTTLENECK_DEPENDENCY }, /* add rax/rcx/rdx/rsi, 1 */
+		{ "\xf2\x0f\x58\x07\x48\x83\xc7\x08\xff\xc9\x75\xf4", 12, 400, 10, NMD_X86_BOTTLENECK_DEPENDENCY }, /* addsd xmm0, [rdi]; add rdi, 8; dec ecx; jnz */
+		{ "\x66\x0f\x70\xc1\x00\x66\x0f\x70\xd1\x00", 10, 200, 1, NMD_X86_BOTTLENECK_PORTS }, /* pshufd xmm0/xmm2, xmm1, 0 */
+		{ "\x66\x0f\x51\xca\x66\x0f\x51\xda", 8, 1200, 18, NMD_X86_BOTTLENECK_THROUGHPUT }, /* sqrtpd xmm1/xmm3, xmm2 */
+		{ "\x31\xc0\x01\xc8", 4, 50, 1, NMD_X86_BOTTLENECK_FRONT_END }, /* xor eax, eax; add eax, ecx */
+		{ "\x48\x11\xc8", 3, 100, 1, NMD_X86_BOTTLENECK_DEPENDENCY }, /* adc rax, rcx: carried through rax and the carry flag */
+		{ "\xc5\xfc\x10\x0c\x87\xc4\xe2\x75\xb8\x04\x86\x48\x83\xc0\x08\x48\x39\xd0\x75\xef", 20, 400, 10, NMD_X86_BOTTLENECK_DEPENDENCY }, /* vmovups ymm1, [rdi+rax*4]; vfmadd231ps ymm0, ymm1, [rsi+rax*4]; add rax, 8; cmp rax, rdx; jnz */
+		{ "\xc5\xfc\x59\xe9\xc5\xfc\x59\xd1\xc5\xfc\x59\xd9\xc5\xfc\x59\xe1", 16, 200, 4, NMD_X86_BOTTLENECK_PORTS }, /* vmulps ymm5/ymm2/ymm3/ymm4, ymm0, ymm1 */
+	};
+	nmd_x86_instruction block_instructions[8];
+	nmd_x86_instruction_timing timing;
+	nmd_x86_block_timing block;
+
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(tests); i++)
+	{
+		size_t num_instructions = 0, offset = 0;
+		while (offset < tests[i].length)
+		{
+			ASSERT_TRUE(nmd_x86_decode(tests[i].buffer + offset, tests[i].length - offset, &block_instructions[num_instructions], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+			offset += block_instructions[num_instructions++].length;
+		}
+
+		ASSERT_TRUE(nmd_x86_analyze_block_timing(block_instructions, num_instructions, NMD_X86_MICROARCHITECTURE_SKYLAKE, &block));
+		EXPECT_EQ(block.cycles_per_iteration, tests[i].cycles_per_iteration) << i;
+		EXPECT_EQ(block.critical_path, tests[i].critical_path) << i;
+		EXPECT_EQ(block.bottleneck, tests[i].bottleneck) << i;
+		EXPECT_EQ(block.num_estimated, 0) << i;
+	}
+
+	/* The shuffles can only use port 5 */
+	ASSERT_TRUE(nmd_x86_decode("\x66\x0f\x70\xc1\x00", 5, &block_instructions[0], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	ASSERT_TRUE(nmd_x86_analyze_block_timing(block_instructions, 1, NMD_X86_MICROARCHITECTURE_SKYLAKE, &block));
+	EXPECT_EQ(block.bottleneck_port, 5);
+	EXPECT_EQ(block.port_pressure[5], 100);
+
+	/* vfmadd231ps ymm0, ymm1, [rsi]: the accumulator is read and written, the load adds to the latency of the address */
+	ASSERT_TRUE(nmd_x86_decode("\xc4\xe2\x75\xb8\x06", 5, &block_instructions[0], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_EQ(block_instructions[0].id, NMD_X86_INSTRUCTION_VFMADD231PS);
+	EXPECT_EQ(block_instructions[0].regs_read, nmd_x86_get_register_mask(NMD_X86_REG_YMM0) | nmd_x86_get_register_mask(NMD_X86_REG_YMM1) | NMD_X86_REG_MASK_RSI | nmd_x86_get_register_mask(NMD_X86_REG_DS));
+	EXPECT_EQ(block_instructions[0].regs_written, nmd_x86_get_register_mask(NMD_X86_REG_YMM0));
+	EXPECT_TRUE(nmd_x86_get_instruction_timing(&block_instructions[0], NMD_X86_MICROARCHITECTURE_SKYLAKE, &timing));
+	EXPECT_EQ(timing.latency, 4);
+	EXPECT_EQ(timing.load_latency, 6);
+	EXPECT_EQ(timing.loads, 1);
+
+	/* add rax, [rcx]: the load is fused with the addition */
+	ASSERT_TRUE(nmd_x86_decode("\x48\x03\x01", 3, &block_instructions[0], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_TRUE(nmd_x86_get_instruction_timing(&block_instructions[0], NMD_X86_MICROARCHITECTURE_SKYLAKE, &timing));
+	EXPECT_EQ(timing.latency, 1);
+	EXPECT_EQ(timing.load_latency, 5);
+	EXPECT_EQ(timing.loads, 1);
+	EXPECT_EQ(timing.stores, 0);
+	EXPECT_EQ(timing.fused_uops, 1);
+
+	/* mov [rdi], rax: only the store's uops */
+	ASSERT_TRUE(nmd_x86_decode("\x48\x89\x07", 3, &block_instructions[0], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_TRUE(nmd_x86_get_instruction_timing(&block_instructions[0], NMD_X86_MICROARCHITECTURE_SKYLAKE, &timing));
+	EXPECT_EQ(timing.uops, 0);
+	EXPECT_EQ(timing.stores, 1);
+	EXPECT_EQ(timing.fused_uops, 1);
+
+	/* cpuid is not in the table */
+	ASSERT_TRUE(nmd_x86_decode("\x0f\xa2", 2, &block_instructions[0], NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL));
+	EXPECT_FALSE(nmd_x86_get_instruction_timing(&block_instructions[0], NMD_X86_MICROARCHITECTURE_SKYLAKE, &timing));
+	ASSERT_TRUE(nmd_x86_analyze_block_timing(block_instructions, 1, NMD_X86_MICROARCHITECTURE_SKYLAKE, &block));
+	EXPECT_EQ(block.num_estimated, 1);
+}
+
+TEST(side_tests_suite, elf_tests)
+{
+	const auto write = [](uint8_t* p, uint64_t value, size_t size) { for (size_t i = 0; i < size; i++) p[i] = (uint8_t)(value >> (i * 8)); };
+	nmd_x86_code_section sections[4];
+	nmd_x86_section_iterator iterator;
+	nmd_x86_instruction instruction;
+	uint64_t address;
+	nmd_x86_elf elf;
+
+	/* ELF64: the header, the code, the section name table and the section headers(null, .text and .shstrtab). */
+	uint8_t image64[104 + 3 * 64] = { 0x7f, 'E', 'L', 'F', 2, 1, 1 };
+	write(image64 + 16, 2, 2); write(image64 + 18, 62, 2); write(image64 + 24, 0x401000, 8); write(image64 + 40, 104, 8);
+	write(image64 + 52, 64, 2); write(image64 + 58, 64, 2); write(image64 + 60, 3, 2); write(image64 + 62, 2, 2);
+	memcpy(image64 + 64, "\x48\x01\xd8\x06\xc3", 5); /* add rax, rbx; (invalid); ret */
+	memcpy(image64 + 80, "\0.text\0.shstrtab", 17);
+	write(image64 + 168, 1, 4); write(image64 + 172, 1, 4); write(image64 + 176, 6, 8); write(image64 + 184, 0x401000, 8); write(image64 + 192, 64, 8); write(image64 + 200, 5, 8);
+	write(image64 + 232, 7, 4); write(image64 + 236, 3, 4); write(image64 + 256, 80, 8); write(image64 + 264, 17, 8);
+
+	ASSERT_TRUE(nmd_x86_elf_parse(image64, sizeof(image64), &elf));
+	EXPECT_EQ(elf.mode, NMD_X86_MODE_64);
+	EXPECT_EQ(elf.entry, 0x401000);
+	EXPECT_EQ(nmd_x86_elf_get_executable_sections(&elf, NULL, 0), 1);
+	ASSERT_EQ(nmd_x86_elf_get_executable_sections(&elf, sections, 4), 1);
+	EXPECT_STREQ(sections[0].name, ".text");
+	EXPECT_EQ(sections[0].name_length, 5);
+	EXPECT_EQ(sections[0].mode, NMD_X86_MODE_64);
+	EXPECT_EQ(sections[0].code, image64 + 64);
+	EXPECT_EQ(sections[0].size, 5);
+	EXPECT_EQ(sections[0].address, 0x401000);
+
+	const struct { uint64_t address; bool valid; uint8_t length; uint16_t id; } expected[] = {
+		{ 0x401000, true, 3, NMD_X86_INSTRUCTION_ADD },
+		{ 0x401003, false, 1, 0 },
+		{ 0x401004, true, 1, NMD_X86_INSTRUCTION_RET },
+	};
+	nmd_x86_section_iterator_init(&iterator, &sections[0], NMD_X86_DECODER_FLAGS_ALL);
+	for (size_t i = 0; i < _NMD_NUM_ELEMENTS(expected); i++)
+	{
+		ASSERT_TRUE(nmd_x86_section_next_instruction(&iterator, &instruction, &address)) << i;
+		EXPECT_EQ(address, expected[i].address) << i;
+		EXPECT_EQ(instruction.valid, expected[i].valid) << i;
+		EXPECT_EQ(instruction.length, expected[i].length) << i;
+		if (expected[i].valid)
+			EXPECT_EQ(instruction.id, expected[i].id) << i;
+		else
+			EXPECT_EQ(instruction.buffer[0], 0x06) << i;
+	}
+	EXPECT_FALSE(nmd_x86_section_next_instruction(&iterator, &instruction, &address));
+
+	/* Truncated files, other machines and header tables outside the image are rejected. */
+	EXPECT_FALSE(nmd_x86_elf_parse(image64, 60, &elf));
+	EXPECT_FALSE(nmd_x86_elf_parse(image64, sizeof(image64) - 1, &elf));
+	image64[18] = 40; /* EM_ARM */
+	EXPECT_FALSE(nmd_x86_elf_parse(image64, sizeof(image64), &elf));
+
+	/* ELF32 without section headers: the executable 'PT_LOAD' segment is used, the read-only one is skipped. */
+	uint8_t image32[52 + 2 * 32 + 3] = { 0x7f, 'E', 'L', 'F', 1, 1, 1 };
+	write(image32 + 16, 2, 2); write(image32 + 18, 3, 2); write(image32 + 24, 0x8048074, 4); write(image32 + 28, 52, 4);
+	write(image32 + 40, 52, 2); write(image32 + 42, 32, 2); write(image32 + 44, 2, 2);
+	write(image32 + 52, 1, 4); write(image32 + 56, 0, 4); write(image32 + 60, 0x8048000, 4); write(image32 + 68, 116, 4); write(image32 + 76, 4, 4);
+	write(image32 + 84, 1, 4); write(image32 + 88, 116, 4); write(image32 + 92, 0x8048074, 4); write(image32 + 100, 3, 4); write(image32 + 108, 5, 4);
+	memcpy(image32 + 116, "\x31\xc0\xc3", 3); /* xor eax, eax; ret */
+
+	ASSERT_TRUE(nmd_x86_elf_parse(image32, sizeof(image32), &elf));
+	EXPECT_EQ(elf.mode, NMD_X86_MODE_32);
+	ASSERT_EQ(nmd_x86_elf_get_executable_sections(&elf, sections, 4), 1);
+	EXPECT_EQ(sections[0].name_length, 0);
+	EXPECT_EQ(sections[0].mode, NMD_X86_MODE_32);
+	EXPECT_EQ(sections[0].address, 0x8048074);
+	EXPECT_EQ(sections[0].size, 3);
+
+	size_t num_instructions = 0;
+	nmd_x86_section_iterator_init(&iterator, &sections[0], NMD_X86_DECODER_FLAGS_MINIMAL);
+	while (nmd_x86_section_next_instruction(&iterator, &instruction, NULL))
+	{
+		EXPECT_TRUE(instruction.valid);
+		num_instructions++;
+	}
+	EXPECT_EQ(num_instructions, 2);
+}
+
+TEST(side_tests_suite, pe_tests)
+{
+	const auto write = [](uint8_t* p, uint64_t value, size_t size) { for (size_t i = 0; i < size; i++) p[i] = (uint8_t)(value >> (i * 8)); };
+	nmd_x86_code_section sections[4];
+	nmd_x86_section_iterator iterator;
+	nmd_x86_instruction instruction;
+	nmd_x86_pe_symbol symbols[4], symbol;
+	uint64_t address;
+	nmd_x86_pe pe;
+
+	/* PE32+ with .text(RVA 1000h, file offset 200h) and .rdata(RVA 2000h, file offset 400h), which holds the export and import tables. */
+	static uint8_t image[0x600];
+	uint8_t* const rdata = image + 0x400 - 0x2000; /* Indexed by RVA. */
+	image[0] = 'M', image[1] = 'Z'; write(image + 0x3c, 0x40, 4);
+	memcpy(image + 0x40, "PE\0\0", 4); write(image + 0x44, 0x8664, 2); write(image + 0x46, 2, 2); write(image + 0x54, 0xf0, 2);
+	write(image + 0x58, 0x20b, 2); write(image + 0x68, 0x1000, 4); write(image + 0x70, 0x140000000, 8); write(image + 0x94, 0x200, 4); write(image + 0xc4, 16, 4);
+	write(image + 0xc8, 0x2000, 4); write(image + 0xcc, 0x100, 4); write(image + 0xd0, 0x2100, 4); write(image + 0xd4, 40, 4);
+	memcpy(image + 0x148, ".text", 5); write(image + 0x150, 7, 4); write(image + 0x154, 0x1000, 4); write(image + 0x158, 0x200, 4); write(image + 0x15c, 0x200, 4); write(image + 0x16c, 0x60000020, 4);
+	memcpy(image + 0x170, ".rdata", 6); write(image + 0x178, 0x200, 4); write(image + 0x17c, 0x2000, 4); write(image + 0x180, 0x200, 4); write(image + 0x184, 0x400, 4); write(image + 0x194, 0x40000040, 4);
+	memcpy(image + 0x200, "\xff\x15\x5a\x11\x00\x00\xc3", 7); /* call [rip+115Ah](the first import address table slot); ret */
+
+	/* Three exports: ordinal 1 at 1006h without a name, "alpha"(ordinal 2) at 1000h and "beta"(ordinal 3) forwarded to "NTDLL.Foo". */
+	write(rdata + 0x200c, 0x2080, 4); write(rdata + 0x2010, 1, 4); write(rdata + 0x2014, 3, 4); write(rdata + 0x2018, 2, 4);
+	write(rdata + 0x201c, 0x2040, 4); write(rdata + 0x2020, 0x2050, 4); write(rdata + 0x2024, 0x2058, 4);
+	write(rdata + 0x2040, 0x1006, 4); write(rdata + 0x2044, 0x1000, 4); write(rdata + 0x2048, 0x2090, 4);
+	write(rdata + 0x2050, 0x20a0, 4); write(rdata + 0x2054, 0x20a8, 4); write(rdata + 0x2058, 1, 2); write(rdata + 0x205a, 2, 2);
+	memcpy(rdata + 0x2080, "test.dll", 9); memcpy(rdata + 0x2090, "NTDLL.Foo", 10); memcpy(rdata + 0x20a0, "alpha", 6); memcpy(rdata + 0x20a8, "beta", 5);
+
+	/* Two imports from KERNEL32.dll: "CreateFileW"(hint 42h) and ordinal 7. */
+	write(rdata + 0x2100, 0x2140, 4); write(rdata + 0x210c, 0x2180, 4); write(rdata + 0x2110, 0x2160, 4);
+	write(rdata + 0x2140, 0x2190, 8); write(rdata + 0x2148, 0x8000000000000007, 8);
+	write(rdata + 0x2160, 0x2190, 8); write(rdata + 0x2168, 0x8000000000000007, 8);
+	memcpy(rdata + 0x2180, "KERNEL32.dll", 13); write(rdata + 0x2190, 0x42, 2); memcpy(rdata + 0x2192, "CreateFileW", 12);
+
+	ASSERT_TRUE(nmd_x86_pe_parse(image, sizeof(image), &pe));
+	EXPECT_EQ(pe.mode, NMD_X86_MODE_64);
+	EXPECT_EQ(pe.image_base, 0x140000000);
+	EXPECT_EQ(pe.entry, 0x1000);
+	EXPECT_EQ(pe.num_exports, 3);
+
+	EXPECT_EQ(nmd_x86_pe_rva_to_pointer(&pe, 0x2180, 13), image + 0x580);
+	EXPECT_EQ(nmd_x86_pe_rva_to_pointer(&pe, 0x3c, 4), image + 0x3c);
+	EXPECT_EQ(nmd_x86_pe_rva_to_pointer(&pe, 0x21ff, 2), (const void*)NULL);
+	EXPECT_EQ(nmd_x86_pe_rva_to_pointer(&pe, 0x2200, 1), (const void*)NULL);
+
+	ASSERT_EQ(nmd_x86_pe_get_executable_sections(&pe, sections, 4), 1);
+	EXPECT_EQ(std::string(sections[0].name, sections[0].name_length), ".text");
+	EXPECT_EQ(sections[0].code, image + 0x200);
+	EXPECT_EQ(sections[0].size, 7);
+	EXPECT_EQ(sections[0].address, 0x140001000);
+	EXPECT_EQ(sections[0].mode, NMD_X86_MODE_64);
+
+	nmd_x86_section_iterator_init(&iterator, &sections[0], NMD_X86_DECODER_FLAGS_ALL);
+	ASSERT_TRUE(nmd_x86_section_next_instruction(&iterator, &instruction, &address));
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_CALL);
+	EXPECT_EQ(address + instruction.length + instruction.displacement - pe.image_base, 0x2160);
+	ASSERT_TRUE(nmd_x86_section_next_instruction(&iterator, &instruction, &address));
+	EXPECT_EQ(instruction.id, NMD_X86_INSTRUCTION_RET);
+	EXPECT_EQ(address, 0x140001006);
+	EXPECT_FALSE(nmd_x86_section_next_instruction(&iterator, &instruction, &address));
+
+	/* Exports sorted by RVA. */
+	ASSERT_EQ(nmd_x86_pe_get_exports(&pe, symbols, 4), 3);
+	EXPECT_EQ(symbols[0].rva, 0x1000);
+	EXPECT_STREQ(symbols[0].name, "alpha");
+	EXPECT_EQ(symbols[0].ordinal, 2);
+	EXPECT_STREQ(symbols[0].module, "test.dll");
+	EXPECT_EQ(symbols[0].forwarder, (const char*)NULL);
+	EXPECT_EQ(symbols[1].rva, 0x1006);
+	EXPECT_EQ(symbols[1].name, (const char*)NULL);
+	EXPECT_EQ(symbols[1].ordinal, 1);
+	EXPECT_STREQ(symbols[2].name, "beta");
+	EXPECT_STREQ(symbols[2].forwarder, "NTDLL.Foo");
+	EXPECT_EQ(nmd_x86_pe_find_symbol(symbols, 3, 0x1006), &symbols[1]);
+	EXPECT_EQ(nmd_x86_pe_find_symbol(symbols, 3, 0x1004), (const nmd_x86_pe_symbol*)NULL);
+
+	ASSERT_TRUE(nmd_x86_pe_find_export(&pe, "alpha", &symbol));
+	EXPECT_EQ(symbol.rva, 0x1000);
+	EXPECT_EQ(symbol.ordinal, 2);
+	ASSERT_TRUE(nmd_x86_pe_find_export(&pe, "beta", &symbol));
+	EXPECT_STREQ(symbol.forwarder, "NTDLL.Foo");
+	EXPECT_FALSE(nmd_x86_pe_find_export(&pe, "alph", &symbol));
+	EXPECT_FALSE(nmd_x86_pe_find_export(&pe, "gamma", &symbol));
+
+	/* Imports sorted by the RVA of their import address table slot. */
+	EXPECT_EQ(nmd_x86_pe_get_imports(&pe, NULL, 0), 2);
+	ASSERT_EQ(nmd_x86_pe_get_imports(&pe, symbols, 4), 2);
+	EXPECT_EQ(symbols[0].rva, 0x2160);
+	EXPECT_STREQ(symbols[0].module, "KERNEL32.dll");
+	EXPECT_STREQ(symbols[0].name, "CreateFileW");
+	EXPECT_EQ(symbols[0].ordinal, 0x42);
+	EXPECT_EQ(symbols[1].rva, 0x2168);
+	EXPECT_EQ(symbols[1].name, (const char*)NULL);
+	EXPECT_EQ(symbols[1].ordinal, 7);
+	EXPECT_EQ(nmd_x86_pe_find_symbol(symbols, 2, 0x2160), &symbols[0]);
+
+	/* Truncated files, other machines and mismatched optional headers are rejected. */
+	EXPECT_FALSE(nmd_x86_pe_parse(image, 0x190, &pe));
+	write(image + 0x58, 0x10b, 2);
+	EXPECT_FALSE(nmd_x86_pe_parse(image, sizeof(image), &pe));
+	write(image + 0x58, 0x20b, 2); write(image + 0x44, 0xaa64, 2); /* ARM64 */
+	EXPECT_FALSE(nmd_x86_pe_parse(image, sizeof(image), &pe));
+}
+
+TEST(side_tests_suite, signature_tests)
+{
+	/* mov rax,[rip+10h]; call rax; mov r11,[rip-10h]; call r11; mov eax,[rbp-4]; add rsp,8; lea rax,[rax+rcx*8]; call 0; ret */
+	const uint8_t code[] = { 0x48, 0x8b, 0x05, 0x10, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x4c, 0x8b, 0x1d, 0xf0, 0xff, 0xff, 0xff, 0x41, 0xff, 0xd3, 0x8b, 0x45, 0xfc,
+		0x48, 0x83, 0xc4, 0x08, 0x48, 0x8d, 0x04, 0xc8, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xc3 };
+	const char* const queries[] = {
+		"mov r64, [rip+?] ; call ?",
+		"MOV REG32, [RBP-4]",
+		"add rsp, 8",
+		"add r64, -8",
+		"lea rax, [rax+rcx*8]",
+		"lea ?, [reg+reg*?]",
+		"lea ?, [rax+rcx]",
+		"?; ret",
+		"call imm",
+		"mov r64, [?]",
+		"mov r64, [rip+?]; call r64; mov",
+	};
+	const size_t num_signatures = sizeof(queries) / sizeof(queries[0]);
+	nmd_x86_signature_element elements[sizeof(queries) / sizeof(queries[0])][4];
+	nmd_x86_signature signatures[sizeof(queries) / sizeof(queries[0])];
+	uint32_t memory[NMD_X86_SIGNATURE_SET_MEMORY_SIZE(sizeof(queries) / sizeof(queries[0]))];
+	nmd_x86_instruction instructions[16];
+	nmd_x86_signature_element scratch[4];
+	nmd_x86_signature_match matches[16];
+	nmd_x86_signature_set set;
+
+	const size_t num_instructions = nmd_x86_decode_buffer(code, sizeof(code), instructions, 16, NMD_X86_MODE_64, NMD_X86_DECODER_FLAGS_ALL, 0);
+	ASSERT_EQ(num_instructions, 9);
+
+	for (size_t i = 0; i < num_signatures; i++)
+	{
+		signatures[i].elements = elements[i];
+		signatures[i].num_elements = nmd_x86_signature_compile(queries[i], elements[i], 4);
+		EXPECT_NE(signatures[i].num_elements, 0) << queries[i];
+	}
+	EXPECT_EQ(signatures[0].num_elements, 2);
+	EXPECT_EQ(elements[0][0].id, NMD_X86_INSTRUCTION_MOV);
+	EXPECT_EQ(elements[0][1].num_operands, 1);
+	EXPECT_EQ(elements[2][0].num_operands, 2);
+	EXPECT_EQ(elements[10][2].num_operands, NMD_X86_SIGNATURE_ANY_OPERANDS);
+
+	/* Invalid queries and queries that don't fit. */
+	EXPECT_EQ(nmd_x86_signature_compile("bogus", scratch, 4), 0);
+	EXPECT_EQ(nmd_x86_signature_compile("mov rax,", scratch, 4), 0);
+	EXPECT_EQ(nmd_x86_signature_compile("mov [rax*3], eax", scratch, 4), 0);
+	EXPECT_EQ(nmd_x86_signature_compile("nop; nop", scratch, 1), 0);
+
+	/* The registers and the displacement differ but the signature matches both. */
+	EXPECT_TRUE(nmd_x86_signature_matches(&signatures[0], instructions, num_instructions));
+	EXPECT_TRUE(nmd_x86_signature_matches(&signatures[0], instructions + 2, num_instructions - 2));
+	EXPECT_FALSE(nmd_x86_signature_matches(&signatures[0], instructions + 4, num_instructions - 4));
+	EXPECT_FALSE(nmd_x86_signature_matches(&signatures[7], instructions + 8, 1));
+
+	nmd_x86_signature_set_init(&set, signatures, num_signatures, memory);
+	const uint32_t expected[][2] = { {0, 0}, {9, 0}, {10, 0}, {0, 2}, {9, 2}, {10, 2}, {1, 4}, {2, 5}, {4, 6}, {5, 6}, {7, 7}, {8, 7} };
+	const size_t num_expected = sizeof(expected) / sizeof(expected[0]);
+	ASSERT_EQ(nmd_x86_signature_scan(&set, instructions, num_instructions, matches, 16), num_expected);
+	for (size_t i = 0; i < num_expected; i++)
+	{
+		EXPECT_EQ(matches[i].signature, expected[i][0]);
+		EXPECT_EQ(matches[i].instruction, expected[i][1]);
+	}
+
+	/* The total is returned even if the matches don't fit. */
+	EXPECT_EQ(nmd_x86_signature_scan(&set, instructions, num_instructions, matches, 2), num_expected);
+	EXPECT_EQ(nmd_x86_signature_scan(&set, instructions, num_instructions, 0, 0), num_expected);
+}
+
+TEST(side_tests_suite, xref_tests)
+{
+	const uint8_t code[] = {
+		0xe8, 0x0b, 0x00, 0x00, 0x00,             /* 401000: call 401010h */
+		0x48, 0x8b, 0x05, 0xf4, 0x0f, 0x00, 0x00, /* 401005: mov rax,[rip+0ff4h](402000h) */
+		0x74, 0x02,                               /* 40100c: jz 401010h */
+		0xcc, 0xcc,                               /* 40100e: int3; int3 */
+		0x89, 0x05, 0xea, 0x0f, 0x00, 0x00,       /* 401010: mov [rip+0feah],eax(402000h) */
+		0x48, 0x8d, 0x0d, 0xe3, 0xff, 0xff, 0xff, /* 401016: lea rcx,[rip-1dh](401000h) */
+		0xb8, 0x00, 0x20, 0x40, 0x00,             /* 40101d: mov eax,402000h */
+		0x68, 0x00, 0x00, 0x00, 0x01,             /* 401022: push 1000000h(outside the image) */
+		0xff, 0x15, 0xd3, 0x0f, 0x00, 0x00,       /* 401027: call [rip+0fd3h](402000h) */
+		0xc3                                      /* 40102d: ret */
+	};
+	nmd_x86_code_section section;
+	section.name = ".text";
+	section.name_length = 5;
+	section.code = code;
+	section.size = sizeof(code);
+	section.address = 0x401000;
+	section.mode = NMD_X86_MODE_64;
+
+	nmd_x86_xref by_source[16], by_target[16], workspace[16], runs_by_source[2][8], runs_by_target[2][8], merged[16];
+	const nmd_x86_xref* xrefs;
+	nmd_x86_xref_index index;
+
+	const size_t num_xrefs = nmd_x86_xref_collect(&section, 0x400000, 0x10000, 0, 0, sizeof(code), by_source, 16);
+	ASSERT_EQ(num_xrefs, 7);
+	const uint32_t expected_sources[] = { 0x1000, 0x1005, 0x100c, 0x1010, 0x1016, 0x101d, 0x1027 };
+	const uint64_t expected_targets[] = { 0x401010, 0x402000, 0x401010, 0x402000, 0x401000, 0x402000, 0x402000 };
+	const uint8_t expected_types[] = { NMD_X86_XREF_TYPE_CALL, NMD_X86_XREF_TYPE_READ, NMD_X86_XREF_TYPE_JUMP, NMD_X86_XREF_TYPE_WRITE, NMD_X86_XREF_TYPE_ADDRESS, NMD_X86_XREF_TYPE_ADDRESS, NMD_X86_XREF_TYPE_READ };
+	for (size_t i = 0; i < num_xrefs; i++)
+	{
+		EXPECT_EQ(by_source[i].source, expected_sources[i]);
+		EXPECT_EQ(by_source[i].target, expected_targets[i]);
+		EXPECT_EQ(by_source[i].type, expected_types[i]);
+	}
+	EXPECT_EQ(nmd_x86_xref_collect(&section, 0x400000, 0x10000, 0, 0, sizeof(code), 0, 0), 7);
+
+	nmd_x86_xref_sort_by_target(by_source, num_xrefs, by_target, workspace);
+	nmd_x86_xref_index_init(&index, 0x400000, by_source, by_target, num_xrefs);
+
+	/* Who references 402000h, sorted by source. */
+	ASSERT_EQ(nmd_x86_xref_find_to(&index, 0x402000, &xrefs), 4);
+	EXPECT_EQ(xrefs[0].source, 0x1005);
+	EXPECT_EQ(xrefs[1].source, 0x1010);
+	EXPECT_EQ(xrefs[2].source, 0x101d);
+	EXPECT_EQ(xrefs[3].source, 0x1027);
+	ASSERT_EQ(nmd_x86_xref_find_to(&index, 0x401010, &xrefs), 2);
+	EXPECT_EQ(xrefs[0].type, NMD_X86_XREF_TYPE_CALL);
+	EXPECT_EQ(xrefs[1].type, NMD_X86_XREF_TYPE_JUMP);
+	EXPECT_EQ(nmd_x86_xref_find_to(&index, 0x401000, &xrefs), 1);
+	EXPECT_EQ(nmd_x86_xref_find_to(&index, 0x401001, &xrefs), 0);
+	EXPECT_EQ(nmd_x86_xref_find_to(&index, 0x500000, &xrefs), 0);
+
+	ASSERT_EQ(nmd_x86_xref_find_from(&index, 0x401016, &xrefs), 1);
+	EXPECT_EQ(xrefs[0].target, 0x401000);
+	EXPECT_EQ(nmd_x86_xref_find_from(&index, 0x401022, &xrefs), 0);
+	EXPECT_EQ(nmd_x86_xref_find_from(&index, 0x300000, &xrefs), 0);
+
+	/* Two threads: each one collects and sorts a chunk of the section, then the runs are merged. The result equals the sequential build. */
+	uint32_t bitmap[(sizeof(code) + 31) / 32] = { 0 };
+	nmd_x86_ldisasm_bulk(code, sizeof(code), NMD_X86_MODE_64, bitmap);
+	nmd_x86_xref_run runs[2];
+	size_t run_sizes[2];
+	std::thread threads[2];
+	for (size_t t = 0; t < 2; t++)
+	{
+		threads[t] = std::thread([&, t]() {
+			run_sizes[t] = nmd_x86_xref_collect(&section, 0x400000, 0x10000, bitmap, t == 0 ? 0 : 0x10, t == 0 ? 0x10 : sizeof(code), runs_by_source[t], 8);
+			nmd_x86_xref workspace_t[8];
+			nmd_x86_xref_sort_by_target(runs_by_source[t], run_sizes[t], runs_by_target[t], workspace_t);
+		});
+	}
+	threads[0].join();
+	threads[1].join();
+	EXPECT_EQ(run_sizes[0], 3);
+	EXPECT_EQ(run_sizes[1], 4);
+
+	for (size_t t = 0; t < 2; t++)
+		runs[t].xrefs = runs_by_source[t], runs[t].num_xrefs = run_sizes[t];
+	ASSERT_EQ(nmd_x86_xref_merge(runs, 2, false, merged), num_xrefs);
+	for (size_t i = 0; i < num_xrefs; i++)
+		EXPECT_TRUE(merged[i].source == by_source[i].source && merged[i].target == by_source[i].target && merged[i].type == by_source[i].type);
+
+	for (size_t t = 0; t < 2; t++)
+		runs[t].xrefs = runs_by_target[t], runs[t].num_xrefs = run_sizes[t];
+	ASSERT_EQ(nmd_x86_xref_merge(runs, 2, true, merged), num_xrefs);
+	for (size_t i = 0; i < num_xrefs; i++)
+		EXPECT_TRUE(merged[i].source == by_target[i].source && merged[i].target == by_target[i].target && merged[i].type == by_target[i].type);
+
+	/* 32-bit mode: '[disp32]' is an absolute address. */
+	const uint8_t code32[] = { 0xa1, 0x00, 0x20, 0x40, 0x00, 0x89, 0x0d, 0x04, 0x20, 0x40, 0x00 }; /* mov eax,[402000h]; mov [402004h],ecx */
+	section.code = code32;
+	section.size = sizeof(code32);
+	section.mode = NMD_X86_MODE_32;
+	ASSERT_EQ(nmd_x86_xref_collect(&section, 0x400000, 0x10000, 0, 0, sizeof(code32), by_source, 16), 2);
+	EXPECT_EQ(by_source[0].target, 0x402000);
+	EXPECT_EQ(by_source[0].type, NMD_X86_XREF_TYPE_READ);
+	EXPECT_EQ(by_source[1].target, 0x402004);
+	EXPECT_EQ(by_source[1].type, NMD_X86_XREF_TYPE_WRITE);
+}
+
+TEST(side_tests_suite, functions_tests)
+{
+	const uint8_t code[] = {
+		0x55,                         /* 1000: push rbp */
+		0x48, 0x89, 0xe5,             /* 1001: mov rbp,rsp */
+		0xe8, 0x07, 0x00, 0x00, 0x00, /* 1004: call 1010h */
+		0x5d,                         /* 1009: pop rbp */
+		0xc3,                         /* 100a: ret */
+		0xcc, 0xcc, 0xcc, 0xcc, 0xcc, /* 100b: int3 x5 */
+		0x31, 0xc0,                   /* 1010: xor eax,eax */
+		0xe9, 0x0d, 0x00, 0x00, 0x00, /* 1012: jmp 1024h(tail call) */
+		0x0f, 0x1f, 0x00,             /* 1017: nop dword ptr [rax] */
+		0xf3, 0x0f, 0x1e, 0xfa,       /* 101a: endbr64 */
+		0x48, 0x83, 0xc0, 0x01,       /* 101e: add rax,1 */
+		0xeb, 0xfa,                   /* 1022: jmp 101eh */
+		0x48, 0x89, 0xc8,             /* 1024: mov rax,rcx */
+		0xc3,                         /* 1027: ret */
+		0x90                          /* 1028: nop */
+	};
+	nmd_x86_code_section sections[2];
+	for (size_t i = 0; i < 2; i++)
+	{
+		sections[i].name = ".text";
+		sections[i].name_length = 5;
+		sections[i].code = code;
+		sections[i].size = sizeof(code);
+		sections[i].address = 0x1000 + i * 0x1000;
+		sections[i].mode = NMD_X86_MODE_64;
+	}
+
+	const uint64_t entry = 0x1000;
+	uint8_t map[sizeof(code)];
+	nmd_x86_function functions[8];
+	ASSERT_EQ(nmd_x86_find_functions(&sections[0], &entry, 1, map, functions, 8), 4);
+
+	const uint64_t expected_starts[] = { 0x1000, 0x1010, 0x101a, 0x1024 };
+	const uint64_t expected_ends[] = { 0x100b, 0x1017, 0x1024, 0x1028 };
+	const uint8_t expected_reasons[] = {
+		NMD_X86_FUNCTION_REASON_ENTRY | NMD_X86_FUNCTION_REASON_PROLOGUE,
+		NMD_X86_FUNCTION_REASON_CALL_TARGET | NMD_X86_FUNCTION_REASON_PADDING,
+		NMD_X86_FUNCTION_REASON_PROLOGUE,
+		NMD_X86_FUNCTION_REASON_TAIL_CALL
+	};
+	for (size_t i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(functions[i].start, expected_starts[i]);
+		EXPECT_EQ(functions[i].end, expected_ends[i]);
+		EXPECT_EQ(functions[i].reasons, expected_reasons[i]);
+	}
+
+	/* Only the first functions are stored, but their ends are still set and the total is returned. */
+	nmd_x86_function first[2];
+	EXPECT_EQ(nmd_x86_find_functions(&sections[0], 0, 0, map, first, 2), 4);
+	EXPECT_EQ(first[0].reasons, NMD_X86_FUNCTION_REASON_PROLOGUE);
+	EXPECT_EQ(first[1].end, 0x1017);
+	EXPECT_EQ(nmd_x86_find_functions(&sections[0], 0, 0, map, 0, 0), 4);
+
+	/* One thread per section. */
+	uint8_t maps[2][sizeof(code)];
+	nmd_x86_function results[2][8];
+	size_t counts[2];
+	std::thread threads[2];
+	for (size_t i = 0; i < 2; i++)
+		threads[i] = std::thread([&, i]() { counts[i] = nmd_x86_find_functions(&sections[i], 0, 0, maps[i], results[i], 8); });
+	for (size_t i = 0; i < 2; i++)
+		threads[i].join();
+	for (size_t i = 0; i < 2; i++)
+	{
+		ASSERT_EQ(counts[i], 4);
+		for (size_t j = 0; j < 4; j++)
+		{
+			EXPECT_EQ(results[i][j].start, expected_starts[j] + i * 0x1000);
+			EXPECT_EQ(results[i][j].end, expected_ends[j] + i * 0x1000);
+		}
+	}
+}
+
+TEST(side_tests_suite, jump_table_tests)
+{
+	const uint8_t code[] = {
+		0x83, 0xff, 0x03,                         /* 1000: cmp edi,3 */
+		0x77, 0x24,                               /* 1003: ja 1029h */
+		0x89, 0xf8,                               /* 1005: mov eax,edi */
+		0x48, 0x8d, 0x15, 0xf2, 0x0f, 0x00, 0x00, /* 1007: lea rdx,[rip+0ff2h](2000h) */
+		0x48, 0x63, 0x04, 0x82,                   /* 100e: movsxd rax,[rdx+rax*4] */
+		0x48, 0x01, 0xd0,                         /* 1012: add rax,rdx */
+		0xff, 0xe0,                               /* 1015: jmp rax */
+		0xb8, 0x01, 0x00, 0x00, 0x00, 0xc3,       /* 1017: mov eax,1; ret */
+		0xb8, 0x02, 0x00, 0x00, 0x00, 0xc3,       /* 101d: mov eax,2; ret */
+		0xb8, 0x03, 0x00, 0x00, 0x00, 0xc3,       /* 1023: mov eax,3; ret */
+		0x31, 0xc0, 0xc3,                         /* 1029: xor eax,eax; ret */
+		0x83, 0xfe, 0x02,                         /* 102c: cmp esi,2 */
+		0x73, 0x0b,                               /* 102f: jae 103ch */
+		0xff, 0x24, 0xf5, 0x10, 0x20, 0x00, 0x00, /* 1031: jmp [rsi*8+2010h] */
+		0xb0, 0x05, 0xc3,                         /* 1038: mov al,5; ret */
+		0xc3,                                     /* 103b: ret */
+		0xc3,                                     /* 103c: ret */
+		0xcc                                      /* 103d: int3(unreachable) */
+	};
+	const uint8_t rodata[] = {
+		0x17, 0xf0, 0xff, 0xff, 0x1d, 0xf0, 0xff, 0xff, 0x23, 0xf0, 0xff, 0xff, 0x2c, 0xf0, 0xff, 0xff, /* 2000: 1017h-2000h, 101dh-2000h, 1023h-2000h, 102ch-2000h */
+		0x38, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  /* 2010: 1038h, 103bh */
+	};
+	nmd_x86_code_section regions[2];
+	regions[0].code = code;
+	regions[0].size = sizeof(code);
+	regions[0].address = 0x1000;
+	regions[1].code = rodata;
+	regions[1].size = sizeof(rodata);
+	regions[1].address = 0x2000;
+
+	uint8_t code_map[sizeof(code)];
+	uint32_t queue[16];
+	nmd_x86_recursive_descent rd;
+	nmd_x86_recursive_descent_init(&rd, code, sizeof(code), NMD_X86_MODE_64, code_map, queue, 16);
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+
+	/* The second switch is only reachable through the first table. */
+	nmd_x86_jump_table tables[4];
+	ASSERT_EQ(nmd_x86_recursive_descent_resolve_jump_tables(&rd, 0x1000, regions, 2, tables, 4), 2);
+
+	/* The queue is restored and the changed range covers the code explored by every round. */
+	EXPECT_EQ(rd.queue_capacity, 16);
+	EXPECT_EQ(rd.changed_begin, 0);
+	EXPECT_GE(rd.changed_end, 0x3c);
+
+	EXPECT_EQ(tables[0].jump, 0x15);
+	EXPECT_EQ(tables[0].table, 0x2000);
+	EXPECT_EQ(tables[0].base, 0x2000);
+	EXPECT_EQ(tables[0].num_entries, 4);
+	EXPECT_EQ(tables[0].entry_size, 4);
+	EXPECT_EQ(tables[0].type, NMD_X86_JUMP_TABLE_ENTRY_OFFSET);
+
+	EXPECT_EQ(tables[1].jump, 0x31);
+	EXPECT_EQ(tables[1].table, 0x2010);
+	EXPECT_EQ(tables[1].base, 0);
+	EXPECT_EQ(tables[1].num_entries, 2);
+	EXPECT_EQ(tables[1].entry_size, 8);
+	EXPECT_EQ(tables[1].type, NMD_X86_JUMP_TABLE_ENTRY_ABSOLUTE);
+
+	uint64_t targets[4];
+	ASSERT_EQ(nmd_x86_jump_table_read(&tables[0], regions, 2, targets, 4), 4);
+	EXPECT_EQ(targets[0], 0x1017);
+	EXPECT_EQ(targets[1], 0x101d);
+	EXPECT_EQ(targets[2], 0x1023);
+	EXPECT_EQ(targets[3], 0x102c);
+	ASSERT_EQ(nmd_x86_jump_table_read(&tables[1], regions, 2, targets, 1), 2);
+	EXPECT_EQ(targets[0], 0x1038);
+	EXPECT_EQ(nmd_x86_jump_table_read(&tables[1], regions, 1, 0, 0), 0);
+
+	const size_t cases[] = { 0x17, 0x1d, 0x23, 0x2c, 0x38, 0x3b };
+	for (size_t i = 0; i < 6; i++)
+		EXPECT_TRUE(code_map[cases[i]] & NMD_X86_CODE_MAP_LEADER);
+	EXPECT_EQ(code_map[0x3d], 0);
+
+	nmd_x86_basic_block blocks[16];
+	const size_t num_blocks = nmd_x86_build_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, blocks, 16);
+	ASSERT_LE(num_blocks, 16);
+	EXPECT_EQ(blocks[1].begin, 0x05);
+	EXPECT_EQ(blocks[1].type, NMD_X86_BLOCK_END_JUMP_TABLE);
+
+	/* 32-bit 'jmp [eax*4+table]'. A table that doesn't fit in the regions is not resolved. */
+	const uint8_t code32[] = {
+		0x3d, 0x02, 0x00, 0x00, 0x00,             /* 0: cmp eax,2 */
+		0x77, 0x07,                               /* 5: ja 0eh */
+		0xff, 0x24, 0x85, 0x00, 0x30, 0x00, 0x00, /* 7: jmp [eax*4+3000h] */
+		0xc3                                      /* e: ret */
+	};
+	const uint8_t table32[] = { 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00 };
+	nmd_x86_code_section region32;
+	region32.code = table32;
+	region32.size = sizeof(table32);
+	region32.address = 0x3000;
+
+	nmd_x86_recursive_descent_init(&rd, code32, sizeof(code32), NMD_X86_MODE_32, code_map, queue, 16);
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+	nmd_x86_recursive_descent_run(&rd);
+	ASSERT_TRUE(nmd_x86_resolve_jump_table(&rd, 0, 7, &tables[0]));
+	EXPECT_EQ(tables[0].table, 0x3000);
+	EXPECT_EQ(tables[0].num_entries, 3);
+	EXPECT_EQ(tables[0].entry_size, 4);
+	EXPECT_FALSE(nmd_x86_resolve_jump_table(&rd, 0, 5, &tables[0]));
+
+	region32.size = 8;
+	EXPECT_EQ(nmd_x86_recursive_descent_resolve_jump_tables(&rd, 0, &region32, 1, tables, 4), 0);
+	EXPECT_EQ(code_map[7] >> NMD_X86_CODE_MAP_END_SHIFT, NMD_X86_BLOCK_END_INDIRECT);
+	region32.size = sizeof(table32);
+	EXPECT_EQ(nmd_x86_recursive_descent_resolve_jump_tables(&rd, 0, &region32, 1, 0, 0), 1);
+	EXPECT_EQ(code_map[7] >> NMD_X86_CODE_MAP_END_SHIFT, NMD_X86_BLOCK_END_JUMP_TABLE);
+
+	/* The index is zero extended by 'movzx' between the bounds check and the jump. The 'jmp rdx' that follows is not a table. */
+	const uint8_t code_movzx[] = {
+		0x83, 0xf9, 0x02,                         /* 0: cmp ecx,2 */
+		0x77, 0x0c,                               /* 3: ja 11h */
+		0x0f, 0xb6, 0xc1,                         /* 5: movzx eax,cl */
+		0xff, 0x24, 0xc5, 0x00, 0x40, 0x00, 0x00, /* 8: jmp [rax*8+4000h] */
+		0xc3,                                     /* f: ret */
+		0xc3,                                     /* 10: ret */
+		0xff, 0xe2                                /* 11: jmp rdx */
+	};
+	const uint8_t table_movzx[] = { 0x0f, 0, 0, 0, 0, 0, 0, 0, 0x10, 0, 0, 0, 0, 0, 0, 0, 0x0f, 0, 0, 0, 0, 0, 0, 0 };
+	nmd_x86_code_section region_movzx;
+	region_movzx.code = table_movzx;
+	region_movzx.size = sizeof(table_movzx);
+	region_movzx.address = 0x4000;
+
+	nmd_x86_recursive_descent_init(&rd, code_movzx, sizeof(code_movzx), NMD_X86_MODE_64, code_map, queue, 16);
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+	ASSERT_EQ(nmd_x86_recursive_descent_resolve_jump_tables(&rd, 0, &region_movzx, 1, tables, 4), 1);
+	EXPECT_EQ(tables[0].jump, 8);
+	EXPECT_EQ(tables[0].num_entries, 3);
+	EXPECT_EQ(tables[0].entry_size, 8);
+	EXPECT_TRUE(code_map[0x10] & NMD_X86_CODE_MAP_LEADER);
+	EXPECT_EQ(code_map[0x11] >> NMD_X86_CODE_MAP_END_SHIFT, NMD_X86_BLOCK_END_INDIRECT);
+	EXPECT_EQ(rd.queue_capacity, 16);
+}
+
+TEST(side_tests_suite, incremental_analysis_tests)
+{
+	uint8_t code[] = {
+		0xe8, 0x0b, 0x00, 0x00, 0x00, /* 1000: call 1010h */
+		0x74, 0x09,                   /* 1005: jz 1010h */
+		0xb8, 0x10, 0x10, 0x00, 0x00, /* 1007: mov eax,1010h */
+		0xc3,                         /* 100c: ret */
+		0xcc, 0xcc, 0xcc,             /* 100d: int3 x3 */
+		0x31, 0xc0,                   /* 1010: xor eax,eax */
+		0xc3,                         /* 1012: ret */
+		0xcc, 0xcc, 0xcc              /* 1013: int3(unreachable) */
+	};
+	nmd_x86_code_section section;
+	section.name = ".text";
+	section.name_length = 5;
+	section.code = code;
+	section.size = sizeof(code);
+	section.address = 0x1000;
+	section.mode = NMD_X86_MODE_64;
+
+	uint8_t code_map[sizeof(code)], fresh_map[sizeof(code)];
+	uint32_t queue[16];
+	nmd_x86_recursive_descent rd, fresh;
+	nmd_x86_recursive_descent_init(&rd, code, sizeof(code), NMD_X86_MODE_64, code_map, queue, 16);
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+	nmd_x86_recursive_descent_run(&rd);
+
+	nmd_x86_basic_block blocks[16], workspace[16], expected_blocks[16];
+	size_t num_blocks = nmd_x86_build_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, blocks, 16);
+	ASSERT_EQ(num_blocks, 3);
+
+	nmd_x86_xref by_source[16], by_target[16], xref_workspace[3 * 8], expected_by_source[16], expected_by_target[16], sort_workspace[16];
+	nmd_x86_xref_index index;
+	size_t num_xrefs = nmd_x86_xref_collect(&section, 0x1000, 0x1000, 0, 0, sizeof(code), by_source, 16);
+	ASSERT_EQ(num_xrefs, 3);
+	nmd_x86_xref_sort_by_target(by_source, num_xrefs, by_target, sort_workspace);
+	nmd_x86_xref_index_init(&index, 0x1000, by_source, by_target, num_xrefs);
+
+	struct patch { size_t offset; uint8_t bytes[5]; size_t size; size_t changed_begin, changed_end; size_t num_blocks, num_xrefs; };
+	const patch patches[] = {
+		{ 0x07, { 0x90 }, 1, 0x07, 0x0d, 4, 2 },                         /* nop; adc [rax],dl; add [rax],al: resynchronizes at 100ch */
+		{ 0x07, { 0xe8, 0x04, 0x00, 0x00, 0x00 }, 5, 0x07, 0x0d, 4, 3 }, /* call 1010h */
+		{ 0x0c, { 0xb8 }, 1, 0x0c, 0x15, 4, 3 },                         /* mov eax,31cccccch; rol bl,0cch; int3: overlaps the branch target 1010h */
+		{ 0x13, { 0x90 }, 1, 0x11, 0x15, 5, 3 },                         /* rol bl,90h: resynchronizes at the 'int3', which becomes a block */
+		{ 0x15, { 0x90 }, 1, 0, 0, 5, 3 }                                /* Unreachable code */
+	};
+
+	for (size_t p = 0; p < sizeof(patches) / sizeof(patches[0]); p++)
+	{
+		for (size_t i = 0; i < patches[p].size; i++)
+			code[patches[p].offset + i] = patches[p].bytes[i];
+
+		size_t changed_begin, changed_end;
+		const bool changed = nmd_x86_recursive_descent_patch(&rd, patches[p].offset, patches[p].offset + patches[p].size, &changed_begin, &changed_end);
+		EXPECT_EQ(changed, patches[p].changed_end != 0);
+		EXPECT_EQ(changed_begin, patches[p].changed_begin);
+		EXPECT_EQ(changed_end, patches[p].changed_end);
+
+		/* The instructions are the ones of a new analysis. Leaders may only be added where the straight line resynchronized. */
+		nmd_x86_recursive_descent_init(&fresh, code, sizeof(code), NMD_X86_MODE_64, fresh_map, queue, 16);
+		nmd_x86_recursive_descent_add_entry(&fresh, 0);
+		nmd_x86_recursive_descent_run(&fresh);
+		for (size_t i = 0; i < sizeof(code); i++)
+		{
+			EXPECT_EQ(code_map[i] & ~NMD_X86_CODE_MAP_LEADER, fresh_map[i] & ~NMD_X86_CODE_MAP_LEADER) << "patch " << p << " offset " << i;
+			if (fresh_map[i] & NMD_X86_CODE_MAP_LEADER)
+			{
+				EXPECT_TRUE(code_map[i] & NMD_X86_CODE_MAP_LEADER);
+			}
+		}
+
+		if (changed)
+		{
+			num_blocks = nmd_x86_update_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, changed_begin, changed_end, blocks, num_blocks, 16, workspace, 16);
+			ASSERT_TRUE(nmd_x86_xref_update(&index, &section, 0x1000, 0, changed_begin, changed_end, by_source, by_target, 16, xref_workspace, 8));
+		}
+
+		ASSERT_EQ(num_blocks, patches[p].num_blocks);
+		ASSERT_EQ(nmd_x86_build_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, expected_blocks, 16), num_blocks);
+		for (size_t i = 0; i < num_blocks; i++)
+		{
+			EXPECT_EQ(blocks[i].begin, expected_blocks[i].begin);
+			EXPECT_EQ(blocks[i].end, expected_blocks[i].end);
+			EXPECT_EQ(blocks[i].successors[0], expected_blocks[i].successors[0]);
+			EXPECT_EQ(blocks[i].successors[1], expected_blocks[i].successors[1]);
+			EXPECT_EQ(blocks[i].num_instructions, expected_blocks[i].num_instructions);
+			EXPECT_EQ(blocks[i].type, expected_blocks[i].type);
+		}
+
+		num_xrefs = nmd_x86_xref_collect(&section, 0x1000, 0x1000, 0, 0, sizeof(code), expected_by_source, 16);
+		ASSERT_EQ(index.num_xrefs, patches[p].num_xrefs);
+		ASSERT_EQ(index.num_xrefs, num_xrefs);
+		nmd_x86_xref_sort_by_target(expected_by_source, num_xrefs, expected_by_target, sort_workspace);
+		for (size_t i = 0; i < num_xrefs; i++)
+		{
+			EXPECT_EQ(by_source[i].source, expected_by_source[i].source);
+			EXPECT_EQ(by_source[i].target, expected_by_source[i].target);
+			EXPECT_EQ(by_source[i].type, expected_by_source[i].type);
+			EXPECT_EQ(by_target[i].source, expected_by_target[i].source);
+			EXPECT_EQ(by_target[i].target, expected_by_target[i].target);
+		}
+	}
+
+	/* The graph is rebuilt from the updated blocks. */
+	uint32_t memory[NMD_X86_CFG_MEMORY_SIZE(16)];
+	nmd_x86_cfg cfg;
+	nmd_x86_cfg_build(&cfg, blocks, num_blocks, memory);
+	EXPECT_EQ(cfg.num_blocks, num_blocks);
+
+	/* The blocks are not modified if they don't fit. */
+	code[0x07] = 0x90;
+	size_t changed_begin, changed_end;
+	ASSERT_TRUE(nmd_x86_recursive_descent_patch(&rd, 0x07, 0x08, &changed_begin, &changed_end));
+	EXPECT_EQ(nmd_x86_update_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, changed_begin, changed_end, blocks, num_blocks, 16, workspace, 0), 0);
+	EXPECT_EQ(nmd_x86_update_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, changed_begin, changed_end, blocks, num_blocks, num_blocks - 1, workspace, 16), 0);
+	EXPECT_EQ(blocks[1].begin, 0x07);
+
+	/* Random patches of random code, whose overlapping instructions give blocks with unsorted ends, match a full rebuild. */
+	uint32_t seed = 12345;
+	auto random = [&](uint32_t range) { seed = seed * 1103515245 + 12345; return (seed >> 16) % range; };
+	const uint8_t pieces[][5] = { { 0x90 }, { 0xeb }, { 0x74 }, { 0xb8 }, { 0xc3 }, { 0x48, 0x89, 0xc8 }, { 0xe8 }, { 0x0f, 0x84 } };
+	uint8_t random_code[256], random_map[sizeof(random_code)];
+	uint32_t random_queue[256];
+	nmd_x86_basic_block random_blocks[256], random_workspace[256], random_expected[256];
+	for (size_t round = 0; round < 20; round++)
+	{
+		for (size_t i = 0; i < sizeof(random_code); i++)
+			random_code[i] = (uint8_t)(random(4) ? pieces[random(8)][0] : random(256));
+		nmd_x86_recursive_descent_init(&rd, random_code, sizeof(random_code), NMD_X86_MODE_64, random_map, random_queue, 256);
+		for (size_t i = 0; i < 8; i++)
+			nmd_x86_recursive_descent_add_entry(&rd, random(sizeof(random_code)));
+		nmd_x86_recursive_descent_run(&rd);
+		num_blocks = nmd_x86_build_basic_blocks(random_code, sizeof(random_code), NMD_X86_MODE_64, random_map, random_blocks, 256);
+
+		for (size_t p = 0; p < 50; p++)
+		{
+			const size_t offset = random(sizeof(random_code) - 4), size = 1 + random(4);
+			for (size_t i = 0; i < size; i++)
+				random_code[offset + i] = (uint8_t)(random(2) ? pieces[random(8)][0] : random(256));
+
+			size_t changed_begin, changed_end;
+			if (!nmd_x86_recursive_descent_patch(&rd, offset, offset + size, &changed_begin, &changed_end))
+				continue;
+			num_blocks = nmd_x86_update_basic_blocks(random_code, sizeof(random_code), NMD_X86_MODE_64, random_map, changed_begin, changed_end, random_blocks, num_blocks, 256, random_workspace, 256);
+			ASSERT_EQ(nmd_x86_build_basic_blocks(random_code, sizeof(random_code), NMD_X86_MODE_64, random_map, random_expected, 256), num_blocks) << round << " " << p;
+			for (size_t i = 0; i < num_blocks; i++)
+			{
+				ASSERT_EQ(random_blocks[i].begin, random_expected[i].begin) << round << " " << p;
+				ASSERT_EQ(random_blocks[i].end, random_expected[i].end) << round << " " << p;
+				ASSERT_EQ(random_blocks[i].successors[0], random_expected[i].successors[0]) << round << " " << p;
+				ASSERT_EQ(random_blocks[i].successors[1], random_expected[i].successors[1]) << round << " " << p;
+				ASSERT_EQ(random_blocks[i].num_instructions, random_expected[i].num_instructions) << round << " " << p;
+				ASSERT_EQ(random_blocks[i].type, random_expected[i].type) << round << " " << p;
+			}
+		}
+	}
+}
+
+TEST(side_tests_suite, cache_tests)
+{
+	uint8_t code[] = {
+		0xe8, 0x0b, 0x00, 0x00, 0x00,       /* 1000: call 1010h */
+		0x74, 0x09,                         /* 1005: jz 1010h */
+		0x48, 0x8b, 0x05, 0x04, 0x00, 0x00, /* 1007: mov rax,[rip+4] */
+		0x00,
+		0xc3,                               /* 100e: ret */
+		0xcc,                               /* 100f: int3 */
+		0x31, 0xc0,                         /* 1010: xor eax,eax */
+		0xc3                                /* 1012: ret */
+	};
+	nmd_x86_code_section section;
+	section.name = ".text";
+	section.name_length = 5;
+	section.code = code;
+	section.size = sizeof(code);
+	section.address = 0x1000;
+	section.mode = NMD_X86_MODE_64;
+
+	uint8_t code_map[sizeof(code)];
+	uint32_t queue[16];
+	nmd_x86_recursive_descent rd;
+	nmd_x86_recursive_descent_init(&rd, code, sizeof(code), NMD_X86_MODE_64, code_map, queue, 16);
+	nmd_x86_recursive_descent_add_entry(&rd, 0);
+	nmd_x86_recursive_descent_run(&rd);
+
+	nmd_x86_cached_instruction instructions[16];
+	nmd_x86_basic_block blocks[16];
+	nmd_x86_xref by_source[16], by_target[16], sort_workspace[16];
+	nmd_x86_cache cache;
+	cache.address = 0x1000;
+	cache.source_size = sizeof(code);
+	cache.source_hash = nmd_x86_cache_hash(code, sizeof(code));
+	cache.mode = NMD_X86_MODE_64;
+	cache.instructions = instructions;
+	cache.num_instructions = nmd_x86_cache_collect_instructions(code, sizeof(code), NMD_X86_MODE_64, code_map, instructions, 16);
+	cache.blocks = blocks;
+	cache.num_blocks = nmd_x86_build_basic_blocks(code, sizeof(code), NMD_X86_MODE_64, code_map, blocks, 16);
+	cache.num_xrefs = nmd_x86_xref_collect(&section, 0x1000, 0x1000, 0, 0, sizeof(code), by_source, 16);
+	nmd_x86_xref_sort_by_target(by_source, cache.num_xrefs, by_target, sort_workspace);
+	cache.xrefs_by_source = by_source;
+	cache.xrefs_by_target = by_target;
+	ASSERT_EQ(cache.num_instructions, 6);
+	ASSERT_EQ(cache.num_blocks, 3);
+	ASSERT_EQ(cache.num_xrefs, 3);
+	EXPECT_EQ(nmd_x86_cache_collect_instructions(code, sizeof(code), NMD_X86_MODE_64, code_map, instructions, 2), 6);
+
+	/* mov rax,[rip+4]: a register and a memory operand */
+	EXPECT_EQ(instructions[2].offset, 7);
+	EXPECT_EQ(instructions[2].id, NMD_X86_INSTRUCTION_MOV);
+	EXPECT_EQ(instructions[2].length, 7);
+	EXPECT_EQ(instructions[2].num_operands, 2);
+	EXPECT_EQ(instructions[2].operand_types, NMD_X86_OPERAND_TYPE_REGISTER | (NMD_X86_OPERAND_TYPE_MEMORY << 2));
+	EXPECT_EQ(instructions[2].implicit_operands, 0);
+
+	/* The size is queried first. The file is padded to a multiple of 8 bytes between the tables. */
+	const size_t file_size = nmd_x86_cache_save(&cache, 0, 0);
+	EXPECT_EQ(file_size, 64 + 72 + 60 + 4 + 2 * 3 * 16);
+	uint64_t file[64] = { 0 };
+	ASSERT_LE(file_size, sizeof(file));
+	EXPECT_EQ(nmd_x86_cache_save(&cache, file, file_size), file_size);
+	const uint8_t* const bytes = (const uint8_t*)file;
+	EXPECT_EQ(memcmp(bytes, "NMDC", 4), 0);
+	EXPECT_EQ(bytes[4], NMD_X86_CACHE_VERSION);
+	EXPECT_EQ(bytes[64], 0x00); /* The offset of the first instruction, little-endian */
+	EXPECT_EQ(bytes[64 + 12], 0x05);
+
+	nmd_x86_cache loaded;
+	ASSERT_EQ(nmd_x86_cache_load(file, file_size, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_OK);
+	EXPECT_EQ(loaded.address, 0x1000);
+	EXPECT_EQ(loaded.source_size, sizeof(code));
+	EXPECT_EQ(loaded.mode, NMD_X86_MODE_64);
+	ASSERT_EQ(loaded.num_instructions, cache.num_instructions);
+	ASSERT_EQ(loaded.num_blocks, cache.num_blocks);
+	ASSERT_EQ(loaded.num_xrefs, cache.num_xrefs);
+	EXPECT_EQ((const void*)loaded.instructions, (const void*)(bytes + 64)); /* In place */
+	EXPECT_EQ(memcmp(loaded.instructions, instructions, sizeof(nmd_x86_cached_instruction) * loaded.num_instructions), 0);
+	for (size_t i = 0; i < loaded.num_blocks; i++)
+	{
+		EXPECT_EQ(loaded.blocks[i].begin, blocks[i].begin);
+		EXPECT_EQ(loaded.blocks[i].end, blocks[i].end);
+		EXPECT_EQ(loaded.blocks[i].successors[0], blocks[i].successors[0]);
+		EXPECT_EQ(loaded.blocks[i].successors[1], blocks[i].successors[1]);
+		EXPECT_EQ(loaded.blocks[i].num_instructions, blocks[i].num_instructions);
+		EXPECT_EQ(loaded.blocks[i].type, blocks[i].type);
+	}
+	for (size_t i = 0; i < loaded.num_xrefs; i++)
+	{
+		EXPECT_EQ(loaded.xrefs_by_source[i].source, by_source[i].source);
+		EXPECT_EQ(loaded.xrefs_by_source[i].target, by_source[i].target);
+		EXPECT_EQ(loaded.xrefs_by_target[i].source, by_target[i].source);
+		EXPECT_EQ(loaded.xrefs_by_target[i].target, by_target[i].target);
+		EXPECT_EQ(loaded.xrefs_by_target[i].type, by_target[i].type);
+	}
+
+	/* Queries on the loaded file */
+	const nmd_x86_cached_instruction* instruction = nmd_x86_cache_find_instruction(&loaded, 0x1010);
+	ASSERT_TRUE(instruction);
+	EXPECT_EQ(instruction->id, NMD_X86_INSTRUCTION_XOR);
+	EXPECT_FALSE(nmd_x86_cache_find_instruction(&loaded, 0x1011));
+	EXPECT_FALSE(nmd_x86_cache_find_instruction(&loaded, 0x100f)); /* Not explored */
+	EXPECT_FALSE(nmd_x86_cache_find_instruction(&loaded, 0xfff));
+	EXPECT_FALSE(nmd_x86_cache_find_instruction(&loaded, 0x1013));
+
+	nmd_x86_xref_index index;
+	const nmd_x86_xref* xrefs;
+	nmd_x86_xref_index_init(&index, 0x1000, loaded.xrefs_by_source, loaded.xrefs_by_target, loaded.num_xrefs);
+	EXPECT_EQ(nmd_x86_xref_find_to(&index, 0x1010, &xrefs), 2);
+
+	/* The buffer was patched */
+	code[0x10] = 0x90;
+	EXPECT_EQ(nmd_x86_cache_load(file, file_size, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_STALE);
+	EXPECT_EQ(nmd_x86_cache_load(file, file_size, code, sizeof(code) - 1, &loaded), NMD_X86_CACHE_STATUS_STALE);
+	EXPECT_EQ(nmd_x86_cache_load(file, file_size, 0, 0, &loaded), NMD_X86_CACHE_STATUS_OK);
+	code[0x10] = 0x31;
+
+	/* Truncated, corrupted, other version and misaligned */
+	EXPECT_EQ(nmd_x86_cache_load(file, file_size - 1, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_INVALID);
+	EXPECT_EQ(nmd_x86_cache_load(file, 63, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_INVALID);
+	uint8_t* const mutable_bytes = (uint8_t*)file;
+	mutable_bytes[40]++;
+	EXPECT_EQ(nmd_x86_cache_load(file, file_size, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_INVALID);
+	mutable_bytes[40]--;
+	mutable_bytes[4]++;
+	EXPECT_EQ(nmd_x86_cache_load(file, file_size, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_VERSION);
+	mutable_bytes[4]--;
+	uint64_t misaligned[65];
+	memcpy((uint8_t*)misaligned + 1, file, file_size);
+	EXPECT_EQ(nmd_x86_cache_load((uint8_t*)misaligned + 1, file_size, code, sizeof(code), &loaded), NMD_X86_CACHE_STATUS_UNSUPPORTED);
+
+	/* Saving is deterministic */
+	uint64_t again[64];
+	memset(again, 0xff, sizeof(again));
+	nmd_x86_cache_save(&cache, again, sizeof(again));
+	EXPECT_EQ(memcmp(again, file, file_size), 0);
+
+	EXPECT_NE(nmd_x86_cache_hash(code, 3), nmd_x86_cache_hash(code, 2));
+	EXPECT_NE(nmd_x86_cache_hash(code, 9), nmd_x86_cache_hash(code + 1, 9));
+}
+
+TEST(side_tests_suite, interpreter_tests)
+{
+	static uint8_t code_page[4096], data_page[4096];
+	nmd_x86_page pages[2];
+	pages[0].address = 0x1000;
+	pages[0].data = code_page;
+	pages[0].writable = true;
+	pages[1].address = 0x2000;
+	pages[1].data = data_page;
+	pages[1].writable = true;
+	nmd_x86_page_table page_table;
+	page_table.pages = pages;
+	page_table.num_pages = 2;
+
+	static nmd_x86_interpreter_block blocks[64];
+	static nmd_x86_micro_op uops[1024];
+	static uint32_t block_map[128];
+	nmd_x86_interpreter it;
+
+	/* Copies 'code' to 1000h and resets the interpreter with 'rsp' at 3000h. */
+	auto load = [&](const char* code, size_t size) {
+		memset(code_page, 0xcc, sizeof(code_page));
+		memcpy(code_page, code, size);
+		nmd_x86_interpreter_init(&it, nmd_x86_page_table_translate, &page_table, blocks, 64, uops, 1024, block_map, 128);
+		it.rip = 0x1000;
+		it.regs[NMD_X86_GPR_RSP] = 0x3000;
+	};
+
+	/* xor eax,eax; mov ecx,10; add eax,ecx; dec ecx; jnz -6; hlt */
+	const char loop[] = "\x31\xc0\xb9\x0a\x00\x00\x00\x01\xc8\xff\xc9\x75\xfa\xf4";
+	load(loop, sizeof(loop) - 1);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_UNSUPPORTED);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RAX], 55);
+	EXPECT_EQ(it.rip, 0x100d);
+	EXPECT_EQ(it.num_instructions, 32);
+
+	/* The limit is checked when a block is left, execution continues where it stopped */
+	load(loop, sizeof(loop) - 1);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 10), NMD_X86_INTERPRETER_EXIT_LIMIT);
+	EXPECT_EQ(it.num_instructions, 11);
+	EXPECT_EQ(it.rip, 0x1007);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_UNSUPPORTED);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RAX], 55);
+
+	/* mov rdi,2000h; call f; mov rbx,[rdi]; hlt; f: mov qword [rdi],42; add qword [rdi],1; ret */
+	const char call[] = "\x48\xc7\xc7\x00\x20\x00\x00\xe8\x04\x00\x00\x00\x48\x8b\x1f\xf4\x48\xc7\x07\x2a\x00\x00\x00\x48\x83\x07\x01\xc3";
+	load(call, sizeof(call) - 1);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_UNSUPPORTED);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RBX], 43);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RSP], 0x3000);
+	EXPECT_EQ(it.rip, 0x100f);
+	EXPECT_EQ(data_page[0xff8], 0x0c);
+
+	/* mov eax,-1; add eax,1; mov edx,0; adc edx,0; setb bl; sete cl; mov rsi,5; cmp rsi,7; cmovl eax,esi; hlt */
+	const char flags[] = "\xb8\xff\xff\xff\xff\x83\xc0\x01\xba\x00\x00\x00\x00\x83\xd2\x00\x0f\x92\xc3\x0f\x94\xc1\x48\xc7\xc6\x05\x00\x00\x00\x48\x83\xfe\x07\x0f\x4c\xc6\xf4";
+	load(flags, sizeof(flags) - 1);
+	it.regs[NMD_X86_GPR_RBX] = it.regs[NMD_X86_GPR_RCX] = 0xffff;
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_UNSUPPORTED);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RDX], 1);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RBX], 0xff00);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RCX], 0xff00);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RAX], 5);
+	EXPECT_EQ(nmd_x86_interpreter_get_flags(&it) & (CF | ZF | SF | OF), CF | SF);
+
+	/* mov eax,100; xor edx,edx; mov ecx,7; div ecx; xor ecx,ecx; div ecx */
+	const char divide[] = "\xb8\x64\x00\x00\x00\x31\xd2\xb9\x07\x00\x00\x00\xf7\xf1\x31\xc9\xf7\xf1";
+	load(divide, sizeof(divide) - 1);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_DIVIDE_ERROR);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RAX], 14);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RDX], 2);
+	EXPECT_EQ(it.rip, 0x1010);
+	EXPECT_EQ(it.num_instructions, 5);
+
+	/* mov ebx,1; mov rax,[5000h] */
+	load("\xbb\x01\x00\x00\x00\x48\x8b\x04\x25\x00\x50\x00\x00", 13);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_PAGE_FAULT);
+	EXPECT_EQ(it.fault_address, 0x5000);
+	EXPECT_EQ(it.rip, 0x1005);
+	EXPECT_EQ(it.num_instructions, 1);
+
+	/* Self-modifying code: mov byte [rip+1],2 patches the immediate of the next instruction, mov eax,1; hlt */
+	load("\xc6\x05\x01\x00\x00\x00\x02\xb8\x01\x00\x00\x00\xf4", 13);
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_UNSUPPORTED);
+	EXPECT_EQ(it.regs[NMD_X86_GPR_RAX], 2);
+	EXPECT_EQ(it.num_flushes, 1);
+	EXPECT_EQ(it.num_instructions, 2);
+
+	/* Code that runs into an unmapped page */
+	load("\x90", 1);
+	it.rip = 0x2ffe;
+	data_page[0xffe] = 0x90;
+	data_page[0xfff] = 0x48;
+	EXPECT_EQ(nmd_x86_interpreter_run(&it, 1000), NMD_X86_INTERPRETER_EXIT_PAGE_FAULT);
+	EXPECT_EQ(it.rip, 0x2fff);
+	EXPECT_EQ(it.fault_address, 0x3000);
+}
+
+TEST(side_tests_suite, liveness_tests)
+{
+	const uint64_t RAX = NMD_X86_REG_MASK_RAX, RCX = NMD_X86_REG_MASK_RCX, RDX = NMD_X86_REG_MASK_RDX, RSP = NMD_X86_REG_MASK_RSP, RSI = NMD_X86_REG_MASK_RSI, RDI = NMD_X86_REG_MASK_RDI;
+	uint8_t code_map[32];
+	uint32_t queue[16], cfg_memory[NMD_X86_CFG_MEMORY_SIZE(8)], workspace[NMD_X86_LIVENESS_WORKSPACE_SIZE(8)], instruction_map[32];
+	nmd_x86_basic_block blocks[8];
+	nmd_x86_block_liveness block_liveness[8];
+	nmd_x86_instruction_liveness instructions[32];
+	nmd_x86_recursive_descent rd;
+	nmd_x86_cfg cfg;
+
+	/* Analyzes the code reachable from offset zero with rax and rsp live at the exits(the return value and the stack) and no flag. */
+	auto analyze = [&](const char* code, size_t size) {
+		nmd_x86_recursive_descent_init(&rd, code, size, NMD_X86_MODE_64, code_map, queue, 16);
+		nmd_x86_recursive_descent_add_entry(&rd, 0);
+		nmd_x86_recursive_descent_run(&rd);
+		const size_t num_blocks = nmd_x86_build_basic_blocks(code, size, NMD_X86_MODE_64, code_map, blocks, 8);
+		nmd_x86_cfg_build(&cfg, blocks, num_blocks, cfg_memory);
+		return nmd_x86_liveness_analyze(code, size, NMD_X86_MODE_64, blocks, &cfg, RAX | RSP, 0, block_liveness, instructions, instruction_map, workspace);
+	};
+	auto live = [&](size_t offset) { return ~nmd_x86_liveness_dead_registers(instructions, instruction_map, offset) & NMD_X86_REG_MASK_GPRS; };
+	auto flags = [&](size_t offset) { return nmd_x86_liveness_live_flags(instructions, instruction_map, offset); };
+
+	/* 0: mov rax,rdi; 3: test rax,rax; 6: jz 10h; 8: mov rcx,[rsi]; b: add rax,rcx; e: jmp 13h; 10: xor eax,eax; 12: nop; 13: ret */
+	const char branch[] = "\x48\x89\xf8\x48\x85\xc0\x74\x08\x48\x8b\x0e\x48\x01\xc8\xeb\x03\x31\xc0\x90\xc3";
+	EXPECT_EQ(analyze(branch, sizeof(branch) - 1), 9);
+	EXPECT_EQ(live(0x00), RDI | RSI | RSP);
+	EXPECT_EQ(live(0x03), RAX | RSI | RSP);
+	EXPECT_EQ(live(0x06), RAX | RSI | RSP);
+	EXPECT_EQ(live(0x08), RAX | RSI | RSP);
+	EXPECT_EQ(live(0x0b), RAX | RCX | RSP);
+	EXPECT_EQ(live(0x10), RSP); /* The zero idiom doesn't read rax */
+	EXPECT_EQ(live(0x13), RAX | RSP);
+	EXPECT_EQ(flags(0x06), NMD_X86_EFLAGS_ZF);
+	EXPECT_EQ(flags(0x03), 0);
+	EXPECT_EQ(flags(0x0b), 0);
+	EXPECT_EQ(instructions[instruction_map[0x06]].regs_out & NMD_X86_REG_MASK_GPRS, RAX | RSI | RSP);
+	EXPECT_EQ(live(0x01), NMD_X86_REG_MASK_GPRS); /* Not an instruction: nothing is known to be dead */
+	EXPECT_EQ(flags(0x01), NMD_X86_LIVENESS_FLAGS);
+	EXPECT_EQ(block_liveness[0].regs_in & NMD_X86_REG_MASK_GPRS, RDI | RSI | RSP);
+	EXPECT_EQ(block_liveness[0].num_instructions, 3);
+
+	/* 0: xor eax,eax; 2: add eax,ecx; 4: dec ecx; 6: jnz 2; 8: ret. The loop keeps rcx live. */
+	const char loop[] = "\x31\xc0\x01\xc8\xff\xc9\x75\xfa\xc3";
+	EXPECT_EQ(analyze(loop, sizeof(loop) - 1), 5);
+	EXPECT_EQ(live(0x00), RCX | RSP);
+	EXPECT_EQ(live(0x02), RAX | RCX | RSP);
+	EXPECT_EQ(live(0x06), RAX | RCX | RSP);
+	EXPECT_EQ(live(0x08), RAX | RSP);
+	EXPECT_EQ(flags(0x06), NMD_X86_EFLAGS_ZF);
+	EXPECT_EQ(flags(0x04), 0); /* dec preserves the carry, but nothing reads it */
+
+	/* 0: add rax,1; 4: adc rdx,0; 8: cld; 9: movsb; a: mov al,1; c: ret */
+	const char implicit[] = "\x48\x83\xc0\x01\x48\x83\xd2\x00\xfc\xa4\xb0\x01\xc3";
+	EXPECT_EQ(analyze(implicit, sizeof(implicit) - 1), 6);
+	EXPECT_EQ(flags(0x04), NMD_X86_EFLAGS_CF);
+	EXPECT_EQ(flags(0x00), 0);
+	EXPECT_EQ(flags(0x09), NMD_X86_EFLAGS_DF);
+	EXPECT_EQ(flags(0x08), 0);
+	EXPECT_EQ(live(0x0a), RAX | RSP); /* Writing al keeps the rest of rax */
+	EXPECT_EQ(live(0x09), RAX | RSI | RDI | RSP);
+	EXPECT_EQ(live(0x00), RAX | RDX | RSI | RDI | RSP);
+
+	/* 0: cmp rcx,rdx; 3: jz 0eh; 5: sub rsi,[rdi]; 8: or rax,rsi; b: sbb rax,rcx; e: ret */
+	const char alu[] = "\x48\x39\xd1\x74\x09\x48\x2b\x37\x48\x09\xf0\x48\x19\xc8\xc3";
+	EXPECT_EQ(analyze(alu, sizeof(alu) - 1), 6);
+	EXPECT_EQ(live(0x00), RAX | RCX | RDX | RSI | RDI | RSP); /* cmp reads both operands */
+	EXPECT_EQ(live(0x03), RAX | RCX | RSI | RDI | RSP);
+	EXPECT_EQ(live(0x05), RAX | RCX | RSI | RDI | RSP); /* The address register of the source is live */
+	EXPECT_EQ(live(0x08), RAX | RCX | RSI | RSP);
+	EXPECT_EQ(live(0x0b), RAX | RCX | RSP);
+	EXPECT_EQ(live(0x0e), RAX | RSP);
+	EXPECT_EQ(flags(0x03), NMD_X86_EFLAGS_ZF);
+	EXPECT_EQ(flags(0x0b), NMD_X86_EFLAGS_CF);
+	EXPECT_EQ(flags(0x08), 0); /* or clears the carry read by sbb */
+	EXPECT_EQ(flags(0x00), 0);
+
+	/* 0: vmovd xmm0,[rdi]; 4: shlx rax,rdx,rcx; 9: mulx rcx,rsi,rax; e: ret. The VEX operands and the implicit rdx of mulx are read. */
+	const char vex[] = "\xc5\xf9\x6e\x07\xc4\xe2\xf1\xf7\xc2\xc4\xe2\xcb\xf6\xc8\xc3";
+	EXPECT_EQ(analyze(vex, sizeof(vex) - 1), 4);
+	EXPECT_EQ(live(0x0e), RAX | RSP);
+	EXPECT_EQ(live(0x09), RAX | RDX | RSP);
+	EXPECT_EQ(live(0x04), RCX | RDX | RSP);
+	EXPECT_EQ(live(0x00), RCX | RDX | RDI | RSP);
+
+	/* 0: mov eax,1; 5: vpslldq xmm1,xmm0,1; a: ret. The registers of 'vpslldq' are unknown, so none is dead before it. */
+	const char unknown[] = "\xb8\x01\x00\x00\x00\xc5\xf1\x73\xf8\x01\xc3";
+	EXPECT_EQ(analyze(unknown, sizeof(unknown) - 1), 3);
+	EXPECT_EQ(live(0x05), NMD_X86_REG_MASK_GPRS);
+	EXPECT_EQ(live(0x00), NMD_X86_REG_MASK_GPRS & ~RAX);
+}
+
 TEST(side_tests_suite, generic_tests)
 {
 	int64_t num;